@@ -0,0 +1,136 @@
+/*
+ *	Asset pack header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the asset pack, a single file archive of the asset tree.
+ *	A pack is memory mapped whole when opened, and entries are handed out as
+ *	pointers into the mapping (for SFML's loadFromMemory()/openFromMemory()),
+ *	so loading an asset from a pack costs no open(), seek(), or copy; only
+ *	the pages actually read are faulted in. Since a pack is one file, it is
+ *	also installed (or replaced) in one rename.
+ *
+ *	File format (little endian):
+ *
+ *		"MMPK", version (1 byte), 3 bytes reserved, n_entries (4 bytes), then
+ *		the table of contents, per entry: offset (8 bytes), size (8 bytes),
+ *		path length (2 bytes), path (as loaded, e.g. "assets/font/x.ttf"),
+ *		then the entry data, each entry starting on an ASSET_PACK_ALIGNMENT
+ *		byte boundary (offsets are from the start of the file)
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- MappedFile ---- //
+
+class MappedFile {
+	/*
+	 *	Class to map a whole file, read only (mmap, or MapViewOfFile on
+	 *	Windows); pages are faulted in as they are read
+	 */
+
+	private:
+		const char* data_ptr;	// (start of mapping, NULL if not open)
+		unsigned long long data_size;
+
+#ifdef _WIN32
+		void* file_handle;
+		void* mapping_handle;
+#endif
+
+	protected:
+		//
+
+	public:
+		MappedFile(void);
+
+		void open(std::string);
+		void close(void);
+		bool isOpen(void);
+
+		const char* getData(void);
+		unsigned long long getSize(void);
+
+		~MappedFile(void);
+
+};	// end MappedFile
+
+
+// ---- AssetPackEntry ---- //
+
+struct AssetPackEntry {
+	/*
+	 *	One packed file
+	 */
+
+	std::string path;
+	unsigned long long offset;	// [bytes] from start of pack
+	unsigned long long size;	// [bytes]
+
+};	// end AssetPackEntry
+
+
+// ---- AssetPack ---- //
+
+class AssetPack {
+	/*
+	 *	Class to build asset packs, and to map one and look up its entries
+	 */
+
+	private:
+		std::string pack_path;
+		MappedFile mapped_file;
+
+		std::vector<AssetPackEntry> entry_vec;
+		std::unordered_map<std::string, int> entry_map;	// path to entry_vec index
+
+	protected:
+		//
+
+	public:
+		AssetPack(void);
+
+		static int build(std::string, std::string);
+
+		void open(std::string);
+		void close(void);
+		bool isOpen(void);
+		const char* find(const std::string&, size_t*);
+
+		int getNumEntries(void);
+		unsigned long long getSize(void);
+		std::string getPath(void);
+
+		~AssetPack(void);
+
+};	// end AssetPack
+
+
+// -------- function prototypes (process-wide pack) -------- //
+AssetPack& assetPack(void);
+
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ *	Atlas packer header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines a rectangle packer for building texture atlases. Rects are
+ *	placed tallest first, by the skyline bottom-left rule: each page keeps
+ *	its skyline (the top edge of everything placed so far, as a list of
+ *	horizontal segments), and each rect goes where its top edge would be
+ *	lowest, then leftmost, on the first page it fits. A new page is opened
+ *	when it fits nowhere. Rects larger than a page are left unpacked.
+ *
+ *	Every rect is padded (right and bottom) so that neighbouring sprites
+ *	never bleed into each other when sampled.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef ATLASPACKER_H
+#define ATLASPACKER_H
+
+
+// -------- includes -------- //
+#include <string>
+#include <vector>
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- AtlasRect ---- //
+
+struct AtlasRect {
+	/*
+	 *	A rect to pack, and where it was packed
+	 */
+
+	std::string key;
+	int width;
+	int height;
+
+	int page;		// -1 if unpacked (larger than a page)
+	int x;
+	int y;
+
+};	// end AtlasRect
+
+
+// ---- SkylineSegment ---- //
+
+struct SkylineSegment {
+	/*
+	 *	Horizontal segment of a page's skyline
+	 */
+
+	int x;
+	int y;
+	int width;
+
+};	// end SkylineSegment
+
+
+// ---- AtlasPacker ---- //
+
+class AtlasPacker {
+	/*
+	 *	Class to pack rects into pages of a texture atlas
+	 */
+
+	private:
+		int page_size;
+		int padding;
+
+		std::vector<AtlasRect> rect_vec;
+		std::vector<std::vector<SkylineSegment>> skyline_vec;	// per page
+		std::vector<int> page_height_vec;
+
+		int fitSkyline(int, int, int, int*);
+		void placeSkyline(int, int, int, int, int);
+
+	protected:
+		//
+
+	public:
+		AtlasPacker(int, int);
+
+		void clear(void);
+		void pushRect(std::string, int, int);
+		int pack(void);
+
+		int getPageSize(void);
+		int getNumPages(void);
+		int getPageHeight(int);
+		int getNumRects(void);
+		AtlasRect getRect(int);
+		double getOccupancy(void);
+
+		~AtlasPacker(void);
+
+};	// end AtlasPacker
+
+
+#endif
@@ -0,0 +1,256 @@
+/*
+ *	Batch runner header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the multi-core batch scenario runner (--batch mode). Complete
+ *	games are run headless on GridSimulator across all cores, using a work
+ *	stealing thread pool, and per-game results are streamed to a CSV or binary
+ *	sink as they complete.
+ *
+ *	Scenario file format (one directive per line, # starts a comment):
+ *
+ *		games <n>						games per (portfolio, policy) pair
+ *		seed <n>						base seed
+ *		threads <n>						worker threads (0 = all cores)
+ *		chunk <n>						games per task
+ *		output <path>					.csv for CSV, anything else is binary
+ *		policy <name> <type> ...		merit order of plant types
+ *		portfolio <name> <type>:<tokens> ...
+ *
+ *	Plant types are named as their texture keys (coal, combined, fission,
+ *	geothermal, hydro, peaker, solar, storage, tidal, wave, wind).
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "GridSimulator.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+// -------- function prototypes -------- //
+int plantTypeFromString(std::string);
+std::string plantTypeToString(int);
+void runBatch(std::string);
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- Batch data ---- //
+
+struct BatchPortfolio {
+	/*
+	 *	Named portfolio of (plant type, tokens) slots
+	 */
+
+	std::string name;
+	std::vector<std::pair<int, int>> slot_vec;
+
+};	// end BatchPortfolio
+
+
+struct BatchPolicy {
+	/*
+	 *	Named merit order dispatch policy
+	 */
+
+	std::string name;
+	std::vector<int> merit_order;
+
+};	// end BatchPolicy
+
+
+struct BatchResult {
+	/*
+	 *	Result of a single game
+	 */
+
+	int portfolio;
+	int policy;
+	int game;
+	unsigned long long seed;
+	double score;
+	int unmet_demand_GWh;
+	int excess_dispatch_GWh;
+	int coal_marbles;
+	int combined_marbles;
+	int peaker_marbles;
+
+};	// end BatchResult
+
+
+// ---- WorkStealingPool ---- //
+
+class WorkStealingPool {
+	/*
+	 *	Class for a work stealing thread pool (each worker pops from the back
+	 *	of its own queue, and steals from the front of the others when idle)
+	 */
+
+	private:
+		std::atomic<int> n_pending;		// pushed, not yet finished
+		std::atomic<int> n_queued;		// pushed, not yet popped
+		std::vector<std::thread> thread_vec;
+		std::vector<std::deque<std::function<void(void)>>> queue_vec;
+		std::vector<std::mutex> mutex_vec;
+
+		std::mutex idle_mutex;
+		std::condition_variable idle_cv;	// signalled on push, and when n_pending reaches 0
+
+		bool popTask(int, std::function<void(void)>*);
+		void work(int);
+
+	protected:
+		//
+
+	public:
+		WorkStealingPool(int);
+
+		int getNumWorkers(void);
+
+		void push(int, std::function<void(void)>);
+		void run(void);
+
+		~WorkStealingPool(void);
+
+};	// end WorkStealingPool
+
+
+// ---- BatchSink ---- //
+
+class BatchSink {
+	/*
+	 *	Base class for streaming sinks of batch results
+	 */
+
+	private:
+		//
+
+	protected:
+		std::mutex mutex;
+		std::ofstream out_stream;
+
+	public:
+		BatchSink(std::string, bool);
+
+		virtual void writeHeader(
+			const std::vector<BatchPortfolio>&,
+			const std::vector<BatchPolicy>&
+		) {return;}
+		virtual void write(const std::vector<BatchResult>&) {return;}
+
+		virtual ~BatchSink(void);
+
+};	// end BatchSink
+
+
+class CSVBatchSink : public BatchSink {
+	/*
+	 *	Class for a CSV sink (one row per game)
+	 */
+
+	private:
+		std::vector<std::string> portfolio_name_vec;
+		std::vector<std::string> policy_name_vec;
+
+	protected:
+		//
+
+	public:
+		CSVBatchSink(std::string);
+
+		void writeHeader(
+			const std::vector<BatchPortfolio>&,
+			const std::vector<BatchPolicy>&
+		);
+		void write(const std::vector<BatchResult>&);
+
+		~CSVBatchSink(void);
+
+};	// end CSVBatchSink
+
+
+class BinaryBatchSink : public BatchSink {
+	/*
+	 *	Class for a binary sink (name tables, then one fixed size record per
+	 *	game, little endian, see BinaryBatchSink::writeHeader())
+	 */
+
+	private:
+		//
+
+	protected:
+		//
+
+	public:
+		BinaryBatchSink(std::string);
+
+		void writeHeader(
+			const std::vector<BatchPortfolio>&,
+			const std::vector<BatchPolicy>&
+		);
+		void write(const std::vector<BatchResult>&);
+
+		~BinaryBatchSink(void);
+
+};	// end BinaryBatchSink
+
+
+// ---- BatchRunner ---- //
+
+class BatchRunner {
+	/*
+	 *	Class to load a scenario file and run it
+	 */
+
+	private:
+		int games_per_scenario;
+		int games_per_task;
+		int n_threads;
+		unsigned long long seed;
+		std::string output_path;
+		std::vector<BatchPortfolio> portfolio_vec;
+		std::vector<BatchPolicy> policy_vec;
+
+		void runTask(int, int, int, int, BatchSink*);
+
+	protected:
+		//
+
+	public:
+		BatchRunner(void);
+
+		void loadScenario(std::string);
+		void run(void);
+
+		~BatchRunner(void);
+
+};	// end BatchRunner
+
+
+#endif
@@ -0,0 +1,42 @@
+/*
+ *	Benchmarks header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the headless benchmark suite (--benchmark mode). Each
+ *	benchmark times an optimized path against the path it replaced, on the
+ *	same inputs, and prints both with the speedup.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "GridSimulator.h"
+#include "PerformanceCurve.h"
+#include "Random.h"
+
+#include <string>
+#include <vector>
+
+
+// -------- function prototypes -------- //
+void printBenchmark(std::string, std::string, double, std::string, double);
+void printBenchmark(std::string, std::string, std::vector<double>, std::string, std::vector<double>);
+void benchmarkPerformanceCurves(void);
+void runBenchmarks(void);
+
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ *	Byte order helpers header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the fixed width little endian read/write and alignment
+ *	helpers shared by the binary file formats (AssetPack, PixelCache, and
+ *	BinaryBatchSink), so that their files do not depend on the host byte
+ *	order or struct layout.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef BYTEORDER_H
+#define BYTEORDER_H
+
+
+// -------- includes -------- //
+#include <cstring>
+#include <string>
+
+
+// -------- function implementations (inline) -------- //
+
+inline void writeLE(std::string* bytes_ptr, unsigned long long value, int n_bytes) {
+	/*
+	 *	Helper function to append an unsigned little endian value
+	 */
+
+	for (int i = 0; i < n_bytes; i++) {
+		bytes_ptr->push_back(char((value >> (8 * i)) & 0xFF));
+	}
+
+	return;
+}	// end writeLE()
+
+
+inline unsigned long long readLE(const char* bytes_ptr, int n_bytes) {
+	/*
+	 *	Helper function to read an unsigned little endian value
+	 */
+
+	unsigned long long value = 0;
+	for (int i = 0; i < n_bytes; i++) {
+		value |= (unsigned long long)(unsigned char)bytes_ptr[i] << (8 * i);
+	}
+
+	return value;
+}	// end readLE()
+
+
+inline void writeDoubleLE(std::string* bytes_ptr, double value) {
+	/*
+	 *	Helper function to append a double (IEEE 754 bits, little endian)
+	 */
+
+	unsigned long long bits = 0;
+	memcpy(&bits, &value, sizeof(double));
+	writeLE(bytes_ptr, bits, 8);
+
+	return;
+}	// end writeDoubleLE()
+
+
+inline double readDoubleLE(const char* bytes_ptr) {
+	/*
+	 *	Helper function to read a double (IEEE 754 bits, little endian)
+	 */
+
+	unsigned long long bits = readLE(bytes_ptr, 8);
+	double value = 0;
+	memcpy(&value, &bits, sizeof(double));
+
+	return value;
+}	// end readDoubleLE()
+
+
+inline unsigned long long alignUp(unsigned long long offset, unsigned long long alignment) {
+	/*
+	 *	Helper function to round an offset up to the given alignment
+	 */
+
+	return (offset + alignment - 1) / alignment * alignment;
+}	// end alignUp()
+
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ *	Dispatch solver header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines an optimal dispatch solver for a built portfolio over one
+ *	24 hour day, by dynamic programming (backward induction) over
+ *
+ *		(hour, hydro reservoir, storage charge, last coal, combined,
+ *		 geothermal, and fission production)
+ *
+ *	which is everything the play phase carries from hour to hour (ramp
+ *	limits, fixed fission output, reservoir drawdown, storage state of
+ *	charge). States are packed into a single mixed radix index, and each
+ *	hour's states are swept in parallel.
+ *
+ *	Demand and renewable production are taken as given for the day (i.e.
+ *	in hindsight, once the day is known), so the solver answers "what was
+ *	the best score possible today, with this portfolio". Smog only moves
+ *	solar, which is then taken as it actually was. The expected optimal
+ *	score of a portfolio is the mean of that over sampled days (an upper
+ *	bound on any non-clairvoyant policy).
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef DISPATCHSOLVER_H
+#define DISPATCHSOLVER_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "GridSimulator.h"
+#include "Random.h"
+
+#include <array>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- DispatchState ---- //
+
+struct DispatchState {
+	/*
+	 *	Inter-temporal state at the start of an hour
+	 */
+
+	int hydro_GWh;			// reservoir charge
+	int storage_GWh;		// storage charge
+	int coal_GWh;			// last production (ramp limited) ...
+	int combined_GWh;
+	int geothermal_GWh;
+	int fission_GWh;		// ... (fixed after the first hour)
+
+};	// end DispatchState
+
+
+// ---- DispatchAction ---- //
+
+struct DispatchAction {
+	/*
+	 *	Dispatch [GWh] of every dispatchable plant for one hour
+	 */
+
+	int coal_GWh;
+	int combined_GWh;
+	int fission_GWh;
+	int geothermal_GWh;
+	int hydro_GWh;
+	int peaker_GWh;
+	int storage_GWh;
+
+};	// end DispatchAction
+
+
+// ---- DispatchSolver ---- //
+
+class DispatchSolver {
+	/*
+	 *	Class to solve for the optimal dispatch of a portfolio over one day
+	 */
+
+	private:
+		int n_threads;
+
+		int coal_GW;
+		int combined_GW;
+		int fission_GW;
+		int geothermal_GW;
+		int hydro_GW;
+		int hydro_capacity_GWh;
+		int peaker_GW;
+		int storage_GW;
+
+		std::vector<int> demand_GWh_vec;
+		std::vector<int> renewable_GWh_vec;
+
+		int n_states;
+		std::array<int, 6> radix_array;		// hydro, storage, coal, combined, geothermal, fission
+		std::array<int, 6> stride_array;
+		std::vector<float> value_vec;		// (hour, state), best score from hour on
+		std::vector<float> scratch_vec;
+
+		bool solved;
+		double optimal_score;
+
+		int encode(const DispatchState&);
+		void decode(int, DispatchState*);
+		DispatchState getInitialState(void);
+
+		void parallelFor(int, const std::function<void(int, int)>&);
+
+		double maximize(int, const DispatchState&, DispatchAction*);
+		double maximizeUnramped(int, const DispatchState&);
+		void runningMax(const float*, float*, int, int);
+		void sweepHour(int);
+
+	protected:
+		//
+
+	public:
+		DispatchSolver(int);
+
+		void clearPortfolio(void);
+		void pushPlant(int, double);
+		void setDay(const std::vector<int>&, const std::vector<int>&);
+
+		double solve(void);
+		double solveExpected(const std::vector<std::pair<int, int>>&, int, unsigned long long);
+
+		int getNumStates(void);
+		double getOptimalScore(void);
+		std::vector<DispatchAction> getSchedule(void);
+
+		~DispatchSolver(void);
+
+};	// end DispatchSolver
+
+
+#endif
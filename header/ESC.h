@@ -34,22 +34,128 @@
 sf::RenderWindow* getRenderWindowPtr(std::string);
 sf::RenderWindow* playBrandAnimation(std::string);
 
+bool loadAsset(sf::Font*, std::string);
+bool loadAsset(sf::Image*, std::string);
+bool loadAsset(sf::Texture*, std::string);
+bool loadAsset(sf::SoundBuffer*, std::string);
+bool openAsset(sf::Music*, std::string);
+bool openAsset(sf::InputSoundFile*, std::string);
+
 
 // -------- class structures & interfaces -------- //
 
 
+// ---- TextureId ---- //
+
+struct TextureId {
+	/*
+	 *	Handle to a texture asset (index into the Assets texture table),
+	 *	resolved from its key once, outside any per-frame code
+	 */
+
+	int idx = -1;
+
+};	// end TextureId
+
+
+// ---- FontId ---- //
+
+struct FontId {
+	/*
+	 *	Handle to a font asset (index into the Assets font table)
+	 */
+
+	int idx = -1;
+
+};	// end FontId
+
+
+// ---- SoundId ---- //
+
+struct SoundId {
+	/*
+	 *	Handle to a sound asset (index into the Assets sound table)
+	 */
+
+	int idx = -1;
+
+};	// end SoundId
+
+
+// ---- AtlasRegion ---- //
+
+struct AtlasRegion {
+	/*
+	 *	Where a texture asset can be drawn from: its atlas page (or its own
+	 *	texture, if not packed) and its rect on that texture
+	 */
+
+	sf::Texture* texture_ptr;
+	sf::IntRect rect;
+
+};	// end AtlasRegion
+
+
 // ---- Assets ---- //
 
 class Assets {
 	/*
-	 *	Class to load, store, and fetch game assets
+	 *	Class to load, store, and fetch game assets. Assets are fetched by
+	 *	handle (O(1), array indexed); keys are interned to handles once, and
+	 *	fetching by key is kept for cold paths and diagnostics.
+	 *
+	 *	Textures and sounds may also be registered lazily: they are loaded on
+	 *	first fetch (or prefetch), and while over the residency budget, the
+	 *	least recently fetched are evicted between frames (see endFrame()),
+	 *	to be loaded again if fetched again. Lazy assets must therefore be
+	 *	fetched on each use, never held across frames. Assets loaded eagerly
+	 *	are never evicted (sprites and atlas pages may refer to them).
+	 *
+	 *	Fonts rasterize glyphs on first draw, per character size; warmGlyphs()
+	 *	does so up front for the (font, size) pairs the game draws, and texts
+	 *	laid out in any other pair are counted as misses (see checkGlyphs()).
 	 */
 
 	private:
-		std::map<std::string, sf::Font*> font_map;
-		std::map<std::string, sf::Texture*> texture_map;
+		std::map<std::string, int> font_id_map;
+		std::vector<std::string> font_key_vec;
+		std::vector<sf::Font*> font_ptr_vec;
+		std::vector<std::vector<unsigned int>> glyph_size_vec;	// by font handle, sizes warmed (or missed)
+
+		std::map<std::string, int> texture_id_map;
+		std::vector<std::string> texture_key_vec;
+		std::vector<sf::Texture*> texture_ptr_vec;
+
 		std::map<std::string, sf::SoundBuffer*> soundbuffer_map;
-		std::map<std::string, sf::Sound*> sound_map;
+
+		std::map<std::string, int> sound_id_map;
+		std::vector<std::string> sound_key_vec;
+		std::vector<sf::Sound*> sound_ptr_vec;
+
+		std::vector<sf::Texture*> atlas_ptr_vec;
+		std::vector<AtlasRegion> region_vec;	// by texture handle, NULL texture if not packed
+
+		int frame;
+		int n_lazy_loads;
+		int n_evictions;
+		int n_glyphs_warmed;
+		int n_glyph_misses;
+		unsigned long long residency_budget;	// [bytes] of lazy assets
+		std::vector<std::string> texture_path_vec;	// by texture handle, "" if not lazy
+		std::vector<int> texture_use_vec;			// by texture handle, frame last fetched
+		std::vector<std::string> sound_path_vec;	// by sound handle, "" if not lazy
+		std::vector<int> sound_use_vec;				// by sound handle, frame last fetched
+
+		TextureId storeTexture(sf::Texture*, std::string);
+		void storeSoundBuffer(sf::SoundBuffer*, std::string);
+		SoundId storeSound(std::string);
+		void clearAtlas(void);
+
+		unsigned long long getTextureBytes(int);
+		unsigned long long getSoundBytes(int);
+		void evictTexture(int);
+		void evictSound(int);
+		void trim(void);
 
 	protected:
 		//
@@ -57,15 +163,50 @@ class Assets {
 	public:
 		Assets();
 
-		void loadFont(std::string, std::string);
-		void loadTexture(std::string, std::string);
+		FontId loadFont(std::string, std::string);
+		TextureId loadTexture(std::string, std::string);
 		void loadSoundBuffer(std::string, std::string);
-		void loadSound(std::string, std::string);
-
-		sf::Font* getFont(std::string);
-		sf::Texture* getTexture(std::string);
-		sf::SoundBuffer* getSoundBuffer(std::string);
-		sf::Sound* getSound(std::string);
+		SoundId loadSound(std::string, std::string);
+		TextureId loadTexture(const sf::Image&, std::string);
+		SoundId loadSound(const std::vector<sf::Int16>&, unsigned int, unsigned int, std::string);
+		TextureId registerTexture(std::string, std::string);
+		SoundId registerSound(std::string, std::string);
+		int buildAtlas(const std::vector<std::string>&, int, int);
+
+		void prefetchTexture(const std::string&);
+		void prefetchSound(const std::string&);
+		void setResidencyBudget(unsigned long long);
+		void endFrame(void);
+
+		int warmGlyphs(FontId, unsigned int);
+		bool checkGlyphs(FontId, unsigned int, const std::string&);
+
+		FontId internFont(const std::string&);
+		TextureId internTexture(const std::string&);
+		SoundId internSound(const std::string&);
+
+		sf::Font* getFont(FontId);
+		sf::Texture* getTexture(TextureId);
+		sf::Sound* getSound(SoundId);
+		AtlasRegion getRegion(TextureId);
+
+		sf::Font* getFont(const std::string&);
+		sf::Texture* getTexture(const std::string&);
+		sf::SoundBuffer* getSoundBuffer(const std::string&);
+		sf::Sound* getSound(const std::string&);
+		AtlasRegion getRegion(const std::string&);
+
+		std::string getFontKey(FontId);
+		std::string getTextureKey(TextureId);
+		std::string getSoundKey(SoundId);
+		int getNumTextures(void);
+		int getNumAtlasPages(void);
+		unsigned long long getResidentBytes(void);
+		int getNumLazyLoads(void);
+		int getNumEvictions(void);
+		unsigned long long getGlyphPageBytes(void);
+		int getNumGlyphsWarmed(void);
+		int getNumGlyphMisses(void);
 
 		~Assets();
 };	// end Assets
@@ -75,20 +216,26 @@ class Assets {
 
 class MusicPlayer {
 	/*
-	 *	Class to open and stream from a list of tracks
+	 *	Class to open and stream from a list of tracks. Tracks are opened
+	 *	when played, and stopped tracks are closed, so only the current track
+	 *	holds a stream (file handle, decoder, buffers).
 	 */
 
  	private:
 		bool first_play_flag;
 		bool render_flag;
-		int render_alpha;
 		int render_state;
-		int render_frame;
+		double render_alpha;
+		double render_frame;
+		FontId teletype_font_id;
 		Assets* assets_ptr;
 		std::map<std::string, sf::Music*>::iterator current_track;
-		std::map<std::string, sf::Music*> track_map;
+		std::map<std::string, sf::Music*> track_map;	// (NULL if not open)
+		std::map<std::string, std::string> track_path_map;
 		sf::RenderWindow* window_ptr;
 
+		void openTrack(void);
+
 	protected:
 		//
 
@@ -102,7 +249,9 @@ class MusicPlayer {
 		void nextTrack(void);
 		void prevTrack(void);
 		void printTrackInfo(void);
+		void update(double);
 		void renderTrackInfo(void);
+		bool isRenderingTrackInfo(void);
 		sf::SoundSource::Status getStatus(void);
 
 		~MusicPlayer();
@@ -130,6 +279,7 @@ class TextBox{
 		double target_width;
 		std::string feed_string;
 		std::string font_key;
+		FontId font_id;
 
 		Assets* assets_ptr;
 		sf::RenderWindow* window_ptr;
@@ -144,6 +294,7 @@ class TextBox{
 	public:
 		TextBox(Assets*, sf::RenderWindow*);
 
+		void update(double);
 		void drawFrame(void);
 		void makeBox(std::string, std::string, int, int, int, double, double);
 		void handleEvents(int);
@@ -153,4 +304,144 @@ class TextBox{
 };	// end TextBox
 
 
+// ---- TextCacheKey ---- //
+
+struct TextCacheKey {
+	/*
+	 *	What a laid out text depends on: font, character size, and string
+	 */
+
+	int font_idx;
+	unsigned int size;
+	std::string str;
+
+	bool operator==(const TextCacheKey&) const;
+
+};	// end TextCacheKey
+
+
+// ---- TextCacheKeyHash ---- //
+
+struct TextCacheKeyHash {
+	size_t operator()(const TextCacheKey&) const;
+};	// end TextCacheKeyHash
+
+
+// ---- TextCacheEntry ---- //
+
+struct TextCacheEntry {
+	/*
+	 *	A laid out text (sf::Text keeps its glyph geometry until its string,
+	 *	font, or size changes, which for a cached text is never) and its local
+	 *	bounds, taken once at layout
+	 */
+
+	sf::Text text;
+	sf::FloatRect bounds;
+	int last_frame;		// last frame fetched, for eviction
+
+};	// end TextCacheEntry
+
+
+// ---- TextCache ---- //
+
+class TextCache {
+	/*
+	 *	Class to retain laid out texts across frames, keyed by (font, size,
+	 *	string), so that overlays re-lay out a text only when its string
+	 *	actually changes. Entries not fetched for max_idle_frames are evicted.
+	 *
+	 *	Texts are shared by key, so callers set transform (origin, position,
+	 *	rotation) each time they draw; fill colour is passed to get().
+	 */
+
+	private:
+		int frame;
+		int max_idle_frames;
+		int frame_hits;
+		int frame_misses;
+		int last_hits;
+		int last_misses;
+		unsigned long long total_hits;
+		unsigned long long total_misses;
+
+		TextCacheKey lookup_key;	// (reused, so lookups do not allocate)
+		std::unordered_map<TextCacheKey, TextCacheEntry, TextCacheKeyHash> entry_map;
+
+		Assets* assets_ptr;
+
+	protected:
+		//
+
+	public:
+		TextCache(Assets*, int);
+
+		TextCacheEntry* get(
+			FontId,
+			unsigned int,
+			const std::string&,
+			sf::Color = sf::Color::White
+		);
+		void endFrame(void);
+		void clear(void);
+
+		int getNumEntries(void);
+		double getHitRate(void);
+		double getTotalHitRate(void);
+
+		~TextCache(void);
+
+};	// end TextCache
+
+
+// ---- FramePacer ---- //
+
+class FramePacer {
+	/*
+	 *	Class to pace frame loops by sleeping, rather than spinning on a clock,
+	 *	until each frame is due. Callers keep their own clock and fixed-step
+	 *	deadlines; the pacer wakes on the first deadline on its own target rate
+	 *	grid (so a lower target rate wakes less often, and the caller catches
+	 *	up steps in between).
+	 *
+	 *	Without vsync, the pacer sleeps to a short spin tail before the
+	 *	deadline and spins the rest, for precision. With vsync, display()
+	 *	already blocks to the vertical blank, so the pacer just sleeps.
+	 *
+	 *	A deadline already passed by a whole frame period when waited on is
+	 *	counted as missed.
+	 */
+
+	private:
+		bool vertical_sync_flag;
+		int n_waits;
+		int n_missed;
+		double target_rate;		// [frames per second]
+		double spin_tail_s;
+		double last_missed_s;	// (deadlines are counted missed at most once)
+		double total_slept_s;
+
+		std::chrono::steady_clock::time_point start_time;
+
+	protected:
+		//
+
+	public:
+		FramePacer(double = FRAMES_PER_SECOND);
+
+		void setTargetRate(double);
+		void setVerticalSync(sf::RenderWindow*, bool);
+		void waitUntil(double, double, double = 1);
+		void printReport(void);
+
+		double getTargetRate(void);
+		int getNumWaits(void);
+		int getNumMissed(void);
+		double getSleepRatio(void);
+
+		~FramePacer(void);
+
+};	// end FramePacer
+
+
 #endif
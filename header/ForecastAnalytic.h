@@ -0,0 +1,91 @@
+/*
+ *	Analytic forecast header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the analytic forecast engine used by Game::getForecast(). The
+ *	next hour weather of Game::generateWindRatio() and
+ *	Game::generateCloudRatio() is a Bernoulli up/down choice followed by a
+ *	uniform step, and the tidal speed noise is uniform, so the production
+ *	curves can be integrated over the exact distribution (Gauss-Legendre,
+ *	split at every kink of the curve and at the clamps). The min and max are
+ *	found from the curve breakpoints, so they are true bounds rather than
+ *	sampled ones.
+ *
+ *	Wave production (Rayleigh wave height nested on a Markov step) has no
+ *	such form here and stays with the sampled ForecastKernel.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef FORECASTANALYTIC_H
+#define FORECASTANALYTIC_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "ForecastKernel.h"
+#include "GridSimulator.h"
+
+#include <vector>
+
+
+// -------- typedefs -------- //
+typedef double (*ForecastCurve)(double, const ForecastParams&);	// production ratio of next state
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- ForecastAnalytic ---- //
+
+class ForecastAnalytic {
+	/*
+	 *	Class to forecast renewable production by quadrature
+	 */
+
+	private:
+		std::vector<double> cut_vec;
+
+		void integrateUniform(
+			double,
+			double,
+			double,
+			const std::vector<double>&,
+			ForecastCurve,
+			const ForecastParams&,
+			ForecastStats*
+		);
+		void integrateMarkov(
+			double,
+			double,
+			const std::vector<double>&,
+			ForecastCurve,
+			const ForecastParams&,
+			ForecastStats*
+		);
+
+	protected:
+		//
+
+	public:
+		ForecastAnalytic(void);
+
+		ForecastStats solar(double, double, double, double);
+		ForecastStats tidal(double, double, double);
+		ForecastStats wind(double, double, double);
+
+		~ForecastAnalytic(void);
+
+};	// end ForecastAnalytic
+
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ *	Forecast kernel header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the Monte Carlo forecast kernel used by Game::getForecast().
+ *	Trials are laid out as structure-of-arrays (one array of uniform rolls per
+ *	random input) and evaluated 8 (AVX2), 4 (SSE2), or 1 (scalar) at a time.
+ *	Only the mean, min, and max production are accumulated, so no per-trial
+ *	output is stored. The widest instruction set supported by the CPU is
+ *	picked at runtime.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef FORECASTKERNEL_H
+#define FORECASTKERNEL_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "Random.h"
+
+#include <string>
+#include <vector>
+
+
+// -------- enums & structs -------- //
+
+enum ForecastKind {
+	FORECAST_SOLAR,		// Markov cloud cover step, then solar curve
+	FORECAST_TIDAL,		// +/- 5% noise on tidal speed, then tidal curve
+	FORECAST_WAVE,		// Markov sea state step, Rayleigh height, then wave curve
+	FORECAST_WIND		// Markov wind step, then wind curve
+};
+
+
+enum ForecastISA {
+	FORECAST_ISA_SCALAR,
+	FORECAST_ISA_SSE2,
+	FORECAST_ISA_AVX2
+};
+
+
+struct ForecastParams {
+	/*
+	 *	Inputs to a forecast kernel (all plain data)
+	 */
+
+	int kind;					// ForecastKind
+	double capacity_GW;
+	double state;				// current Markov state (normalized), or tidal speed [m/s]
+	double step;				// max Markov step (normalized)
+	double solar_base_kWm2;		// time-of-day solar resource (solar only)
+	double smog_ratio;			// (solar only)
+	double design_value;		// design speed [m/s] (tidal, wind)
+
+};	// end ForecastParams
+
+
+struct ForecastStats {
+	/*
+	 *	Outputs of a forecast kernel (production over all trials [GWh])
+	 */
+
+	double mean_GWh;
+	double min_GWh;
+	double max_GWh;
+
+};	// end ForecastStats
+
+
+// -------- function prototypes -------- //
+void forecastKernelScalar(const ForecastParams&, const float*, const float*, const float*, int, ForecastStats*);
+bool forecastKernelSSE2(const ForecastParams&, const float*, const float*, const float*, int, ForecastStats*);
+bool forecastKernelAVX2(const ForecastParams&, const float*, const float*, const float*, int, ForecastStats*);
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- ForecastKernel ---- //
+
+class ForecastKernel {
+	/*
+	 *	Class to own trial buffers and dispatch forecasts to the best kernel
+	 */
+
+	private:
+		int isa;
+		int n_trials;
+		std::vector<float> roll_vec;
+		std::vector<float> step_vec;
+		std::vector<float> height_vec;
+		RandomStream random_stream;
+
+		ForecastStats run(const ForecastParams&);
+
+	protected:
+		//
+
+	public:
+		ForecastKernel(int);
+
+		int getISA(void);
+		int getNumTrials(void);
+		std::string getISAName(void);
+		void setISA(int);
+		void setStream(const RandomStream&);
+
+		ForecastStats solar(double, double, double, double);
+		ForecastStats tidal(double, double, double);
+		ForecastStats wave(double, double);
+		ForecastStats wind(double, double, double);
+
+		~ForecastKernel(void);
+
+};	// end ForecastKernel
+
+
+#endif
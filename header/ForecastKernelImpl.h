@@ -0,0 +1,379 @@
+/*
+ *	Forecast kernel internals for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Width-generic forecast kernel, written once against a small set of lane
+ *	operations (Ops) and instantiated per instruction set. Only to be included
+ *	by the forecast kernel translation units (which may be built with
+ *	different instruction set flags), hence everything here has internal
+ *	linkage.
+ *
+ *	exp() and log() are the single precision Cephes polynomial approximations
+ *	(relative error ~1e-7 over the ranges used here).
+ *
+ *	ref: S. L. Moshier (1992), Cephes Math Library, http://www.netlib.org/cephes/
+ *
+ */
+
+
+#ifndef FORECASTKERNELIMPL_H
+#define FORECASTKERNELIMPL_H
+
+
+// -------- includes -------- //
+#include "ForecastKernel.h"
+
+#include <cfloat>
+#include <cmath>
+
+
+namespace {
+
+
+// ---- ScalarOps ---- //
+
+struct ScalarOps {
+	/*
+	 *	Lane operations, one lane (also used for kernel tails)
+	 */
+
+	typedef float V;
+	typedef bool M;
+	typedef int I;
+	static const int width = 1;
+
+	static inline V load(const float* ptr) {return *ptr;}
+	static inline V set1(float x) {return x;}
+	static inline V add(V a, V b) {return a + b;}
+	static inline V sub(V a, V b) {return a - b;}
+	static inline V mul(V a, V b) {return a * b;}
+	static inline V div(V a, V b) {return a / b;}
+	static inline V min(V a, V b) {return a < b ? a : b;}
+	static inline V max(V a, V b) {return a > b ? a : b;}
+	static inline V sqrt(V a) {return sqrtf(a);}
+	static inline M lt(V a, V b) {return a < b;}
+	static inline M le(V a, V b) {return a <= b;}
+	static inline M gt(V a, V b) {return a > b;}
+	static inline M maskOr(M a, M b) {return a || b;}
+	static inline V select(M m, V a, V b) {return m ? a : b;}
+	static inline I roundToInt(V a) {return int(lrintf(a));}
+	static inline V toFloat(I a) {return float(a);}
+	static inline V pow2(I a) {return ldexpf(1.0f, a);}
+	static inline V exponent(V a) {int e = 0; frexpf(a, &e); return float(e);}
+	static inline V mantissa(V a) {int e = 0; return frexpf(a, &e);}
+	static inline double sum(V a) {return a;}
+	static inline double minimum(V a) {return a;}
+	static inline double maximum(V a) {return a;}
+
+};	// end ScalarOps
+
+
+// ---- generic kernel ---- //
+
+template <class O>
+inline typename O::V fkExp(typename O::V x) {
+	/*
+	 *	exp(x), Cephes expf
+	 */
+
+	typedef typename O::V V;
+	typedef typename O::I I;
+
+	x = O::min(O::max(x, O::set1(-88.3762626647949f)), O::set1(88.3762626647949f));
+
+	I n = O::roundToInt(O::mul(x, O::set1(1.44269504088896341f)));
+	V fx = O::toFloat(n);
+	x = O::sub(x, O::mul(fx, O::set1(0.693359375f)));
+	x = O::sub(x, O::mul(fx, O::set1(-2.12194440e-4f)));
+
+	V z = O::mul(x, x);
+	V y = O::set1(1.9875691500e-4f);
+	y = O::add(O::mul(y, x), O::set1(1.3981999507e-3f));
+	y = O::add(O::mul(y, x), O::set1(8.3334519073e-3f));
+	y = O::add(O::mul(y, x), O::set1(4.1665795894e-2f));
+	y = O::add(O::mul(y, x), O::set1(1.6666665459e-1f));
+	y = O::add(O::mul(y, x), O::set1(5.0000001201e-1f));
+	y = O::add(O::add(O::mul(y, z), x), O::set1(1.0f));
+
+	return O::mul(y, O::pow2(n));
+}	// end fkExp()
+
+
+template <class O>
+inline typename O::V fkLog(typename O::V x) {
+	/*
+	 *	log(x) for positive, normal x, Cephes logf
+	 */
+
+	typedef typename O::V V;
+	typedef typename O::M M;
+
+	V e = O::exponent(x);
+	V m = O::mantissa(x);	// x = m * 2^e, m in [0.5, 1)
+
+	M small = O::lt(m, O::set1(0.707106781186547524f));
+	e = O::select(small, O::sub(e, O::set1(1.0f)), e);
+	m = O::sub(O::add(m, O::select(small, m, O::set1(0.0f))), O::set1(1.0f));
+
+	V z = O::mul(m, m);
+	V y = O::set1(7.0376836292e-2f);
+	y = O::add(O::mul(y, m), O::set1(-1.1514610310e-1f));
+	y = O::add(O::mul(y, m), O::set1(1.1676998740e-1f));
+	y = O::add(O::mul(y, m), O::set1(-1.2420140846e-1f));
+	y = O::add(O::mul(y, m), O::set1(1.4249322787e-1f));
+	y = O::add(O::mul(y, m), O::set1(-1.6668057665e-1f));
+	y = O::add(O::mul(y, m), O::set1(2.0000714765e-1f));
+	y = O::add(O::mul(y, m), O::set1(-2.4999993993e-1f));
+	y = O::add(O::mul(y, m), O::set1(3.3333331174e-1f));
+	y = O::mul(O::mul(y, m), z);
+
+	y = O::add(y, O::mul(e, O::set1(-2.12194440e-4f)));
+	y = O::sub(y, O::mul(z, O::set1(0.5f)));
+
+	return O::add(O::add(m, y), O::mul(e, O::set1(0.693359375f)));
+}	// end fkLog()
+
+
+template <class O>
+inline typename O::V fkClamp01(typename O::V x) {
+	return O::min(O::max(x, O::set1(0.0f)), O::set1(1.0f));
+}	// end fkClamp01()
+
+
+template <class O>
+inline typename O::V fkMarkovStep(
+	typename O::V state,
+	typename O::V roll,
+	typename O::V step_roll,
+	float step
+) {
+	/*
+	 *	One step of the simple Markov process of Game::generateWindRatio() et al
+	 */
+
+	typedef typename O::V V;
+	typedef typename O::M M;
+
+	M increase = O::le(roll, O::sub(O::set1(1.0f), state));
+	V delta = O::mul(O::set1(step), step_roll);
+	V next = O::select(increase, O::add(state, delta), O::sub(state, delta));
+
+	return fkClamp01<O>(next);
+}	// end fkMarkovStep()
+
+
+template <class O>
+inline typename O::V fkEvaluate(
+	const ForecastParams& params,
+	typename O::V roll,
+	typename O::V step_roll,
+	typename O::V height_roll
+) {
+	/*
+	 *	Production [GWh] of one lane of trials
+	 */
+
+	typedef typename O::V V;
+	typedef typename O::M M;
+
+	V state = O::set1(params.state);
+	V prod = O::set1(0.0f);
+
+	switch (params.kind) {
+		case (FORECAST_SOLAR):
+			{
+				V cloud = fkMarkovStep<O>(state, roll, step_roll, params.step);
+				V res = O::mul(
+					O::mul(O::set1(params.solar_base_kWm2), O::sub(O::set1(1.0f), cloud)),
+					O::set1(1.0f - params.smog_ratio)
+				);
+				prod = fkClamp01<O>(res);
+			}
+			break;
+
+		case (FORECAST_TIDAL):
+			{
+				V res = O::mul(
+					state,
+					O::add(O::set1(0.95f), O::mul(O::set1(0.1f), roll))
+				);
+				res = fkClamp01<O>(res);
+
+				V design = O::set1(params.design_value);
+				V turb = O::div(O::sub(res, design), design);
+				V curve = O::sub(
+					O::mul(O::set1(1.69215f), fkExp<O>(O::mul(O::set1(1.25909f), turb))),
+					O::set1(0.69215f)
+				);
+				prod = O::select(O::le(turb, O::set1(0.0f)), curve, O::set1(1.0f));
+
+				M outside = O::maskOr(
+					O::lt(turb, O::set1(-0.71f)),
+					O::gt(turb, O::set1(0.65f))
+				);
+				prod = O::select(outside, O::set1(0.0f), prod);
+			}
+			break;
+
+		case (FORECAST_WAVE):
+			{
+				V norm = fkMarkovStep<O>(state, roll, step_roll, params.step);
+				V period = O::add(O::mul(O::set1(15.0f - 5.75f), norm), O::set1(5.75f));
+				V period_2 = O::mul(period, period);
+
+				// Rayleigh scalar (see waveHeight())
+				V u = O::sub(
+					O::set1(1.0f),
+					O::min(height_roll, O::set1(0.999999f))
+				);
+				V scalar = O::mul(
+					O::set1(0.028f),
+					O::sqrt(O::mul(O::set1(-2.0f), fkLog<O>(u)))
+				);
+				V height = O::mul(scalar, period_2);
+				height = O::select(
+					O::gt(scalar, O::set1(0.2184f)),
+					O::mul(O::set1(0.2f), period_2),
+					height
+				);
+
+				// see waveProductionRatio()
+				prod = O::sub(
+					O::sub(
+						O::mul(O::set1(0.289f), height),
+						O::mul(O::mul(O::set1(0.00111f), O::mul(height, height)), period)
+					),
+					O::mul(O::set1(0.0169f), period)
+				);
+				prod = fkClamp01<O>(prod);
+			}
+			break;
+
+		case (FORECAST_WIND):
+			{
+				V ratio = fkMarkovStep<O>(state, roll, step_roll, params.step);
+
+				V design = O::set1(params.design_value);
+				V turb = O::div(O::sub(ratio, design), design);
+				V turb_2 = O::mul(turb, turb);
+				M below = O::le(turb, O::set1(0.0f));
+
+				// one exp() per lane, pick the branch coefficients first
+				V e = fkExp<O>(O::mul(
+					O::select(below, O::set1(-5.97588f), O::set1(-9.30254f)),
+					turb_2
+				));
+				prod = O::select(
+					below,
+					O::sub(O::mul(O::set1(1.03273f), e), O::set1(0.03273f)),
+					O::add(O::mul(O::set1(0.16154f), e), O::set1(0.83846f))
+				);
+
+				M outside = O::maskOr(
+					O::lt(turb, O::set1(-0.76f)),
+					O::gt(turb, O::set1(0.68f))
+				);
+				prod = O::select(outside, O::set1(0.0f), prod);
+				prod = O::min(prod, O::set1(1.0f));
+			}
+			break;
+
+		default:
+			// do nothing!
+			break;
+	}
+
+	return O::mul(O::set1(params.capacity_GW), prod);
+}	// end fkEvaluate()
+
+
+template <class O>
+void fkRun(
+	const ForecastParams& params,
+	const float* roll_ptr,
+	const float* step_ptr,
+	const float* height_ptr,
+	int n_trials,
+	ForecastStats* stats_ptr
+) {
+	/*
+	 *	Runs all trials, O::width at a time (scalar tail), accumulating sum,
+	 *	min, and max (lane sums are flushed to double every 256 blocks)
+	 */
+
+	typedef typename O::V V;
+
+	double sum_GWh = 0;
+	double min_GWh = DBL_MAX;
+	double max_GWh = -DBL_MAX;
+
+	V lane_sum = O::set1(0.0f);
+	V lane_min = O::set1(FLT_MAX);
+	V lane_max = O::set1(-FLT_MAX);
+
+	int i = 0;
+	int n_blocks = 0;
+	for (; i + O::width <= n_trials; i += O::width) {
+		V prod = fkEvaluate<O>(
+			params,
+			O::load(roll_ptr + i),
+			O::load(step_ptr + i),
+			O::load(height_ptr + i)
+		);
+		lane_sum = O::add(lane_sum, prod);
+		lane_min = O::min(lane_min, prod);
+		lane_max = O::max(lane_max, prod);
+
+		n_blocks++;
+		if (n_blocks == 256) {
+			sum_GWh += O::sum(lane_sum);
+			lane_sum = O::set1(0.0f);
+			n_blocks = 0;
+		}
+	}
+	sum_GWh += O::sum(lane_sum);
+	if (i > 0) {
+		min_GWh = O::minimum(lane_min);
+		max_GWh = O::maximum(lane_max);
+	}
+
+	for (; i < n_trials; i++) {
+		double prod = fkEvaluate<ScalarOps>(
+			params,
+			roll_ptr[i],
+			step_ptr[i],
+			height_ptr[i]
+		);
+		sum_GWh += prod;
+		if (prod < min_GWh) {
+			min_GWh = prod;
+		}
+		if (prod > max_GWh) {
+			max_GWh = prod;
+		}
+	}
+
+	if (n_trials <= 0) {
+		min_GWh = 0;
+		max_GWh = 0;
+	}
+
+	stats_ptr->mean_GWh = n_trials > 0 ? sum_GWh / n_trials : 0;
+	stats_ptr->min_GWh = min_GWh;
+	stats_ptr->max_GWh = max_GWh;
+
+	return;
+}	// end fkRun()
+
+
+}	// end anonymous namespace
+
+
+#endif
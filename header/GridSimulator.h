@@ -0,0 +1,170 @@
+/*
+ *	Grid simulator header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines a headless (SFML-free) model of the play phase: dispatch,
+ *	scoring, smog, storage charging, and weather advance, using plain-data
+ *	plant models. A complete 24 hour game can be run without a window,
+ *	textures, or audio (e.g. for batch evaluation of portfolios).
+ *
+ *	The free functions declared here are the shared rule math: the Plant
+ *	hierarchy and Game use them too, so both paths step the weather, draw
+ *	demand, and score an hour the same way.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef GRIDSIMULATOR_H
+#define GRIDSIMULATOR_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "PerformanceCurve.h"
+#include "PlantKind.h"
+#include "Random.h"
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+// -------- function prototypes -------- //
+void usePerformanceTables(bool);
+double weatherRatioStep(double, RandomStream&);
+double waveResourceStep(double, RandomStream&);
+double initialWaveResource(RandomStream&);
+double tidalResource(double, RandomStream&);
+int drawDemandGWh(int, RandomStream&);
+double demandPoints(int, int);
+double solarProductionRatio(double);
+double solarTimeOfDayResource(double);
+double tidalProductionRatio(double, double);
+double waveHeight(double, double);
+double waveProductionRatio(double, double);
+double windProductionRatio(double, double);
+int hydroStorageGWh(int);
+int tokensPerGW(int);
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- PlantModel ---- //
+
+struct PlantModel {
+	/*
+	 *	Plain-data model of a plant (no rendering state)
+	 */
+
+	int type;						// see PLANT_* in constants.h
+	bool has_run;
+	int last_production_GWh;
+	int mustered_GWh;
+	double production_ratio;		// renewables only, this hour [GWh/GW]
+	double capacity_GW;
+	double capacity_GWh;			// hydro and storage only
+	double charge_GWh;				// hydro and storage only
+	double design_value;			// design speed [m/s] (tidal, wind), period [s] (wave)
+	std::vector<int> marbles_committed_vector;
+
+};	// end PlantModel
+
+
+// ---- GridSimulator ---- //
+
+class GridSimulator {
+	/*
+	 *	Class to simulate the play phase of the game without rendering
+	 */
+
+	private:
+		int hour_of_day;
+		int current_energy_demand_GWh;
+		int tidal_idx_offset;
+		int coal_marbles;
+		int combined_marbles;
+		int peaker_marbles;
+		int excess_dispatch_GWh;
+		int total_coal_marbles;
+		int total_combined_marbles;
+		int total_peaker_marbles;
+		int total_excess_dispatch_GWh;
+		int total_unmet_demand_GWh;
+		double cloud_cover_ratio;
+		double wind_speed_ratio;
+		double smog_ratio;
+		double wave_res_s;
+		double score;
+		std::vector<int> energy_demand_GWh_vec;
+		std::vector<int> actual_energy_demand_GWh_vec;
+		std::vector<double> tidal_res_ms_vec;
+		std::vector<PlantModel> plant_model_vec;
+
+		RandomService random_service;
+
+		double rand01(int);
+
+		double generateWindRatio(void);
+		double generateCloudRatio(void);
+		double generateSolarResource(void);
+		double generateWaveResource(void);
+
+		void computeProduction(void);
+		int drawDemand(void);
+
+	protected:
+		//
+
+	public:
+		GridSimulator(unsigned long long);
+
+		void reset(unsigned long long);
+		void clearPlants(void);
+
+		int pushPlant(int, double);
+		int pushPlantTokens(int, int);
+		int rollGeothermalCapacity(int);
+
+		void start(void);
+		void setDispatch(int, int);
+		void dispatchMeritOrder(const std::vector<int>&);
+		void commitHour(void);
+		double runDay(const std::vector<int>&);
+
+		bool isFinished(void);
+		int getHourOfDay(void);
+		int getNumPlants(void);
+		int getMinDispatch(int);
+		int getMaxDispatch(int);
+		int getDispatch(int);
+		int getEnergyDemandGWh(void);
+		int getCoalMarbles(void);
+		int getCombinedMarbles(void);
+		int getPeakerMarbles(void);
+		int getExcessDispatchGWh(void);
+		int getUnmetDemandGWh(void);
+		double getScore(void);
+		double getSmogRatio(void);
+		double getCloudCoverRatio(void);
+		double getWindSpeedRatio(void);
+		double getWaveResource(void);
+		const PlantModel& getPlantModel(int);
+		const std::vector<int>& getActualEnergyDemandVec(void);
+
+		~GridSimulator(void);
+
+};	// end GridSimulator
+
+
+#endif
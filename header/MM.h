@@ -28,30 +28,81 @@
 #include "constants.h"
 #include "includes.h"
 
+#include "AtlasPacker.h"
+#include "BatchRunner.h"
+#include "DispatchSolver.h"
 #include "ESC.h"
+#include "ForecastAnalytic.h"
+#include "ForecastKernel.h"
+#include "GridSimulator.h"
+#include "PlantKind.h"
+#include "PortfolioOptimizer.h"
+#include "Random.h"
+#include "Session.h"
 
 
 // -------- function prototypes -------- //
 void runTests(void);
+void benchmarkStartup(void);
+void benchmarkAssetHandles(void);
 void renderSplashScreen(sf::RenderWindow*);
 
 
 // -------- class structures & interfaces -------- //
 
 
+// ---- MarbleBatch ---- //
+
+class MarbleBatch {
+	/*
+	 *	Class to collect marble quads (glass and core) into vertex arrays, so
+	 *	that any number of marbles is drawn in two draw calls
+	 */
+
+	private:
+		bool region_flag;
+		std::vector<sf::Vector2f> circle_vec;	// unit circle, as sf::CircleShape
+
+		TextureId texture_id;	// "marble" sheet
+		AtlasRegion region;		// (looked up once per frame)
+		sf::VertexArray glass_array;
+		sf::VertexArray core_array;
+		sf::RenderWindow* window_ptr;
+
+		Assets* assets_ptr;
+
+	protected:
+		//
+
+	public:
+		MarbleBatch(sf::RenderWindow*, Assets*);
+
+		void pushGlass(double, double, double, sf::Color);
+		void pushCore(double, double, double, sf::IntRect, sf::Color);
+		void draw(void);
+
+		~MarbleBatch(void);
+
+};	// end MarbleBatch
+
+
 // ---- Marble ---- //
 
 class Marble {
 	private:
 		bool charge;
-		int frame;
-		int glow_frame;
 		int height;
 		int tile;
 		int width;
+		double frame;
+		double glow_frame;
 		double init_dist;
 		double position_x;
 		double position_y;
+		double prev_glow_frame;
+		double prev_position_x;
+		double prev_position_y;
+		double prev_scale;
 		double scale;
 		double target_x;
 		double target_y;
@@ -69,80 +120,258 @@ class Marble {
 		Marble(double, double, sf::RenderWindow*, Assets*, sf::Color, bool);
 
 		bool isFinished(void);
-		void drawFrame(void);
+		void update(double);
+		void drawFrame(double, MarbleBatch*);
 
 		~Marble(void);
 
 };	// end Marble
 
 
-// ---- Emissions Hierarchy ---- //
+// ---- Emissions ---- //
 
+enum ParticleType {
+	PARTICLE_STEAM,		// (i.e. tile rows of the "emissions" texture)
+	PARTICLE_SMOKE
+};
 
-// ---- Particle ---- //
 
-class Particle {
-	private:
-		//
+// ---- ParticlePool ---- //
 
-	protected:
-		int height;
-		int sprite_idx;
-		int width;
-		double alpha;
-		double angle;
-		double position_x;
-		double position_y;
-		double scale;
-		std::string texture_key;
+class ParticlePool {
+	/*
+	 *	Class for a fixed capacity pool of steam and smoke particles, stored as
+	 *	a structure of arrays (shared by all emitters, and drawn in one call)
+	 */
 
+	private:
+		int capacity;
+		int n_particles;
+		std::vector<float> alpha_vec;
+		std::vector<float> angle_vec;
+		std::vector<float> position_x_vec;
+		std::vector<float> position_y_vec;
+		std::vector<float> scale_vec;
+		std::vector<float> prev_alpha_vec;
+		std::vector<float> prev_angle_vec;
+		std::vector<float> prev_position_x_vec;
+		std::vector<float> prev_position_y_vec;
+		std::vector<float> prev_scale_vec;
+		std::vector<unsigned char> type_vec;
+
+		TextureId texture_id;	// "emissions" sheet
+		sf::VertexArray vertex_array;
 		sf::RenderWindow* window_ptr;
 
 		Assets* assets_ptr;
 
+		void remove(int);
+
+	protected:
+		//
+
 	public:
-		Particle(double, double, sf::RenderWindow*, Assets*);
+		ParticlePool(int, sf::RenderWindow*, Assets*);
 
-		bool isFinished(void);
-		void drawFrame(double wind_speed_ratio);
+		int getNumParticles(void);
+		bool spawn(int, double, double);
+		void clear(void);
+		void update(double, double);
+		void drawFrame(double);
+
+		~ParticlePool(void);
 
-		virtual ~Particle(void);
+};	// end ParticlePool
 
-};	// end Particle
 
+// ---- LayerCache ---- //
 
-// ---- Particle <-- Steam ---- //
+class LayerCache {
+	/*
+	 *	Class to cache a static layer (one that looks the same whenever its
+	 *	inputs are the same) in a render texture, so that it is redrawn only
+	 *	when its inputs change and is otherwise blitted in one draw. Falls
+	 *	back to drawing straight to the window if render textures are not
+	 *	available.
+	 */
 
-class Steam : public Particle {
 	private:
-		//
+		bool created_flag;
+		bool fallback_flag;
+		bool valid_flag;
+		int n_redraws;
+		std::vector<double> input_vec;
+
+		sf::RenderTexture render_texture;
+		sf::Sprite sprite;
+		sf::RenderWindow* window_ptr;
+
+		void create(void);
 
 	protected:
 		//
 
 	public:
-		Steam(double, double, sf::RenderWindow*, Assets*);
+		LayerCache(sf::RenderWindow*);
 
-		~Steam(void);
+		bool needsRedraw(std::initializer_list<double>);
+		sf::RenderTarget* beginRedraw(void);
+		void endRedraw(void);
+		void draw(void);
+		void invalidate(void);
 
-};	// end Steam
+		int getNumRedraws(void);
 
+		~LayerCache(void);
+
+};	// end LayerCache
+
+
+// ---- ChartSeries ---- //
+
+struct ChartSeries {
+	/*
+	 *	One data series of a BarChart (one value per x slot)
+	 */
 
-// ----  Particle <-- Smoke ---- //
+	std::string label;
+	sf::Color colour;
+	bool stacked_flag;	// stacked bars (else thin marker bars, in front)
+	std::vector<double> value_vec;
+
+};	// end ChartSeries
+
+
+// ---- BarChart ---- //
+
+class BarChart {
+	/*
+	 *	Class to draw a (full screen) bar chart: axes, grid, ticks, labels,
+	 *	stacked and marker bars, legend, and title. The chart is built (bars
+	 *	as one vertex array, lines as another) into a LayerCache only when its
+	 *	data change, so each frame it is a single draw.
+	 */
 
-class Smoke : public Particle {
 	private:
+		bool dirty_flag;
+		int n_x;
+		int n_y;
+		int n_x_ticks;
+		std::string title;
+		std::string x_label;
+		std::string y_label;
+		std::vector<ChartSeries> series_vec;
+
+		FontId title_font_id;
+		FontId label_font_id;
+		LayerCache layer;
+		sf::VertexArray line_array;
+		sf::VertexArray bar_array;
+
+		Assets* assets_ptr;
+
+		void pushBar(double, double, double, double, sf::Color);
+		void build(sf::RenderTarget*);
+
+	protected:
 		//
 
+	public:
+		BarChart(
+			std::string,
+			std::string,
+			std::string,
+			int,
+			int,
+			sf::RenderWindow*,
+			Assets*
+		);
+
+		void setNumXTicks(int);
+		void setNumSeries(int);
+		void setSeries(int, std::string, sf::Color, bool, const std::vector<double>&);
+		void draw(void);
+
+		int getNumBuilds(void);
+
+		~BarChart(void);
+
+};	// end BarChart
+
+
+// ---- DecodedAsset ---- //
+
+enum DecodedAssetType {
+	DECODED_TEXTURE,	// (decoded to an sf::Image)
+	DECODED_SOUND		// (decoded to samples)
+};
+
+
+struct DecodedAsset {
+	/*
+	 *	An asset queued with AssetLoader, and (once decoded) its decoded data
+	 */
+
+	int type;
+	std::string path;
+	std::string key;
+
+	bool decoded_flag;
+	bool ok_flag;
+	sf::Image image;
+	std::vector<sf::Int16> sample_vec;
+	unsigned int channel_count;
+	unsigned int sample_rate;
+
+};	// end DecodedAsset
+
+
+// ---- AssetLoader ---- //
+
+class AssetLoader {
+	/*
+	 *	Class to decode image and audio assets on a worker pool (in the
+	 *	background, e.g. while the brand and splash animations play), leaving
+	 *	only the upload (GL textures, AL buffers) to the render thread.
+	 *
+	 *	Assets are uploaded in the order queued, whatever order they decode
+	 *	in, so asset handles and the load log are the same every run.
+	 */
+
+	private:
+		bool started_flag;
+		int n_decoded;
+		int n_uploaded;
+		std::vector<DecodedAsset> asset_vec;
+		std::mutex decoded_mutex;	// (guards n_decoded, and each decoded_flag)
+		std::mutex open_mutex;		// (sound file readers register on first open)
+
+		WorkStealingPool* pool_ptr;
+		std::thread pool_thread;
+
+		void queue(int, std::string, std::string);
+		void decode(int);
+
 	protected:
 		//
 
 	public:
-		Smoke(double, double, sf::RenderWindow*, Assets*);
+		AssetLoader(int);
+
+		void queueTexture(std::string, std::string);
+		void queueSound(std::string, std::string);
+		void start(void);
+		int upload(Assets*, double);
+
+		bool isFinished(void);
+		int getNumQueued(void);
+		int getNumDecoded(void);
+		int getNumUploaded(void);
+		double getProgress(void);
 
-		~Smoke(void);
+		~AssetLoader(void);
 
-};	// end Smoke
+};	// end AssetLoader
 
 
 // ---- Sky Disk ---- //
@@ -166,7 +395,7 @@ class SkyDisk {
 		SkyDisk(sf::RenderWindow*, Assets*);
 
 		void buildSprites(void);
-		void drawFrame(double);
+		void drawFrame(double, sf::RenderTarget*);
 
 		~SkyDisk(void);
 
@@ -177,6 +406,9 @@ class SkyDisk {
 
 class OvercastClouds {
 	private:
+		double cloud_dx;
+
+		TextureId cloud_texture_id;
 		sf::RenderWindow* window_ptr;
 		sf::Sprite overcast_sky_sprite;
 		std::list<sf::Sprite*> cloud_sprite_ptr_list;
@@ -192,6 +424,9 @@ class OvercastClouds {
 		OvercastClouds(sf::RenderWindow*, Assets*);
 
 		void buildSprites(void);
+		void update(double, double);
+		void drawOvercast(double, double, sf::RenderTarget*);
+		void drawClouds(double, double, double);
 		void drawFrame(double, double, double);
 
 		~OvercastClouds(void);
@@ -218,7 +453,7 @@ class Foreground {
 		Foreground(sf::RenderWindow*, Assets*);
 
 		void buildSprites(void);
-		void drawFrame(bool, double);
+		void drawFrame(bool, double, sf::RenderTarget*);
 
 		~Foreground(void);
 
@@ -229,7 +464,7 @@ class Foreground {
 
 class WindSock {
 	private:
-		int frame;
+		double frame;
 
 		sf::RenderWindow* window_ptr;
 		sf::Sprite sock_sprite;
@@ -245,7 +480,8 @@ class WindSock {
 
 		sf::Color getShading(double);
 		void buildSprites(void);
-		void drawFrame(double, double);
+		void update(double, double);
+		void drawFrame(double);
 
 		~WindSock(void);
 };	// end WindSock
@@ -271,21 +507,22 @@ class Plant {
 		bool draw_tokens;
 		bool draw_charge;
 		bool draw_price;
-		int frame;
-		int muster_frame;
-		int line_frame;
 		int price_per_GW;
-		int pulse_frame;
 		int height;
 		int last_production_GWh;
 		int marble_counter;
-		int marble_frame;
 		int marble_iters;
 		int marbles_committed;
+		int marbles_released;
 		int n_blits;
 		int n_sprites;
 		int sprite_idx;
 		int width;
+		double frame;
+		double muster_frame;
+		double line_frame;
+		double pulse_frame;
+		double marble_frame;
 		double capacity_GW;
 		double position_x;
 		double position_y;
@@ -294,15 +531,28 @@ class Plant {
 		std::string texture_key;
 		std::vector<int> marbles_committed_vector;
 
+		PlantKind kind;
+
+		TextureId texture_id;
+		TextureId selected_texture_id;
+		TextureId marble_texture_id;
+		TextureId token_texture_id;
+		TextureId power_capacity_texture_id;
+		TextureId price_texture_id;
+		FontId bold_font_id;
+
 		sf::Color marble_colour;
 		sf::RenderWindow* window_ptr;
 
 		Assets* assets_ptr;
-		std::list<Steam*> steam_ptr_list;
-		std::list<Smoke*> smoke_ptr_list;
 		std::list<Marble*> marble_ptr_list;
 		std::list<sf::Sprite*> marble_sprite_ptr_list;
 
+		MarbleBatch muster_batch;
+
+		void setTextureKey(std::string);
+		void setKind(PlantKind);
+
 	public:
 		Plant(int, int, double, sf::RenderWindow*, Assets*);
 
@@ -312,7 +562,7 @@ class Plant {
 		int getMusteredMarbles(void);
 		int getPositionX(void);
 		int getPositionY(void);
-		int getTextureIndex(void);
+		PlantKind getKind(void);
 		int getMarblesCommitted(int);
 		double getCapacityGW(void);
 		int getPrice(void);
@@ -340,10 +590,12 @@ class Plant {
 		void drawTokens(void);
 		void drawCapacity(void);
 		void drawPrice(void);
-		virtual void drawMarbles(void);
+		virtual void updateMarbles(double);
+		virtual void emitSteam(ParticlePool*) {return;}
+		virtual void emitSmoke(ParticlePool*) {return;}
+		virtual void update(double, double, ParticlePool*);
+		virtual void drawMarbles(double, MarbleBatch*);
 		virtual void drawMusteredMarbles(void);
-		virtual void drawSteam(double) {return;}
-		virtual void drawSmoke(double) {return;}
 		virtual void drawFrame(bool, bool);
 		virtual double getProduction(double) {return 0;}
 		virtual void setEnergyCapacity(double) {return;}
@@ -372,8 +624,8 @@ class Coal : public Plant {
 	public:
 		Coal(int, int, double, sf::RenderWindow*, Assets*);
 
-		void drawSteam(double);
-		void drawSmoke(double);
+		void emitSteam(ParticlePool*);
+		void emitSmoke(ParticlePool*);
 
 		void incMarbles(void);
 		void decMarbles(void);
@@ -396,8 +648,8 @@ class Combined : public Plant {
 	public:
 		Combined(int, int, double, sf::RenderWindow*, Assets*);
 
-		void drawSteam(double);
-		void drawSmoke(double);
+		void emitSteam(ParticlePool*);
+		void emitSmoke(ParticlePool*);
 
 		void incMarbles(void);
 		void decMarbles(void);
@@ -420,7 +672,7 @@ class Fission : public Plant {
 	public:
 		Fission(int, int, double, sf::RenderWindow*, Assets*);
 
-		void drawSteam(double);
+		void emitSteam(ParticlePool*);
 
 		void incMarbles(void);
 		void decMarbles(void);
@@ -443,7 +695,8 @@ class Geothermal : public Plant {
 	public:
 		Geothermal(int, int, double, sf::RenderWindow*, Assets*);
 
-		void drawSteam(double);
+		void emitSteam(ParticlePool*);
+		void update(double, double, ParticlePool*);
 		void drawFrame(bool, bool);
 
 		void incMarbles(void);
@@ -498,7 +751,7 @@ class Peaker : public Plant {
 	public:
 		Peaker(int, int, double, sf::RenderWindow*, Assets*);
 
-		void drawSmoke(double);
+		void emitSmoke(ParticlePool*);
 
 		~Peaker(void);
 
@@ -573,6 +826,7 @@ class Tidal : public Plant {
 		void incMarbles(void) {return;}
 		void decMarbles(void) {return;}
 
+		void update(double, double, ParticlePool*);
 		void drawFrame(bool, bool);
 		double getProduction(double);
 		double getDesignSpeed(void);
@@ -599,6 +853,7 @@ class Wave : public Plant {
 		void incMarbles(void) {return;}
 		void decMarbles(void) {return;}
 
+		void update(double, double, ParticlePool*);
 		void drawFrame(bool, bool);
 		double getProduction(double);
 		double getDesignPeriod(void);
@@ -624,6 +879,7 @@ class Wind : public Plant {
 		void incMarbles(void) {return;}
 		void decMarbles(void) {return;}
 
+		void update(double, double, ParticlePool*);
 		void drawFrame(bool, bool);
 		double getProduction(double);
 		double getDesignSpeed(void);
@@ -705,7 +961,7 @@ class PictorialTutorial {
  private:
 
  protected:
-	 int frame;
+	 double frame;
 	 std::vector<int> heights;
 	 std::vector<int> n_sprites;
 	 std::vector<int> sprite_idx;
@@ -716,6 +972,10 @@ class PictorialTutorial {
 	 std::vector<double> rel_pos_y;
 	 std::vector<double> scales;
 	 std::vector<std::string> texture_keys;
+	 std::vector<TextureId> texture_ids;
+	 TextureId wasd_texture_id;
+	 TextureId spacebar_texture_id;
+	 FontId bold_font_id;
 	 std::vector<int> ws_indices;
 	 std::vector<int> ad_indices;
 	 std::vector<int> spacebar_indices;
@@ -736,6 +996,7 @@ class PictorialTutorial {
 
 	 void reset(void);
 
+	 void update(double);
 	 void drawFrame(int);
 
 	 void update(PhaseManager*, std::vector<Plant*>*);
@@ -761,7 +1022,7 @@ class DiceRoll {
  	 std::vector<int> spacebar_frame_vec;
 
  protected:
-	 int frame;
+	 double frame;
 	 int height;
 	 int n_sprites;
 	 int sprite_idx;
@@ -770,6 +1031,9 @@ class DiceRoll {
 	 double position_y;
 	 double scale;
 	 std::string texture_key;
+	 TextureId texture_id;
+	 TextureId spacebar_texture_id;
+	 FontId bold_font_id;
 
 	 sf::RenderWindow* window_ptr;
 
@@ -793,6 +1057,7 @@ class DiceRoll {
 
  	 void randDiceNum(void);
 
+	 void update(double, bool);
 	 void drawFrame(bool);
 
 	 ~DiceRoll(void);
@@ -809,11 +1074,15 @@ class Game {
 
 	private:
 		bool draw_frame_rate;
+		bool idle_flag;
 		bool music_paused;
+		bool record_flag;
 		bool powered_flag;
 		bool draw_energy_overlay;
 		bool draw_forecast_overlay;
 		bool can_defer_load;
+		bool solving_flag;	// (a solveOptimalDispatch() is in flight on solve_thread)
+		std::atomic<bool> solved_flag;
 		int frame;
 		int current_energy_demand_GWh;
 		int tidal_idx_offset;
@@ -822,9 +1091,18 @@ class Game {
 		int peaker_marbles;
 		int excess_dispatch_GWh;
 		int rolls_rem_corr;
+		int session_mode;
+		int session_phase;
+		int replay_speed;
+		int n_replay_divergences;
+		int steps_since_render;
+		int time_str_minutes;
+		int last_active_frame;
+		int prefetch_phase;
 		double cloud_cover_ratio;
 		double next_cloud_cover_ratio;
 		double dt_s;
+		double clock_offset_s;
 		double frame_time_s;
 		double hour_of_day;
 		double next_hour_of_day;
@@ -836,12 +1114,18 @@ class Game {
 		double wave_res_s;
 		double next_wave_res_s;
 		double score;
+		double optimal_score;
+		double score_str_score;
 		double fade_alpha;
 		std::vector<bool> key_vec;
 		std::vector<int> energy_demand_GWh_vec;
 		std::vector<int> actual_energy_demand_GWh_vec;
 		std::vector<double> tidal_res_ms_vec;
+		std::vector<double> chart_value_vec;	// (scratch, for energy_chart)
 		std::string points_str;
+		std::string score_str;	// (formatted only when score or time change)
+		std::string time_str;
+		std::string session_path;
 		std::map<std::string, int> forecast_map;
 
 		sf::Clock clock;
@@ -851,6 +1135,16 @@ class Game {
 		sf::Sprite clock_face_sprite;
 		sf::Sprite clock_hour_sprite;
 		sf::Sprite clock_minute_sprite;
+		sf::Text frame_rate_text;
+
+		FontId bold_font_id;
+		FontId teletype_font_id;
+		TextureId energy_demand_texture_id;
+		TextureId logo_texture_id;
+		TextureId solar_texture_id;
+		TextureId tidal_texture_id;	// (selection textures)
+		TextureId wave_texture_id;
+		TextureId wind_texture_id;
 
 		Assets assets;
 		OvercastClouds overcast_clouds;
@@ -861,19 +1155,48 @@ class Game {
 		DiceRoll dice_roll;
 		std::vector<Plant*> plant_ptr_vec;
 		SkyDisk sky_disk;
+		LayerCache back_layer;	// sky disk, overcast sky
+		LayerCache front_layer;	// smog dome, foreground + Plinko City
+		BarChart energy_chart;
 		TextBox text_box;
+		TextCache text_cache;
+		FramePacer frame_pacer;
 		WindSock wind_sock;
+		MarbleBatch marble_batch;
+		ParticlePool particle_pool;
+		ForecastKernel forecast_kernel;
+		ForecastAnalytic forecast_analytic;
+		DispatchSolver dispatch_solver;
+		std::thread solve_thread;	// (keeps the solve off the main thread)
+		SessionLog session_log;	// (replayed from)
+		SessionLog record_log;	// (recorded to)
+
+		double getRunTimeSeconds(void);
+		double getRenderRatio(void);
+		bool checkIdle(void);
+		bool renderDue(void);
+		void waitNextStep(void);
+		bool pollEvent(sf::Event*);
+		std::string getScoreString(void);
+		std::string getTimeString(void);
+		void displayFrame(void);
+		void logPhase(void);
+		void loadAssets(AssetLoader*);
+		void prefetchAssets(void);
 
 		void renderTitle(void);
 		void handleEvents(void);
 		void handleKeys(sf::Keyboard::Key, bool);
+		void renderBackground(double);
 		void renderOverlays(void);
 		void render(void);
 		void setHourDay(double);
 		void setPoweredFlag(bool);
 		void pushPlant(int, Plant*);
 		bool transition(void);
-		void update(void);
+		void solveOptimalDispatch(void);
+		void collectOptimalDispatch(void);
+		void update(double);
 		void plantInfo(int);
 		void reset(void);
 		void deferLoad(void);
@@ -890,12 +1213,21 @@ class Game {
 		//
 
 	public:
-		Game(sf::RenderWindow*);
+		Game(sf::RenderWindow*, AssetLoader* = NULL);
+
+		static void queueAssets(AssetLoader*);
 
 		void initPlants(void);
 		void clearPlants(void);
+		void recordSession(std::string);
+		void replaySession(const SessionLog&, int);
+		void setTargetFrameRate(double);
+		void setAssetBudget(double);
 		void run(void);
 
+		double getScore(void);
+		int getNumReplayDivergences(void);
+
 		void test1(void);
 
 		~Game(void);
@@ -0,0 +1,196 @@
+/*
+ *	Performance curve header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines compile-time generated, linearly interpolated lookup tables
+ *	for the dimensionless turbine performance curves, shared by every plant,
+ *	GridSimulator, and ForecastAnalytic (all through the *ProductionRatio()
+ *	functions of GridSimulator.h).
+ *
+ *	ERROR BOUND: linear interpolation on a uniform grid of step h is within
+ *	h^2 / 8 * max|f''| of the curve. With PERFORMANCE_CURVE_POINTS = 1024:
+ *
+ *		wind, turb_speed in [-0.76, 0]:	max|f''| = 12.35,	error <= 8.5e-7
+ *		wind, turb_speed in [0, 0.68]:	max|f''| = 3.01,	error <= 1.7e-7
+ *		tidal, turb_speed in [-0.71, 0]:	max|f''| = 2.68,	error <= 1.6e-7
+ *
+ *	i.e. under 1e-6 GWh per GW of capacity. The tables also check this at
+ *	compile time against their own midpoints (see static_assert below).
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef PERFORMANCECURVE_H
+#define PERFORMANCECURVE_H
+
+
+// -------- constants -------- //
+#define PERFORMANCE_CURVE_POINTS	1024
+#define PERFORMANCE_CURVE_TOLERANCE	1e-6
+
+
+// -------- function implementations (constexpr) -------- //
+
+constexpr double constexprExp(double x) {
+	/*
+	 *	Compile-time exp() (std::exp() is not constexpr): x = k ln 2 + r with
+	 *	|r| <= ln 2 / 2, Taylor series for e^r, then scale by 2^k
+	 */
+
+	const double ln_2 = 0.69314718055994530942;
+
+	int k = int(x / ln_2 + (x < 0 ? -0.5 : 0.5));
+	double r = x - k * ln_2;
+
+	double term = 1;
+	double sum = 1;
+	for (int n = 1; n < 30; n++) {
+		term *= r / n;
+		sum += term;
+	}
+
+	while (k > 0) {
+		sum *= 2;
+		k--;
+	}
+	while (k < 0) {
+		sum /= 2;
+		k++;
+	}
+
+	return sum;
+}	// end constexprExp()
+
+
+constexpr double windCurveLower(double turb_speed) {
+	return 1.03273 * constexprExp(-5.97588 * turb_speed * turb_speed) - 0.03273;
+}	// end windCurveLower()
+
+
+constexpr double windCurveUpper(double turb_speed) {
+	return 0.16154 * constexprExp(-9.30254 * turb_speed * turb_speed) + 0.83846;
+}	// end windCurveUpper()
+
+
+constexpr double tidalCurveLower(double turb_speed) {
+	return 1.69215 * constexprExp(1.25909 * turb_speed) - 0.69215;
+}	// end tidalCurveLower()
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- PerformanceCurve ---- //
+
+template <int N>
+class PerformanceCurve {
+	/*
+	 *	Class for a curve tabulated at N uniform points on [x_min, x_max] at
+	 *	compile time, and linearly interpolated at run time
+	 */
+
+	private:
+		double x_min;
+		double x_max;
+		double step;
+		double inv_step;
+		double table[N] = {};
+
+	protected:
+		//
+
+	public:
+		template <typename F>
+		constexpr PerformanceCurve(double x_min, double x_max, F curve) :
+		x_min(x_min),
+		x_max(x_max),
+		step((x_max - x_min) / (N - 1)),
+		inv_step((N - 1) / (x_max - x_min))
+		{
+			for (int i = 0; i < N; i++) {
+				this->table[i] = curve(x_min + i * this->step);
+			}
+		}
+
+		constexpr double evaluate(double x) const {
+			/*
+			 *	Method to interpolate the curve at x (clamped to [x_min, x_max])
+			 */
+
+			if (x <= this->x_min) {
+				return this->table[0];
+			}
+			if (x >= this->x_max) {
+				return this->table[N - 1];
+			}
+
+			double position = (x - this->x_min) * this->inv_step;
+			int i = int(position);
+			if (i > N - 2) {
+				i = N - 2;
+			}
+			double frac = position - i;
+
+			return this->table[i] + frac * (this->table[i + 1] - this->table[i]);
+		}
+
+		template <typename F>
+		constexpr double getMidpointError(F curve) const {
+			/*
+			 *	Method to get the max interpolation error at cell midpoints
+			 *	(where linear interpolation error peaks)
+			 */
+
+			double max_error = 0;
+			for (int i = 0; i < N - 1; i++) {
+				double x = this->x_min + (i + 0.5) * this->step;
+				double error = this->evaluate(x) - curve(x);
+				if (error < 0) {
+					error = -error;
+				}
+				if (error > max_error) {
+					max_error = error;
+				}
+			}
+			return max_error;
+		}
+
+};	// end PerformanceCurve
+
+
+// -------- tables -------- //
+
+inline constexpr PerformanceCurve<PERFORMANCE_CURVE_POINTS> WIND_CURVE_LOWER(
+	-0.76, 0, windCurveLower
+);
+inline constexpr PerformanceCurve<PERFORMANCE_CURVE_POINTS> WIND_CURVE_UPPER(
+	0, 0.68, windCurveUpper
+);
+inline constexpr PerformanceCurve<PERFORMANCE_CURVE_POINTS> TIDAL_CURVE_LOWER(
+	-0.71, 0, tidalCurveLower
+);
+
+static_assert(
+	WIND_CURVE_LOWER.getMidpointError(windCurveLower) < PERFORMANCE_CURVE_TOLERANCE,
+	"wind (lower) performance table exceeds tolerance"
+);
+static_assert(
+	WIND_CURVE_UPPER.getMidpointError(windCurveUpper) < PERFORMANCE_CURVE_TOLERANCE,
+	"wind (upper) performance table exceeds tolerance"
+);
+static_assert(
+	TIDAL_CURVE_LOWER.getMidpointError(tidalCurveLower) < PERFORMANCE_CURVE_TOLERANCE,
+	"tidal performance table exceeds tolerance"
+);
+
+
+#endif
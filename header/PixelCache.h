@@ -0,0 +1,118 @@
+/*
+ *	Pixel cache header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the pixel cache, an on-disk cache of decoded images (RGBA,
+ *	8 bits per channel) so that PNGs are decoded on first launch only. Later
+ *	launches map the cache and upload pixels straight from the mapping.
+ *
+ *	Entries are keyed by source path and checked against a hash of the
+ *	source file bytes, so a changed PNG misses (and is decoded and cached
+ *	again) without any manual invalidation. A cache of another version is
+ *	ignored, and the cache is only rewritten when something missed: once
+ *	after startup, and again at shutdown (for lazily loaded images), which
+ *	keeps only the entries used that run.
+ *
+ *	File format (little endian):
+ *
+ *		"MMPC", version (1 byte), 3 bytes reserved, n_entries (4 bytes), then
+ *		per entry: source hash (8 bytes, FNV-1a), width (4 bytes), height
+ *		(4 bytes), offset (8 bytes), path length (2 bytes), path, then the
+ *		pixel data (width * height * 4 bytes per entry), each entry starting
+ *		on an ASSET_PACK_ALIGNMENT byte boundary
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef PIXELCACHE_H
+#define PIXELCACHE_H
+
+
+// -------- includes -------- //
+#include "AssetPack.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- PixelCacheEntry ---- //
+
+struct PixelCacheEntry {
+	/*
+	 *	One decoded image, either in the mapped cache file or stored this run
+	 */
+
+	std::string path;
+	unsigned long long source_hash;
+	unsigned int width;
+	unsigned int height;
+
+	const char* pixels_ptr;		// (into the mapping, or into pixel_str)
+	std::string pixel_str;		// (stored this run only)
+	bool used_flag;
+
+};	// end PixelCacheEntry
+
+
+// ---- PixelCache ---- //
+
+class PixelCache {
+	/*
+	 *	Class to look up and store decoded images, and to write them back
+	 *	(lookups and stores are thread safe, e.g. for AssetLoader workers)
+	 */
+
+	private:
+		bool dirty_flag;
+		int n_hits;
+		int n_misses;
+		std::string cache_path;
+		MappedFile mapped_file;
+
+		std::vector<PixelCacheEntry*> entry_ptr_vec;
+		std::unordered_map<std::string, int> entry_map;	// path to entry_ptr_vec index
+		std::mutex entry_mutex;
+
+		void clear(void);
+
+	protected:
+		//
+
+	public:
+		PixelCache(void);
+
+		static unsigned long long hashBytes(const char*, size_t);
+
+		void open(std::string);
+		const char* find(const std::string&, unsigned long long, unsigned int*, unsigned int*);
+		void store(const std::string&, unsigned long long, unsigned int, unsigned int, const unsigned char*);
+		bool save(bool);
+
+		int getNumEntries(void);
+		int getNumHits(void);
+		int getNumMisses(void);
+
+		~PixelCache(void);
+
+};	// end PixelCache
+
+
+// -------- function prototypes (process-wide cache) -------- //
+PixelCache& pixelCache(void);
+
+
+#endif
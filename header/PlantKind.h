@@ -0,0 +1,108 @@
+/*
+ *	Plant kind header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the plant kinds (one byte each, so type checks in per-frame
+ *	loops are single compares) and a compile-time descriptor table holding
+ *	everything that varies by kind: name, textures, info text, price,
+ *	emissions, and marble colour. Plants, GridSimulator, and the optimizers
+ *	all read from this one table.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef PLANTKIND_H
+#define PLANTKIND_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+
+
+// -------- enums -------- //
+
+enum PlantKind : signed char {
+	PLANT_NULL = -1,	// empty slot
+	PLANT_COAL,
+	PLANT_COMBINED,
+	PLANT_FISSION,
+	PLANT_GEOTHERMAL,
+	PLANT_HYDRO,
+	PLANT_PEAKER,
+	PLANT_SOLAR,
+	PLANT_STORAGE,
+	PLANT_TIDAL,
+	PLANT_WAVE,
+	PLANT_WIND,
+	N_PLANT_TYPES
+};
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- PlantDescriptor ---- //
+
+struct PlantDescriptor {
+	/*
+	 *	Everything that varies by plant kind
+	 */
+
+	const char* name;					// as displayed (e.g. chart legends)
+	const char* texture_key;			// in play
+	const char* selection_texture_key;	// during plant selection
+	const char* info_text;				// plant info text box
+
+	int tokens_per_GW;
+	double emission_points;		// score penalty per marble dispatched
+	double smog_per_marble;
+
+	unsigned char marble_rgba[4];
+
+};	// end PlantDescriptor
+
+
+// -------- constants -------- //
+
+constexpr PlantDescriptor PLANT_NULL_DESCRIPTOR = {
+	"", "null", "null", "", TOKENS_PER_GW, 0, 0, {255, 255, 255, 255}
+};
+
+constexpr PlantDescriptor PLANT_DESCRIPTORS[N_PLANT_TYPES] = {
+	{"Coal", "coal", "coal", TEXT_COAL, TOKENS_PER_GW, 1, 0.001, {25, 4, 1, 255}},
+	{"Combined", "combined", "combined", TEXT_COMBINED, TOKENS_PER_GW, 0.5, 0.0005, {217, 88, 34, 255}},
+	{"Fission", "fission", "fission", TEXT_FISSION, FISSION_TOKENS_PER_GW, 0, 0, {0, 255, 0, 255}},
+	{"Geothermal", "geothermal", "geothermal", TEXT_GEOTHERMAL, TOKENS_PER_GW, 0, 0, {196, 161, 26, 255}},
+	{"Hydro", "hydro", "hydro", TEXT_HYDRO, TOKENS_PER_GW, 0, 0, {0, 80, 255, 255}},
+	{"Peaker", "peaker", "peaker", TEXT_PEAKER, PEAKER_TOKENS_PER_GW, 0.75, 0.00075, {255, 0, 0, 255}},
+	{"Solar", "solar", "solar", TEXT_SOLAR, TOKENS_PER_GW, 0, 0, {255, 246, 115, 255}},
+	{"Storage", "storage", "storage", TEXT_STORAGE, STORAGE_TOKENS_PER_GW, 0, 0, {75, 150, 75, 255}},
+	{"Tidal", "tidal", "tidal selection", TEXT_TIDAL, TOKENS_PER_GW, 0, 0, {6, 143, 252, 255}},
+	{"Wave", "wave", "wave selection", TEXT_WAVE, TOKENS_PER_GW, 0, 0, {255, 0, 255, 255}},
+	{"Wind", "wind", "wind selection", TEXT_WIND, TOKENS_PER_GW, 0, 0, {104, 194, 255, 255}}
+};
+
+
+// -------- function implementations (constexpr) -------- //
+
+constexpr const PlantDescriptor& plantDescriptor(int kind) {
+	/*
+	 *	Descriptor of the given plant kind (anything out of range, including
+	 *	PLANT_NULL, gets the empty slot's descriptor)
+	 */
+
+	return (kind >= 0 && kind < N_PLANT_TYPES) ?
+		PLANT_DESCRIPTORS[kind] : PLANT_NULL_DESCRIPTOR;
+}	// end plantDescriptor()
+
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ *	Portfolio optimizer header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the capacity phase portfolio optimizer (--optimize mode). It
+ *	searches every way of spending TOTAL_TOKENS on up to six distinct plant
+ *	types, scores each portfolio over the same N sampled days (common random
+ *	numbers, see RandomSubsystem), and reports the Pareto front of expected
+ *	score versus expected emissions.
+ *
+ *	The search is a branch-and-bound over portfolios, types added in index
+ *	order. A node is pruned when an optimistic bound on every portfolio in
+ *	its subtree (score from above, emissions from below) is dominated by the
+ *	front found so far. The bound is built from per-day scenario profiles
+ *	(demand, renewable production ratios, geothermal rolls), which are
+ *	simulated once and memoized, so bounding a node costs no simulation:
+ *
+ *		- any hour the subtree cannot cover (capacity + remaining tokens)
+ *		  scores at most -unmet instead of +demand
+ *		- any demand not covered by clean capacity + remaining tokens costs
+ *		  at least the cheapest fossil penalty available to the subtree
+ *		- renewable production above demand + storage is excess
+ *
+ *	Portfolio evaluation races the same bound: days are simulated one at a
+ *	time, and stopped as soon as the rest of the days cannot lift the
+ *	portfolio onto the front. Subtrees are evaluated in parallel on the batch
+ *	runner's work stealing pool.
+ *
+ *	Emissions are counted as the game's smog weights (coal 1, combined 0.5,
+ *	peaker 0.75 per marble), which are also its score penalties.
+ *
+ *	Usage: --optimize <n_days> [token_step], where token_step > 1 only tries
+ *	investments in multiples of token_step units (much smaller tree). The
+ *	front is written to optimizer_front.csv.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef PORTFOLIOOPTIMIZER_H
+#define PORTFOLIOOPTIMIZER_H
+
+
+// -------- includes -------- //
+#include "constants.h"
+#include "BatchRunner.h"
+#include "GridSimulator.h"
+#include "Random.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+// -------- constants -------- //
+#define OPTIMIZER_MAX_SLOTS		6
+#define OPTIMIZER_MAX_GEO_SETS	(TOTAL_TOKENS / CAPACITY_PER_GEOTHERMAL_ROLL)
+
+
+// -------- typedefs -------- //
+typedef std::array<int, N_PLANT_TYPES> TokenVector;	// tokens per plant type
+
+
+// -------- function prototypes -------- //
+int tokensPerUnit(int);
+void runOptimizer(int, int);
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- ScenarioProfile ---- //
+
+struct ScenarioProfile {
+	/*
+	 *	Portfolio independent data of one sampled day (simulated once)
+	 */
+
+	unsigned long long seed;
+	int demand_GWh[HOURS_PER_GAME];
+	double production_ratio[N_PLANT_TYPES][HOURS_PER_GAME];	// renewables only, smog free
+	int geothermal_GW[OPTIMIZER_MAX_GEO_SETS + 1];				// by number of roll sets
+
+};	// end ScenarioProfile
+
+
+// ---- PortfolioNode ---- //
+
+struct PortfolioNode {
+	/*
+	 *	Search tree node (a portfolio, and its capacity over every sampled
+	 *	hour, built incrementally from its parent's)
+	 */
+
+	TokenVector tokens;
+	int last_type;
+	int n_slots;
+	int tokens_used;
+	int fossil_GW;
+	int peaker_GW;
+	int storage_GW;
+	std::vector<int> clean_GWh;			// (day, hour), max clean dispatch
+	std::vector<int> must_take_GWh;		// (day, hour), non-solar renewables
+
+};	// end PortfolioNode
+
+
+// ---- PortfolioScore ---- //
+
+struct PortfolioScore {
+	/*
+	 *	Expected performance of a portfolio over the sampled days
+	 */
+
+	TokenVector tokens;
+	double score;
+	double emissions;
+	double unmet_demand_GWh;
+
+};	// end PortfolioScore
+
+
+// ---- PortfolioOptimizer ---- //
+
+class PortfolioOptimizer {
+	/*
+	 *	Class to search the capacity phase for the score/emissions Pareto front
+	 */
+
+	private:
+		int n_days;
+		int n_threads;
+		int token_step;
+		unsigned long long seed;
+		bool peaker_in_merit_order;
+		std::vector<int> merit_order;
+		std::vector<ScenarioProfile> profile_vec;
+
+		std::mutex front_mutex;
+		std::vector<PortfolioScore> front_vec;
+
+		std::atomic<long long> n_nodes;
+		std::atomic<long long> n_pruned;
+		std::atomic<long long> n_evaluated;
+		std::atomic<long long> n_raced;
+		std::atomic<long long> n_days_simulated;
+
+		void buildProfiles(void);
+
+		PortfolioNode makeChild(const PortfolioNode&, int, int);
+		int getReserveTokens(const PortfolioNode&);
+		double getFossilWeight(const PortfolioNode&, int);
+		void boundDay(const PortfolioNode&, int, int, double*, double*);
+		void bound(const PortfolioNode&, int, double*, double*);
+
+		bool isDominated(double, double);
+		void offer(const PortfolioScore&);
+		void evaluate(const PortfolioNode&, GridSimulator*);
+		void search(const PortfolioNode&, GridSimulator*);
+
+	protected:
+		//
+
+	public:
+		PortfolioOptimizer(int, unsigned long long, int, int);
+
+		void setMeritOrder(const std::vector<int>&);
+		void run(void);
+
+		std::string getPortfolioString(const TokenVector&);
+		const std::vector<int>& getMeritOrder(void);
+		const std::vector<PortfolioScore>& getFront(void);
+		void writeFront(std::string);
+
+		~PortfolioOptimizer(void);
+
+};	// end PortfolioOptimizer
+
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ *	Random number header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the random number service that replaces the C rand(). All
+ *	draws come from counter-based streams: output i of a stream is a pure
+ *	function of (key, i), so a stream has no hidden shared state, can be
+ *	filled in bulk, and can be jumped to any position.
+ *
+ *	Each subsystem (weather, dice, particles, ...) gets its own stream, keyed
+ *	from the one game seed, so e.g. cosmetic particles never perturb the
+ *	weather. Worker threads take their own streams via deriveStream().
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+
+// -------- includes -------- //
+#include <cstddef>
+#include <vector>
+
+
+// -------- enums -------- //
+
+enum RandomSubsystem {
+	RNG_WEATHER,		// wind, cloud cover, and sea state Markov steps
+	RNG_TIDAL,			// tidal table offset and tidal speed noise
+	RNG_DEMAND,			// hourly demand noise
+	RNG_WAVE,			// Rayleigh wave height (Wave::getProduction())
+	RNG_DICE,			// geothermal dice
+	RNG_FORECAST,		// forecast Monte Carlo trials
+	RNG_PARTICLES,		// steam and smoke spawning (cosmetic)
+	RNG_CLOUDS,			// overcast cloud spawning (cosmetic)
+	RNG_WINDSOCK,		// wind sock flutter (cosmetic)
+	RNG_BATCH,			// batch runner game seeds
+	N_RNG_SUBSYSTEMS
+};
+
+
+// -------- function prototypes -------- //
+unsigned long long mixBits(unsigned long long);
+unsigned long long deriveSeed(unsigned long long, unsigned long long, unsigned long long);
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- RandomStream ---- //
+
+class RandomStream {
+	/*
+	 *	Class for a counter-based random stream (SplitMix64 output function
+	 *	applied to key + counter * gamma)
+	 */
+
+	private:
+		unsigned long long key;
+		unsigned long long counter;
+
+	protected:
+		//
+
+	public:
+		RandomStream(void);
+		RandomStream(unsigned long long);
+
+		unsigned long long getKey(void);
+		unsigned long long getCounter(void);
+		void setCounter(unsigned long long);
+
+		unsigned long long nextBits(void);
+		double uniform(void);
+		float uniformFloat(void);
+		int uniformInt(int, int);
+
+		void fill(float*, size_t);
+		void fill(double*, size_t);
+		void fill(std::vector<float>*);
+
+		~RandomStream(void);
+
+};	// end RandomStream
+
+
+// ---- RandomService ---- //
+
+class RandomService {
+	/*
+	 *	Class to own the game seed and one stream per subsystem
+	 *
+	 *	ASSUMPTION: getStream() streams belong to the main thread; other
+	 *	threads must use deriveStream() (which is const, so thread safe)
+	 */
+
+	private:
+		unsigned long long game_seed;
+		std::vector<RandomStream> stream_vec;
+
+	protected:
+		//
+
+	public:
+		RandomService(unsigned long long);
+
+		void reseed(unsigned long long);
+		unsigned long long getSeed(void);
+		RandomStream& getStream(int);
+		RandomStream deriveStream(int, unsigned long long) const;
+
+		~RandomService(void);
+
+};	// end RandomService
+
+
+// -------- function prototypes (process-wide service) -------- //
+RandomService& randomService(void);
+RandomStream& randomStream(int);
+
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ *	Session log header for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	This defines the session log, a compact record of one play session: the
+ *	game seed, plus every key event and phase transition tagged with the frame
+ *	it happened on. Since all game randomness derives from the seed and the
+ *	game advances one fixed step per frame, feeding the key events back on
+ *	the same frames re-simulates the session exactly.
+ *
+ *	File format (little endian, varint = LEB128, signed values zigzagged):
+ *
+ *		"MMSR", version (1 byte), seed (8 bytes), n_events (varint), then per
+ *		event: type (1 byte), frame - last frame (varint), value (varint)
+ *
+ *	so a key event is usually 3 bytes.
+ *
+ *	NOTE: nothing in here may include SFML (i.e. do not include includes.h).
+ *
+ */
+
+
+#ifndef SESSION_H
+#define SESSION_H
+
+
+// -------- includes -------- //
+#include <string>
+#include <vector>
+
+
+// -------- enums -------- //
+
+enum SessionMode {
+	SESSION_OFF,
+	SESSION_RECORD,
+	SESSION_REPLAY
+};
+
+
+enum SessionEventType {
+	SESSION_KEY_PRESS,		// value = key code
+	SESSION_KEY_RELEASE,	// value = key code
+	SESSION_PHASE,			// value = new phase
+	SESSION_END,			// value = final score, in quarter points
+	N_SESSION_EVENT_TYPES
+};
+
+
+// -------- class structures & interfaces -------- //
+
+
+// ---- SessionEvent ---- //
+
+struct SessionEvent {
+	/*
+	 *	One logged event
+	 */
+
+	int frame;
+	int type;
+	int value;
+
+};	// end SessionEvent
+
+
+// ---- SessionLog ---- //
+
+class SessionLog {
+	/*
+	 *	Class to record, store, and play back a session
+	 */
+
+	private:
+		unsigned long long seed;
+		size_t replay_idx;
+		std::vector<SessionEvent> event_vec;
+
+	protected:
+		//
+
+	public:
+		SessionLog(void);
+
+		void reset(unsigned long long);
+		void pushEvent(int, int, int);
+
+		void write(std::string);
+		void read(std::string);
+
+		void rewind(void);
+		bool nextEvent(int, SessionEvent*);
+		bool hasEvent(int, int, int);
+
+		unsigned long long getSeed(void);
+		int getNumEvents(void);
+		SessionEvent getEvent(int);
+
+		~SessionLog(void);
+
+};	// end SessionLog
+
+
+#endif
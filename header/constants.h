@@ -23,6 +23,9 @@
 #define FRAMES_PER_BLIT		5.0
 #define	SECONDS_PER_FRAME	1.0 / 60.0
 #define FRAMES_PER_SECOND	60.0
+#define MAX_STEPS_PER_RENDER	6	// fixed steps per render, before the game slows down instead
+#define IDLE_STEPS_PER_RENDER	6	// fixed steps per render once idle, i.e. 10 fps (see Game::checkIdle())
+#define IDLE_DELAY_SECONDS	3.0	// [s] without input or animation before going idle
 
 #define SCREEN_WIDTH		1280.0 //1024.0
 #define SCREEN_HEIGHT		960.0  //768.0
@@ -30,6 +33,7 @@
 #define GW_PER_TOKEN  1
 #define TOTAL_TOKENS  36
 //#define STORAGE_TOKENS_PER_GW  2
+#define TOKENS_PER_GW	1	// (plants without their own token price below)
 #define FISSION_TOKENS_PER_GW	2
 #define PEAKER_TOKENS_PER_GW	2
 #define STORAGE_TOKENS_PER_GW	3
@@ -39,21 +43,29 @@
 #define MAX_FISSION_CAPACITY	999		// remove upper bounds, pricing to enforce
 #define MAX_PEAKER_CAPACITY		999		// remove upper bounds, pricing to enforce
 
+// plant kinds (PLANT_NULL, PLANT_COAL, ..., N_PLANT_TYPES): see PlantKind.h
+
+#define HOURS_PER_GAME		24
+#define FORECAST_TRIALS		65536	// Monte Carlo trials per forecast (see ForecastKernel)
+#define FORECAST_ANALYTIC	true	// quadrature forecasts where available (see ForecastAnalytic)
+#define PARTICLE_POOL_CAPACITY	8192	// steam and smoke particles, across all plants
+#define ATLAS_PAGE_SIZE		2048	// texture atlas page width [px] (capped at the GPU maximum)
+#define ATLAS_PADDING		2		// [px] between atlas rects
+#define ASSET_PACK_PATH		"assets.mmpk"	// used in place of the loose asset files, if present (see AssetPack)
+#define ASSET_PACK_ALIGNMENT	64		// [bytes] asset pack entry alignment
+#define PIXEL_CACHE_PATH	"pixels.mmpc"	// decoded images, written on first launch (see PixelCache)
+#define ASSET_UPLOAD_BUDGET_S	0.008	// [s] of decoded asset uploads per loading screen frame (see AssetLoader)
+#define ASSET_RESIDENCY_BUDGET_MB	8	// [MB] of lazily loaded assets kept resident (see Assets)
+#define ASSET_PREFETCH_HOLD_FRAMES	600	// prefetched assets are not evicted for this long (see Assets)
+#define TEXT_CACHE_MAX_IDLE_FRAMES	120	// overlay texts not drawn for this long are evicted (see TextCache)
+#define FRAME_PACER_SPIN_TAIL_S	0.002	// [s] spun (not slept) before each frame deadline, without vsync (see FramePacer)
+#define BENCHMARK_REPETITIONS	9		// timed repetitions per benchmark, reported as median and spread (see runBenchmarks())
+
 // SFML-specific constants
 
-#define MARBLE_COLOUR_COAL				sf::Color(25, 4, 1, 255)
-#define MARBLE_COLOUR_COMBINED			sf::Color(217, 88, 34, 255)
-#define MARBLE_COLOUR_FISSION			sf::Color(0, 255, 0, 255)
-#define MARBLE_COLOUR_GEOTHERMAL		sf::Color(196, 161, 26, 255)
 #define MARBLE_COLOUR_GLASS				sf::Color(224, 242, 241, 32)
 #define MARBLE_COLOUR_GLASS_MUSTER		sf::Color(224, 242, 241, 128)
-#define MARBLE_COLOUR_HYDRO				sf::Color(0, 80, 255, 255)
-#define MARBLE_COLOUR_PEAKER			sf::Color(255, 0, 0, 255)
-#define MARBLE_COLOUR_SOLAR				sf::Color(255, 246, 115, 255)
-#define MARBLE_COLOUR_STORAGE			sf::Color(75, 150, 75, 255)
-#define MARBLE_COLOUR_TIDAL				sf::Color(6, 143, 252, 255)
-#define MARBLE_COLOUR_WAVE				sf::Color(255, 0, 255, 255)
-#define MARBLE_COLOUR_WIND				sf::Color(104, 194, 255, 255)
+#define MARBLE_GLASS_POINTS				30	// same as sf::CircleShape
 
 #define TEXT_BOX_BACK_COLOUR			sf::Color(0, 86, 255, 240)
 #define TEXT_BOX_OUTLINE_COLOUR			sf::Color(128, 122, 138, 255)
@@ -0,0 +1,451 @@
+/*
+ *	Asset pack implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the asset pack (see AssetPack.h for the file format).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/AssetPack.h"
+#include "../header/ByteOrder.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+	#define NOMINMAX
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+
+// -------- constants -------- //
+static const char ASSET_PACK_MAGIC[4] = {'M', 'M', 'P', 'K'};
+static const unsigned char ASSET_PACK_VERSION = 1;
+static const size_t ASSET_PACK_HEADER_SIZE = 12;
+static const size_t ASSET_PACK_TOC_ENTRY_SIZE = 18;	// (plus path)
+
+
+// -------- class implementations -------- //
+
+
+// ---- MappedFile ---- //
+
+MappedFile::MappedFile(void) {
+	/*
+	 *	Constructor for MappedFile class
+	 */
+
+	this->data_ptr = NULL;
+	this->data_size = 0;
+
+#ifdef _WIN32
+	this->file_handle = NULL;
+	this->mapping_handle = NULL;
+#endif
+
+	return;
+}	// end MappedFile::MappedFile()
+
+
+void MappedFile::open(std::string path) {
+	/*
+	 *	Method to map the given file, read only
+	 */
+
+	this->close();
+
+	std::stringstream error_ss;
+	error_ss << "EXCEPTION: MappedFile::open(): Cannot map \"" << path << "\"";
+
+#ifdef _WIN32
+	HANDLE file_handle = CreateFileA(
+		path.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		NULL,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL,
+		NULL
+	);
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		error_ss << " (cannot open).";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0) {
+		CloseHandle(file_handle);
+		error_ss << " (empty, or cannot get size).";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	HANDLE mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	void* view_ptr = NULL;
+	if (mapping_handle != NULL) {
+		view_ptr = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+	}
+	if (view_ptr == NULL) {
+		if (mapping_handle != NULL) {
+			CloseHandle(mapping_handle);
+		}
+		CloseHandle(file_handle);
+		error_ss << ".";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->file_handle = file_handle;
+	this->mapping_handle = mapping_handle;
+	this->data_ptr = (const char*)view_ptr;
+	this->data_size = file_size.QuadPart;
+#else
+	int file_descriptor = ::open(path.c_str(), O_RDONLY);
+	if (file_descriptor < 0) {
+		error_ss << " (cannot open).";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	struct stat file_stat;
+	if (fstat(file_descriptor, &file_stat) != 0 || file_stat.st_size == 0) {
+		::close(file_descriptor);
+		error_ss << " (empty, or cannot get size).";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	void* view_ptr = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+	::close(file_descriptor);	// (the mapping holds its own reference)
+	if (view_ptr == MAP_FAILED) {
+		error_ss << ".";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->data_ptr = (const char*)view_ptr;
+	this->data_size = file_stat.st_size;
+#endif
+
+	return;
+}	// end MappedFile::open()
+
+
+void MappedFile::close(void) {
+	/*
+	 *	Method to unmap the file (if mapped)
+	 */
+
+	if (this->data_ptr == NULL) {
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(this->data_ptr);
+	CloseHandle(this->mapping_handle);
+	CloseHandle(this->file_handle);
+	this->file_handle = NULL;
+	this->mapping_handle = NULL;
+#else
+	munmap((void*)this->data_ptr, this->data_size);
+#endif
+
+	this->data_ptr = NULL;
+	this->data_size = 0;
+
+	return;
+}	// end MappedFile::close()
+
+
+bool MappedFile::isOpen(void) {
+	return this->data_ptr != NULL;
+}	// end MappedFile::isOpen()
+
+
+const char* MappedFile::getData(void) {
+	return this->data_ptr;
+}	// end MappedFile::getData()
+
+
+unsigned long long MappedFile::getSize(void) {
+	return this->data_size;
+}	// end MappedFile::getSize()
+
+
+MappedFile::~MappedFile(void) {
+	this->close();
+	return;
+}	// end MappedFile::~MappedFile()
+
+
+// ---- AssetPack ---- //
+
+AssetPack::AssetPack(void) {
+	/*
+	 *	Constructor for AssetPack class
+	 */
+
+	this->pack_path = "";
+	return;
+}	// end AssetPack::AssetPack()
+
+
+int AssetPack::build(std::string root_dir, std::string out_path) {
+	/*
+	 *	Method to pack every file under root_dir into a pack at out_path
+	 *	(written beside it, then renamed into place, so an existing pack is
+	 *	replaced atomically); returns the number of files packed
+	 */
+
+	std::vector<std::string> path_vec;
+	for (
+		const std::filesystem::directory_entry& dir_entry :
+		std::filesystem::recursive_directory_iterator(root_dir)
+	) {
+		if (dir_entry.is_regular_file()) {
+			path_vec.push_back(dir_entry.path().generic_string());
+		}
+	}
+	std::sort(path_vec.begin(), path_vec.end());
+
+	// lay out table of contents, then entries
+	std::vector<AssetPackEntry> entry_vec;
+	unsigned long long offset = ASSET_PACK_HEADER_SIZE;
+	for (size_t i = 0; i < path_vec.size(); i++) {
+		if (path_vec[i].size() > 0xFFFF) {
+			std::stringstream error_ss;
+			error_ss << "EXCEPTION: AssetPack::build(): Path too long \"" <<
+				path_vec[i] << "\".";
+			throw std::runtime_error(error_ss.str());
+		}
+		offset += ASSET_PACK_TOC_ENTRY_SIZE + path_vec[i].size();
+	}
+
+	for (size_t i = 0; i < path_vec.size(); i++) {
+		AssetPackEntry entry;
+		entry.path = path_vec[i];
+		entry.offset = alignUp(offset, ASSET_PACK_ALIGNMENT);
+		entry.size = std::filesystem::file_size(path_vec[i]);
+		entry_vec.push_back(entry);
+
+		offset = entry.offset + entry.size;
+	}
+
+	std::string bytes(ASSET_PACK_MAGIC, 4);
+	bytes.push_back(char(ASSET_PACK_VERSION));
+	writeLE(&bytes, 0, 3);
+	writeLE(&bytes, entry_vec.size(), 4);
+	for (size_t i = 0; i < entry_vec.size(); i++) {
+		writeLE(&bytes, entry_vec[i].offset, 8);
+		writeLE(&bytes, entry_vec[i].size, 8);
+		writeLE(&bytes, entry_vec[i].path.size(), 2);
+		bytes += entry_vec[i].path;
+	}
+
+	// write
+	std::string tmp_path = out_path + ".tmp";
+	{
+		std::ofstream out_stream(tmp_path, std::ios::binary);
+		if (!out_stream.is_open()) {
+			std::stringstream error_ss;
+			error_ss << "EXCEPTION: AssetPack::build(): Cannot open \"" <<
+				tmp_path << "\" for writing.";
+			throw std::runtime_error(error_ss.str());
+		}
+		out_stream.write(bytes.data(), bytes.size());
+
+		for (size_t i = 0; i < entry_vec.size(); i++) {
+			std::ifstream in_stream(entry_vec[i].path, std::ios::binary);
+			std::string data(
+				(std::istreambuf_iterator<char>(in_stream)),
+				std::istreambuf_iterator<char>()
+			);
+			if (!in_stream.good() && !in_stream.eof()) {
+				std::stringstream error_ss;
+				error_ss << "EXCEPTION: AssetPack::build(): Cannot read \"" <<
+					entry_vec[i].path << "\".";
+				throw std::runtime_error(error_ss.str());
+			}
+
+			std::string padding(entry_vec[i].offset - out_stream.tellp(), '\0');
+			out_stream.write(padding.data(), padding.size());
+			out_stream.write(data.data(), data.size());
+		}
+
+		if (!out_stream.good()) {
+			std::stringstream error_ss;
+			error_ss << "EXCEPTION: AssetPack::build(): Cannot write \"" <<
+				tmp_path << "\".";
+			throw std::runtime_error(error_ss.str());
+		}
+	}
+	std::filesystem::rename(tmp_path, out_path);
+
+	std::cout << "asset pack: " << entry_vec.size() << " files from \"" <<
+		root_dir << "\" packed into \"" << out_path << "\" (" << offset <<
+		" bytes)" << std::endl;
+
+	return entry_vec.size();
+}	// end AssetPack::build()
+
+
+void AssetPack::open(std::string path) {
+	/*
+	 *	Method to map the pack at the given path and read its table of
+	 *	contents (see AssetPack.h for format)
+	 */
+
+	this->close();
+	this->mapped_file.open(path);
+
+	const char* data_ptr = this->mapped_file.getData();
+	unsigned long long data_size = this->mapped_file.getSize();
+
+	std::stringstream error_ss;
+	error_ss << "EXCEPTION: AssetPack::open(): \"" << path << "\" ";
+
+	if (
+		data_size < ASSET_PACK_HEADER_SIZE ||
+		std::string(data_ptr, 4).compare(0, 4, ASSET_PACK_MAGIC, 4) != 0
+	) {
+		this->mapped_file.close();
+		error_ss << "is not an asset pack.";
+		throw std::runtime_error(error_ss.str());
+	}
+	if ((unsigned char)data_ptr[4] != ASSET_PACK_VERSION) {
+		error_ss << "has unsupported version " << int((unsigned char)data_ptr[4]) << ".";
+		this->mapped_file.close();
+		throw std::runtime_error(error_ss.str());
+	}
+
+	unsigned long long n_entries = readLE(data_ptr + 8, 4);
+	unsigned long long idx = ASSET_PACK_HEADER_SIZE;
+	for (unsigned long long i = 0; i < n_entries; i++) {
+		if (idx + ASSET_PACK_TOC_ENTRY_SIZE > data_size) {
+			this->mapped_file.close();
+			this->entry_vec.clear();
+			error_ss << "is truncated (entry " << i << " of " << n_entries << ").";
+			throw std::runtime_error(error_ss.str());
+		}
+
+		AssetPackEntry entry;
+		entry.offset = readLE(data_ptr + idx, 8);
+		entry.size = readLE(data_ptr + idx + 8, 8);
+		size_t path_length = readLE(data_ptr + idx + 16, 2);
+		idx += ASSET_PACK_TOC_ENTRY_SIZE;
+
+		if (
+			idx + path_length > data_size ||
+			entry.offset > data_size ||
+			entry.size > data_size - entry.offset
+		) {
+			this->mapped_file.close();
+			this->entry_vec.clear();
+			error_ss << "is truncated (entry " << i << " of " << n_entries << ").";
+			throw std::runtime_error(error_ss.str());
+		}
+		entry.path = std::string(data_ptr + idx, path_length);
+		idx += path_length;
+
+		this->entry_vec.push_back(entry);
+	}
+
+	for (size_t i = 0; i < this->entry_vec.size(); i++) {
+		this->entry_map[this->entry_vec[i].path] = i;
+	}
+	this->pack_path = path;
+
+	std::cout << "asset pack: \"" << path << "\" opened (" <<
+		this->entry_vec.size() << " entries, " << data_size <<
+		" bytes mapped)" << std::endl;
+
+	return;
+}	// end AssetPack::open()
+
+
+void AssetPack::close(void) {
+	/*
+	 *	Method to unmap the pack (anything loaded from it by pointer, e.g.
+	 *	fonts and streamed music, must be gone first)
+	 */
+
+	this->mapped_file.close();
+	this->entry_vec.clear();
+	this->entry_map.clear();
+	this->pack_path = "";
+
+	return;
+}	// end AssetPack::close()
+
+
+bool AssetPack::isOpen(void) {
+	return this->mapped_file.isOpen();
+}	// end AssetPack::isOpen()
+
+
+const char* AssetPack::find(const std::string& path, size_t* size_ptr) {
+	/*
+	 *	Method to find the given path in the pack; returns a pointer to its
+	 *	data, and its size through size_ptr (NULL if not open or not packed)
+	 */
+
+	std::unordered_map<std::string, int>::iterator entry_iter =
+		this->entry_map.find(path);
+	if (entry_iter == this->entry_map.end()) {
+		return NULL;
+	}
+
+	const AssetPackEntry& entry = this->entry_vec[entry_iter->second];
+	*size_ptr = entry.size;
+
+	return this->mapped_file.getData() + entry.offset;
+}	// end AssetPack::find()
+
+
+int AssetPack::getNumEntries(void) {
+	return this->entry_vec.size();
+}	// end AssetPack::getNumEntries()
+
+
+unsigned long long AssetPack::getSize(void) {
+	return this->mapped_file.getSize();
+}	// end AssetPack::getSize()
+
+
+std::string AssetPack::getPath(void) {
+	return this->pack_path;
+}	// end AssetPack::getPath()
+
+
+AssetPack::~AssetPack(void) {
+	this->close();
+	return;
+}	// end AssetPack::~AssetPack()
+
+
+// -------- function implementations (process-wide pack) -------- //
+
+AssetPack& assetPack(void) {
+	/*
+	 *	Function to get the process-wide asset pack (not open until main()
+	 *	opens one; lookups then fall back to loose files)
+	 */
+
+	static AssetPack asset_pack;
+	return asset_pack;
+}	// end assetPack()
@@ -0,0 +1,317 @@
+/*
+ *	Atlas packer implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the skyline atlas packer (see AtlasPacker.h).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/AtlasPacker.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+
+// -------- class implementations -------- //
+
+
+// ---- AtlasPacker ---- //
+
+AtlasPacker::AtlasPacker(int page_size, int padding) {
+	/*
+	 *	Constructor for AtlasPacker class
+	 */
+
+	if (page_size <= 0 || padding < 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: AtlasPacker::AtlasPacker(): page size " <<
+			page_size << " and padding " << padding << " are not valid.";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->page_size = page_size;
+	this->padding = padding;
+
+	// stream out and return
+	std::cout << "AtlasPacker object created at " << this << "." << std::endl;
+	return;
+}	// end AtlasPacker::AtlasPacker()
+
+
+int AtlasPacker::fitSkyline(int page, int width, int height, int* y_ptr) {
+	/*
+	 *	Method to find where a (padded) rect best fits on the given page's
+	 *	skyline: lowest bottom edge, then leftmost. Returns the index of the
+	 *	segment to place at (with the top edge in *y_ptr), or -1 if none fit.
+	 */
+
+	const std::vector<SkylineSegment>& skyline = this->skyline_vec[page];
+
+	int best_idx = -1;
+	int best_bottom = this->page_size + 1;
+	int best_x = this->page_size + 1;
+
+	for (size_t i = 0; i < skyline.size(); i++) {
+		int x = skyline[i].x;
+		if (x + width > this->page_size) {
+			break;
+		}
+
+		// rest on the highest segment spanned
+		int y = 0;
+		int width_left = width;
+		for (size_t j = i; width_left > 0; j++) {
+			y = std::max(y, skyline[j].y);
+			width_left -= skyline[j].width;
+		}
+
+		if (y + height > this->page_size) {
+			continue;
+		}
+
+		if (
+			y + height < best_bottom ||
+			(y + height == best_bottom && x < best_x)
+		) {
+			best_idx = i;
+			best_bottom = y + height;
+			best_x = x;
+			*y_ptr = y;
+		}
+	}
+
+	return best_idx;
+}	// end AtlasPacker::fitSkyline()
+
+
+void AtlasPacker::placeSkyline(int page, int idx, int x, int y, int width) {
+	/*
+	 *	Method to raise the given page's skyline to y over [x, x + width),
+	 *	starting at segment idx
+	 */
+
+	std::vector<SkylineSegment>& skyline = this->skyline_vec[page];
+
+	SkylineSegment segment;
+	segment.x = x;
+	segment.y = y;
+	segment.width = width;
+	skyline.insert(skyline.begin() + idx, segment);
+
+	// trim (or drop) segments now under the new one
+	size_t i = idx + 1;
+	while (i < skyline.size()) {
+		int overlap = x + width - skyline[i].x;
+		if (overlap <= 0) {
+			break;
+		}
+
+		if (overlap >= skyline[i].width) {
+			skyline.erase(skyline.begin() + i);
+		}
+		else {
+			skyline[i].x += overlap;
+			skyline[i].width -= overlap;
+			break;
+		}
+	}
+
+	// merge neighbours at the same height
+	i = 0;
+	while (i + 1 < skyline.size()) {
+		if (skyline[i].y == skyline[i + 1].y) {
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+		}
+		else {
+			i++;
+		}
+	}
+
+	return;
+}	// end AtlasPacker::placeSkyline()
+
+
+void AtlasPacker::clear(void) {
+	/*
+	 *	Method to clear all rects and pages
+	 */
+
+	this->rect_vec.clear();
+	this->skyline_vec.clear();
+	this->page_height_vec.clear();
+
+	return;
+}	// end AtlasPacker::clear()
+
+
+void AtlasPacker::pushRect(std::string key, int width, int height) {
+	/*
+	 *	Method to add a rect to be packed
+	 */
+
+	if (width < 0 || height < 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: AtlasPacker::pushRect(): rect \"" << key <<
+			"\" has negative size.";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	AtlasRect rect;
+	rect.key = key;
+	rect.width = width;
+	rect.height = height;
+	rect.page = -1;
+	rect.x = 0;
+	rect.y = 0;
+	this->rect_vec.push_back(rect);
+
+	return;
+}	// end AtlasPacker::pushRect()
+
+
+int AtlasPacker::pack(void) {
+	/*
+	 *	Method to pack all rects (tallest first), returns the number of pages
+	 */
+
+	this->skyline_vec.clear();
+	this->page_height_vec.clear();
+
+	std::vector<int> order_vec(this->rect_vec.size());
+	std::iota(order_vec.begin(), order_vec.end(), 0);
+	std::stable_sort(
+		order_vec.begin(),
+		order_vec.end(),
+		[this](int a, int b) {
+			if (this->rect_vec[a].height != this->rect_vec[b].height) {
+				return this->rect_vec[a].height > this->rect_vec[b].height;
+			}
+			return this->rect_vec[a].width > this->rect_vec[b].width;
+		}
+	);
+
+	for (size_t i = 0; i < order_vec.size(); i++) {
+		AtlasRect& rect = this->rect_vec[order_vec[i]];
+		rect.page = -1;
+
+		if (rect.width > this->page_size || rect.height > this->page_size) {
+			continue;
+		}
+
+		// padding is not needed past the page edge
+		int padded_width = std::min(rect.width + this->padding, this->page_size);
+		int padded_height = std::min(rect.height + this->padding, this->page_size);
+
+		// first page it fits on, else a new page
+		int y = 0;
+		int idx = -1;
+		int page = 0;
+		for (page = 0; page < int(this->skyline_vec.size()); page++) {
+			idx = this->fitSkyline(page, padded_width, padded_height, &y);
+			if (idx >= 0) {
+				break;
+			}
+		}
+
+		if (idx < 0) {
+			SkylineSegment floor;
+			floor.x = 0;
+			floor.y = 0;
+			floor.width = this->page_size;
+			this->skyline_vec.push_back(std::vector<SkylineSegment>(1, floor));
+			this->page_height_vec.push_back(0);
+
+			page = this->skyline_vec.size() - 1;
+			idx = this->fitSkyline(page, padded_width, padded_height, &y);
+		}
+
+		rect.page = page;
+		rect.x = this->skyline_vec[page][idx].x;
+		rect.y = y;
+		this->placeSkyline(page, idx, rect.x, y + padded_height, padded_width);
+
+		this->page_height_vec[page] = std::max(
+			this->page_height_vec[page],
+			rect.y + rect.height
+		);
+	}
+
+	return this->skyline_vec.size();
+}	// end AtlasPacker::pack()
+
+
+int AtlasPacker::getPageSize(void) {
+	return this->page_size;
+}	// end AtlasPacker::getPageSize()
+
+
+int AtlasPacker::getNumPages(void) {
+	return this->skyline_vec.size();
+}	// end AtlasPacker::getNumPages()
+
+
+int AtlasPacker::getPageHeight(int page) {
+	/*
+	 *	Method to get the used height of the given page (pages need only be
+	 *	this tall)
+	 */
+
+	return this->page_height_vec.at(page);
+}	// end AtlasPacker::getPageHeight()
+
+
+int AtlasPacker::getNumRects(void) {
+	return this->rect_vec.size();
+}	// end AtlasPacker::getNumRects()
+
+
+AtlasRect AtlasPacker::getRect(int i) {
+	return this->rect_vec.at(i);
+}	// end AtlasPacker::getRect()
+
+
+double AtlasPacker::getOccupancy(void) {
+	/*
+	 *	Method to get the fraction of used page area covered by packed rects
+	 */
+
+	double page_area = 0;
+	for (size_t i = 0; i < this->page_height_vec.size(); i++) {
+		page_area += double(this->page_size) * this->page_height_vec[i];
+	}
+	if (page_area <= 0) {
+		return 0;
+	}
+
+	double rect_area = 0;
+	for (size_t i = 0; i < this->rect_vec.size(); i++) {
+		if (this->rect_vec[i].page >= 0) {
+			rect_area += double(this->rect_vec[i].width) * this->rect_vec[i].height;
+		}
+	}
+
+	return rect_area / page_area;
+}	// end AtlasPacker::getOccupancy()
+
+
+AtlasPacker::~AtlasPacker(void) {
+	/*
+	 *	Destructor for AtlasPacker class
+	 */
+
+	std::cout << "AtlasPacker object at " << this << " destroyed." << std::endl;
+	return;
+}	// end AtlasPacker::~AtlasPacker()
@@ -0,0 +1,701 @@
+/*
+ *	Batch runner implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the multi-core batch scenario runner (--batch mode).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/BatchRunner.h"
+#include "../header/ByteOrder.h"
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+
+// -------- constants -------- //
+static const int BATCH_RECORD_SIZE = 48;	// bytes per BinaryBatchSink record
+
+// plant type names (texture keys), by type index
+static const std::vector<std::string> PLANT_TYPE_STR_VEC = {
+	"coal", "combined", "fission", "geothermal", "hydro", "peaker",
+	"solar", "storage", "tidal", "wave", "wind"
+};
+
+
+// -------- function implementations -------- //
+
+int plantTypeFromString(std::string type_str) {
+	/*
+	 *	Helper function to map plant type name (texture key) to type index
+	 */
+
+	for (size_t i = 0; i < PLANT_TYPE_STR_VEC.size(); i++) {
+		if (type_str.compare(PLANT_TYPE_STR_VEC[i]) == 0) {
+			return int(i);
+		}
+	}
+
+	return PLANT_NULL;
+}	// end plantTypeFromString()
+
+
+std::string plantTypeToString(int type) {
+	/*
+	 *	Helper function to map plant type index to type name (texture key)
+	 */
+
+	if (type < 0 || type >= int(PLANT_TYPE_STR_VEC.size())) {
+		return "null";
+	}
+
+	return PLANT_TYPE_STR_VEC[type];
+}	// end plantTypeToString()
+
+
+void runBatch(std::string scenario_path) {
+	/*
+	 *	Runs the batch scenario at the given path (--batch mode)
+	 */
+
+	BatchRunner batch_runner;
+	batch_runner.loadScenario(scenario_path);
+	batch_runner.run();
+
+	return;
+}	// end runBatch()
+
+
+// ---- WorkStealingPool ---- //
+
+WorkStealingPool::WorkStealingPool(int n_workers) :
+	queue_vec(n_workers > 0 ? n_workers : 1),
+	mutex_vec(n_workers > 0 ? n_workers : 1)
+{
+	/*
+	 *	Constructor for WorkStealingPool class
+	 */
+
+	this->n_pending = 0;
+	this->n_queued = 0;
+
+	// stream out and return
+	std::cout << "\nWorkStealingPool object created at " << this << " (" <<
+		this->queue_vec.size() << " workers)." << std::endl;
+	return;
+}	// end WorkStealingPool::WorkStealingPool()
+
+
+int WorkStealingPool::getNumWorkers(void) {
+	return int(this->queue_vec.size());
+}	// end WorkStealingPool::getNumWorkers()
+
+
+void WorkStealingPool::push(int worker, std::function<void(void)> task) {
+	/*
+	 *	Method to push a task onto the given worker's queue
+	 */
+
+	worker %= this->getNumWorkers();
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_vec[worker]);
+		this->queue_vec[worker].push_back(task);
+		this->n_pending++;
+		this->n_queued++;
+	}
+
+	// wake an idle worker (if running)
+	std::lock_guard<std::mutex> idle_lock(this->idle_mutex);
+	this->idle_cv.notify_one();
+
+	return;
+}	// end WorkStealingPool::push()
+
+
+bool WorkStealingPool::popTask(int worker, std::function<void(void)>* task_ptr) {
+	/*
+	 *	Method to get the next task for the given worker (own queue first, from
+	 *	the back, then steal from the front of the others)
+	 */
+
+	int n_workers = this->getNumWorkers();
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_vec[worker]);
+		if (!this->queue_vec[worker].empty()) {
+			*task_ptr = std::move(this->queue_vec[worker].back());
+			this->queue_vec[worker].pop_back();
+			this->n_queued--;
+			return true;
+		}
+	}
+
+	for (int i = 1; i < n_workers; i++) {
+		int victim = (worker + i) % n_workers;
+
+		std::lock_guard<std::mutex> lock(this->mutex_vec[victim]);
+		if (!this->queue_vec[victim].empty()) {
+			*task_ptr = std::move(this->queue_vec[victim].front());
+			this->queue_vec[victim].pop_front();
+			this->n_queued--;
+			return true;
+		}
+	}
+
+	return false;
+}	// end WorkStealingPool::popTask()
+
+
+void WorkStealingPool::work(int worker) {
+	/*
+	 *	Method run by each worker thread, until no tasks are pending (an idle
+	 *	worker blocks until a task is pushed, or the last one finishes)
+	 */
+
+	std::function<void(void)> task;
+
+	while (true) {
+		if (this->popTask(worker, &task)) {
+			task();
+			if (--this->n_pending == 0) {
+				std::lock_guard<std::mutex> idle_lock(this->idle_mutex);
+				this->idle_cv.notify_all();
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> idle_lock(this->idle_mutex);
+		this->idle_cv.wait(
+			idle_lock,
+			[this]() {return this->n_pending == 0 || this->n_queued > 0;}
+		);
+		if (this->n_pending == 0) {
+			break;
+		}
+	}
+
+	return;
+}	// end WorkStealingPool::work()
+
+
+void WorkStealingPool::run(void) {
+	/*
+	 *	Method to run all pushed tasks (blocks until finished)
+	 */
+
+	for (int i = 0; i < this->getNumWorkers(); i++) {
+		this->thread_vec.push_back(
+			std::thread(&WorkStealingPool::work, this, i)
+		);
+	}
+
+	for (size_t i = 0; i < this->thread_vec.size(); i++) {
+		this->thread_vec[i].join();
+	}
+	this->thread_vec.clear();
+
+	return;
+}	// end WorkStealingPool::run()
+
+
+WorkStealingPool::~WorkStealingPool(void) {
+	/*
+	 *	Destructor for WorkStealingPool class
+	 */
+
+	for (size_t i = 0; i < this->thread_vec.size(); i++) {
+		if (this->thread_vec[i].joinable()) {
+			this->thread_vec[i].join();
+		}
+	}
+
+	// stream out and return
+	std::cout << "WorkStealingPool object at " << this << " destroyed." << std::endl;
+	return;
+}	// end WorkStealingPool::~WorkStealingPool()
+
+
+// ---- BatchSink ---- //
+
+BatchSink::BatchSink(std::string path, bool binary) {
+	/*
+	 *	Constructor for BatchSink class
+	 */
+
+	if (binary) {
+		this->out_stream.open(path, std::ios::out | std::ios::binary);
+	}
+	else {
+		this->out_stream.open(path, std::ios::out);
+	}
+
+	if (!this->out_stream.is_open()) {
+		std::stringstream err_ss;
+		err_ss << "EXCEPTION: BatchSink::BatchSink(): Cannot open output at \"" <<
+			path << "\".";
+		throw std::runtime_error(err_ss.str());
+	}
+
+	// stream out and return
+	std::cout << "\nBatchSink object created at " << this << " (" << path <<
+		")." << std::endl;
+	return;
+}	// end BatchSink::BatchSink()
+
+
+BatchSink::~BatchSink(void) {
+	/*
+	 *	Destructor for BatchSink class
+	 */
+
+	this->out_stream.close();
+
+	// stream out and return
+	std::cout << "BatchSink object at " << this << " destroyed." << std::endl;
+	return;
+}	// end BatchSink::~BatchSink()
+
+
+// ---- BatchSink <-- CSVBatchSink ---- //
+
+CSVBatchSink::CSVBatchSink(std::string path) : BatchSink(path, false) {
+	/*
+	 *	Constructor for CSVBatchSink class
+	 */
+
+	return;
+}	// end CSVBatchSink::CSVBatchSink()
+
+
+void CSVBatchSink::writeHeader(
+	const std::vector<BatchPortfolio>& portfolio_vec,
+	const std::vector<BatchPolicy>& policy_vec
+) {
+	/*
+	 *	Method to write CSV column names (and keep name tables for the rows)
+	 */
+
+	for (size_t i = 0; i < portfolio_vec.size(); i++) {
+		this->portfolio_name_vec.push_back(portfolio_vec[i].name);
+	}
+	for (size_t i = 0; i < policy_vec.size(); i++) {
+		this->policy_name_vec.push_back(policy_vec[i].name);
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->out_stream << "portfolio,policy,game,seed,score,unmet_demand_GWh," <<
+		"excess_dispatch_GWh,coal_marbles,combined_marbles,peaker_marbles\n";
+
+	return;
+}	// end CSVBatchSink::writeHeader()
+
+
+void CSVBatchSink::write(const std::vector<BatchResult>& result_vec) {
+	/*
+	 *	Method to write a block of results (one row per game)
+	 */
+
+	// format outside of the lock, write inside
+	std::stringstream rows_ss;
+	for (size_t i = 0; i < result_vec.size(); i++) {
+		const BatchResult& result = result_vec[i];
+		rows_ss << this->portfolio_name_vec[result.portfolio] << "," <<
+			this->policy_name_vec[result.policy] << "," <<
+			result.game << "," <<
+			result.seed << "," <<
+			result.score << "," <<
+			result.unmet_demand_GWh << "," <<
+			result.excess_dispatch_GWh << "," <<
+			result.coal_marbles << "," <<
+			result.combined_marbles << "," <<
+			result.peaker_marbles << "\n";
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->out_stream << rows_ss.str();
+
+	return;
+}	// end CSVBatchSink::write()
+
+
+CSVBatchSink::~CSVBatchSink(void) {
+	/*
+	 *	Destructor for CSVBatchSink class
+	 */
+
+	return;
+}	// end CSVBatchSink::~CSVBatchSink()
+
+
+// ---- BatchSink <-- BinaryBatchSink ---- //
+
+BinaryBatchSink::BinaryBatchSink(std::string path) : BatchSink(path, true) {
+	/*
+	 *	Constructor for BinaryBatchSink class
+	 */
+
+	return;
+}	// end BinaryBatchSink::BinaryBatchSink()
+
+
+void BinaryBatchSink::writeHeader(
+	const std::vector<BatchPortfolio>& portfolio_vec,
+	const std::vector<BatchPolicy>& policy_vec
+) {
+	/*
+	 *	Method to write magic, record size, and name tables
+	 *
+	 *	layout (little endian): "MMBATCH2", uint32 record size, uint32 n
+	 *	portfolios, names, uint32 n policies, names (each name is uint32
+	 *	length then chars), then records of BATCH_RECORD_SIZE bytes:
+	 *
+	 *		int32 portfolio, int32 policy, int32 game, uint64 seed,
+	 *		float64 score, int32 unmet demand [GWh], int32 excess dispatch
+	 *		[GWh], int32 coal marbles, int32 combined marbles, int32 peaker
+	 *		marbles
+	 */
+
+	std::string bytes = "MMBATCH2";
+	writeLE(&bytes, BATCH_RECORD_SIZE, 4);
+
+	writeLE(&bytes, portfolio_vec.size(), 4);
+	for (size_t i = 0; i < portfolio_vec.size(); i++) {
+		writeLE(&bytes, portfolio_vec[i].name.size(), 4);
+		bytes += portfolio_vec[i].name;
+	}
+
+	writeLE(&bytes, policy_vec.size(), 4);
+	for (size_t i = 0; i < policy_vec.size(); i++) {
+		writeLE(&bytes, policy_vec[i].name.size(), 4);
+		bytes += policy_vec[i].name;
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->out_stream.write(bytes.data(), bytes.size());
+
+	return;
+}	// end BinaryBatchSink::writeHeader()
+
+
+void BinaryBatchSink::write(const std::vector<BatchResult>& result_vec) {
+	/*
+	 *	Method to write a block of results (field by field, fixed widths, see
+	 *	BinaryBatchSink::writeHeader())
+	 */
+
+	// serialize outside of the lock, write inside
+	std::string bytes;
+	bytes.reserve(result_vec.size() * BATCH_RECORD_SIZE);
+	for (size_t i = 0; i < result_vec.size(); i++) {
+		const BatchResult& result = result_vec[i];
+
+		writeLE(&bytes, (unsigned int)result.portfolio, 4);
+		writeLE(&bytes, (unsigned int)result.policy, 4);
+		writeLE(&bytes, (unsigned int)result.game, 4);
+		writeLE(&bytes, result.seed, 8);
+		writeDoubleLE(&bytes, result.score);
+		writeLE(&bytes, (unsigned int)result.unmet_demand_GWh, 4);
+		writeLE(&bytes, (unsigned int)result.excess_dispatch_GWh, 4);
+		writeLE(&bytes, (unsigned int)result.coal_marbles, 4);
+		writeLE(&bytes, (unsigned int)result.combined_marbles, 4);
+		writeLE(&bytes, (unsigned int)result.peaker_marbles, 4);
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->out_stream.write(bytes.data(), bytes.size());
+
+	return;
+}	// end BinaryBatchSink::write()
+
+
+BinaryBatchSink::~BinaryBatchSink(void) {
+	/*
+	 *	Destructor for BinaryBatchSink class
+	 */
+
+	return;
+}	// end BinaryBatchSink::~BinaryBatchSink()
+
+
+// ---- BatchRunner ---- //
+
+BatchRunner::BatchRunner(void) {
+	/*
+	 *	Constructor for BatchRunner class
+	 */
+
+	this->games_per_scenario = 1000;
+	this->games_per_task = 256;
+	this->n_threads = 0;
+	this->seed = 0;
+	this->output_path = "batch.csv";
+
+	// stream out and return
+	std::cout << "\nBatchRunner object created at " << this << "." << std::endl;
+	return;
+}	// end BatchRunner::BatchRunner()
+
+
+void BatchRunner::loadScenario(std::string path) {
+	/*
+	 *	Method to load scenario file (see BatchRunner.h for format)
+	 */
+
+	std::ifstream in_stream(path);
+	if (!in_stream.is_open()) {
+		std::stringstream err_ss;
+		err_ss << "EXCEPTION: BatchRunner::loadScenario(): Cannot open scenario at \"" <<
+			path << "\".";
+		throw std::runtime_error(err_ss.str());
+	}
+
+	std::string line_str;
+	int line_num = 0;
+	while (std::getline(in_stream, line_str)) {
+		line_num++;
+
+		// strip comments
+		size_t comment_idx = line_str.find('#');
+		if (comment_idx != std::string::npos) {
+			line_str.erase(comment_idx);
+		}
+
+		std::stringstream line_ss(line_str);
+		std::string key_str;
+		if (!(line_ss >> key_str)) {
+			continue;
+		}
+
+		std::stringstream err_ss;
+		err_ss << "EXCEPTION: BatchRunner::loadScenario(): \"" << path << "\", line " <<
+			line_num << ": ";
+
+		if (key_str.compare("games") == 0) {
+			line_ss >> this->games_per_scenario;
+		}
+		else if (key_str.compare("seed") == 0) {
+			line_ss >> this->seed;
+		}
+		else if (key_str.compare("threads") == 0) {
+			line_ss >> this->n_threads;
+		}
+		else if (key_str.compare("chunk") == 0) {
+			line_ss >> this->games_per_task;
+		}
+		else if (key_str.compare("output") == 0) {
+			line_ss >> this->output_path;
+		}
+		else if (key_str.compare("policy") == 0) {
+			BatchPolicy policy;
+			line_ss >> policy.name;
+
+			std::string type_str;
+			while (line_ss >> type_str) {
+				int type = plantTypeFromString(type_str);
+				if (type < 0) {
+					err_ss << "unknown plant type \"" << type_str << "\".";
+					throw std::runtime_error(err_ss.str());
+				}
+				policy.merit_order.push_back(type);
+			}
+			this->policy_vec.push_back(policy);
+		}
+		else if (key_str.compare("portfolio") == 0) {
+			BatchPortfolio portfolio;
+			line_ss >> portfolio.name;
+
+			int total_tokens = 0;
+			std::string slot_str;
+			while (line_ss >> slot_str) {
+				size_t colon_idx = slot_str.find(':');
+				int type = plantTypeFromString(slot_str.substr(0, colon_idx));
+				int tokens = 0;
+				if (colon_idx != std::string::npos) {
+					tokens = atoi(slot_str.substr(colon_idx + 1).c_str());
+				}
+				if (type < 0 || tokens <= 0) {
+					err_ss << "bad portfolio slot \"" << slot_str << "\".";
+					throw std::runtime_error(err_ss.str());
+				}
+				portfolio.slot_vec.push_back(std::make_pair(type, tokens));
+				total_tokens += tokens;
+			}
+
+			if (total_tokens > TOTAL_TOKENS) {
+				std::cout << "WARNING: BatchRunner::loadScenario(): portfolio \"" <<
+					portfolio.name << "\" uses " << total_tokens << " tokens (more than " <<
+					TOTAL_TOKENS << ")." << std::endl;
+			}
+			this->portfolio_vec.push_back(portfolio);
+		}
+		else {
+			err_ss << "unknown directive \"" << key_str << "\".";
+			throw std::runtime_error(err_ss.str());
+		}
+	}
+
+	if (this->portfolio_vec.empty() || this->policy_vec.empty()) {
+		std::stringstream err_ss;
+		err_ss << "EXCEPTION: BatchRunner::loadScenario(): \"" << path <<
+			"\" needs at least one portfolio and one policy.";
+		throw std::runtime_error(err_ss.str());
+	}
+	if (this->games_per_task < 1) {
+		this->games_per_task = 1;
+	}
+
+	std::cout << "\tscenario \"" << path << "\" loaded: " <<
+		this->portfolio_vec.size() << " portfolio(s), " <<
+		this->policy_vec.size() << " policy(s), " <<
+		this->games_per_scenario << " game(s) each." << std::endl;
+
+	return;
+}	// end BatchRunner::loadScenario()
+
+
+void BatchRunner::runTask(
+	int portfolio,
+	int policy,
+	int first_game,
+	int n_games,
+	BatchSink* sink_ptr
+) {
+	/*
+	 *	Method to run a block of games (one pool task) and stream the results
+	 */
+
+	GridSimulator grid_simulator(0);
+	std::vector<BatchResult> result_vec;
+	result_vec.reserve(n_games);
+
+	// seeds derived in stages (portfolio, then policy, then game), so no
+	// index can spill into another's bits
+	unsigned long long portfolio_seed = deriveSeed(this->seed, RNG_BATCH, portfolio);
+	unsigned long long policy_seed = deriveSeed(portfolio_seed, RNG_BATCH, policy);
+
+	for (int game = first_game; game < first_game + n_games; game++) {
+		unsigned long long game_seed = deriveSeed(policy_seed, RNG_BATCH, game);
+
+		// geothermal capacity is rolled per game, so rebuild plants each time
+		grid_simulator.clearPlants();
+		grid_simulator.reset(game_seed);
+		const BatchPortfolio& portfolio_ref = this->portfolio_vec[portfolio];
+		for (size_t i = 0; i < portfolio_ref.slot_vec.size(); i++) {
+			grid_simulator.pushPlantTokens(
+				portfolio_ref.slot_vec[i].first,
+				portfolio_ref.slot_vec[i].second
+			);
+		}
+
+		BatchResult result;
+		result.portfolio = portfolio;
+		result.policy = policy;
+		result.game = game;
+		result.seed = game_seed;
+		result.score = grid_simulator.runDay(this->policy_vec[policy].merit_order);
+		result.unmet_demand_GWh = grid_simulator.getUnmetDemandGWh();
+		result.excess_dispatch_GWh = grid_simulator.getExcessDispatchGWh();
+		result.coal_marbles = grid_simulator.getCoalMarbles();
+		result.combined_marbles = grid_simulator.getCombinedMarbles();
+		result.peaker_marbles = grid_simulator.getPeakerMarbles();
+		result_vec.push_back(result);
+	}
+
+	sink_ptr->write(result_vec);
+
+	return;
+}	// end BatchRunner::runTask()
+
+
+void BatchRunner::run(void) {
+	/*
+	 *	Method to run all (portfolio, policy) scenarios across all cores
+	 */
+
+	int n_threads = this->n_threads;
+	if (n_threads <= 0) {
+		n_threads = std::thread::hardware_concurrency();
+	}
+	if (n_threads <= 0) {
+		n_threads = 1;
+	}
+
+	// make sink
+	BatchSink* sink_ptr = NULL;
+	std::string extension_str = "";
+	if (this->output_path.size() >= 4) {
+		extension_str = this->output_path.substr(this->output_path.size() - 4);
+	}
+	if (extension_str.compare(".csv") == 0) {
+		sink_ptr = new CSVBatchSink(this->output_path);
+	}
+	else {
+		sink_ptr = new BinaryBatchSink(this->output_path);
+	}
+	sink_ptr->writeHeader(this->portfolio_vec, this->policy_vec);
+
+	// deal tasks round robin, idle workers steal the rest
+	WorkStealingPool pool(n_threads);
+	int n_tasks = 0;
+	for (size_t portfolio = 0; portfolio < this->portfolio_vec.size(); portfolio++) {
+		for (size_t policy = 0; policy < this->policy_vec.size(); policy++) {
+			for (
+				int game = 0;
+				game < this->games_per_scenario;
+				game += this->games_per_task
+			) {
+				int n_games = this->games_per_task;
+				if (game + n_games > this->games_per_scenario) {
+					n_games = this->games_per_scenario - game;
+				}
+
+				pool.push(
+					n_tasks,
+					[this, portfolio, policy, game, n_games, sink_ptr]() {
+						this->runTask(portfolio, policy, game, n_games, sink_ptr);
+					}
+				);
+				n_tasks++;
+			}
+		}
+	}
+
+	auto start_time = std::chrono::steady_clock::now();
+	pool.run();
+	double run_time_s = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start_time
+	).count();
+
+	delete sink_ptr;
+
+	int n_games = this->portfolio_vec.size() * this->policy_vec.size() *
+		this->games_per_scenario;
+	std::cout << "\tbatch finished: " << n_games << " game(s) in " << run_time_s <<
+		" s on " << n_threads << " thread(s) (" << n_games / run_time_s <<
+		" games/s), results in \"" << this->output_path << "\"." << std::endl;
+
+	return;
+}	// end BatchRunner::run()
+
+
+BatchRunner::~BatchRunner(void) {
+	/*
+	 *	Destructor for BatchRunner class
+	 */
+
+	// stream out and return
+	std::cout << "BatchRunner object at " << this << " destroyed." << std::endl;
+	return;
+}	// end BatchRunner::~BatchRunner()
@@ -0,0 +1,226 @@
+/*
+ *	Benchmarks implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the headless benchmark suite (--benchmark mode).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/Benchmarks.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+
+// -------- function implementations -------- //
+
+void printBenchmark(
+	std::string title,
+	std::string baseline_name,
+	double baseline_time,
+	std::string optimized_name,
+	double optimized_time
+) {
+	/*
+	 *	Helper function to print a benchmark result (times in any common unit)
+	 */
+
+	std::ios_base::fmtflags cout_flags = std::cout.flags();
+	std::streamsize cout_precision = std::cout.precision();
+
+	std::cout << "\t" << title << std::endl;
+	std::cout << "\t\t" << std::left << std::setw(24) << baseline_name <<
+		std::fixed << std::setprecision(3) << baseline_time << std::endl;
+	std::cout << "\t\t" << std::left << std::setw(24) << optimized_name <<
+		std::fixed << std::setprecision(3) << optimized_time << std::endl;
+	std::cout << "\t\t" << std::left << std::setw(24) << "speedup" <<
+		std::fixed << std::setprecision(2) << baseline_time / optimized_time <<
+		"x" << std::endl;
+	std::cout.flags(cout_flags);
+	std::cout.precision(cout_precision);
+
+	return;
+}	// end printBenchmark()
+
+
+void printBenchmark(
+	std::string title,
+	std::string baseline_name,
+	std::vector<double> baseline_time_vec,
+	std::string optimized_name,
+	std::vector<double> optimized_time_vec
+) {
+	/*
+	 *	Helper function to print a benchmark result (times in any common unit,
+	 *	one per repetition, run in pairs): median and spread of each, the
+	 *	speedup of the medians, and in how many pairs the optimized path won
+	 */
+
+	int n_wins = 0;
+	for (size_t i = 0; i < baseline_time_vec.size(); i++) {
+		if (optimized_time_vec[i] < baseline_time_vec[i]) {
+			n_wins++;
+		}
+	}
+
+	std::sort(baseline_time_vec.begin(), baseline_time_vec.end());
+	std::sort(optimized_time_vec.begin(), optimized_time_vec.end());
+
+	double baseline_time = baseline_time_vec[baseline_time_vec.size() / 2];
+	double optimized_time = optimized_time_vec[optimized_time_vec.size() / 2];
+
+	std::ios_base::fmtflags cout_flags = std::cout.flags();
+	std::streamsize cout_precision = std::cout.precision();
+
+	std::cout << "\t" << title << ", median [min, max] of " <<
+		baseline_time_vec.size() << std::endl;
+	std::cout << "\t\t" << std::left << std::setw(24) << baseline_name <<
+		std::fixed << std::setprecision(3) << baseline_time << " [" <<
+		baseline_time_vec.front() << ", " << baseline_time_vec.back() << "]" <<
+		std::endl;
+	std::cout << "\t\t" << std::left << std::setw(24) << optimized_name <<
+		std::fixed << std::setprecision(3) << optimized_time << " [" <<
+		optimized_time_vec.front() << ", " << optimized_time_vec.back() << "]" <<
+		std::endl;
+	std::cout << "\t\t" << std::left << std::setw(24) << "speedup" <<
+		std::fixed << std::setprecision(2) << baseline_time / optimized_time <<
+		"x (faster in " << n_wins << " of " << baseline_time_vec.size() <<
+		" repetitions)" << std::endl;
+	std::cout.flags(cout_flags);
+	std::cout.precision(cout_precision);
+
+	return;
+}	// end printBenchmark()
+
+
+void benchmarkPerformanceCurves(void) {
+	/*
+	 *	Benchmark of the compile-time performance curve tables against libm,
+	 *	both on the bare curves and in the hot batch simulation loop (the
+	 *	tables measurably win on the bare curves only; in runDay() the gain is
+	 *	within run to run spread)
+	 */
+
+	std::cout << "\n1. performance curves (tables vs libm)" << std::endl;
+
+	// bare curves, same inputs for both
+	{
+		const int n_evals = 1 << 22;
+		RandomStream random_stream(deriveSeed(1234, RNG_BATCH, 0));
+		std::vector<double> speed_vec(n_evals, 0);
+		random_stream.fill(speed_vec.data(), speed_vec.size());
+
+		// (modes interleaved per repetition, so drift hits both alike)
+		std::vector<double> time_ns_vec[2];
+		double checksum[2] = {0, 0};
+		for (int rep = 0; rep < BENCHMARK_REPETITIONS; rep++) {
+			for (int mode = 0; mode < 2; mode++) {
+				usePerformanceTables(mode == 1);
+				checksum[mode] = 0;
+
+				auto start = std::chrono::steady_clock::now();
+				for (int i = 0; i < n_evals; i++) {
+					checksum[mode] += windProductionRatio(speed_vec[i], 0.47);
+					checksum[mode] += tidalProductionRatio(speed_vec[i], 0.47);
+				}
+				auto end = std::chrono::steady_clock::now();
+
+				time_ns_vec[mode].push_back(
+					std::chrono::duration<double, std::nano>(end - start).count() /
+					(2.0 * n_evals)
+				);
+			}
+		}
+
+		printBenchmark(
+			"wind + tidal curve [ns/eval]",
+			"libm",
+			time_ns_vec[0],
+			"table",
+			time_ns_vec[1]
+		);
+		std::cout << "\t\tmean abs deviation      " <<
+			fabs(checksum[1] - checksum[0]) / (2.0 * n_evals) << std::endl;
+	}
+
+	// hot batch loop, a wind and tidal heavy portfolio
+	{
+		const int n_games = 20000;
+		std::vector<int> merit_order = {
+			PLANT_FISSION, PLANT_GEOTHERMAL, PLANT_HYDRO, PLANT_STORAGE,
+			PLANT_COAL, PLANT_COMBINED, PLANT_PEAKER
+		};
+
+		GridSimulator grid_simulator(0);
+		grid_simulator.pushPlantTokens(PLANT_WIND, 10);
+		grid_simulator.pushPlantTokens(PLANT_TIDAL, 10);
+		grid_simulator.pushPlantTokens(PLANT_SOLAR, 4);
+		grid_simulator.pushPlantTokens(PLANT_HYDRO, 4);
+		grid_simulator.pushPlantTokens(PLANT_PEAKER, 8);
+
+		std::vector<double> time_us_vec[2];
+		double total_score[2] = {0, 0};
+		for (int rep = 0; rep < BENCHMARK_REPETITIONS; rep++) {
+			for (int mode = 0; mode < 2; mode++) {
+				usePerformanceTables(mode == 1);
+				total_score[mode] = 0;
+
+				auto start = std::chrono::steady_clock::now();
+				for (int game = 0; game < n_games; game++) {
+					grid_simulator.reset(deriveSeed(1234, RNG_BATCH, game));
+					total_score[mode] += grid_simulator.runDay(merit_order);
+				}
+				auto end = std::chrono::steady_clock::now();
+
+				time_us_vec[mode].push_back(
+					std::chrono::duration<double, std::micro>(end - start).count() /
+					n_games
+				);
+			}
+		}
+
+		printBenchmark(
+			"GridSimulator::runDay() [us/game]",
+			"libm",
+			time_us_vec[0],
+			"table",
+			time_us_vec[1]
+		);
+		std::cout << "\t\tmean score (libm, table) " << total_score[0] / n_games <<
+			", " << total_score[1] / n_games << std::endl;
+		std::cout << "\t\t(curve evaluations are a small share of runDay(), so the" <<
+			"\n\t\t tables speed up the bare curves only, not the batch loop)" <<
+			std::endl;
+	}
+
+	usePerformanceTables(true);
+
+	return;
+}	// end benchmarkPerformanceCurves()
+
+
+void runBenchmarks(void) {
+	/*
+	 *	Runs the benchmark suite for Megawatts & Marbles - The Energy Planning Game
+	 */
+
+	std::cout << "Running benchmarks ... " << std::endl;
+
+	benchmarkPerformanceCurves();
+
+	std::cout << "\n*** All benchmarks complete! ***\n" << std::endl;
+
+	return;
+}	// end runBenchmarks()
@@ -0,0 +1,770 @@
+/*
+ *	Dispatch solver implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the optimal dispatch solver.
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/DispatchSolver.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+
+// -------- function implementations -------- //
+
+static void rampRange(
+	int last_GWh,
+	int ramp_GWh,
+	int capacity_GW,
+	bool first_hour,
+	int* min_ptr,
+	int* max_ptr
+) {
+	/*
+	 *	Helper function to get the dispatch range of a ramp limited plant (as
+	 *	GridSimulator::getMinDispatch() / getMaxDispatch())
+	 */
+
+	*min_ptr = 0;
+	*max_ptr = capacity_GW;
+
+	if (first_hour) {
+		return;
+	}
+
+	if (last_GWh - ramp_GWh > 0) {
+		*min_ptr = last_GWh - ramp_GWh;
+	}
+	if (last_GWh + ramp_GWh < capacity_GW) {
+		*max_ptr = last_GWh + ramp_GWh;
+	}
+
+	return;
+}	// end rampRange()
+
+
+// ---- DispatchSolver ---- //
+
+DispatchSolver::DispatchSolver(int n_threads) {
+	/*
+	 *	Constructor for DispatchSolver class (n_threads = 0 for all cores)
+	 */
+
+	this->n_threads = n_threads;
+	if (this->n_threads <= 0) {
+		this->n_threads = std::thread::hardware_concurrency();
+	}
+	if (this->n_threads <= 0) {
+		this->n_threads = 1;
+	}
+
+	this->clearPortfolio();
+	this->demand_GWh_vec.assign(HOURS_PER_GAME, 0);
+	this->renewable_GWh_vec.assign(HOURS_PER_GAME, 0);
+
+	// stream out and return
+	std::cout << "\nDispatchSolver object created at " << this << "." << std::endl;
+	return;
+}	// end DispatchSolver::DispatchSolver()
+
+
+void DispatchSolver::clearPortfolio(void) {
+	/*
+	 *	Method to clear the portfolio (no dispatchable plants)
+	 */
+
+	this->coal_GW = 0;
+	this->combined_GW = 0;
+	this->fission_GW = 0;
+	this->geothermal_GW = 0;
+	this->hydro_GW = 0;
+	this->hydro_capacity_GWh = 0;
+	this->peaker_GW = 0;
+	this->storage_GW = 0;
+
+	this->n_states = 0;
+	this->solved = false;
+	this->optimal_score = 0;
+
+	return;
+}	// end DispatchSolver::clearPortfolio()
+
+
+void DispatchSolver::pushPlant(int type, double capacity_GW) {
+	/*
+	 *	Method to add a plant of given type and capacity (as built, i.e.
+	 *	geothermal already rolled); renewables are ignored, their production
+	 *	comes with the day (see setDay())
+	 */
+
+	int* capacity_ptr = NULL;
+
+	switch (type) {
+		case (PLANT_COAL):
+			capacity_ptr = &(this->coal_GW);
+			break;
+
+		case (PLANT_COMBINED):
+			capacity_ptr = &(this->combined_GW);
+			break;
+
+		case (PLANT_FISSION):
+			capacity_ptr = &(this->fission_GW);
+			break;
+
+		case (PLANT_GEOTHERMAL):
+			capacity_ptr = &(this->geothermal_GW);
+			break;
+
+		case (PLANT_HYDRO):
+			capacity_ptr = &(this->hydro_GW);
+			break;
+
+		case (PLANT_PEAKER):
+			capacity_ptr = &(this->peaker_GW);
+			break;
+
+		case (PLANT_STORAGE):
+			capacity_ptr = &(this->storage_GW);
+			break;
+
+		default:
+			// renewable or null, do nothing!
+			return;
+	}
+
+	// ramp and charge state is per plant, so one plant of each type
+	if (*capacity_ptr > 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: DispatchSolver::pushPlant(): " <<
+			"more than one plant of type " << type;
+		throw std::runtime_error(error_ss.str());
+	}
+
+	*capacity_ptr = ceil(capacity_GW);
+	if (type == PLANT_HYDRO) {
+		this->hydro_capacity_GWh = hydroStorageGWh(int(round(capacity_GW)));
+	}
+
+	this->solved = false;
+
+	return;
+}	// end DispatchSolver::pushPlant()
+
+
+void DispatchSolver::setDay(
+	const std::vector<int>& demand_GWh_vec,
+	const std::vector<int>& renewable_GWh_vec
+) {
+	/*
+	 *	Method to set the day: demand and total renewable production, by hour
+	 */
+
+	if (
+		int(demand_GWh_vec.size()) < HOURS_PER_GAME ||
+		int(renewable_GWh_vec.size()) < HOURS_PER_GAME
+	) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: DispatchSolver::setDay(): " <<
+			"need " << HOURS_PER_GAME << " hours of demand and renewable production";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->demand_GWh_vec.assign(
+		demand_GWh_vec.begin(),
+		demand_GWh_vec.begin() + HOURS_PER_GAME
+	);
+	this->renewable_GWh_vec.assign(
+		renewable_GWh_vec.begin(),
+		renewable_GWh_vec.begin() + HOURS_PER_GAME
+	);
+
+	this->solved = false;
+
+	return;
+}	// end DispatchSolver::setDay()
+
+
+int DispatchSolver::encode(const DispatchState& state) {
+	/*
+	 *	Method to pack a state into its mixed radix index
+	 */
+
+	return state.hydro_GWh * this->stride_array[0] +
+		state.storage_GWh * this->stride_array[1] +
+		state.coal_GWh * this->stride_array[2] +
+		state.combined_GWh * this->stride_array[3] +
+		state.geothermal_GWh * this->stride_array[4] +
+		state.fission_GWh * this->stride_array[5];
+}	// end DispatchSolver::encode()
+
+
+void DispatchSolver::decode(int idx, DispatchState* state_ptr) {
+	/*
+	 *	Method to unpack a mixed radix index into its state
+	 */
+
+	int digits[6] = {0, 0, 0, 0, 0, 0};
+	for (int i = 0; i < 6; i++) {
+		digits[i] = idx % this->radix_array[i];
+		idx /= this->radix_array[i];
+	}
+
+	state_ptr->hydro_GWh = digits[0];
+	state_ptr->storage_GWh = digits[1];
+	state_ptr->coal_GWh = digits[2];
+	state_ptr->combined_GWh = digits[3];
+	state_ptr->geothermal_GWh = digits[4];
+	state_ptr->fission_GWh = digits[5];
+
+	return;
+}	// end DispatchSolver::decode()
+
+
+DispatchState DispatchSolver::getInitialState(void) {
+	/*
+	 *	Method to get the state at the start of the day (reservoir full,
+	 *	storage empty, nothing run yet)
+	 */
+
+	DispatchState state;
+	state.hydro_GWh = this->hydro_capacity_GWh;
+	state.storage_GWh = 0;
+	state.coal_GWh = 0;
+	state.combined_GWh = 0;
+	state.geothermal_GWh = 0;
+	state.fission_GWh = 0;
+
+	return state;
+}	// end DispatchSolver::getInitialState()
+
+
+double DispatchSolver::maximize(
+	int hour,
+	const DispatchState& state,
+	DispatchAction* action_ptr
+) {
+	/*
+	 *	Method to get the best score from the given hour and state on (this
+	 *	hour's score plus the best score from the next hour's state), and the
+	 *	action that gets it
+	 *
+	 *	Every dispatch is enumerated, except the peaker: below demand another
+	 *	peaker marble nets +0.25 and meeting demand nets +demand, so the only
+	 *	candidates are "as much as is needed" and, beyond that, as much more
+	 *	as storage could take.
+	 */
+
+	bool first_hour = (hour == 0);
+	int demand_GWh = this->demand_GWh_vec[hour];
+	int renewable_GWh = this->renewable_GWh_vec[hour];
+
+	const float* next_value_ptr = NULL;
+	if (hour + 1 < HOURS_PER_GAME) {
+		next_value_ptr = &(this->value_vec[(hour + 1) * this->n_states]);
+	}
+
+	// dispatch ranges
+	int coal_min = 0;
+	int coal_max = 0;
+	rampRange(state.coal_GWh, 1, this->coal_GW, first_hour, &coal_min, &coal_max);
+
+	int combined_min = 0;
+	int combined_max = 0;
+	rampRange(
+		state.combined_GWh, 2, this->combined_GW, first_hour, &combined_min, &combined_max
+	);
+
+	int geothermal_min = 0;
+	int geothermal_max = 0;
+	rampRange(
+		state.geothermal_GWh, 2, this->geothermal_GW, first_hour,
+		&geothermal_min, &geothermal_max
+	);
+
+	int fission_min = state.fission_GWh;
+	int fission_max = state.fission_GWh;
+	if (first_hour) {
+		fission_min = 0;
+		fission_max = this->fission_GW;
+	}
+
+	int hydro_min = 0;
+	int hydro_max = 0;
+	if (state.hydro_GWh > 0) {
+		hydro_min = 1;	// minimum discharge
+		hydro_max = std::max(1, std::min(this->hydro_GW, state.hydro_GWh));
+	}
+
+	int storage_max = std::min(this->storage_GW, state.storage_GWh);
+
+	// enumerate
+	double best_value = -std::numeric_limits<double>::infinity();
+
+	for (int fission = fission_min; fission <= fission_max; fission++) {
+	for (int coal = coal_min; coal <= coal_max; coal++) {
+	for (int combined = combined_min; combined <= combined_max; combined++) {
+	for (int geothermal = geothermal_min; geothermal <= geothermal_max; geothermal++) {
+		int thermal_GWh = renewable_GWh + fission + coal + combined + geothermal;
+		double thermal_cost = coal + 0.5 * combined;
+		int thermal_idx = coal * this->stride_array[2] +
+			combined * this->stride_array[3] +
+			geothermal * this->stride_array[4] +
+			fission * this->stride_array[5];
+
+		for (int hydro = hydro_min; hydro <= hydro_max; hydro++) {
+			int hydro_idx = thermal_idx + (state.hydro_GWh - hydro) * this->stride_array[0];
+
+			for (int storage = 0; storage <= storage_max; storage++) {
+				int other_GWh = thermal_GWh + hydro + storage;
+				int storage_after_GWh = state.storage_GWh - storage;
+				int space_GWh = this->storage_GW - storage_after_GWh;
+
+				int needed_GWh = std::max(0, demand_GWh - other_GWh);
+				int chargeable_GWh = std::max(
+					0,
+					space_GWh - std::max(0, other_GWh - demand_GWh)
+				);
+				int peaker_first = std::min(this->peaker_GW, needed_GWh);
+				int peaker_last = std::min(this->peaker_GW, needed_GWh + chargeable_GWh);
+
+				for (int peaker = peaker_first; peaker <= peaker_last; peaker++) {
+					int total_GWh = other_GWh + peaker;
+
+					double value = 0;
+					if (total_GWh >= demand_GWh) {
+						value += demand_GWh;
+					}
+					else {
+						value += total_GWh - demand_GWh;
+					}
+					value -= thermal_cost + 0.75 * peaker;
+
+					int excess_GWh = std::max(0, total_GWh - demand_GWh);
+					int charge_GWh = std::min(space_GWh, excess_GWh);
+					value -= excess_GWh - charge_GWh;
+
+					if (next_value_ptr != NULL) {
+						value += next_value_ptr[
+							hydro_idx +
+							(storage_after_GWh + charge_GWh) * this->stride_array[1]
+						];
+					}
+
+					if (value > best_value) {
+						best_value = value;
+
+						if (action_ptr != NULL) {
+							action_ptr->coal_GWh = coal;
+							action_ptr->combined_GWh = combined;
+							action_ptr->fission_GWh = fission;
+							action_ptr->geothermal_GWh = geothermal;
+							action_ptr->hydro_GWh = hydro;
+							action_ptr->peaker_GWh = peaker;
+							action_ptr->storage_GWh = storage;
+						}
+					}
+				}
+			}
+		}
+	}
+	}
+	}
+	}
+
+	return best_value;
+}	// end DispatchSolver::maximize()
+
+
+void DispatchSolver::parallelFor(int n, const std::function<void(int, int)>& body) {
+	/*
+	 *	Method to run body over [0, n), split into one contiguous chunk per
+	 *	thread
+	 */
+
+	int n_threads = std::min(this->n_threads, n);
+	if (n_threads <= 1) {
+		body(0, n);
+		return;
+	}
+
+	std::vector<std::thread> thread_vec;
+	int chunk = (n + n_threads - 1) / n_threads;
+	for (int i = 0; i < n_threads; i++) {
+		int first_idx = i * chunk;
+		int last_idx = std::min(n, first_idx + chunk);
+		if (first_idx >= last_idx) {
+			break;
+		}
+		thread_vec.push_back(std::thread(body, first_idx, last_idx));
+	}
+	for (size_t i = 0; i < thread_vec.size(); i++) {
+		thread_vec[i].join();
+	}
+
+	return;
+}	// end DispatchSolver::parallelFor()
+
+
+double DispatchSolver::maximizeUnramped(int hour, const DispatchState& dispatch) {
+	/*
+	 *	Method to get the best score from the given hour on, given the
+	 *	reservoir and storage charge, and this hour's ramp limited (coal,
+	 *	combined, geothermal, fission) dispatch; i.e. the best hydro, storage,
+	 *	and peaker dispatch (see maximize() for the peaker candidates)
+	 */
+
+	int demand_GWh = this->demand_GWh_vec[hour];
+	int thermal_GWh = this->renewable_GWh_vec[hour] + dispatch.coal_GWh +
+		dispatch.combined_GWh + dispatch.geothermal_GWh + dispatch.fission_GWh;
+	double thermal_cost = dispatch.coal_GWh + 0.5 * dispatch.combined_GWh;
+
+	const float* next_value_ptr = NULL;
+	if (hour + 1 < HOURS_PER_GAME) {
+		next_value_ptr = &(this->value_vec[(hour + 1) * this->n_states]);
+	}
+	int thermal_idx = dispatch.coal_GWh * this->stride_array[2] +
+		dispatch.combined_GWh * this->stride_array[3] +
+		dispatch.geothermal_GWh * this->stride_array[4] +
+		dispatch.fission_GWh * this->stride_array[5];
+
+	int hydro_min = 0;
+	int hydro_max = 0;
+	if (dispatch.hydro_GWh > 0) {
+		hydro_min = 1;	// minimum discharge
+		hydro_max = std::max(1, std::min(this->hydro_GW, dispatch.hydro_GWh));
+	}
+	int storage_max = std::min(this->storage_GW, dispatch.storage_GWh);
+
+	double best_value = -std::numeric_limits<double>::infinity();
+
+	for (int hydro = hydro_min; hydro <= hydro_max; hydro++) {
+		int hydro_idx = thermal_idx + (dispatch.hydro_GWh - hydro) * this->stride_array[0];
+
+		for (int storage = 0; storage <= storage_max; storage++) {
+			int other_GWh = thermal_GWh + hydro + storage;
+			int storage_after_GWh = dispatch.storage_GWh - storage;
+			int space_GWh = this->storage_GW - storage_after_GWh;
+
+			int needed_GWh = std::max(0, demand_GWh - other_GWh);
+			int chargeable_GWh = std::max(
+				0,
+				space_GWh - std::max(0, other_GWh - demand_GWh)
+			);
+			int peaker_first = std::min(this->peaker_GW, needed_GWh);
+			int peaker_last = std::min(this->peaker_GW, needed_GWh + chargeable_GWh);
+
+			for (int peaker = peaker_first; peaker <= peaker_last; peaker++) {
+				int total_GWh = other_GWh + peaker;
+
+				double value = 0;
+				if (total_GWh >= demand_GWh) {
+					value += demand_GWh;
+				}
+				else {
+					value += total_GWh - demand_GWh;
+				}
+				value -= thermal_cost + 0.75 * peaker;
+
+				int excess_GWh = std::max(0, total_GWh - demand_GWh);
+				int charge_GWh = std::min(space_GWh, excess_GWh);
+				value -= excess_GWh - charge_GWh;
+
+				if (next_value_ptr != NULL) {
+					value += next_value_ptr[
+						hydro_idx +
+						(storage_after_GWh + charge_GWh) * this->stride_array[1]
+					];
+				}
+
+				if (value > best_value) {
+					best_value = value;
+				}
+			}
+		}
+	}
+
+	return best_value;
+}	// end DispatchSolver::maximizeUnramped()
+
+
+void DispatchSolver::runningMax(
+	const float* source_ptr,
+	float* target_ptr,
+	int digit,
+	int radius
+) {
+	/*
+	 *	Method to take the max of source over a +/- radius window along the
+	 *	given state digit (clipped to its range), into target
+	 */
+
+	int stride = this->stride_array[digit];
+	int radix = this->radix_array[digit];
+
+	this->parallelFor(
+		this->n_states,
+		[source_ptr, target_ptr, stride, radix, radius](int first_idx, int last_idx) {
+			for (int idx = first_idx; idx < last_idx; idx++) {
+				int value = (idx / stride) % radix;
+				int lower = std::max(0, value - radius);
+				int upper = std::min(radix - 1, value + radius);
+
+				float best_value = source_ptr[idx + (lower - value) * stride];
+				for (int k = lower + 1; k <= upper; k++) {
+					best_value = std::max(best_value, source_ptr[idx + (k - value) * stride]);
+				}
+				target_ptr[idx] = best_value;
+			}
+		}
+	);
+
+	return;
+}	// end DispatchSolver::runningMax()
+
+
+void DispatchSolver::sweepHour(int hour) {
+	/*
+	 *	Method to compute the best score from every state at the given hour
+	 *	(after the first)
+	 *
+	 *	This hour's score and next state depend on last production only
+	 *	through which coal / combined / geothermal dispatch the ramp limits
+	 *	allow, and those are windows of +/- 1, 2, 2 around last production.
+	 *	So the best hydro, storage, and peaker dispatch is found once per
+	 *	(charge, this hour's dispatch), over the same packed index, and the
+	 *	best over each ramp window is then three running maxima (fission
+	 *	is fixed, so no window). States are swept in parallel.
+	 */
+
+	float* value_ptr = &(this->value_vec[hour * this->n_states]);
+	float* scratch_ptr = this->scratch_vec.data();
+
+	// reachable reservoir window (at least 1, at most hydro_GW drawn per hour)
+	int hydro_lower_GWh = std::max(
+		0,
+		this->hydro_capacity_GWh - hour * this->hydro_GW
+	);
+	int hydro_upper_GWh = std::max(0, this->hydro_capacity_GWh - hour);
+
+	// 1. best unramped dispatch (into value, as scratch)
+	this->parallelFor(
+		this->n_states,
+		[this, hour, value_ptr, hydro_lower_GWh, hydro_upper_GWh](
+			int first_idx,
+			int last_idx
+		) {
+			DispatchState dispatch;
+			for (int idx = first_idx; idx < last_idx; idx++) {
+				this->decode(idx, &dispatch);
+				if (
+					dispatch.hydro_GWh < hydro_lower_GWh ||
+					dispatch.hydro_GWh > hydro_upper_GWh
+				) {
+					value_ptr[idx] = 0;	// never referenced from a reachable state
+					continue;
+				}
+				value_ptr[idx] = this->maximizeUnramped(hour, dispatch);
+			}
+		}
+	);
+
+	// 2. best over coal, combined, then geothermal ramp windows
+	this->runningMax(value_ptr, scratch_ptr, 2, 1);
+	this->runningMax(scratch_ptr, value_ptr, 3, 2);
+	this->runningMax(value_ptr, scratch_ptr, 4, 2);
+	std::copy(scratch_ptr, scratch_ptr + this->n_states, value_ptr);
+
+	return;
+}	// end DispatchSolver::sweepHour()
+
+
+double DispatchSolver::solve(void) {
+	/*
+	 *	Method to solve the day by backward induction, returns the optimal
+	 *	score
+	 */
+
+	this->radix_array = {
+		this->hydro_capacity_GWh + 1,
+		this->storage_GW + 1,
+		this->coal_GW + 1,
+		this->combined_GW + 1,
+		this->geothermal_GW + 1,
+		this->fission_GW + 1
+	};
+
+	this->n_states = 1;
+	for (int i = 0; i < 6; i++) {
+		this->stride_array[i] = this->n_states;
+		this->n_states *= this->radix_array[i];
+	}
+
+	this->value_vec.assign(HOURS_PER_GAME * this->n_states, 0);
+	this->scratch_vec.assign(this->n_states, 0);
+	for (int hour = HOURS_PER_GAME - 1; hour >= 1; hour--) {
+		this->sweepHour(hour);
+	}
+
+	// first hour, from the initial state only
+	this->optimal_score = this->maximize(0, this->getInitialState(), NULL);
+	this->solved = true;
+
+	return this->optimal_score;
+}	// end DispatchSolver::solve()
+
+
+double DispatchSolver::solveExpected(
+	const std::vector<std::pair<int, int>>& slot_vec,
+	int n_days,
+	unsigned long long seed
+) {
+	/*
+	 *	Method to get the expected optimal score of a portfolio of (plant
+	 *	type, tokens) slots, over n_days sampled days (as BatchRunner games)
+	 *
+	 *	Each day is played out once under merit order dispatch, only to record
+	 *	its demand and renewable production (only solar depends on dispatch,
+	 *	through smog).
+	 */
+
+	static const std::vector<int> merit_order = {
+		PLANT_FISSION, PLANT_GEOTHERMAL, PLANT_HYDRO, PLANT_STORAGE,
+		PLANT_COMBINED, PLANT_PEAKER, PLANT_COAL
+	};
+
+	if (n_days <= 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: DispatchSolver::solveExpected(): " <<
+			"n_days must be positive (got " << n_days << ")";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	GridSimulator grid_simulator(0);
+	std::vector<int> demand_GWh_vec(HOURS_PER_GAME, 0);
+	std::vector<int> renewable_GWh_vec(HOURS_PER_GAME, 0);
+	double total_score = 0;
+
+	for (int day = 0; day < n_days; day++) {
+		grid_simulator.clearPlants();
+		grid_simulator.reset(deriveSeed(seed, RNG_BATCH, day));
+		for (size_t i = 0; i < slot_vec.size(); i++) {
+			grid_simulator.pushPlantTokens(slot_vec[i].first, slot_vec[i].second);
+		}
+
+		// record the day
+		grid_simulator.start();
+		for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+			demand_GWh_vec[hour] = grid_simulator.getEnergyDemandGWh();
+			renewable_GWh_vec[hour] = 0;
+			for (int i = 0; i < grid_simulator.getNumPlants(); i++) {
+				switch (grid_simulator.getPlantModel(i).type) {
+					case (PLANT_SOLAR):
+					case (PLANT_TIDAL):
+					case (PLANT_WAVE):
+					case (PLANT_WIND):
+						renewable_GWh_vec[hour] += grid_simulator.getPlantModel(i).mustered_GWh;
+						break;
+
+					default:
+						// do nothing!
+						break;
+				}
+			}
+
+			grid_simulator.dispatchMeritOrder(merit_order);
+			grid_simulator.commitHour();
+		}
+
+		// solve it
+		this->clearPortfolio();
+		for (int i = 0; i < grid_simulator.getNumPlants(); i++) {
+			this->pushPlant(
+				grid_simulator.getPlantModel(i).type,
+				grid_simulator.getPlantModel(i).capacity_GW
+			);
+		}
+		this->setDay(demand_GWh_vec, renewable_GWh_vec);
+		total_score += this->solve();
+	}
+
+	return total_score / n_days;
+}	// end DispatchSolver::solveExpected()
+
+
+int DispatchSolver::getNumStates(void) {
+	return this->n_states;
+}	// end DispatchSolver::getNumStates()
+
+
+double DispatchSolver::getOptimalScore(void) {
+	return this->optimal_score;
+}	// end DispatchSolver::getOptimalScore()
+
+
+std::vector<DispatchAction> DispatchSolver::getSchedule(void) {
+	/*
+	 *	Method to get the optimal dispatch schedule (the optimal policy,
+	 *	followed from the initial state)
+	 */
+
+	if (!this->solved) {
+		this->solve();
+	}
+
+	std::vector<DispatchAction> schedule_vec;
+	schedule_vec.reserve(HOURS_PER_GAME);
+
+	DispatchState state = this->getInitialState();
+	for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+		DispatchAction action;
+		this->maximize(hour, state, &action);
+		schedule_vec.push_back(action);
+
+		// step state
+		int total_GWh = this->renewable_GWh_vec[hour] + action.coal_GWh +
+			action.combined_GWh + action.fission_GWh + action.geothermal_GWh +
+			action.hydro_GWh + action.peaker_GWh + action.storage_GWh;
+		int excess_GWh = std::max(0, total_GWh - this->demand_GWh_vec[hour]);
+
+		state.hydro_GWh -= action.hydro_GWh;
+		state.storage_GWh -= action.storage_GWh;
+		state.storage_GWh += std::min(
+			this->storage_GW - state.storage_GWh,
+			excess_GWh
+		);
+		state.coal_GWh = action.coal_GWh;
+		state.combined_GWh = action.combined_GWh;
+		state.geothermal_GWh = action.geothermal_GWh;
+		state.fission_GWh = action.fission_GWh;
+	}
+
+	return schedule_vec;
+}	// end DispatchSolver::getSchedule()
+
+
+DispatchSolver::~DispatchSolver(void) {
+	/*
+	 *	Destructor for DispatchSolver class
+	 */
+
+	// stream out and return
+	std::cout << "DispatchSolver object at " << this << " destroyed." << std::endl;
+	return;
+}	// end DispatchSolver::~DispatchSolver()
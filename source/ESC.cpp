@@ -25,6 +25,9 @@
 #include "../header/constants.h"
 #include "../header/includes.h"
 
+#include "../header/AssetPack.h"
+#include "../header/AtlasPacker.h"
+#include "../header/PixelCache.h"
 #include "../header/ESC.h"
 
 
@@ -118,10 +121,12 @@ sf::RenderWindow* playBrandAnimation(std::string input_str) {
 	sf::RenderWindow* window_ptr = getRenderWindowPtr(
 		"[ESC] Interactive - thanks for playing! =)"
 	);
+	FramePacer frame_pacer;
+	frame_pacer.setVerticalSync(window_ptr, true);
 
 	// load brand assets
 	sf::Font font;
-	assert (font.loadFromFile("assets/ESC_brand/OpenSans-Bold.ttf"));
+	assert (loadAsset(&font, "assets/ESC_brand/OpenSans-Bold.ttf"));
 	sf::Text input_text(input_str, font, 16);
 	input_text.setPosition(
 		int(round(SCREEN_WIDTH - 16 - input_text.getLocalBounds().width)),
@@ -130,21 +135,21 @@ sf::RenderWindow* playBrandAnimation(std::string input_str) {
 
 	sf::Texture ESC_large_txtr;
 	ESC_large_txtr.setSmooth(true);
-	assert (ESC_large_txtr.loadFromFile("assets/ESC_brand/ESC_key_109x90.png"));
+	assert (loadAsset(&ESC_large_txtr, "assets/ESC_brand/ESC_key_109x90.png"));
 	sf::Sprite ESC_large_sprite(ESC_large_txtr);
 
 	sf::Texture ESC_small_txtr;
 	ESC_small_txtr.setSmooth(true);
-	assert (ESC_small_txtr.loadFromFile("assets/ESC_brand/ESC_key_98x81.png"));
+	assert (loadAsset(&ESC_small_txtr, "assets/ESC_brand/ESC_key_98x81.png"));
 	sf::Sprite ESC_small_sprite(ESC_small_txtr);
 
 	sf::SoundBuffer key_press_buffer;
-	assert (key_press_buffer.loadFromFile("assets/ESC_brand/key_press.ogg"));
+	assert (loadAsset(&key_press_buffer, "assets/ESC_brand/key_press.ogg"));
 	sf::Sound key_press_sound(key_press_buffer);
 
 	// set window icon
 	sf::Image window_icon;
-	assert (window_icon.loadFromFile("assets/ESC_brand/ESC_key_109x90.png"));
+	assert (loadAsset(&window_icon, "assets/ESC_brand/ESC_key_109x90.png"));
 	window_ptr->setIcon(
 		window_icon.getSize().x,
 		window_icon.getSize().y,
@@ -438,6 +443,12 @@ sf::RenderWindow* playBrandAnimation(std::string input_str) {
 		if (animation_finished) {
 			break;
 		}
+
+		// sleep until next "clock tick"
+		frame_pacer.waitUntil(
+			(frame + 1) * SECONDS_PER_FRAME,
+			clock.getElapsedTime().asSeconds()
+		);
 	}
 
 	// clear and flip
@@ -448,6 +459,174 @@ sf::RenderWindow* playBrandAnimation(std::string input_str) {
 }	// end playBrandAnimation()
 
 
+bool loadAsset(sf::Font* font_ptr, std::string path) {
+	/*
+	 *	Function to load a font from the asset pack, if the path is packed
+	 *	(zero-copy, the font reads from the mapping for as long as it lives),
+	 *	else from the loose file at path
+	 */
+
+	size_t size = 0;
+	const char* data_ptr = assetPack().find(path, &size);
+	if (data_ptr != NULL) {
+		return font_ptr->loadFromMemory(data_ptr, size);
+	}
+
+	return font_ptr->loadFromFile(path);
+}	// end loadAsset()
+
+
+static const char* readAsset(std::string path, std::string* file_str_ptr, size_t* size_ptr) {
+	/*
+	 *	Helper function to get the bytes of an asset, from the asset pack if
+	 *	packed (no copy), else read into file_str (NULL if neither)
+	 */
+
+	const char* data_ptr = assetPack().find(path, size_ptr);
+	if (data_ptr != NULL) {
+		return data_ptr;
+	}
+
+	std::ifstream in_stream(path, std::ios::binary);
+	if (!in_stream.is_open()) {
+		return NULL;
+	}
+	file_str_ptr->assign(
+		(std::istreambuf_iterator<char>(in_stream)),
+		std::istreambuf_iterator<char>()
+	);
+	*size_ptr = file_str_ptr->size();
+
+	return file_str_ptr->data();
+}	// end readAsset()
+
+
+bool loadAsset(sf::Image* image_ptr, std::string path) {
+	/*
+	 *	Function to load an image (from the pixel cache if the source is
+	 *	unchanged, else decoded from the asset pack or file, and cached)
+	 */
+
+	std::string file_str;
+	size_t size = 0;
+	const char* data_ptr = readAsset(path, &file_str, &size);
+	if (data_ptr == NULL) {
+		return false;
+	}
+
+	unsigned long long source_hash = PixelCache::hashBytes(data_ptr, size);
+	unsigned int width = 0;
+	unsigned int height = 0;
+	const char* pixels_ptr = pixelCache().find(path, source_hash, &width, &height);
+	if (pixels_ptr != NULL) {
+		image_ptr->create(width, height, (const sf::Uint8*)pixels_ptr);
+		return true;
+	}
+
+	if (!image_ptr->loadFromMemory(data_ptr, size)) {
+		return false;
+	}
+	pixelCache().store(
+		path,
+		source_hash,
+		image_ptr->getSize().x,
+		image_ptr->getSize().y,
+		image_ptr->getPixelsPtr()
+	);
+
+	return true;
+}	// end loadAsset()
+
+
+bool loadAsset(sf::Texture* texture_ptr, std::string path) {
+	/*
+	 *	Function to load a texture (uploaded straight from the mapped pixel
+	 *	cache if the source is unchanged, else decoded and cached)
+	 */
+
+	std::string file_str;
+	size_t size = 0;
+	const char* data_ptr = readAsset(path, &file_str, &size);
+	if (data_ptr == NULL) {
+		return false;
+	}
+
+	unsigned long long source_hash = PixelCache::hashBytes(data_ptr, size);
+	unsigned int width = 0;
+	unsigned int height = 0;
+	const char* pixels_ptr = pixelCache().find(path, source_hash, &width, &height);
+	if (pixels_ptr != NULL) {
+		if (!texture_ptr->create(width, height)) {
+			return false;
+		}
+		texture_ptr->update((const sf::Uint8*)pixels_ptr);
+		return true;
+	}
+
+	sf::Image image;
+	if (!image.loadFromMemory(data_ptr, size)) {
+		return false;
+	}
+	pixelCache().store(
+		path,
+		source_hash,
+		image.getSize().x,
+		image.getSize().y,
+		image.getPixelsPtr()
+	);
+
+	return texture_ptr->loadFromImage(image);
+}	// end loadAsset()
+
+
+bool loadAsset(sf::SoundBuffer* soundbuffer_ptr, std::string path) {
+	/*
+	 *	Function to load a sound buffer (from the asset pack if packed, else
+	 *	from file)
+	 */
+
+	size_t size = 0;
+	const char* data_ptr = assetPack().find(path, &size);
+	if (data_ptr != NULL) {
+		return soundbuffer_ptr->loadFromMemory(data_ptr, size);
+	}
+
+	return soundbuffer_ptr->loadFromFile(path);
+}	// end loadAsset()
+
+
+bool openAsset(sf::Music* music_ptr, std::string path) {
+	/*
+	 *	Function to open a music stream (from the asset pack if packed, else
+	 *	from file; zero-copy, streams from the mapping)
+	 */
+
+	size_t size = 0;
+	const char* data_ptr = assetPack().find(path, &size);
+	if (data_ptr != NULL) {
+		return music_ptr->openFromMemory(data_ptr, size);
+	}
+
+	return music_ptr->openFromFile(path);
+}	// end openAsset()
+
+
+bool openAsset(sf::InputSoundFile* sound_file_ptr, std::string path) {
+	/*
+	 *	Function to open a sound file for decoding (from the asset pack if
+	 *	packed, else from file)
+	 */
+
+	size_t size = 0;
+	const char* data_ptr = assetPack().find(path, &size);
+	if (data_ptr != NULL) {
+		return sound_file_ptr->openFromMemory(data_ptr, size);
+	}
+
+	return sound_file_ptr->openFromFile(path);
+}	// end openAsset()
+
+
 // -------- class implementations -------- //
 
 
@@ -458,7 +637,13 @@ Assets::Assets() {
 	 *	Constructor for Assets class
 	 */
 
-	//
+	this->frame = 0;
+	this->n_lazy_loads = 0;
+	this->n_evictions = 0;
+	this->n_glyphs_warmed = 0;
+	this->n_glyph_misses = 0;
+	this->residency_budget =
+		(unsigned long long)(ASSET_RESIDENCY_BUDGET_MB) * 1024 * 1024;
 
 	// stream out and return
 	std::cout << "Assets object created at " << this << "." << std::endl;
@@ -466,14 +651,14 @@ Assets::Assets() {
 }	// end Assets::Assets()
 
 
-void Assets::loadFont(std::string path_2_font, std::string asset_key) {
+FontId Assets::loadFont(std::string path_2_font, std::string asset_key) {
 	/*
-	 *	Method to load font and add to font_map
+	 *	Method to load font into its slot, returns its handle
 	 */
 
 	sf::Font* font = new sf::Font();
 
-	if (!font->loadFromFile(path_2_font))
+	if (!loadAsset(font, path_2_font))
 	{
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: Assets::loadFont(): Cannot load font at \"" <<
@@ -481,28 +666,29 @@ void Assets::loadFont(std::string path_2_font, std::string asset_key) {
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	if (this->font_map.count(asset_key) > 0) {
+	FontId font_id = this->internFont(asset_key);
+	if (this->font_ptr_vec[font_id.idx] != NULL) {
 		std::cout << "WARNING: Assets::loadFont(): Asset key \"" << asset_key <<
 			"\" already in use. Asset will be overwritten!" << std::endl;
-		delete this->font_map[asset_key];
+		delete this->font_ptr_vec[font_id.idx];
 	}
 
-	this->font_map[asset_key] = font;
+	this->font_ptr_vec[font_id.idx] = font;
 	std::cout << "\tsf::Font asset \"" << asset_key << "\" loaded at " <<
 		font << "." << std::endl;
 
-	return;
+	return font_id;
 }	// end Assets::loadFont()
 
 
-void Assets::loadTexture(std::string path_2_texture, std::string asset_key) {
+TextureId Assets::loadTexture(std::string path_2_texture, std::string asset_key) {
 	/*
-	 *	Method to load texture and add to texture_map
+	 *	Method to load texture into its slot, returns its handle
 	 */
 
 	sf::Texture* texture = new sf::Texture();
 
-	if (!texture->loadFromFile(path_2_texture))
+	if (!loadAsset(texture, path_2_texture))
 	{
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: Assets::loadTexture(): Cannot load texture at \"" <<
@@ -510,18 +696,51 @@ void Assets::loadTexture(std::string path_2_texture, std::string asset_key) {
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	if (this->texture_map.count(asset_key) > 0) {
+	return this->storeTexture(texture, asset_key);
+}	// end Assets::loadTexture()
+
+
+TextureId Assets::loadTexture(const sf::Image& image, std::string asset_key) {
+	/*
+	 *	Method to load texture from a decoded image (see AssetLoader) into its
+	 *	slot, returns its handle
+	 */
+
+	sf::Texture* texture = new sf::Texture();
+
+	if (!texture->loadFromImage(image))
+	{
+		delete texture;
+
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: Assets::loadTexture(): Cannot upload texture \"" <<
+			asset_key << "\".";
+	    throw std::runtime_error(error_ss.str());
+	}
+
+	return this->storeTexture(texture, asset_key);
+}	// end Assets::loadTexture()
+
+
+TextureId Assets::storeTexture(sf::Texture* texture, std::string asset_key) {
+	/*
+	 *	Method to store a loaded texture in its slot, returns its handle
+	 */
+
+	TextureId texture_id = this->internTexture(asset_key);
+	if (this->texture_ptr_vec[texture_id.idx] != NULL) {
 		std::cout << "WARNING: Assets::loadTexture(): Asset key \"" << asset_key <<
 			"\" already in use. Asset will be overwritten!" << std::endl;
-		delete this->texture_map[asset_key];
+		delete this->texture_ptr_vec[texture_id.idx];
 	}
 
-	this->texture_map[asset_key] = texture;
+	this->texture_ptr_vec[texture_id.idx] = texture;
+	this->region_vec[texture_id.idx].texture_ptr = NULL;	// (until the atlas is rebuilt)
 	std::cout << "\tsf::Texture asset \"" << asset_key << "\" loaded at " <<
 		texture << "." << std::endl;
 
-	return;
-}	// end Assets::loadTexture()
+	return texture_id;
+}	// end Assets::storeTexture()
 
 
 void Assets::loadSoundBuffer(std::string path_2_soundbuffer, std::string asset_key) {
@@ -531,7 +750,7 @@ void Assets::loadSoundBuffer(std::string path_2_soundbuffer, std::string asset_k
 
 	sf::SoundBuffer* soundbuffer = new sf::SoundBuffer();
 
-	if (!soundbuffer->loadFromFile(path_2_soundbuffer))
+	if (!loadAsset(soundbuffer, path_2_soundbuffer))
 	{
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: Assets::loadSoundBuffer(): Cannot load sound buffer at \"" <<
@@ -539,10 +758,21 @@ void Assets::loadSoundBuffer(std::string path_2_soundbuffer, std::string asset_k
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	if (this->soundbuffer_map.count(asset_key) > 0) {
+	this->storeSoundBuffer(soundbuffer, asset_key);
+	return;
+}	// end Assets::loadSoundBuffer()
+
+
+void Assets::storeSoundBuffer(sf::SoundBuffer* soundbuffer, std::string asset_key) {
+	/*
+	 *	Method to add a loaded sound buffer to soundbuffer_map
+	 */
+
+	auto itr = this->soundbuffer_map.find(asset_key);
+	if (itr != this->soundbuffer_map.end()) {
 		std::cout << "WARNING: Assets::loadSoundBuffer(): Asset key \"" << asset_key <<
 			"\" already in use. Asset will be overwritten!" << std::endl;
-		delete this->soundbuffer_map[asset_key];
+		delete itr->second;
 	}
 
 	this->soundbuffer_map[asset_key] = soundbuffer;
@@ -550,127 +780,952 @@ void Assets::loadSoundBuffer(std::string path_2_soundbuffer, std::string asset_k
 		soundbuffer << "." << std::endl;
 
 	return;
-}	// end Assets::loadSoundBuffer()
+}	// end Assets::storeSoundBuffer()
 
 
-void Assets::loadSound(std::string path_2_sound, std::string asset_key) {
+SoundId Assets::loadSound(std::string path_2_sound, std::string asset_key) {
 	/*
-	 *	Method to load sound and add to sound_map
+	 *	Method to load sound into its slot, returns its handle
 	 */
 
 	// create associated sf::SoundBuffer
 	this->loadSoundBuffer(path_2_sound, asset_key);
 
+	return this->storeSound(asset_key);
+}	// end Assets::loadSound()
+
+
+SoundId Assets::loadSound(
+	const std::vector<sf::Int16>& sample_vec,
+	unsigned int channel_count,
+	unsigned int sample_rate,
+	std::string asset_key
+) {
+	/*
+	 *	Method to load sound from decoded samples (see AssetLoader) into its
+	 *	slot, returns its handle
+	 */
+
+	// create associated sf::SoundBuffer
+	sf::SoundBuffer* soundbuffer = new sf::SoundBuffer();
+
+	if (
+		!soundbuffer->loadFromSamples(
+			sample_vec.data(),
+			sample_vec.size(),
+			channel_count,
+			sample_rate
+		)
+	) {
+		delete soundbuffer;
+
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: Assets::loadSound(): Cannot upload sound buffer \"" <<
+			asset_key << "\".";
+	    throw std::runtime_error(error_ss.str());
+	}
+
+	this->storeSoundBuffer(soundbuffer, asset_key);
+	return this->storeSound(asset_key);
+}	// end Assets::loadSound()
+
+
+SoundId Assets::storeSound(std::string asset_key) {
+	/*
+	 *	Method to create a sound on the (stored) sound buffer of the same key,
+	 *	in its slot, returns its handle
+	 */
+
 	sf::Sound* sound = new sf::Sound();
 	sound->setBuffer(*(this->soundbuffer_map[asset_key]));
 
-	if (this->sound_map.count(asset_key) > 0) {
+	SoundId sound_id = this->internSound(asset_key);
+	if (this->sound_ptr_vec[sound_id.idx] != NULL) {
 		std::cout << "WARNING: Assets::loadSound(): Asset key \"" << asset_key <<
 			"\" already in use. Asset will be overwritten!" << std::endl;
-		delete this->sound_map[asset_key];
+		delete this->sound_ptr_vec[sound_id.idx];
 	}
 
-	this->sound_map[asset_key] = sound;
+	this->sound_ptr_vec[sound_id.idx] = sound;
 	std::cout << "\tsf::Sound asset \"" << asset_key << "\" loaded at " <<
 		sound << "." << std::endl;
 
+	return sound_id;
+}	// end Assets::storeSound()
+
+
+TextureId Assets::registerTexture(std::string path_2_texture, std::string asset_key) {
+	/*
+	 *	Method to register a texture to be loaded on first fetch (lazily, and
+	 *	evictable), returns its handle
+	 */
+
+	TextureId texture_id = this->internTexture(asset_key);
+	this->texture_path_vec[texture_id.idx] = path_2_texture;
+
+	std::cout << "\tsf::Texture asset \"" << asset_key << "\" registered (lazy)." <<
+		std::endl;
+
+	return texture_id;
+}	// end Assets::registerTexture()
+
+
+SoundId Assets::registerSound(std::string path_2_sound, std::string asset_key) {
+	/*
+	 *	Method to register a sound to be loaded on first fetch (lazily, and
+	 *	evictable), returns its handle
+	 */
+
+	SoundId sound_id = this->internSound(asset_key);
+	this->sound_path_vec[sound_id.idx] = path_2_sound;
+
+	std::cout << "\tsf::Sound asset \"" << asset_key << "\" registered (lazy)." <<
+		std::endl;
+
+	return sound_id;
+}	// end Assets::registerSound()
+
+
+void Assets::clearAtlas(void) {
+	/*
+	 *	Method to delete atlas pages and regions (textures draw from their own
+	 *	texture until the atlas is rebuilt)
+	 */
+
+	for (size_t i = 0; i < this->atlas_ptr_vec.size(); i++) {
+		delete this->atlas_ptr_vec[i];
+	}
+	this->atlas_ptr_vec.clear();
+
+	for (size_t i = 0; i < this->region_vec.size(); i++) {
+		this->region_vec[i].texture_ptr = NULL;
+	}
+
 	return;
-}	// end Assets::loadSound()
+}	// end Assets::clearAtlas()
+
+
+int Assets::buildAtlas(
+	const std::vector<std::string>& key_vec,
+	int page_size,
+	int padding
+) {
+	/*
+	 *	Method to pack the given (loaded, eager) textures into atlas pages
+	 *	(see AtlasPacker), so that getRegion() can hand out (page, rect)
+	 *	pairs. Each texture packed is read back from the GPU here, and kept,
+	 *	so pass only those drawn through getRegion(). Textures too large for
+	 *	a page keep drawing from their own texture. Returns the number of
+	 *	pages.
+	 */
+
+	this->clearAtlas();
+
+	if (page_size > int(sf::Texture::getMaximumSize())) {
+		page_size = sf::Texture::getMaximumSize();
+	}
+
+	// rects are pushed in key order, so rect_idx_vec maps rect to handle
+	AtlasPacker atlas_packer(page_size, padding);
+	std::vector<int> rect_idx_vec;
+	for (size_t i = 0; i < key_vec.size(); i++) {
+		// lazy textures are not packed (they may be evicted)
+		auto itr = this->texture_id_map.find(key_vec[i]);
+		if (
+			itr == this->texture_id_map.end() ||
+			this->texture_ptr_vec[itr->second] == NULL ||
+			!this->texture_path_vec[itr->second].empty()
+		) {
+			std::cout << "WARNING: Assets::buildAtlas(): Texture \"" << key_vec[i] <<
+				"\" is not loaded (or is lazy), not packed." << std::endl;
+			continue;
+		}
+
+		sf::Vector2u size = this->texture_ptr_vec[itr->second]->getSize();
+		atlas_packer.pushRect(itr->first, size.x, size.y);
+		rect_idx_vec.push_back(itr->second);
+	}
+	int n_pages = atlas_packer.pack();
+
+	// blit into page images
+	std::vector<sf::Image> page_vec(n_pages);
+	for (int i = 0; i < n_pages; i++) {
+		int page_height = atlas_packer.getPageHeight(i);
+		if (page_height < 1) {
+			page_height = 1;
+		}
+		page_vec[i].create(page_size, page_height, sf::Color(0, 0, 0, 0));
+	}
+
+	for (int i = 0; i < atlas_packer.getNumRects(); i++) {
+		AtlasRect rect = atlas_packer.getRect(i);
+		if (rect.page < 0) {
+			continue;
+		}
+
+		page_vec[rect.page].copy(
+			this->texture_ptr_vec[rect_idx_vec[i]]->copyToImage(),
+			rect.x,
+			rect.y
+		);
+	}
+
+	// upload pages, then map regions onto them
+	for (int i = 0; i < n_pages; i++) {
+		sf::Texture* texture = new sf::Texture();
+		if (!texture->loadFromImage(page_vec[i])) {
+			delete texture;
+			this->clearAtlas();
+
+			std::stringstream error_ss;
+			error_ss << "EXCEPTION: Assets::buildAtlas(): Cannot create atlas " <<
+				"page " << i << " (" << page_size << " x " <<
+				atlas_packer.getPageHeight(i) << ").";
+			throw std::runtime_error(error_ss.str());
+		}
+		this->atlas_ptr_vec.push_back(texture);
+	}
+
+	int n_packed = 0;
+	for (int i = 0; i < atlas_packer.getNumRects(); i++) {
+		AtlasRect rect = atlas_packer.getRect(i);
+		if (rect.page < 0) {
+			std::cout << "WARNING: Assets::buildAtlas(): Texture \"" << rect.key <<
+				"\" is too large for a " << page_size << " px atlas page." <<
+				std::endl;
+			continue;
+		}
+
+		AtlasRegion& region = this->region_vec[rect_idx_vec[i]];
+		region.texture_ptr = this->atlas_ptr_vec[rect.page];
+		region.rect = sf::IntRect(rect.x, rect.y, rect.width, rect.height);
+		n_packed++;
+	}
+
+	std::cout << "\ttexture atlas: " << n_packed << " of " <<
+		atlas_packer.getNumRects() << " textures packed into " << n_pages <<
+		" page(s), " << int(round(100 * atlas_packer.getOccupancy())) <<
+		"% occupancy" << std::endl;
+
+	return n_pages;
+}	// end Assets::buildAtlas()
+
+
+FontId Assets::internFont(const std::string& asset_key) {
+	/*
+	 *	Method to get the handle for the given font key, reserving an (empty)
+	 *	slot if it has not been seen yet (so handles can be resolved before
+	 *	the font is loaded)
+	 */
+
+	FontId font_id;
+
+	auto itr = this->font_id_map.find(asset_key);
+	if (itr != this->font_id_map.end()) {
+		font_id.idx = itr->second;
+		return font_id;
+	}
+
+	font_id.idx = this->font_ptr_vec.size();
+	this->font_id_map[asset_key] = font_id.idx;
+	this->font_key_vec.push_back(asset_key);
+	this->font_ptr_vec.push_back(NULL);
+	this->glyph_size_vec.push_back(std::vector<unsigned int>());
+
+	return font_id;
+}	// end Assets::internFont()
+
+
+TextureId Assets::internTexture(const std::string& asset_key) {
+	/*
+	 *	Method to get the handle for the given texture key, reserving an
+	 *	(empty) slot if it has not been seen yet
+	 */
+
+	TextureId texture_id;
+
+	auto itr = this->texture_id_map.find(asset_key);
+	if (itr != this->texture_id_map.end()) {
+		texture_id.idx = itr->second;
+		return texture_id;
+	}
+
+	texture_id.idx = this->texture_ptr_vec.size();
+	this->texture_id_map[asset_key] = texture_id.idx;
+	this->texture_key_vec.push_back(asset_key);
+	this->texture_ptr_vec.push_back(NULL);
+	this->texture_path_vec.push_back("");
+	this->texture_use_vec.push_back(0);
+
+	AtlasRegion region;
+	region.texture_ptr = NULL;
+	this->region_vec.push_back(region);
+
+	return texture_id;
+}	// end Assets::internTexture()
+
+
+SoundId Assets::internSound(const std::string& asset_key) {
+	/*
+	 *	Method to get the handle for the given sound key, reserving an (empty)
+	 *	slot if it has not been seen yet
+	 */
+
+	SoundId sound_id;
+
+	auto itr = this->sound_id_map.find(asset_key);
+	if (itr != this->sound_id_map.end()) {
+		sound_id.idx = itr->second;
+		return sound_id;
+	}
+
+	sound_id.idx = this->sound_ptr_vec.size();
+	this->sound_id_map[asset_key] = sound_id.idx;
+	this->sound_key_vec.push_back(asset_key);
+	this->sound_ptr_vec.push_back(NULL);
+	this->sound_path_vec.push_back("");
+	this->sound_use_vec.push_back(0);
+
+	return sound_id;
+}	// end Assets::internSound()
+
+
+sf::Font* Assets::getFont(FontId font_id) {
+	/*
+	 *	Method to get font by handle
+	 */
+
+	if (
+		font_id.idx < 0 ||
+		font_id.idx >= int(this->font_ptr_vec.size()) ||
+		this->font_ptr_vec[font_id.idx] == NULL
+	) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: Assets::getFont(): Cannot get font " <<
+			"with asset key \"" << this->getFontKey(font_id) << "\".";
+	    throw std::runtime_error(error_ss.str());
+	}
+
+	return this->font_ptr_vec[font_id.idx];
+}	// end Assets::getFont()
+
+
+sf::Texture* Assets::getTexture(TextureId texture_id) {
+	/*
+	 *	Method to get texture by handle (loading it first if lazy and not
+	 *	resident)
+	 *	be sure to dereference if you need const Texture&
+	 */
+
+	if (
+		texture_id.idx >= 0 &&
+		texture_id.idx < int(this->texture_ptr_vec.size()) &&
+		this->texture_ptr_vec[texture_id.idx] == NULL &&
+		!this->texture_path_vec[texture_id.idx].empty()
+	) {
+		this->loadTexture(
+			this->texture_path_vec[texture_id.idx],
+			this->texture_key_vec[texture_id.idx]
+		);
+		this->n_lazy_loads++;
+	}
+
+	if (
+		texture_id.idx < 0 ||
+		texture_id.idx >= int(this->texture_ptr_vec.size()) ||
+		this->texture_ptr_vec[texture_id.idx] == NULL
+	) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: Assets::getTexture(): Cannot get texture " <<
+			"with asset key \"" << this->getTextureKey(texture_id) << "\".";
+	    throw std::runtime_error(error_ss.str());
+	}
+
+	if (this->texture_use_vec[texture_id.idx] < this->frame) {
+		this->texture_use_vec[texture_id.idx] = this->frame;
+	}
+
+	return this->texture_ptr_vec[texture_id.idx];
+}	// end Assets::getTexture()
+
+
+sf::Sound* Assets::getSound(SoundId sound_id) {
+	/*
+	 *	Method to get sound by handle (loading it first if lazy and not
+	 *	resident)
+	 */
+
+	if (
+		sound_id.idx >= 0 &&
+		sound_id.idx < int(this->sound_ptr_vec.size()) &&
+		this->sound_ptr_vec[sound_id.idx] == NULL &&
+		!this->sound_path_vec[sound_id.idx].empty()
+	) {
+		this->loadSound(
+			this->sound_path_vec[sound_id.idx],
+			this->sound_key_vec[sound_id.idx]
+		);
+		this->n_lazy_loads++;
+	}
+
+	if (
+		sound_id.idx < 0 ||
+		sound_id.idx >= int(this->sound_ptr_vec.size()) ||
+		this->sound_ptr_vec[sound_id.idx] == NULL
+	) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: Assets::getSound(): Cannot get sound " <<
+			"with asset key \"" << this->getSoundKey(sound_id) << "\".";
+	    throw std::runtime_error(error_ss.str());
+	}
+
+	if (this->sound_use_vec[sound_id.idx] < this->frame) {
+		this->sound_use_vec[sound_id.idx] = this->frame;
+	}
+
+	return this->sound_ptr_vec[sound_id.idx];
+}	// end Assets::getSound()
+
 
+AtlasRegion Assets::getRegion(TextureId texture_id) {
+	/*
+	 *	Method to get where to draw the given texture from: its atlas page and
+	 *	rect if packed, else its own texture (whole)
+	 */
+
+	sf::Texture* texture = this->getTexture(texture_id);
+
+	AtlasRegion region = this->region_vec[texture_id.idx];
+	if (region.texture_ptr == NULL) {
+		region.texture_ptr = texture;
+		sf::Vector2u size = texture->getSize();
+		region.rect = sf::IntRect(0, 0, size.x, size.y);
+	}
+
+	return region;
+}	// end Assets::getRegion()
 
-sf::Font* Assets::getFont(std::string asset_key) {
+
+sf::Font* Assets::getFont(const std::string& asset_key) {
 	/*
-	 *	Method to get font from font_map
+	 *	Method to get font by key (cold paths only, prefer handles)
 	 */
 
-	if (this->font_map.count(asset_key) <= 0) {
+	FontId font_id;
+
+	auto itr = this->font_id_map.find(asset_key);
+	if (itr != this->font_id_map.end()) {
+		font_id.idx = itr->second;
+	}
+
+	if (font_id.idx < 0 || this->font_ptr_vec[font_id.idx] == NULL) {
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: Assets::getFont(): Cannot get font " <<
 			"with asset key \"" << asset_key << "\".";
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	return this->font_map[asset_key];
+	return this->font_ptr_vec[font_id.idx];
 }	// end Assets::getFont()
 
 
-sf::Texture* Assets::getTexture(std::string asset_key) {
+sf::Texture* Assets::getTexture(const std::string& asset_key) {
 	/*
-	 *	Method to get texture from texture_map
+	 *	Method to get texture by key (cold paths only, prefer handles)
 	 *	be sure to dereference if you need const Texture&
 	 */
 
-	if (this->texture_map.count(asset_key) <= 0) {
+	TextureId texture_id;
+
+	auto itr = this->texture_id_map.find(asset_key);
+	if (itr != this->texture_id_map.end()) {
+		texture_id.idx = itr->second;
+	}
+
+	if (texture_id.idx < 0) {
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: Assets::getTexture(): Cannot get texture " <<
 			"with asset key \"" << asset_key << "\".";
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	return this->texture_map[asset_key];
+	return this->getTexture(texture_id);
 }	// end Assets::getTexture()
 
 
-sf::SoundBuffer* Assets::getSoundBuffer(std::string asset_key) {
+sf::SoundBuffer* Assets::getSoundBuffer(const std::string& asset_key) {
 	/*
 	 *	Method to get SoundBuffer from soundbuffer_map
 	 */
 
-	if (this->soundbuffer_map.count(asset_key) <= 0) {
+	auto itr = this->soundbuffer_map.find(asset_key);
+	if (itr == this->soundbuffer_map.end()) {
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: Assets::getSoundBuffer(): Cannot get sound buffer " <<
 			"with asset key \"" << asset_key << "\".";
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	return this->soundbuffer_map[asset_key];
+	return itr->second;
 }	// end Assets::getSoundBuffer()
 
 
-sf::Sound* Assets::getSound(std::string asset_key) {
+sf::Sound* Assets::getSound(const std::string& asset_key) {
 	/*
-	 *	Method to get Sound from sound_map
+	 *	Method to get sound by key (cold paths only, prefer handles)
 	 */
 
-	if (this->sound_map.count(asset_key) <= 0) {
+	SoundId sound_id;
+
+	auto itr = this->sound_id_map.find(asset_key);
+	if (itr != this->sound_id_map.end()) {
+		sound_id.idx = itr->second;
+	}
+
+	if (sound_id.idx < 0) {
 		std::stringstream error_ss;
-		error_ss << "EXCEPTION: Assets::getSound(): Cannot get sound buffer " <<
+		error_ss << "EXCEPTION: Assets::getSound(): Cannot get sound " <<
 			"with asset key \"" << asset_key << "\".";
 	    throw std::runtime_error(error_ss.str());
 	}
 
-	return this->sound_map[asset_key];
+	return this->getSound(sound_id);
 }	// end Assets::getSound()
 
 
+AtlasRegion Assets::getRegion(const std::string& asset_key) {
+	/*
+	 *	Method to get where to draw the given texture from, by key (cold paths
+	 *	only, prefer handles)
+	 */
+
+	auto itr = this->texture_id_map.find(asset_key);
+	if (itr == this->texture_id_map.end()) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: Assets::getRegion(): Cannot get texture " <<
+			"with asset key \"" << asset_key << "\".";
+	    throw std::runtime_error(error_ss.str());
+	}
+
+	TextureId texture_id;
+	texture_id.idx = itr->second;
+
+	return this->getRegion(texture_id);
+}	// end Assets::getRegion()
+
+
+std::string Assets::getFontKey(FontId font_id) {
+	/*
+	 *	Method to get the key a font handle was interned from (diagnostics)
+	 */
+
+	if (font_id.idx < 0 || font_id.idx >= int(this->font_key_vec.size())) {
+		return "(invalid handle)";
+	}
+
+	return this->font_key_vec[font_id.idx];
+}	// end Assets::getFontKey()
+
+
+std::string Assets::getTextureKey(TextureId texture_id) {
+	/*
+	 *	Method to get the key a texture handle was interned from (diagnostics)
+	 */
+
+	if (texture_id.idx < 0 || texture_id.idx >= int(this->texture_key_vec.size())) {
+		return "(invalid handle)";
+	}
+
+	return this->texture_key_vec[texture_id.idx];
+}	// end Assets::getTextureKey()
+
+
+std::string Assets::getSoundKey(SoundId sound_id) {
+	/*
+	 *	Method to get the key a sound handle was interned from (diagnostics)
+	 */
+
+	if (sound_id.idx < 0 || sound_id.idx >= int(this->sound_key_vec.size())) {
+		return "(invalid handle)";
+	}
+
+	return this->sound_key_vec[sound_id.idx];
+}	// end Assets::getSoundKey()
+
+
+int Assets::getNumTextures(void) {
+	return this->texture_ptr_vec.size();
+}	// end Assets::getNumTextures()
+
+
+int Assets::getNumAtlasPages(void) {
+	return this->atlas_ptr_vec.size();
+}	// end Assets::getNumAtlasPages()
+
+
+unsigned long long Assets::getTextureBytes(int idx) {
+	/*
+	 *	Method to estimate the memory held by the texture in the given slot
+	 *	(RGBA, 8 bits per channel)
+	 */
+
+	if (this->texture_ptr_vec[idx] == NULL) {
+		return 0;
+	}
+
+	sf::Vector2u size = this->texture_ptr_vec[idx]->getSize();
+	return (unsigned long long)(size.x) * size.y * 4;
+}	// end Assets::getTextureBytes()
+
+
+unsigned long long Assets::getSoundBytes(int idx) {
+	/*
+	 *	Method to estimate the memory held by the sound in the given slot (its
+	 *	buffer's samples)
+	 */
+
+	if (this->sound_ptr_vec[idx] == NULL) {
+		return 0;
+	}
+
+	auto itr = this->soundbuffer_map.find(this->sound_key_vec[idx]);
+	if (itr == this->soundbuffer_map.end()) {
+		return 0;
+	}
+
+	return (unsigned long long)(itr->second->getSampleCount()) * sizeof(sf::Int16);
+}	// end Assets::getSoundBytes()
+
+
+unsigned long long Assets::getResidentBytes(void) {
+	/*
+	 *	Method to estimate the memory held by resident lazy assets
+	 */
+
+	unsigned long long resident_bytes = 0;
+
+	for (size_t i = 0; i < this->texture_ptr_vec.size(); i++) {
+		if (!this->texture_path_vec[i].empty()) {
+			resident_bytes += this->getTextureBytes(i);
+		}
+	}
+
+	for (size_t i = 0; i < this->sound_ptr_vec.size(); i++) {
+		if (!this->sound_path_vec[i].empty()) {
+			resident_bytes += this->getSoundBytes(i);
+		}
+	}
+
+	return resident_bytes;
+}	// end Assets::getResidentBytes()
+
+
+int Assets::getNumLazyLoads(void) {
+	return this->n_lazy_loads;
+}	// end Assets::getNumLazyLoads()
+
+
+int Assets::getNumEvictions(void) {
+	return this->n_evictions;
+}	// end Assets::getNumEvictions()
+
+
+void Assets::evictTexture(int idx) {
+	/*
+	 *	Method to delete the (lazy) texture in the given slot, leaving it
+	 *	registered
+	 */
+
+	std::cout << "\tsf::Texture asset \"" << this->texture_key_vec[idx] << "\" at " <<
+		this->texture_ptr_vec[idx] << " evicted." << std::endl;
+
+	delete this->texture_ptr_vec[idx];
+	this->texture_ptr_vec[idx] = NULL;
+	this->region_vec[idx].texture_ptr = NULL;
+
+	this->n_evictions++;
+	return;
+}	// end Assets::evictTexture()
+
+
+void Assets::evictSound(int idx) {
+	/*
+	 *	Method to delete the (lazy) sound in the given slot and its buffer,
+	 *	leaving it registered
+	 */
+
+	std::cout << "\tsf::Sound asset \"" << this->sound_key_vec[idx] << "\" at " <<
+		this->sound_ptr_vec[idx] << " evicted." << std::endl;
+
+	// sound before its buffer
+	delete this->sound_ptr_vec[idx];
+	this->sound_ptr_vec[idx] = NULL;
+
+	auto itr = this->soundbuffer_map.find(this->sound_key_vec[idx]);
+	if (itr != this->soundbuffer_map.end()) {
+		delete itr->second;
+		this->soundbuffer_map.erase(itr);
+	}
+
+	this->n_evictions++;
+	return;
+}	// end Assets::evictSound()
+
+
+void Assets::trim(void) {
+	/*
+	 *	Method to evict lazy assets, least recently fetched first, until
+	 *	within the residency budget. Assets fetched this frame, and sounds
+	 *	still playing, are never evicted.
+	 */
+
+	unsigned long long resident_bytes = this->getResidentBytes();
+
+	while (resident_bytes > this->residency_budget) {
+		bool texture_flag = false;
+		int lru_idx = -1;
+		int lru_frame = this->frame;
+
+		for (size_t i = 0; i < this->texture_ptr_vec.size(); i++) {
+			if (
+				this->texture_path_vec[i].empty() ||
+				this->texture_ptr_vec[i] == NULL ||
+				this->texture_use_vec[i] >= lru_frame
+			) {
+				continue;
+			}
+
+			texture_flag = true;
+			lru_idx = i;
+			lru_frame = this->texture_use_vec[i];
+		}
+
+		for (size_t i = 0; i < this->sound_ptr_vec.size(); i++) {
+			if (
+				this->sound_path_vec[i].empty() ||
+				this->sound_ptr_vec[i] == NULL ||
+				this->sound_use_vec[i] >= lru_frame ||
+				this->sound_ptr_vec[i]->getStatus() == sf::Sound::Playing
+			) {
+				continue;
+			}
+
+			texture_flag = false;
+			lru_idx = i;
+			lru_frame = this->sound_use_vec[i];
+		}
+
+		// nothing left to evict
+		if (lru_idx < 0) {
+			break;
+		}
+
+		if (texture_flag) {
+			resident_bytes -= this->getTextureBytes(lru_idx);
+			this->evictTexture(lru_idx);
+		}
+
+		else {
+			resident_bytes -= this->getSoundBytes(lru_idx);
+			this->evictSound(lru_idx);
+		}
+	}
+
+	return;
+}	// end Assets::trim()
+
+
+void Assets::prefetchTexture(const std::string& asset_key) {
+	/*
+	 *	Method to load a lazy texture ahead of its use (e.g. on a phase
+	 *	change), held against eviction for ASSET_PREFETCH_HOLD_FRAMES
+	 */
+
+	TextureId texture_id = this->internTexture(asset_key);
+	this->getTexture(texture_id);
+
+	this->texture_use_vec[texture_id.idx] = this->frame + ASSET_PREFETCH_HOLD_FRAMES;
+	return;
+}	// end Assets::prefetchTexture()
+
+
+void Assets::prefetchSound(const std::string& asset_key) {
+	/*
+	 *	Method to load a lazy sound ahead of its use (e.g. on a phase change),
+	 *	held against eviction for ASSET_PREFETCH_HOLD_FRAMES
+	 */
+
+	SoundId sound_id = this->internSound(asset_key);
+	this->getSound(sound_id);
+
+	this->sound_use_vec[sound_id.idx] = this->frame + ASSET_PREFETCH_HOLD_FRAMES;
+	return;
+}	// end Assets::prefetchSound()
+
+
+void Assets::setResidencyBudget(unsigned long long residency_budget) {
+	/*
+	 *	Method to set the residency budget [bytes] of lazy assets (evicting at
+	 *	the end of the frame if now over)
+	 */
+
+	this->residency_budget = residency_budget;
+	return;
+}	// end Assets::setResidencyBudget()
+
+
+void Assets::endFrame(void) {
+	/*
+	 *	Method to end the frame: evict down to the residency budget (nothing
+	 *	fetched this frame is evicted), then advance the frame count
+	 */
+
+	this->trim();
+
+	this->frame++;
+	return;
+}	// end Assets::endFrame()
+
+
+int Assets::warmGlyphs(FontId font_id, unsigned int size) {
+	/*
+	 *	Method to rasterize the printable ASCII glyphs (all the game's text)
+	 *	of the given font at the given size, so that no text in that pair
+	 *	rasterizes (and uploads) glyphs mid-frame; returns glyphs rasterized
+	 */
+
+	sf::Font* font = this->getFont(font_id);
+
+	std::vector<unsigned int>& size_vec = this->glyph_size_vec[font_id.idx];
+	for (size_t i = 0; i < size_vec.size(); i++) {
+		if (size_vec[i] == size) {
+			return 0;
+		}
+	}
+	size_vec.push_back(size);
+
+	int n_glyphs = 0;
+	for (sf::Uint32 code_point = ' '; code_point <= '~'; code_point++) {
+		font->getGlyph(code_point, size, false);
+		n_glyphs++;
+	}
+
+	this->n_glyphs_warmed += n_glyphs;
+	return n_glyphs;
+}	// end Assets::warmGlyphs()
+
+
+bool Assets::checkGlyphs(FontId font_id, unsigned int size, const std::string& str) {
+	/*
+	 *	Method to check that the given text (about to be laid out) draws only
+	 *	warmed glyphs; if not, counts and flags a miss (once per pair, for
+	 *	sizes not warmed)
+	 */
+
+	bool warm_flag = false;
+	std::vector<unsigned int>& size_vec = this->glyph_size_vec[font_id.idx];
+	for (size_t i = 0; i < size_vec.size(); i++) {
+		if (size_vec[i] == size) {
+			warm_flag = true;
+			break;
+		}
+	}
+
+	if (!warm_flag) {
+		std::cout << "WARNING: Assets::checkGlyphs(): Font \"" <<
+			this->getFontKey(font_id) << "\" at size " << size <<
+			" was not warmed (glyphs rasterized mid-frame)." << std::endl;
+
+		size_vec.push_back(size);	// (so flagged once)
+		this->n_glyph_misses++;
+		return false;
+	}
+
+	for (size_t i = 0; i < str.size(); i++) {
+		if ((str[i] < ' ' || str[i] > '~') && str[i] != '\n' && str[i] != '\t') {
+			this->n_glyph_misses++;
+			return false;
+		}
+	}
+
+	return true;
+}	// end Assets::checkGlyphs()
+
+
+unsigned long long Assets::getGlyphPageBytes(void) {
+	/*
+	 *	Method to get the memory held by glyph pages (one texture per font and
+	 *	size, RGBA), over warmed and missed sizes
+	 */
+
+	unsigned long long page_bytes = 0;
+
+	for (size_t i = 0; i < this->font_ptr_vec.size(); i++) {
+		if (this->font_ptr_vec[i] == NULL) {
+			continue;
+		}
+
+		for (size_t j = 0; j < this->glyph_size_vec[i].size(); j++) {
+			sf::Vector2u page_size =
+				this->font_ptr_vec[i]->getTexture(this->glyph_size_vec[i][j]).getSize();
+			page_bytes += (unsigned long long)(page_size.x) * page_size.y * 4;
+		}
+	}
+
+	return page_bytes;
+}	// end Assets::getGlyphPageBytes()
+
+
+int Assets::getNumGlyphsWarmed(void) {
+	return this->n_glyphs_warmed;
+}	// end Assets::getNumGlyphsWarmed()
+
+
+int Assets::getNumGlyphMisses(void) {
+	return this->n_glyph_misses;
+}	// end Assets::getNumGlyphMisses()
+
+
 Assets::~Assets() {
 	/*
 	 *	Destructor for Assets class
 	 */
 
+	// clean up atlas
+	this->clearAtlas();
+
 	// clean up fonts
-	for (
-		auto itr = this->font_map.begin();
-		itr != this->font_map.end();
-		itr++
-	) {
-		delete itr->second;
-		std::cout << "\tsf::Font asset \"" << itr->first << "\" at " <<
-			itr->second << " destroyed." << std::endl;
+	for (size_t i = 0; i < this->font_ptr_vec.size(); i++) {
+		if (this->font_ptr_vec[i] == NULL) {
+			continue;
+		}
+		delete this->font_ptr_vec[i];
+		std::cout << "\tsf::Font asset \"" << this->font_key_vec[i] << "\" at " <<
+			this->font_ptr_vec[i] << " destroyed." << std::endl;
 	}
-	this->font_map.clear();
+	this->font_ptr_vec.clear();
 
 	// clean up textures
-	for (
-		auto itr = this->texture_map.begin();
-		itr != this->texture_map.end();
-		itr++
-	) {
-		delete itr->second;
-		std::cout << "\tsf::Texture asset \"" << itr->first << "\" at " <<
-			itr->second << " destroyed." << std::endl;
+	for (size_t i = 0; i < this->texture_ptr_vec.size(); i++) {
+		if (this->texture_ptr_vec[i] == NULL) {
+			continue;
+		}
+		delete this->texture_ptr_vec[i];
+		std::cout << "\tsf::Texture asset \"" << this->texture_key_vec[i] << "\" at " <<
+			this->texture_ptr_vec[i] << " destroyed." << std::endl;
 	}
-	this->texture_map.clear();
+	this->texture_ptr_vec.clear();
+
+	// clean up sounds (before their buffers)
+	for (size_t i = 0; i < this->sound_ptr_vec.size(); i++) {
+		if (this->sound_ptr_vec[i] == NULL) {
+			continue;
+		}
+		delete this->sound_ptr_vec[i];
+		std::cout << "\tsf::Sound asset \"" << this->sound_key_vec[i] << "\" at " <<
+			this->sound_ptr_vec[i] << " destroyed." << std::endl;
+	}
+	this->sound_ptr_vec.clear();
 
 	// clean up sound buffers
 	for (
@@ -684,18 +1739,6 @@ Assets::~Assets() {
 	}
 	this->soundbuffer_map.clear();
 
-	// clean up sounds
-	for (
-		auto itr = this->sound_map.begin();
-		itr != this->sound_map.end();
-		itr++
-	) {
-		delete itr->second;
-		std::cout << "\tsf::Sound asset \"" << itr->first << "\" at " <<
-			itr->second << " destroyed." << std::endl;
-	}
-	this->sound_map.clear();
-
 	// stream out and return
 	std::cout << "Assets object at " << this << " destroyed." << std::endl;
 	return;
@@ -717,6 +1760,8 @@ MusicPlayer::MusicPlayer(Assets* assets_ptr, sf::RenderWindow* window_ptr) {
 	this->assets_ptr = assets_ptr;
 	this->window_ptr = window_ptr;
 
+	this->teletype_font_id = this->assets_ptr->internFont("teletype");
+
 	// stream out and return
 	std::cout << "MusicPlayer object created at " << this << "." << std::endl;
 	return;
@@ -725,13 +1770,15 @@ MusicPlayer::MusicPlayer(Assets* assets_ptr, sf::RenderWindow* window_ptr) {
 
 void MusicPlayer::addTrack(std::string path_2_track, std::string track_key) {
 	/*
-	 *	Method to "add track" to track_map
+	 *	Method to "add track" to track_map (checked to exist, but not opened
+	 *	until played)
 	 */
 
-	sf::Music* music = new sf::Music();
-
-	if (!music->openFromFile(path_2_track))
-	{
+	size_t pack_size = 0;
+	if (
+		assetPack().find(path_2_track, &pack_size) == NULL &&
+		!std::ifstream(path_2_track).good()
+	) {
 		std::stringstream error_ss;
 		error_ss << "EXCEPTION: MusicPlayer::addTrack(): Cannot add track at \"" <<
 			path_2_track << "\".";
@@ -742,13 +1789,62 @@ void MusicPlayer::addTrack(std::string path_2_track, std::string track_key) {
 		std::cout << "WARNING: MusicPlayer::addTrack(): Track key \"" <<
 			track_key << "\" already in use. Track will be overwritten!" <<
 			std::endl;
-		delete this->track_map[track_key];
+		if (this->track_map[track_key] != NULL) {
+			this->track_map[track_key]->stop();
+			delete this->track_map[track_key];
+		}
 	}
 
-	this->track_map[track_key] = music;
-	this->current_track = this->track_map.begin();
-	std::cout << "\tTrack (sf::Music) \"" << track_key << "\" added at " <<
-		music << "." << std::endl;
+	this->track_map[track_key] = NULL;
+	this->track_path_map[track_key] = path_2_track;
+	this->current_track = this->track_map.begin();
+	std::cout << "\tTrack (sf::Music) \"" << track_key << "\" added." << std::endl;
+
+	return;
+}	// end MusicPlayer::openTrack()
+
+
+void MusicPlayer::openTrack(void) {
+	/*
+	 *	Method to open current track (if not open), and close stopped tracks
+	 */
+
+	if (this->current_track->second == NULL) {
+		sf::Music* music = new sf::Music();
+
+		if (!openAsset(music, this->track_path_map[this->current_track->first]))
+		{
+			delete music;
+
+			std::stringstream error_ss;
+			error_ss << "EXCEPTION: MusicPlayer::openTrack(): Cannot open track at \"" <<
+				this->track_path_map[this->current_track->first] << "\".";
+		    throw std::runtime_error(error_ss.str());
+		}
+
+		this->current_track->second = music;
+		std::cout << "\tTrack (sf::Music) \"" << this->current_track->first <<
+			"\" opened at " << music << "." << std::endl;
+	}
+
+	for (
+		auto itr = this->track_map.begin();
+		itr != this->track_map.end();
+		itr++
+	) {
+		if (
+			itr == this->current_track ||
+			itr->second == NULL ||
+			itr->second->getStatus() != sf::SoundSource::Stopped
+		) {
+			continue;
+		}
+
+		std::cout << "\tTrack (sf::Music) \"" << itr->first << "\" at " <<
+			itr->second << " closed." << std::endl;
+		delete itr->second;
+		itr->second = NULL;
+	}
 
 	return;
 }	// end MusicPlayer::openTrack()
@@ -759,7 +1855,8 @@ void MusicPlayer::play(void) {
 	 *	Method to play current track
 	 */
 
-	// play (resume) current track
+	// play (resume) current track, opening it first if need be
+	this->openTrack();
 	this->current_track->second->play();
 
 	// print track info (if first play)
@@ -778,7 +1875,9 @@ void MusicPlayer::pause(void) {
 	 */
 
 	// pause current track
-	this->current_track->second->pause();
+	if (this->current_track->second != NULL) {
+		this->current_track->second->pause();
+	}
 	return;
 }	// end MusicPlayer::pause()
 
@@ -789,7 +1888,9 @@ void MusicPlayer::stop(void) {
 	 */
 
 	// stop current track
-	this->current_track->second->stop();
+	if (this->current_track->second != NULL) {
+		this->current_track->second->stop();
+	}
 	return;
 }	// end MusicPlayer::stop()
 
@@ -799,7 +1900,7 @@ void MusicPlayer::nextTrack(void) {
 	 *	Method to stop current track and move to next track
 	 */
 
-	this->current_track->second->stop();
+	this->stop();
 
 	this->current_track++;
 	if (this->current_track == this->track_map.end()) {
@@ -816,7 +1917,7 @@ void MusicPlayer::prevTrack(void) {
 	 *	Method to stop current track and move to previous track
 	 */
 
-	this->current_track->second->stop();
+	this->stop();
 
 	if (this->current_track == this->track_map.begin()) {
 		this->current_track = this->track_map.end();
@@ -846,70 +1947,72 @@ void MusicPlayer::printTrackInfo(void) {
 }	// end MusicPlayer::printTrackInfo()
 
 
-void MusicPlayer::renderTrackInfo(void) {
+void MusicPlayer::update(double dt_s) {
 	/*
-	 *	Method to render track info to window.
+	 *	Method to advance the track info overlay by dt_s (fade in, pause,
+	 *	fade out; renderTrackInfo() only draws it)
 	 */
 
-	if (this->render_flag) {
-		// init rectangles
-		int background_alpha;
-		int text_alpha;
-		sf::RectangleShape background_rect;
-		switch (this->render_state) {
-			case (0):	// fade in
-				background_alpha = this->render_alpha;
-				text_alpha = this->render_alpha;
-				if (background_alpha > 192) {
-					background_alpha = 192;
-				}
-				this->render_alpha += 3;
+	if (!this->render_flag) {
+		return;
+	}
 
-				if (this->render_alpha >= 255) {
-					this->render_alpha = 255;
-					this->render_state++;
-				}
-				break;
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+	switch (this->render_state) {
+		case (0):	// fade in
+			this->render_alpha += 3 * n_frames;
 
-			case (1):	// pause
-				background_alpha = 192;
-				text_alpha = 255;
-				this->render_frame++;
-				if (this->render_frame >= 2 * FRAMES_PER_SECOND) {
-					this->render_state++;
-				}
-				break;
+			if (this->render_alpha >= 255) {
+				this->render_alpha = 255;
+				this->render_state++;
+			}
+			break;
 
-			default:	// fade out
-				background_alpha = this->render_alpha;
-				text_alpha = this->render_alpha;
-				if (background_alpha > 192) {
-					background_alpha = 192;
-				}
-				else if (background_alpha <= 0) {
-					background_alpha = 0;
-				}
-				if (text_alpha <= 0) {
-					text_alpha = 0;
-				}
-				this->render_alpha -= 3;
+		case (1):	// pause
+			this->render_frame += n_frames;
+			if (this->render_frame >= 2 * FRAMES_PER_SECOND) {
+				this->render_state++;
+			}
+			break;
 
-				if (this->render_alpha <= 0) {
-					this->render_alpha = 0;
-					this->render_state = 0;
-					this->render_frame = 0;
-					this->render_flag = false;
-				}
-				break;
+		default:	// fade out
+			this->render_alpha -= 3 * n_frames;
+
+			if (this->render_alpha <= 0) {
+				this->render_alpha = 0;
+				this->render_state = 0;
+				this->render_frame = 0;
+				this->render_flag = false;
+			}
+			break;
+	}
+
+	return;
+}	// end MusicPlayer::update()
+
+
+void MusicPlayer::renderTrackInfo(void) {
+	/*
+	 *	Method to render track info to window.
+	 */
+
+	if (this->render_flag) {
+		// init rectangles (alpha as of the last update())
+		int text_alpha = this->render_alpha;
+		int background_alpha = text_alpha;
+		if (background_alpha > 192) {
+			background_alpha = 192;
 		}
+		sf::RectangleShape background_rect;
 		background_rect.setFillColor(sf::Color(64, 64, 64, background_alpha));
 
 
 		// set text font, size, and string
 		sf::Text track_text;
-		track_text.setFont(*(this->assets_ptr->getFont("teletype")));
+		track_text.setFont(*(this->assets_ptr->getFont(this->teletype_font_id)));
 		track_text.setCharacterSize(16);
 		track_text.setString(this->current_track->first);
+		this->assets_ptr->checkGlyphs(this->teletype_font_id, 16, this->current_track->first);
 		track_text.setFillColor(
 			sf::Color(255, 255, 255, text_alpha)
 		);
@@ -937,11 +2040,25 @@ void MusicPlayer::renderTrackInfo(void) {
 }	// end MusicPlayer::renderTrackInfo()
 
 
+bool MusicPlayer::isRenderingTrackInfo(void) {
+	/*
+	 *	Method to check if the track info overlay is showing (so the game
+	 *	does not go idle while it fades)
+	 */
+
+	return this->render_flag;
+}	// end MusicPlayer::isRenderingTrackInfo()
+
+
 sf::SoundSource::Status MusicPlayer::getStatus(void) {
 	/*
 	 *	Method to get status of current track
 	 */
 
+	if (this->current_track->second == NULL) {
+		return sf::SoundSource::Stopped;
+	}
+
 	return this->current_track->second->getStatus();
 }	// end MusicPlayer::getStatus()
 
@@ -957,6 +2074,9 @@ MusicPlayer::~MusicPlayer() {
 		itr != this->track_map.end();
 		itr++
 	) {
+		if (itr->second == NULL) {
+			continue;
+		}
 		itr->second->stop();
 		delete itr->second;
 		std::cout << "\tTrack (sf::Music) \"" << itr->first << "\" at " <<
@@ -993,6 +2113,7 @@ TextBox::TextBox(
 	this->text_ptr_vec_idx = 0;
  	this->feed_string = "";
  	this->font_key = "";
+	this->font_id = FontId();
 
 	this->assets_ptr = assets_ptr;
 	this->window_ptr = window_ptr;
@@ -1021,6 +2142,7 @@ void TextBox::reset(void) {
 	this->text_ptr_vec_idx = 0;
   	this->feed_string = "";
   	this->font_key = "";
+	this->font_id = FontId();
 
 	for (
 		auto itr = this->text_ptr_vec.begin();
@@ -1035,36 +2157,27 @@ void TextBox::reset(void) {
 }	// end TextBox::reset()
 
 
-void TextBox::drawFrame(void) {
+void TextBox::update(double dt_s) {
 	/*
-	 *	Method to handle drawing of text box frame
+	 *	Method to advance the text box by dt_s (expands the box; drawFrame()
+	 *	only draws it)
 	 */
 
 	if (this->feed_string.empty()) {
 		return;
 	}
 
-	// init backing rect
-	sf::RectangleShape back_rect;
-	back_rect.setFillColor(TEXT_BOX_BACK_COLOUR);
-	back_rect.setPosition(this->x, this->y);
-	back_rect.setOutlineColor(TEXT_BOX_OUTLINE_COLOUR);
-	back_rect.setOutlineThickness(TEXT_BOX_OUTLINE_THICKNESS);
-
-	// animation switch statement
 	switch (this->animation_state) {
-		case (0):	// draw expanding box
-			back_rect.setSize(sf::Vector2f(this->width, this->height));
-
+		case (0):	// expanding box
 			if (this->width < this->target_width) {
-				this->width += 4 * (SECONDS_PER_FRAME) * this->target_width;
+				this->width += 4 * dt_s * this->target_width;
 			}
 			if (this->width >= this->target_width) {
 				this->width = this->target_width;
 			}
 
 			if (this->height < this->target_height) {
-				this->height += 4 * (SECONDS_PER_FRAME) * this->target_height;
+				this->height += 4 * dt_s * this->target_height;
 			}
 			if (this->height >= this->target_height) {
 				this->height = this->target_height;
@@ -1084,14 +2197,50 @@ void TextBox::drawFrame(void) {
 			break;
 	}
 
+	return;
+}	// end TextBox::update()
+
+
+void TextBox::drawFrame(void) {
+	/*
+	 *	Method to handle drawing of text box frame
+	 */
+
+	if (this->feed_string.empty()) {
+		return;
+	}
+
+	// init backing rect
+	sf::RectangleShape back_rect;
+	back_rect.setFillColor(TEXT_BOX_BACK_COLOUR);
+	back_rect.setPosition(this->x, this->y);
+	back_rect.setOutlineColor(TEXT_BOX_OUTLINE_COLOUR);
+	back_rect.setOutlineThickness(TEXT_BOX_OUTLINE_THICKNESS);
+
+	// animation switch statement (sized by update())
+	switch (this->animation_state) {
+		case (0):	// draw expanding box
+			back_rect.setSize(sf::Vector2f(this->width, this->height));
+			break;
+
+		default:
+			// do nothing!
+			break;
+	}
+
 	if (!this->font_key.empty()) {
 		// assemble left text
 		if (this->text_ptr_vec_idx > 0) {
 			this->left_text.setString("Page Left: [<--]");
 			this->left_text.setFont(
-				*(this->assets_ptr->getFont(this->font_key))
+				*(this->assets_ptr->getFont(this->font_id))
 			);
 			this->left_text.setCharacterSize(0.015 * SCREEN_HEIGHT);
+			this->assets_ptr->checkGlyphs(
+				this->font_id,
+				(unsigned int)(0.015 * SCREEN_HEIGHT),
+				"Page Left: [<--]"
+			);
 			double left_width = this->left_text.getLocalBounds().width;
 			double left_height = this->left_text.getLocalBounds().height;
 			this->left_text.setOrigin(0, left_height / 2);
@@ -1109,9 +2258,14 @@ void TextBox::drawFrame(void) {
 		if (this->text_ptr_vec_idx < this->text_ptr_vec.size() - 1) {	// right
 			this->right_text.setString("Page Right: [-->]");
 			this->right_text.setFont(
-				*(this->assets_ptr->getFont(this->font_key))
+				*(this->assets_ptr->getFont(this->font_id))
 			);
 			this->right_text.setCharacterSize(0.015 * SCREEN_HEIGHT);
+			this->assets_ptr->checkGlyphs(
+				this->font_id,
+				(unsigned int)(0.015 * SCREEN_HEIGHT),
+				"Page Right: [-->]"
+			);
 			double right_width = this->right_text.getLocalBounds().width;
 			double right_height = this->right_text.getLocalBounds().height;
 			this->right_text.setOrigin(right_width, right_height / 2);
@@ -1170,13 +2324,19 @@ void TextBox::makeBox(
   	this->y = y;
   	this->feed_string = feed_string;
   	this->font_key = font_key;
+	this->font_id = this->assets_ptr->internFont(font_key);
 
 	// assemble enter text
 	this->enter_text.setString("Close: [Enter]");
 	this->enter_text.setFont(
-		*(this->assets_ptr->getFont(this->font_key))
+		*(this->assets_ptr->getFont(this->font_id))
 	);
 	this->enter_text.setCharacterSize(0.015 * SCREEN_HEIGHT);
+	this->assets_ptr->checkGlyphs(
+		this->font_id,
+		(unsigned int)(0.015 * SCREEN_HEIGHT),
+		"Close: [Enter]"
+	);
 	double enter_width = this->enter_text.getLocalBounds().width;
 	double enter_height = this->enter_text.getLocalBounds().height;
 	this->enter_text.setOrigin(enter_width / 2, enter_height / 2);
@@ -1198,7 +2358,7 @@ void TextBox::makeBox(
 			feed_idx < this->feed_string.size() &&
 			sf::Text(
 				field_str,
-				*(this->assets_ptr->getFont(this->font_key)),
+				*(this->assets_ptr->getFont(this->font_id)),
 				this->font_size
 			).getLocalBounds().height < field_height
 		) {
@@ -1210,7 +2370,7 @@ void TextBox::makeBox(
 				feed_idx < this->feed_string.size() &&
 				sf::Text(
 					line_str,
-					*(this->assets_ptr->getFont(this->font_key)),
+					*(this->assets_ptr->getFont(this->font_id)),
 					this->font_size
 				).getLocalBounds().width < line_width
 			) {
@@ -1247,10 +2407,11 @@ void TextBox::makeBox(
 			}
 		}
 
-		// push field onto text_ptr_vec
+		// push field onto text_ptr_vec (flagging glyphs not warmed)
+		this->assets_ptr->checkGlyphs(this->font_id, this->font_size, field_str);
 		sf::Text* push_text = new sf::Text(
 			field_str,
-			*(this->assets_ptr->getFont(this->font_key)),
+			*(this->assets_ptr->getFont(this->font_id)),
 			this->font_size
 		);
 		push_text->setPosition(
@@ -1345,3 +2506,367 @@ TextBox::~TextBox() {
 	std::cout << "TextBox object at " << this << " destroyed." << std::endl;
 	return;
 }	// end TextBox::~TextBox()
+
+
+// ---- TextCacheKey ---- //
+
+bool TextCacheKey::operator==(const TextCacheKey& other) const {
+	return this->font_idx == other.font_idx &&
+		this->size == other.size &&
+		this->str == other.str;
+}	// end TextCacheKey::operator==()
+
+
+// ---- TextCacheKeyHash ---- //
+
+size_t TextCacheKeyHash::operator()(const TextCacheKey& key) const {
+	/*
+	 *	Hash of a text cache key (string hash, mixed with font and size)
+	 */
+
+	size_t hash = std::hash<std::string>()(key.str);
+	hash ^= (size_t(key.font_idx) << 16) + key.size + 0x9e3779b9 + (hash << 6) +
+		(hash >> 2);
+
+	return hash;
+}	// end TextCacheKeyHash::operator()()
+
+
+// ---- TextCache ---- //
+
+TextCache::TextCache(Assets* assets_ptr, int max_idle_frames) {
+	/*
+	 *	Constructor for TextCache class
+	 */
+
+	if (max_idle_frames < 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: TextCache::TextCache(): max idle frames " <<
+			max_idle_frames << " is not valid.";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->frame = 0;
+	this->max_idle_frames = max_idle_frames;
+	this->frame_hits = 0;
+	this->frame_misses = 0;
+	this->last_hits = 0;
+	this->last_misses = 0;
+	this->total_hits = 0;
+	this->total_misses = 0;
+
+	this->lookup_key.font_idx = -1;
+	this->lookup_key.size = 0;
+
+	this->assets_ptr = assets_ptr;
+
+	// stream out and return
+	std::cout << "TextCache object created at " << this << "." << std::endl;
+	return;
+}	// end TextCache::TextCache()
+
+
+TextCacheEntry* TextCache::get(
+	FontId font_id,
+	unsigned int size,
+	const std::string& str,
+	sf::Color colour
+) {
+	/*
+	 *	Method to get the laid out text for (font, size, string), laying it
+	 *	out only if not already cached
+	 */
+
+	this->lookup_key.font_idx = font_id.idx;
+	this->lookup_key.size = size;
+	this->lookup_key.str = str;
+
+	auto itr = this->entry_map.find(this->lookup_key);
+	if (itr == this->entry_map.end()) {
+		this->frame_misses++;
+
+		itr = this->entry_map.emplace(
+			this->lookup_key,
+			TextCacheEntry()
+		).first;
+
+		// (flags glyphs about to be rasterized mid-frame)
+		this->assets_ptr->checkGlyphs(font_id, size, str);
+
+		TextCacheEntry& entry = itr->second;
+		entry.text.setFont(*(this->assets_ptr->getFont(font_id)));
+		entry.text.setCharacterSize(size);
+		entry.text.setString(str);
+		entry.text.setFillColor(colour);
+		entry.bounds = entry.text.getLocalBounds();
+	}
+	else {
+		this->frame_hits++;
+
+		// colour is per vertex, only touch it if it changed
+		if (itr->second.text.getFillColor() != colour) {
+			itr->second.text.setFillColor(colour);
+		}
+	}
+
+	itr->second.last_frame = this->frame;
+	return &(itr->second);
+}	// end TextCache::get()
+
+
+void TextCache::endFrame(void) {
+	/*
+	 *	Method to close out a frame: tally hits and misses, and evict entries
+	 *	not fetched for max_idle_frames
+	 */
+
+	this->last_hits = this->frame_hits;
+	this->last_misses = this->frame_misses;
+	this->total_hits += this->frame_hits;
+	this->total_misses += this->frame_misses;
+	this->frame_hits = 0;
+	this->frame_misses = 0;
+
+	auto itr = this->entry_map.begin();
+	while (itr != this->entry_map.end()) {
+		if (this->frame - itr->second.last_frame > this->max_idle_frames) {
+			itr = this->entry_map.erase(itr);
+		}
+		else {
+			itr++;
+		}
+	}
+
+	this->frame++;
+	return;
+}	// end TextCache::endFrame()
+
+
+void TextCache::clear(void) {
+	/*
+	 *	Method to clear all entries (e.g. if fonts are reloaded)
+	 */
+
+	this->entry_map.clear();
+	return;
+}	// end TextCache::clear()
+
+
+int TextCache::getNumEntries(void) {
+	return this->entry_map.size();
+}	// end TextCache::getNumEntries()
+
+
+double TextCache::getHitRate(void) {
+	/*
+	 *	Method to get the hit rate over the last frame
+	 */
+
+	int n_lookups = this->last_hits + this->last_misses;
+	if (n_lookups <= 0) {
+		return 0;
+	}
+
+	return double(this->last_hits) / n_lookups;
+}	// end TextCache::getHitRate()
+
+
+double TextCache::getTotalHitRate(void) {
+	/*
+	 *	Method to get the hit rate over all frames so far
+	 */
+
+	unsigned long long n_lookups = this->total_hits + this->total_misses;
+	if (n_lookups <= 0) {
+		return 0;
+	}
+
+	return double(this->total_hits) / n_lookups;
+}	// end TextCache::getTotalHitRate()
+
+
+TextCache::~TextCache(void) {
+	/*
+	 *	Destructor for TextCache class
+	 */
+
+	this->clear();
+
+	// stream out and return
+	std::cout << "TextCache object at " << this << " destroyed." << std::endl;
+	return;
+}	// end TextCache::~TextCache()
+
+
+// ---- FramePacer ---- //
+
+FramePacer::FramePacer(double target_rate) {
+	/*
+	 *	Constructor for FramePacer class
+	 */
+
+	this->vertical_sync_flag = false;
+	this->n_waits = 0;
+	this->n_missed = 0;
+	this->spin_tail_s = FRAME_PACER_SPIN_TAIL_S;
+	this->last_missed_s = -1;
+	this->total_slept_s = 0;
+	this->start_time = std::chrono::steady_clock::now();
+
+	this->setTargetRate(target_rate);
+
+	// stream out and return
+	std::cout << "FramePacer object created at " << this << "." << std::endl;
+	return;
+}	// end FramePacer::FramePacer()
+
+
+void FramePacer::setTargetRate(double target_rate) {
+	/*
+	 *	Method to set the target frame rate [frames per second]
+	 */
+
+	if (target_rate <= 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: FramePacer::setTargetRate(): target rate " <<
+			target_rate << " is not valid.";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->target_rate = target_rate;
+	return;
+}	// end FramePacer::setTargetRate()
+
+
+void FramePacer::setVerticalSync(sf::RenderWindow* window_ptr, bool vertical_sync_flag) {
+	/*
+	 *	Method to enable or disable vertical sync on the given window, and pace
+	 *	to match (all vsync changes should go through here)
+	 */
+
+	if (window_ptr != NULL) {
+		window_ptr->setVerticalSyncEnabled(vertical_sync_flag);
+	}
+	this->vertical_sync_flag = vertical_sync_flag;
+
+	return;
+}	// end FramePacer::setVerticalSync()
+
+
+void FramePacer::waitUntil(double due_s, double now_s, double time_scale) {
+	/*
+	 *	Method to wait until the frame due at due_s is due, given the caller's
+	 *	clock reads now_s, and runs time_scale times faster than real time
+	 *	(0 to fast-forward, i.e. never wait). Returns at once if already due.
+	 */
+
+	if (time_scale <= 0) {
+		return;
+	}
+
+	this->n_waits++;
+
+	// wake on the first deadline on the target rate grid, at or after due_s
+	double period_s = 1 / this->target_rate;
+	double wake_s = ceil(due_s * this->target_rate - 1e-6) * period_s;
+	if (wake_s < due_s) {
+		wake_s = due_s;
+	}
+
+	double wait_s = (wake_s - now_s) / time_scale;
+	if (wait_s <= 0) {
+		if (-wait_s >= period_s && due_s > this->last_missed_s) {
+			this->n_missed++;
+			this->last_missed_s = due_s;
+		}
+		return;
+	}
+
+	std::chrono::steady_clock::time_point sleep_start = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point deadline = sleep_start +
+		std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+			std::chrono::duration<double>(wait_s)
+		);
+
+	// sleep (sf::sleep raises the OS timer resolution while sleeping, where
+	// needed), then spin out the tail unless display() will block on vsync
+	double sleep_s = wait_s;
+	if (!this->vertical_sync_flag) {
+		sleep_s -= this->spin_tail_s;
+	}
+	if (sleep_s > 0) {
+		sf::sleep(sf::seconds(sleep_s));
+	}
+
+	this->total_slept_s += std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - sleep_start
+	).count();
+
+	if (!this->vertical_sync_flag) {
+		while (std::chrono::steady_clock::now() < deadline) {
+			// spin
+		}
+	}
+
+	return;
+}	// end FramePacer::waitUntil()
+
+
+void FramePacer::printReport(void) {
+	/*
+	 *	Method to print deadlines waited on, deadlines missed, and time slept
+	 */
+
+	// (formatted locally, so std::cout keeps its precision)
+	std::stringstream slept_ss;
+	slept_ss << std::setprecision(4) << 100 * this->getSleepRatio();
+
+	std::cout << "\nframe pacer: " << this->n_waits << " deadlines (target " <<
+		this->target_rate << " fps, vsync " <<
+		(this->vertical_sync_flag ? "on" : "off") << "), " << this->n_missed <<
+		" missed, slept " << slept_ss.str() << " % of run time" << std::endl;
+
+	return;
+}	// end FramePacer::printReport()
+
+
+double FramePacer::getTargetRate(void) {
+	return this->target_rate;
+}	// end FramePacer::getTargetRate()
+
+
+int FramePacer::getNumWaits(void) {
+	return this->n_waits;
+}	// end FramePacer::getNumWaits()
+
+
+int FramePacer::getNumMissed(void) {
+	return this->n_missed;
+}	// end FramePacer::getNumMissed()
+
+
+double FramePacer::getSleepRatio(void) {
+	/*
+	 *	Method to get the fraction of time since construction spent asleep
+	 */
+
+	double elapsed_s = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - this->start_time
+	).count();
+	if (elapsed_s <= 0) {
+		return 0;
+	}
+
+	return this->total_slept_s / elapsed_s;
+}	// end FramePacer::getSleepRatio()
+
+
+FramePacer::~FramePacer(void) {
+	/*
+	 *	Destructor for FramePacer class
+	 */
+
+	// stream out and return
+	std::cout << "FramePacer object at " << this << " destroyed." << std::endl;
+	return;
+}	// end FramePacer::~FramePacer()
@@ -0,0 +1,359 @@
+/*
+ *	Analytic forecast implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the analytic (quadrature) forecast engine.
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/ForecastAnalytic.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+
+// -------- constants -------- //
+
+// 8 point Gauss-Legendre nodes and weights on [-1, 1]
+static const int GL_ORDER = 8;
+static const double GL_NODES[GL_ORDER] = {
+	-0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498,
+	0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363
+};
+static const double GL_WEIGHTS[GL_ORDER] = {
+	0.1012285362903763, 0.2223810344533745, 0.3137066458778873, 0.3626837833783620,
+	0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763
+};
+
+// offset used to take one-sided limits at curve breakpoints
+static const double BREAK_EPSILON = 1e-9;
+
+
+// -------- curve functions -------- //
+
+static double clampRatio(double x) {
+	/*
+	 *	Helper function to clamp a state to [0, 1], as the Markov steps do
+	 */
+
+	if (x < 0) {
+		return 0;
+	}
+	else if (x > 1) {
+		return 1;
+	}
+	return x;
+}	// end clampRatio()
+
+
+static double solarCurve(double cloud_cover_ratio, const ForecastParams& params) {
+	return solarProductionRatio(
+		params.solar_base_kWm2 *
+		(1 - clampRatio(cloud_cover_ratio)) *
+		(1 - params.smog_ratio)
+	);
+}	// end solarCurve()
+
+
+static double tidalCurve(double tidal_res_ms, const ForecastParams& params) {
+	return tidalProductionRatio(clampRatio(tidal_res_ms), params.design_value);
+}	// end tidalCurve()
+
+
+static double windCurve(double wind_speed_ratio, const ForecastParams& params) {
+	return windProductionRatio(clampRatio(wind_speed_ratio), params.design_value);
+}	// end windCurve()
+
+
+// ---- ForecastAnalytic ---- //
+
+ForecastAnalytic::ForecastAnalytic(void) {
+	/*
+	 *	Constructor for ForecastAnalytic class
+	 */
+
+	this->cut_vec.reserve(16);
+
+	// stream out and return
+	std::cout << "\nForecastAnalytic object created at " << this << "." << std::endl;
+	return;
+}	// end ForecastAnalytic::ForecastAnalytic()
+
+
+void ForecastAnalytic::integrateUniform(
+	double weight,
+	double lower,
+	double upper,
+	const std::vector<double>& break_vec,
+	ForecastCurve curve,
+	const ForecastParams& params,
+	ForecastStats* stats_ptr
+) {
+	/*
+	 *	Method to add weight * E[curve(X)], X ~ U[lower, upper], to the mean,
+	 *	and to widen the bounds by the range of curve over [lower, upper]
+	 *
+	 *	ASSUMPTION: curve is smooth and monotone between breakpoints, so each
+	 *	sub-interval is integrated exactly enough by one Gauss-Legendre panel
+	 *	and its extremes lie at the panel ends (as one-sided limits)
+	 */
+
+	if (weight <= 0) {
+		return;
+	}
+
+	// degenerate distribution (no step, or zero state)
+	if (upper - lower <= BREAK_EPSILON) {
+		double value = curve(lower, params);
+		stats_ptr->mean_GWh += weight * value;
+		stats_ptr->min_GWh = std::min(stats_ptr->min_GWh, value);
+		stats_ptr->max_GWh = std::max(stats_ptr->max_GWh, value);
+		return;
+	}
+
+	// cut at every breakpoint inside the support
+	this->cut_vec.clear();
+	this->cut_vec.push_back(lower);
+	for (size_t i = 0; i < break_vec.size(); i++) {
+		if (break_vec[i] > lower && break_vec[i] < upper) {
+			this->cut_vec.push_back(break_vec[i]);
+		}
+	}
+	this->cut_vec.push_back(upper);
+	std::sort(this->cut_vec.begin(), this->cut_vec.end());
+
+	// integrate panel by panel, and check panel ends for bounds
+	double integral = 0;
+	for (size_t i = 0; i + 1 < this->cut_vec.size(); i++) {
+		double a = this->cut_vec[i];
+		double b = this->cut_vec[i + 1];
+		double half_width = (b - a) / 2;
+		double mid = (a + b) / 2;
+
+		if (half_width <= 0) {
+			continue;
+		}
+
+		for (int j = 0; j < GL_ORDER; j++) {
+			integral += half_width * GL_WEIGHTS[j] * curve(mid + half_width * GL_NODES[j], params);
+		}
+
+		double end_values[3] = {
+			curve(a, params),
+			curve(std::min(a + BREAK_EPSILON, mid), params),
+			curve(std::max(b - BREAK_EPSILON, mid), params)
+		};
+		for (int j = 0; j < 3; j++) {
+			stats_ptr->min_GWh = std::min(stats_ptr->min_GWh, end_values[j]);
+			stats_ptr->max_GWh = std::max(stats_ptr->max_GWh, end_values[j]);
+		}
+	}
+
+	stats_ptr->mean_GWh += weight * integral / (upper - lower);
+
+	return;
+}	// end ForecastAnalytic::integrateUniform()
+
+
+void ForecastAnalytic::integrateMarkov(
+	double state,
+	double step,
+	const std::vector<double>& break_vec,
+	ForecastCurve curve,
+	const ForecastParams& params,
+	ForecastStats* stats_ptr
+) {
+	/*
+	 *	Method to integrate curve over one step of the simple Markov process
+	 *	of Game::generateWindRatio() et al (up with probability 1 - state,
+	 *	then a uniform step of up to step, then clamped to [0, 1])
+	 */
+
+	double increase_prob = clampRatio(1 - state);
+
+	this->integrateUniform(
+		increase_prob,
+		state,
+		state + step,
+		break_vec,
+		curve,
+		params,
+		stats_ptr
+	);
+	this->integrateUniform(
+		1 - increase_prob,
+		state - step,
+		state,
+		break_vec,
+		curve,
+		params,
+		stats_ptr
+	);
+
+	return;
+}	// end ForecastAnalytic::integrateMarkov()
+
+
+ForecastStats ForecastAnalytic::solar(
+	double capacity_GW,
+	double solar_base_kWm2,
+	double cloud_cover_ratio,
+	double smog_ratio
+) {
+	/*
+	 *	Method to forecast solar production (cloud cover takes one Markov step)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_SOLAR;
+	params.capacity_GW = capacity_GW;
+	params.state = cloud_cover_ratio;
+	params.step = 0.5;
+	params.solar_base_kWm2 = solar_base_kWm2;
+	params.smog_ratio = smog_ratio;
+	params.design_value = 0;
+
+	// production is monotone in cloud cover, only the clamps are kinks
+	static const std::vector<double> break_vec = {0, 1};
+
+	ForecastStats stats;
+	stats.mean_GWh = 0;
+	stats.min_GWh = std::numeric_limits<double>::infinity();
+	stats.max_GWh = -std::numeric_limits<double>::infinity();
+
+	this->integrateMarkov(
+		params.state,
+		params.step,
+		break_vec,
+		&solarCurve,
+		params,
+		&stats
+	);
+
+	stats.mean_GWh *= capacity_GW;
+	stats.min_GWh *= capacity_GW;
+	stats.max_GWh *= capacity_GW;
+
+	return stats;
+}	// end ForecastAnalytic::solar()
+
+
+ForecastStats ForecastAnalytic::tidal(
+	double capacity_GW,
+	double tidal_res_ms,
+	double design_speed_ms
+) {
+	/*
+	 *	Method to forecast tidal production (+/- 5% uniform noise on tabulated
+	 *	speed)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_TIDAL;
+	params.capacity_GW = capacity_GW;
+	params.state = tidal_res_ms;
+	params.step = 0;
+	params.solar_base_kWm2 = 0;
+	params.smog_ratio = 0;
+	params.design_value = design_speed_ms;
+
+	// see tidalProductionRatio()
+	std::vector<double> break_vec = {
+		0,
+		1,
+		design_speed_ms * (1 - 0.71),
+		design_speed_ms,
+		design_speed_ms * (1 + 0.65)
+	};
+
+	ForecastStats stats;
+	stats.mean_GWh = 0;
+	stats.min_GWh = std::numeric_limits<double>::infinity();
+	stats.max_GWh = -std::numeric_limits<double>::infinity();
+
+	this->integrateUniform(
+		1,
+		0.95 * tidal_res_ms,
+		1.05 * tidal_res_ms,
+		break_vec,
+		&tidalCurve,
+		params,
+		&stats
+	);
+
+	stats.mean_GWh *= capacity_GW;
+	stats.min_GWh *= capacity_GW;
+	stats.max_GWh *= capacity_GW;
+
+	return stats;
+}	// end ForecastAnalytic::tidal()
+
+
+ForecastStats ForecastAnalytic::wind(
+	double capacity_GW,
+	double wind_speed_ratio,
+	double design_speed_ms
+) {
+	/*
+	 *	Method to forecast wind production (wind takes one Markov step)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_WIND;
+	params.capacity_GW = capacity_GW;
+	params.state = wind_speed_ratio;
+	params.step = 0.5;
+	params.solar_base_kWm2 = 0;
+	params.smog_ratio = 0;
+	params.design_value = design_speed_ms;
+
+	// see windProductionRatio()
+	std::vector<double> break_vec = {
+		0,
+		1,
+		design_speed_ms * (1 - 0.76),
+		design_speed_ms,
+		design_speed_ms * (1 + 0.68)
+	};
+
+	ForecastStats stats;
+	stats.mean_GWh = 0;
+	stats.min_GWh = std::numeric_limits<double>::infinity();
+	stats.max_GWh = -std::numeric_limits<double>::infinity();
+
+	this->integrateMarkov(
+		params.state,
+		params.step,
+		break_vec,
+		&windCurve,
+		params,
+		&stats
+	);
+
+	stats.mean_GWh *= capacity_GW;
+	stats.min_GWh *= capacity_GW;
+	stats.max_GWh *= capacity_GW;
+
+	return stats;
+}	// end ForecastAnalytic::wind()
+
+
+ForecastAnalytic::~ForecastAnalytic(void) {
+	/*
+	 *	Destructor for ForecastAnalytic class
+	 */
+
+	// stream out and return
+	std::cout << "ForecastAnalytic object at " << this << " destroyed." << std::endl;
+	return;
+}	// end ForecastAnalytic::~ForecastAnalytic()
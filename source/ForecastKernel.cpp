@@ -0,0 +1,349 @@
+/*
+ *	Forecast kernel implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the scalar and SSE2 forecast kernels, and of the
+ *	ForecastKernel dispatcher (see ForecastKernelAVX2.cpp for AVX2).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/ForecastKernelImpl.h"
+
+#include <iostream>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+
+
+// -------- SSE2 lane operations -------- //
+
+#if defined(__SSE2__)
+
+namespace {
+
+struct SSE2Ops {
+	/*
+	 *	Lane operations, four lanes (SSE2)
+	 */
+
+	typedef __m128 V;
+	typedef __m128 M;
+	typedef __m128i I;
+	static const int width = 4;
+
+	static inline V load(const float* ptr) {return _mm_loadu_ps(ptr);}
+	static inline V set1(float x) {return _mm_set1_ps(x);}
+	static inline V add(V a, V b) {return _mm_add_ps(a, b);}
+	static inline V sub(V a, V b) {return _mm_sub_ps(a, b);}
+	static inline V mul(V a, V b) {return _mm_mul_ps(a, b);}
+	static inline V div(V a, V b) {return _mm_div_ps(a, b);}
+	static inline V min(V a, V b) {return _mm_min_ps(a, b);}
+	static inline V max(V a, V b) {return _mm_max_ps(a, b);}
+	static inline V sqrt(V a) {return _mm_sqrt_ps(a);}
+	static inline M lt(V a, V b) {return _mm_cmplt_ps(a, b);}
+	static inline M le(V a, V b) {return _mm_cmple_ps(a, b);}
+	static inline M gt(V a, V b) {return _mm_cmpgt_ps(a, b);}
+	static inline M maskOr(M a, M b) {return _mm_or_ps(a, b);}
+	static inline V select(M m, V a, V b) {
+		return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+	}
+	static inline I roundToInt(V a) {return _mm_cvtps_epi32(a);}
+	static inline V toFloat(I a) {return _mm_cvtepi32_ps(a);}
+	static inline V pow2(I a) {
+		return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(a, _mm_set1_epi32(127)), 23));
+	}
+	static inline V exponent(V a) {
+		I bits = _mm_srli_epi32(_mm_castps_si128(a), 23);
+		return _mm_cvtepi32_ps(_mm_sub_epi32(bits, _mm_set1_epi32(126)));
+	}
+	static inline V mantissa(V a) {
+		I bits = _mm_and_si128(_mm_castps_si128(a), _mm_set1_epi32(0x807fffff));
+		return _mm_castsi128_ps(_mm_or_si128(bits, _mm_set1_epi32(0x3f000000)));
+	}
+	static inline double sum(V a) {
+		float lanes[4];
+		_mm_storeu_ps(lanes, a);
+		return double(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+	}
+	static inline double minimum(V a) {
+		float lanes[4];
+		_mm_storeu_ps(lanes, a);
+		return fmin(fmin(lanes[0], lanes[1]), fmin(lanes[2], lanes[3]));
+	}
+	static inline double maximum(V a) {
+		float lanes[4];
+		_mm_storeu_ps(lanes, a);
+		return fmax(fmax(lanes[0], lanes[1]), fmax(lanes[2], lanes[3]));
+	}
+
+};	// end SSE2Ops
+
+}	// end anonymous namespace
+
+#endif
+
+
+// -------- function implementations -------- //
+
+void forecastKernelScalar(
+	const ForecastParams& params,
+	const float* roll_ptr,
+	const float* step_ptr,
+	const float* height_ptr,
+	int n_trials,
+	ForecastStats* stats_ptr
+) {
+	/*
+	 *	Scalar forecast kernel (portable fallback)
+	 */
+
+	fkRun<ScalarOps>(params, roll_ptr, step_ptr, height_ptr, n_trials, stats_ptr);
+	return;
+}	// end forecastKernelScalar()
+
+
+bool forecastKernelSSE2(
+	const ForecastParams& params,
+	const float* roll_ptr,
+	const float* step_ptr,
+	const float* height_ptr,
+	int n_trials,
+	ForecastStats* stats_ptr
+) {
+	/*
+	 *	SSE2 forecast kernel, returns false if not built in
+	 */
+
+	#if defined(__SSE2__)
+		fkRun<SSE2Ops>(params, roll_ptr, step_ptr, height_ptr, n_trials, stats_ptr);
+		return true;
+	#else
+		return false;
+	#endif
+}	// end forecastKernelSSE2()
+
+
+// ---- ForecastKernel ---- //
+
+ForecastKernel::ForecastKernel(int n_trials) {
+	/*
+	 *	Constructor for ForecastKernel class
+	 */
+
+	this->n_trials = n_trials;
+	this->roll_vec.resize(n_trials, 0);
+	this->step_vec.resize(n_trials, 0);
+	this->height_vec.resize(n_trials, 0);
+	this->random_stream = randomService().deriveStream(RNG_FORECAST, 0);
+
+	// pick widest supported instruction set
+	this->isa = FORECAST_ISA_SCALAR;
+	#if defined(__SSE2__)
+		this->isa = FORECAST_ISA_SSE2;
+	#endif
+	#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			this->isa = FORECAST_ISA_AVX2;
+		}
+	#endif
+
+	// stream out and return
+	std::cout << "\nForecastKernel object created at " << this << " (" <<
+		this->n_trials << " trials, " << this->getISAName() << ")." << std::endl;
+	return;
+}	// end ForecastKernel::ForecastKernel()
+
+
+int ForecastKernel::getISA(void) {
+	return this->isa;
+}	// end ForecastKernel::getISA()
+
+
+int ForecastKernel::getNumTrials(void) {
+	return this->n_trials;
+}	// end ForecastKernel::getNumTrials()
+
+
+std::string ForecastKernel::getISAName(void) {
+	switch (this->isa) {
+		case (FORECAST_ISA_SSE2):
+			return "SSE2";
+
+		case (FORECAST_ISA_AVX2):
+			return "AVX2";
+
+		default:
+			return "scalar";
+	}
+}	// end ForecastKernel::getISAName()
+
+
+void ForecastKernel::setISA(int isa) {
+	/*
+	 *	Method to force an instruction set (e.g. for testing or benchmarking);
+	 *	run() falls back if the kernel is not built in
+	 */
+
+	this->isa = isa;
+	return;
+}	// end ForecastKernel::setISA()
+
+
+void ForecastKernel::setStream(const RandomStream& random_stream) {
+	/*
+	 *	Method to set the stream the trial inputs are drawn from (e.g. a
+	 *	RandomService::deriveStream() per worker thread)
+	 */
+
+	this->random_stream = random_stream;
+	return;
+}	// end ForecastKernel::setStream()
+
+
+ForecastStats ForecastKernel::run(const ForecastParams& params) {
+	/*
+	 *	Method to roll trial inputs and run the selected kernel
+	 */
+
+	ForecastStats stats;
+
+	this->random_stream.fill(&(this->roll_vec));
+	if (params.kind != FORECAST_TIDAL) {
+		this->random_stream.fill(&(this->step_vec));
+	}
+	if (params.kind == FORECAST_WAVE) {
+		this->random_stream.fill(&(this->height_vec));
+	}
+
+	const float* roll_ptr = this->roll_vec.data();
+	const float* step_ptr = this->step_vec.data();
+	const float* height_ptr = this->height_vec.data();
+
+	switch (this->isa) {
+		case (FORECAST_ISA_AVX2):
+			if (forecastKernelAVX2(params, roll_ptr, step_ptr, height_ptr, this->n_trials, &stats)) {
+				break;
+			}
+			// fall through
+
+		case (FORECAST_ISA_SSE2):
+			if (forecastKernelSSE2(params, roll_ptr, step_ptr, height_ptr, this->n_trials, &stats)) {
+				break;
+			}
+			// fall through
+
+		default:
+			forecastKernelScalar(params, roll_ptr, step_ptr, height_ptr, this->n_trials, &stats);
+			break;
+	}
+
+	return stats;
+}	// end ForecastKernel::run()
+
+
+ForecastStats ForecastKernel::solar(
+	double capacity_GW,
+	double solar_base_kWm2,
+	double cloud_cover_ratio,
+	double smog_ratio
+) {
+	/*
+	 *	Method to forecast solar production (cloud cover takes one Markov step)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_SOLAR;
+	params.capacity_GW = capacity_GW;
+	params.state = cloud_cover_ratio;
+	params.step = 0.5;
+	params.solar_base_kWm2 = solar_base_kWm2;
+	params.smog_ratio = smog_ratio;
+	params.design_value = 0;
+
+	return this->run(params);
+}	// end ForecastKernel::solar()
+
+
+ForecastStats ForecastKernel::tidal(
+	double capacity_GW,
+	double tidal_res_ms,
+	double design_speed_ms
+) {
+	/*
+	 *	Method to forecast tidal production (+/- 5% noise on tabulated speed)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_TIDAL;
+	params.capacity_GW = capacity_GW;
+	params.state = tidal_res_ms;
+	params.step = 0;
+	params.solar_base_kWm2 = 0;
+	params.smog_ratio = 0;
+	params.design_value = design_speed_ms;
+
+	return this->run(params);
+}	// end ForecastKernel::tidal()
+
+
+ForecastStats ForecastKernel::wave(double capacity_GW, double wave_res_s) {
+	/*
+	 *	Method to forecast wave production (sea state takes one Markov step,
+	 *	then a Rayleigh distributed wave height)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_WAVE;
+	params.capacity_GW = capacity_GW;
+	params.state = (wave_res_s - 5.75) / (15 - 5.75);
+	params.step = 0.1;
+	params.solar_base_kWm2 = 0;
+	params.smog_ratio = 0;
+	params.design_value = 0;
+
+	return this->run(params);
+}	// end ForecastKernel::wave()
+
+
+ForecastStats ForecastKernel::wind(
+	double capacity_GW,
+	double wind_speed_ratio,
+	double design_speed_ms
+) {
+	/*
+	 *	Method to forecast wind production (wind takes one Markov step)
+	 */
+
+	ForecastParams params;
+	params.kind = FORECAST_WIND;
+	params.capacity_GW = capacity_GW;
+	params.state = wind_speed_ratio;
+	params.step = 0.5;
+	params.solar_base_kWm2 = 0;
+	params.smog_ratio = 0;
+	params.design_value = design_speed_ms;
+
+	return this->run(params);
+}	// end ForecastKernel::wind()
+
+
+ForecastKernel::~ForecastKernel(void) {
+	/*
+	 *	Destructor for ForecastKernel class
+	 */
+
+	// stream out and return
+	std::cout << "ForecastKernel object at " << this << " destroyed." << std::endl;
+	return;
+}	// end ForecastKernel::~ForecastKernel()
@@ -0,0 +1,121 @@
+/*
+ *	AVX2 forecast kernel for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	AVX2 instantiation of the forecast kernel. This is the only translation
+ *	unit built with -mavx2 -mfma (see makefile), and it is only called when
+ *	the CPU reports AVX2 (see ForecastKernel::ForecastKernel()).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/ForecastKernelImpl.h"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+
+// -------- AVX2 lane operations -------- //
+
+#if defined(__AVX2__)
+
+namespace {
+
+struct AVX2Ops {
+	/*
+	 *	Lane operations, eight lanes (AVX2)
+	 */
+
+	typedef __m256 V;
+	typedef __m256 M;
+	typedef __m256i I;
+	static const int width = 8;
+
+	static inline V load(const float* ptr) {return _mm256_loadu_ps(ptr);}
+	static inline V set1(float x) {return _mm256_set1_ps(x);}
+	static inline V add(V a, V b) {return _mm256_add_ps(a, b);}
+	static inline V sub(V a, V b) {return _mm256_sub_ps(a, b);}
+	static inline V mul(V a, V b) {return _mm256_mul_ps(a, b);}
+	static inline V div(V a, V b) {return _mm256_div_ps(a, b);}
+	static inline V min(V a, V b) {return _mm256_min_ps(a, b);}
+	static inline V max(V a, V b) {return _mm256_max_ps(a, b);}
+	static inline V sqrt(V a) {return _mm256_sqrt_ps(a);}
+	static inline M lt(V a, V b) {return _mm256_cmp_ps(a, b, _CMP_LT_OQ);}
+	static inline M le(V a, V b) {return _mm256_cmp_ps(a, b, _CMP_LE_OQ);}
+	static inline M gt(V a, V b) {return _mm256_cmp_ps(a, b, _CMP_GT_OQ);}
+	static inline M maskOr(M a, M b) {return _mm256_or_ps(a, b);}
+	static inline V select(M m, V a, V b) {return _mm256_blendv_ps(b, a, m);}
+	static inline I roundToInt(V a) {return _mm256_cvtps_epi32(a);}
+	static inline V toFloat(I a) {return _mm256_cvtepi32_ps(a);}
+	static inline V pow2(I a) {
+		return _mm256_castsi256_ps(
+			_mm256_slli_epi32(_mm256_add_epi32(a, _mm256_set1_epi32(127)), 23)
+		);
+	}
+	static inline V exponent(V a) {
+		I bits = _mm256_srli_epi32(_mm256_castps_si256(a), 23);
+		return _mm256_cvtepi32_ps(_mm256_sub_epi32(bits, _mm256_set1_epi32(126)));
+	}
+	static inline V mantissa(V a) {
+		I bits = _mm256_and_si256(_mm256_castps_si256(a), _mm256_set1_epi32(0x807fffff));
+		return _mm256_castsi256_ps(_mm256_or_si256(bits, _mm256_set1_epi32(0x3f000000)));
+	}
+	static inline double sum(V a) {
+		float lanes[8];
+		_mm256_storeu_ps(lanes, a);
+		double sum = 0;
+		for (int i = 0; i < 8; i++) {
+			sum += lanes[i];
+		}
+		return sum;
+	}
+	static inline double minimum(V a) {
+		__m128 half = _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+		half = _mm_min_ps(half, _mm_movehl_ps(half, half));
+		half = _mm_min_ss(half, _mm_shuffle_ps(half, half, 1));
+		return _mm_cvtss_f32(half);
+	}
+	static inline double maximum(V a) {
+		__m128 half = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+		half = _mm_max_ps(half, _mm_movehl_ps(half, half));
+		half = _mm_max_ss(half, _mm_shuffle_ps(half, half, 1));
+		return _mm_cvtss_f32(half);
+	}
+
+};	// end AVX2Ops
+
+}	// end anonymous namespace
+
+#endif
+
+
+// -------- function implementations -------- //
+
+bool forecastKernelAVX2(
+	const ForecastParams& params,
+	const float* roll_ptr,
+	const float* step_ptr,
+	const float* height_ptr,
+	int n_trials,
+	ForecastStats* stats_ptr
+) {
+	/*
+	 *	AVX2 forecast kernel, returns false if not built in
+	 */
+
+	#if defined(__AVX2__)
+		fkRun<AVX2Ops>(params, roll_ptr, step_ptr, height_ptr, n_trials, stats_ptr);
+		return true;
+	#else
+		return false;
+	#endif
+}	// end forecastKernelAVX2()
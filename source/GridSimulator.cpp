@@ -0,0 +1,1132 @@
+/*
+ *	Grid simulator implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the headless grid simulator. The rule math (weather
+ *	steps, demand, scoring, performance curves) is in the free functions
+ *	below and is shared with the Plant hierarchy and Game; only the dispatch
+ *	and commit bookkeeping mirrors Game::handleKeys() (Space, play phase).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/GridSimulator.h"
+
+
+// -------- file scope variables -------- //
+static bool use_performance_tables = true;
+
+
+// -------- function implementations -------- //
+
+void usePerformanceTables(bool use_tables) {
+	/*
+	 *	Function to switch the performance curves between the compile-time
+	 *	tables and libm (for benchmarking, see runBenchmarks())
+	 */
+
+	use_performance_tables = use_tables;
+	return;
+}	// end usePerformanceTables()
+
+
+double weatherRatioStep(double ratio, RandomStream& stream) {
+	/*
+	 *	One step of the simple Markov process for wind speed and cloud cover
+	 *	ratios (up with probability 1 - ratio, by up to 0.5, clamped to
+	 *	[0, 1])
+	 */
+
+	double inc_prob = 1 - ratio;
+	double roll = stream.uniform();
+	double next_ratio = 0;
+
+	if (roll <= inc_prob) {
+		next_ratio = ratio + 0.5 * stream.uniform();
+	}
+	else {
+		next_ratio = ratio - 0.5 * stream.uniform();
+	}
+
+	if (next_ratio > 1) {
+		next_ratio = 1;
+	}
+	else if (next_ratio < 0) {
+		next_ratio = 0;
+	}
+
+	return next_ratio;
+}	// end weatherRatioStep()
+
+
+double waveResourceStep(double wave_res_s, RandomStream& stream) {
+	/*
+	 *	One step of the simple Markov process for wave energy period [s]
+	 *	(normalized over [5.75, 15] s, up with probability 1 - normalized, by
+	 *	up to 0.1)
+	 */
+
+	double norm_res = (wave_res_s - 5.75) / (15 - 5.75);
+	double inc_prob = 1 - norm_res;
+	double next_norm_res = 0;
+
+	double roll = stream.uniform();
+	if (roll <= inc_prob) {
+		next_norm_res = norm_res + 0.1 * stream.uniform();
+	}
+	else {
+		next_norm_res = norm_res - 0.1 * stream.uniform();
+	}
+
+	if (next_norm_res > 1) {
+		next_norm_res = 1;
+	}
+	else if (next_norm_res < 0) {
+		next_norm_res = 0;
+	}
+
+	return (15 - 5.75) * next_norm_res + 5.75;
+}	// end waveResourceStep()
+
+
+double initialWaveResource(RandomStream& stream) {
+	/*
+	 *	Initial wave energy period [s], drawn on leaving the capacity phase
+	 *
+	 *	NOTE: the "- 5.75" (rather than "+ 5.75") is the baseline behaviour
+	 *	and is kept on purpose. It puts the first hour in [-5.75, 3.5] s, so
+	 *	wave plants produce little or nothing in the first hour and the sea
+	 *	state then climbs in from calm (5.75 s). Changing it would change
+	 *	every recorded session and batch result.
+	 */
+
+	return (15 - 5.75) * stream.uniform() - 5.75;
+}	// end initialWaveResource()
+
+
+double tidalResource(double table_res_ms, RandomStream& stream) {
+	/*
+	 *	Tidal speed ratio for the hour, from the tidal table value plus +/- 5%
+	 *	noise (clamped to [0, 1])
+	 */
+
+	double tidal_res_ms = table_res_ms * (1 + (0.1 * stream.uniform() - 0.05));
+	if (tidal_res_ms < 0) {
+		tidal_res_ms = 0;
+	}
+	else if (tidal_res_ms > 1) {
+		tidal_res_ms = 1;
+	}
+
+	return tidal_res_ms;
+}	// end tidalResource()
+
+
+int drawDemandGWh(int table_demand_GWh, RandomStream& stream) {
+	/*
+	 *	Demand [GWh] for the hour, from the demand table value plus noise on
+	 *	{-2, -1, 0, 1}
+	 */
+
+	return table_demand_GWh + int(4 * stream.uniform()) - 2;
+}	// end drawDemandGWh()
+
+
+double demandPoints(int total_dispatch_GWh, int demand_GWh) {
+	/*
+	 *	Points for meeting demand this hour (+demand if met, otherwise minus
+	 *	the shortfall)
+	 */
+
+	if (total_dispatch_GWh >= demand_GWh) {
+		return demand_GWh;
+	}
+	return total_dispatch_GWh - demand_GWh;
+}	// end demandPoints()
+
+
+
+double solarProductionRatio(double solar_res_kWm2) {
+	/*
+	 *	Dimensionless solar production (per GW of capacity)
+	 */
+
+	if (solar_res_kWm2 <= 0) {
+		return 0;
+	}
+	if (solar_res_kWm2 > 1) {
+		return 1;
+	}
+	return solar_res_kWm2;
+}	// end solarProductionRatio()
+
+
+double solarTimeOfDayResource(double hour_of_day) {
+	/*
+	 *	Clear sky solar resource [kW/m2] for the given hour of day
+	 */
+
+	if (hour_of_day <= 5.5 || hour_of_day >= 17.5) {
+		return 0;
+	}
+	else if (hour_of_day <= 10) {
+		return (2.0 / 9.0) * hour_of_day - (11.0 / 9.0);
+	}
+	else if (hour_of_day >= 14) {
+		return (-2.0 / 7.0) * hour_of_day + 5.0;
+	}
+	return 1;
+}	// end solarTimeOfDayResource()
+
+
+double tidalProductionRatio(double tidal_res_ms, double design_speed_ms) {
+	/*
+	 *	Dimensionless tidal production (per GW of capacity), from the derived
+	 *	dimensionless performance curve
+	 */
+
+	if (tidal_res_ms <= 0) {
+		return 0;
+	}
+
+	double turb_speed = (tidal_res_ms - design_speed_ms) / design_speed_ms;
+
+	if (turb_speed < -0.71 || turb_speed > 0.65) {
+		return 0;
+	}
+	else if (turb_speed <= 0) {
+		if (use_performance_tables) {
+			return TIDAL_CURVE_LOWER.evaluate(turb_speed);
+		}
+		return 1.69215 * exp(1.25909 * turb_speed) - 0.69215;
+	}
+	return 1;
+}	// end tidalProductionRatio()
+
+
+double waveHeight(double wave_res_s, double roll) {
+	/*
+	 *	Significant wave height [m] for the given energy period [s], using a
+	 *	Rayleigh distributed scalar (roll in [0, 1))
+	 *
+	 *	ASSUMPTION: H_s = c * T_e^2, with random c < 0.2184 (deep-water
+	 *	breaking condition)
+	 */
+
+	double sigma = 0.028;	// Rayleigh scale parameter (mode of dist)
+	if (roll >= 1) {
+		roll = 0.999999;
+	}
+	double scalar = sigma * sqrt(2 * log(1 / (1 - roll)));
+	double wave_res_s_2 = wave_res_s * wave_res_s;
+	double wave_res_m = scalar * wave_res_s_2;
+	if (wave_res_m > 0.2184 * wave_res_s_2) {
+		wave_res_m = 0.2 * wave_res_s_2;
+	}
+
+	return wave_res_m;
+}	// end waveHeight()
+
+
+double waveProductionRatio(double wave_res_s, double wave_res_m) {
+	/*
+	 *	Dimensionless wave production (per GW of capacity), from a *very*
+	 *	simplified dimensionless performance model of Robertson et al (2021)
+	 */
+
+	if (wave_res_m <= 0) {
+		return 0;
+	}
+
+	double prod = 0.289 * wave_res_m -
+		0.00111 * wave_res_m * wave_res_m * wave_res_s -
+		0.0169 * wave_res_s;
+	if (prod <= 0) {
+		prod = 0;
+	}
+	else if (prod >= 1) {
+		prod = 1;
+	}
+
+	return prod;
+}	// end waveProductionRatio()
+
+
+double windProductionRatio(double wind_res_ms, double design_speed_ms) {
+	/*
+	 *	Dimensionless wind production (per GW of capacity), from the derived
+	 *	dimensionless performance curve
+	 */
+
+	if (wind_res_ms <= 0) {
+		return 0;
+	}
+
+	double turb_speed = (wind_res_ms - design_speed_ms) / design_speed_ms;
+	double prod = 0;
+
+	if (turb_speed < -0.76 || turb_speed > 0.68) {
+		prod = 0;
+	}
+	else if (use_performance_tables) {
+		if (turb_speed <= 0) {
+			prod = WIND_CURVE_LOWER.evaluate(turb_speed);
+		}
+		else {
+			prod = WIND_CURVE_UPPER.evaluate(turb_speed);
+		}
+	}
+	else if (turb_speed <= 0) {
+		prod = 1.03273 * exp(-5.97588 * pow(turb_speed, 2)) - 0.03273;
+	}
+	else {
+		prod = 0.16154 * exp(-9.30254 * pow(turb_speed, 2)) + 0.83846;
+	}
+	if (prod > 1) {
+		prod = 1;
+	}
+
+	return prod;
+}	// end windProductionRatio()
+
+
+int hydroStorageGWh(int capacity_GW) {
+	/*
+	 *	Reservoir size [GWh] for the given hydro capacity [GW]
+	 */
+
+	static const int capacities[] = {
+		16, 29, 40, 49, 56, 63, 70, 77, 84,
+		91, 98, 104, 110, 116, 122, 128, 134, 140
+	};
+	static const int n_capacities = sizeof(capacities) / sizeof(capacities[0]);
+
+	if (capacity_GW <= 0) {
+		return 0;
+	}
+	else if (capacity_GW > n_capacities) {
+		return capacities[n_capacities - 1];
+	}
+	return capacities[capacity_GW - 1];
+}	// end hydroStorageGWh()
+
+
+int tokensPerGW(int type) {
+	/*
+	 *	Capacity tokens spent per GW of the given plant type
+	 */
+
+	return plantDescriptor(type).tokens_per_GW;
+}	// end tokensPerGW()
+
+
+// ---- GridSimulator ---- //
+
+GridSimulator::GridSimulator(unsigned long long seed) :
+random_service(seed)
+{
+	/*
+	 *	Constructor for GridSimulator class
+	 *
+	 *	(no stream out here, these are constructed in bulk by batch jobs)
+	 */
+
+	this->energy_demand_GWh_vec = {
+		13, 13, 13, 15, 16, 18,
+		19, 20, 20, 20, 19, 18,
+		18, 18, 19, 21, 22, 21,
+		20, 18, 17, 15, 14
+	};
+
+	this->tidal_res_ms_vec = {
+		0.125, 0.279, 0.265, 0.106, 0.076, 0.221,
+		0.645, 0.918, 1,     0.913, 0.744, 0.487,
+		0.104, 0.323, 0.621, 0.670, 0.621, 0.483,
+		0.157, 0.181, 0.497, 0.609, 0.565
+	};
+
+	this->actual_energy_demand_GWh_vec.reserve(HOURS_PER_GAME + 1);
+
+	this->reset(seed);
+	return;
+}	// end GridSimulator::GridSimulator()
+
+
+double GridSimulator::rand01(int subsystem) {
+	/*
+	 *	Method to generate a uniform random number on [0, 1) from the given
+	 *	subsystem stream (see RandomSubsystem)
+	 */
+
+	return this->random_service.getStream(subsystem).uniform();
+}	// end GridSimulator::rand01()
+
+
+void GridSimulator::reset(unsigned long long seed) {
+	/*
+	 *	Method to reset the simulator to the start of a game (plants are kept,
+	 *	but their operating state is reset)
+	 */
+
+	this->random_service.reseed(seed);
+
+	this->hour_of_day = 0;
+	this->current_energy_demand_GWh = 0;
+	this->coal_marbles = 0;
+	this->combined_marbles = 0;
+	this->peaker_marbles = 0;
+	this->excess_dispatch_GWh = 0;
+	this->total_coal_marbles = 0;
+	this->total_combined_marbles = 0;
+	this->total_peaker_marbles = 0;
+	this->total_excess_dispatch_GWh = 0;
+	this->total_unmet_demand_GWh = 0;
+	this->cloud_cover_ratio = 0;
+	this->wind_speed_ratio = 0;
+	this->smog_ratio = 0;
+	this->wave_res_s = 0;
+	this->score = 0;
+	this->actual_energy_demand_GWh_vec.clear();
+
+	this->tidal_idx_offset = round(23 * this->rand01(RNG_TIDAL));
+
+	for (size_t i = 0; i < this->plant_model_vec.size(); i++) {
+		PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+		plant_ptr->has_run = false;
+		plant_ptr->last_production_GWh = 0;
+		plant_ptr->mustered_GWh = 0;
+		plant_ptr->marbles_committed_vector.clear();
+		if (plant_ptr->type == PLANT_HYDRO) {
+			plant_ptr->charge_GWh = plant_ptr->capacity_GWh;
+			plant_ptr->mustered_GWh = 1;	// minimum discharge
+		}
+		else if (plant_ptr->type == PLANT_STORAGE) {
+			plant_ptr->charge_GWh = 0;
+		}
+	}
+
+	return;
+}	// end GridSimulator::reset()
+
+
+void GridSimulator::clearPlants(void) {
+	/*
+	 *	Method to clear all plant models
+	 */
+
+	this->plant_model_vec.clear();
+	return;
+}	// end GridSimulator::clearPlants()
+
+
+int GridSimulator::pushPlant(int type, double capacity_GW) {
+	/*
+	 *	Method to add a plant model of given type and capacity (geothermal
+	 *	capacity is taken as already rolled), returns index of plant
+	 */
+
+	PlantModel plant;
+	plant.type = type;
+	plant.has_run = false;
+	plant.last_production_GWh = 0;
+	plant.mustered_GWh = 0;
+	plant.production_ratio = 0;
+	plant.capacity_GW = capacity_GW;
+	plant.capacity_GWh = 0;
+	plant.charge_GWh = 0;
+	plant.design_value = 0;
+	plant.marbles_committed_vector.reserve(HOURS_PER_GAME);
+
+	switch (type) {
+		case (PLANT_HYDRO):
+			plant.capacity_GWh = hydroStorageGWh(int(round(capacity_GW)));
+			plant.charge_GWh = plant.capacity_GWh;
+			plant.mustered_GWh = 1;	// minimum discharge
+			break;
+
+		case (PLANT_STORAGE):
+			plant.capacity_GWh = capacity_GW;
+			break;
+
+		case (PLANT_TIDAL):
+			plant.design_value = 0.47;
+			break;
+
+		case (PLANT_WAVE):
+			plant.design_value = 8.5;	// specific to Robertson et al (2021) model
+			break;
+
+		case (PLANT_WIND):
+			plant.design_value = 0.47;
+			break;
+
+		default:
+			// do nothing!
+			break;
+	}
+
+	this->plant_model_vec.push_back(plant);
+	return int(this->plant_model_vec.size()) - 1;
+}	// end GridSimulator::pushPlant()
+
+
+int GridSimulator::pushPlantTokens(int type, int tokens) {
+	/*
+	 *	Method to add a plant model by tokens invested (as in the capacity
+	 *	phase), returns index of plant
+	 */
+
+	if (type < 0 || tokens <= 0) {
+		return this->pushPlant(PLANT_NULL, 0);
+	}
+
+	if (type == PLANT_GEOTHERMAL) {
+		return this->pushPlant(
+			type,
+			this->rollGeothermalCapacity(tokens / CAPACITY_PER_GEOTHERMAL_ROLL)
+		);
+	}
+
+	return this->pushPlant(type, tokens / tokensPerGW(type));
+}	// end GridSimulator::pushPlantTokens()
+
+
+int GridSimulator::rollGeothermalCapacity(int n_roll_sets) {
+	/*
+	 *	Method to roll for geothermal capacity, as in DiceRoll (three dice per
+	 *	set of CAPACITY_PER_GEOTHERMAL_ROLL tokens, each die adding 0 or 1 GW)
+	 */
+
+	int capacity_GW = 0;
+
+	for (int i = 0; i < n_roll_sets; i++) {
+		int roll_0 = 1 + int(6 * this->rand01(RNG_DICE));
+		int roll_1 = 1 + int(6 * this->rand01(RNG_DICE));
+		int roll_2 = 1 + int(6 * this->rand01(RNG_DICE));
+
+		// first roll
+		if (roll_0 <= 3) {
+			capacity_GW++;
+		}
+
+		// second roll
+		if (
+			(roll_0 <= 3 && roll_1 <= 4) ||
+			(roll_0 > 3 && roll_1 <= 2)
+		) {
+			capacity_GW++;
+		}
+
+		// third roll
+		if (roll_0 <= 3) {
+			if (
+				(roll_1 <= 4 && roll_2 <= 5) ||
+				(roll_1 > 4 && roll_2 <= 3)
+			) {
+				capacity_GW++;
+			}
+		}
+		else {
+			if (
+				(roll_1 <= 2 && roll_2 <= 3) ||
+				(roll_1 > 2 && roll_2 <= 1)
+			) {
+				capacity_GW++;
+			}
+		}
+	}
+
+	return capacity_GW;
+}	// end GridSimulator::rollGeothermalCapacity()
+
+
+double GridSimulator::generateWindRatio(void) {
+	/*
+	 *	Method to generate wind ratio (see weatherRatioStep())
+	 */
+
+	return weatherRatioStep(
+		this->wind_speed_ratio,
+		this->random_service.getStream(RNG_WEATHER)
+	);
+}	// end GridSimulator::generateWindRatio()
+
+
+double GridSimulator::generateCloudRatio(void) {
+	/*
+	 *	Method to generate cloud ratio (see weatherRatioStep())
+	 */
+
+	return weatherRatioStep(
+		this->cloud_cover_ratio,
+		this->random_service.getStream(RNG_WEATHER)
+	);
+}	// end GridSimulator::generateCloudRatio()
+
+
+double GridSimulator::generateSolarResource(void) {
+	/*
+	 *	Method to generate solar resource
+	 *	(product of cloud cover and time of day)
+	 */
+
+	return solarTimeOfDayResource(this->hour_of_day) *
+		(1 - this->cloud_cover_ratio) * (1 - this->smog_ratio);
+}	// end GridSimulator::generateSolarResource()
+
+
+double GridSimulator::generateWaveResource(void) {
+	/*
+	 *	Method to generate wave energy period (see waveResourceStep())
+	 */
+
+	return waveResourceStep(
+		this->wave_res_s,
+		this->random_service.getStream(RNG_WEATHER)
+	);
+}	// end GridSimulator::generateWaveResource()
+
+
+void GridSimulator::computeProduction(void) {
+	/*
+	 *	Method to compute renewable production for the current hour (mustered
+	 *	marbles of renewables are fixed by the weather)
+	 */
+
+	for (size_t i = 0; i < this->plant_model_vec.size(); i++) {
+		PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+		double prod = 0;
+
+		switch (plant_ptr->type) {
+			case (PLANT_SOLAR):
+				prod = solarProductionRatio(this->generateSolarResource());
+				break;
+
+			case (PLANT_TIDAL):
+				{
+					double tidal_res_ms = tidalResource(
+						this->tidal_res_ms_vec[
+							(this->hour_of_day + this->tidal_idx_offset) % 23
+						],
+						this->random_service.getStream(RNG_TIDAL)
+					);
+
+					prod = tidalProductionRatio(tidal_res_ms, plant_ptr->design_value);
+				}
+				break;
+
+			case (PLANT_WAVE):
+				{
+					double wave_res_s = this->wave_res_s;
+					if (wave_res_s <= 0) {
+						wave_res_s = 0;
+					}
+					prod = waveProductionRatio(
+						wave_res_s,
+						waveHeight(wave_res_s, this->rand01(RNG_WAVE))
+					);
+				}
+				break;
+
+			case (PLANT_WIND):
+				prod = windProductionRatio(
+					this->wind_speed_ratio,
+					plant_ptr->design_value
+				);
+				break;
+
+			default:
+				// not renewable, do nothing!
+				continue;
+		}
+
+		plant_ptr->production_ratio = prod;
+		plant_ptr->mustered_GWh = round(plant_ptr->capacity_GW * prod);
+	}
+
+	return;
+}	// end GridSimulator::computeProduction()
+
+
+int GridSimulator::drawDemand(void) {
+	/*
+	 *	Method to draw the (noisy) demand for the current hour
+	 */
+
+	int idx = 0;
+	if (this->hour_of_day < 23) {
+		idx = this->hour_of_day;
+	}
+
+	return drawDemandGWh(
+		this->energy_demand_GWh_vec[idx],
+		this->random_service.getStream(RNG_DEMAND)
+	);
+}	// end GridSimulator::drawDemand()
+
+
+void GridSimulator::start(void) {
+	/*
+	 *	Method to start the play phase (initial weather, production, and
+	 *	demand), as on leaving the capacity phase
+	 */
+
+	this->wind_speed_ratio = this->rand01(RNG_WEATHER);
+	this->cloud_cover_ratio = this->rand01(RNG_WEATHER);
+	this->wave_res_s = initialWaveResource(this->random_service.getStream(RNG_WEATHER));
+
+	this->computeProduction();
+
+	this->current_energy_demand_GWh = this->drawDemand();
+	this->actual_energy_demand_GWh_vec.push_back(this->current_energy_demand_GWh);
+
+	return;
+}	// end GridSimulator::start()
+
+
+int GridSimulator::getMinDispatch(int i) {
+	/*
+	 *	Method to get the minimum dispatch [GWh] of the given plant this hour
+	 *	(ramping, minimum discharge, and fixed renewable production)
+	 */
+
+	PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+
+	switch (plant_ptr->type) {
+		case (PLANT_COAL):
+			if (plant_ptr->has_run && plant_ptr->last_production_GWh - 1 > 0) {
+				return plant_ptr->last_production_GWh - 1;
+			}
+			return 0;
+
+		case (PLANT_COMBINED):
+		case (PLANT_GEOTHERMAL):
+			if (plant_ptr->has_run && plant_ptr->last_production_GWh - 2 > 0) {
+				return plant_ptr->last_production_GWh - 2;
+			}
+			return 0;
+
+		case (PLANT_FISSION):
+			if (plant_ptr->has_run) {
+				return plant_ptr->last_production_GWh;
+			}
+			return 0;
+
+		case (PLANT_HYDRO):
+			if (plant_ptr->mustered_GWh >= 1) {
+				return 1;
+			}
+			return 0;
+
+		case (PLANT_SOLAR):
+		case (PLANT_TIDAL):
+		case (PLANT_WAVE):
+		case (PLANT_WIND):
+			return plant_ptr->mustered_GWh;
+
+		default:
+			return 0;
+	}
+}	// end GridSimulator::getMinDispatch()
+
+
+int GridSimulator::getMaxDispatch(int i) {
+	/*
+	 *	Method to get the maximum dispatch [GWh] of the given plant this hour
+	 *	(capacity, ramping, and charge limits)
+	 */
+
+	PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+	int max_GWh = ceil(plant_ptr->capacity_GW);
+
+	switch (plant_ptr->type) {
+		case (PLANT_COAL):
+			if (plant_ptr->has_run && plant_ptr->last_production_GWh + 1 < max_GWh) {
+				max_GWh = plant_ptr->last_production_GWh + 1;
+			}
+			break;
+
+		case (PLANT_COMBINED):
+		case (PLANT_GEOTHERMAL):
+			if (plant_ptr->has_run && plant_ptr->last_production_GWh + 2 < max_GWh) {
+				max_GWh = plant_ptr->last_production_GWh + 2;
+			}
+			break;
+
+		case (PLANT_FISSION):
+			if (plant_ptr->has_run) {
+				max_GWh = plant_ptr->last_production_GWh;
+			}
+			break;
+
+		case (PLANT_HYDRO):
+		case (PLANT_STORAGE):
+			if (ceil(plant_ptr->charge_GWh) < max_GWh) {
+				max_GWh = ceil(plant_ptr->charge_GWh);
+			}
+			if (max_GWh < plant_ptr->mustered_GWh) {
+				max_GWh = plant_ptr->mustered_GWh;
+			}
+			break;
+
+		case (PLANT_SOLAR):
+		case (PLANT_TIDAL):
+		case (PLANT_WAVE):
+		case (PLANT_WIND):
+			max_GWh = plant_ptr->mustered_GWh;
+			break;
+
+		case (PLANT_PEAKER):
+			break;
+
+		default:
+			max_GWh = 0;
+			break;
+	}
+
+	if (max_GWh < 0) {
+		max_GWh = 0;
+	}
+
+	return max_GWh;
+}	// end GridSimulator::getMaxDispatch()
+
+
+void GridSimulator::setDispatch(int i, int dispatch_GWh) {
+	/*
+	 *	Method to muster the given dispatch [GWh] at the given plant (clamped
+	 *	to what the plant would allow by incMarbles() / decMarbles())
+	 */
+
+	int min_GWh = this->getMinDispatch(i);
+	int max_GWh = this->getMaxDispatch(i);
+
+	if (dispatch_GWh < min_GWh) {
+		dispatch_GWh = min_GWh;
+	}
+	else if (dispatch_GWh > max_GWh) {
+		dispatch_GWh = max_GWh;
+	}
+
+	this->plant_model_vec[i].mustered_GWh = dispatch_GWh;
+	return;
+}	// end GridSimulator::setDispatch()
+
+
+void GridSimulator::dispatchMeritOrder(const std::vector<int>& merit_order) {
+	/*
+	 *	Method to muster dispatch by a simple merit order policy: every plant
+	 *	is set to its minimum, then plants are ramped up in the given order of
+	 *	plant types until demand is met (or nothing more can be dispatched)
+	 */
+
+	int residual_GWh = this->current_energy_demand_GWh;
+
+	for (int i = 0; i < this->getNumPlants(); i++) {
+		this->setDispatch(i, this->getMinDispatch(i));
+		residual_GWh -= this->plant_model_vec[i].mustered_GWh;
+	}
+
+	for (size_t j = 0; j < merit_order.size(); j++) {
+		for (int i = 0; i < this->getNumPlants(); i++) {
+			if (residual_GWh <= 0) {
+				return;
+			}
+			if (this->plant_model_vec[i].type != merit_order[j]) {
+				continue;
+			}
+
+			int last_GWh = this->plant_model_vec[i].mustered_GWh;
+			this->setDispatch(i, last_GWh + residual_GWh);
+			residual_GWh -= this->plant_model_vec[i].mustered_GWh - last_GWh;
+		}
+	}
+
+	return;
+}	// end GridSimulator::dispatchMeritOrder()
+
+
+void GridSimulator::commitHour(void) {
+	/*
+	 *	Method to commit the mustered dispatch and advance to the next hour
+	 *	(mirrors Game::handleKeys(), Space, play phase)
+	 */
+
+	if (this->isFinished()) {
+		return;
+	}
+
+	// reset marbles (for emissions)
+	this->coal_marbles = 0;
+	this->combined_marbles = 0;
+	this->peaker_marbles = 0;
+
+	// determine total dispatch, update score, update smog
+	int total_dispatch_GWh = 0;
+	double smog_ratio = this->smog_ratio;
+	for (size_t i = 0; i < this->plant_model_vec.size(); i++) {
+		PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+		if (plant_ptr->type < 0) {
+			continue;
+		}
+
+		total_dispatch_GWh += plant_ptr->mustered_GWh;
+
+		// emissions
+		const PlantDescriptor& descriptor = plantDescriptor(plant_ptr->type);
+		if (descriptor.emission_points > 0) {
+			this->score -= descriptor.emission_points * plant_ptr->mustered_GWh;
+			smog_ratio += descriptor.smog_per_marble * plant_ptr->mustered_GWh;
+		}
+
+		switch (plant_ptr->type) {
+			case (PLANT_COAL):
+				this->coal_marbles += plant_ptr->mustered_GWh;
+				break;
+
+			case (PLANT_COMBINED):
+				this->combined_marbles += plant_ptr->mustered_GWh;
+				break;
+
+			case (PLANT_PEAKER):
+				this->peaker_marbles += plant_ptr->mustered_GWh;
+				break;
+
+			default:
+				// do nothing!
+				break;
+		}
+	}
+	this->score += demandPoints(total_dispatch_GWh, this->current_energy_demand_GWh);
+	if (total_dispatch_GWh < this->current_energy_demand_GWh) {
+		this->total_unmet_demand_GWh +=
+			this->current_energy_demand_GWh - total_dispatch_GWh;
+	}
+	if (smog_ratio > 1) {
+		smog_ratio = 1;
+	}
+	this->total_coal_marbles += this->coal_marbles;
+	this->total_combined_marbles += this->combined_marbles;
+	this->total_peaker_marbles += this->peaker_marbles;
+
+	// commit marbles
+	for (size_t i = 0; i < this->plant_model_vec.size(); i++) {
+		PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+		if (plant_ptr->type < 0) {
+			continue;
+		}
+
+		plant_ptr->marbles_committed_vector.push_back(plant_ptr->mustered_GWh);
+		if (plant_ptr->mustered_GWh > 0) {
+			plant_ptr->has_run = true;
+		}
+
+		switch (plant_ptr->type) {
+			case (PLANT_COAL):
+			case (PLANT_COMBINED):
+			case (PLANT_FISSION):
+			case (PLANT_GEOTHERMAL):
+				// last production stays mustered (ramping)
+				plant_ptr->last_production_GWh = plant_ptr->mustered_GWh;
+				if (!plant_ptr->has_run) {
+					plant_ptr->mustered_GWh = 0;
+				}
+				break;
+
+			case (PLANT_HYDRO):
+				// re-muster minimum discharge, if any water left
+				plant_ptr->charge_GWh -= plant_ptr->mustered_GWh;
+				plant_ptr->mustered_GWh = 0;
+				if (plant_ptr->charge_GWh > 0) {
+					plant_ptr->mustered_GWh = 1;
+				}
+				break;
+
+			case (PLANT_STORAGE):
+				plant_ptr->charge_GWh -= plant_ptr->mustered_GWh;
+				plant_ptr->mustered_GWh = 0;
+				break;
+
+			default:
+				plant_ptr->mustered_GWh = 0;
+				break;
+		}
+	}
+
+	// lock in ramping rate constraints (after first round)
+	if (this->hour_of_day == 0) {
+		for (size_t i = 0; i < this->plant_model_vec.size(); i++) {
+			this->plant_model_vec[i].has_run = true;
+		}
+	}
+
+	// determine storage charging (from any available excess)
+	int excess_dispatch_GWh = 0;
+	if (total_dispatch_GWh > this->current_energy_demand_GWh) {
+		excess_dispatch_GWh = total_dispatch_GWh -
+			this->current_energy_demand_GWh;
+	}
+	for (size_t i = 0; i < this->plant_model_vec.size(); i++) {
+		if (excess_dispatch_GWh <= 0) {
+			break;
+		}
+
+		PlantModel* plant_ptr = &(this->plant_model_vec[i]);
+		if (plant_ptr->type != PLANT_STORAGE) {
+			continue;
+		}
+
+		int space_GWh = plant_ptr->capacity_GWh - plant_ptr->charge_GWh;
+		if (space_GWh <= 0) {
+			continue;
+		}
+		if (space_GWh > excess_dispatch_GWh) {
+			space_GWh = excess_dispatch_GWh;
+		}
+		plant_ptr->charge_GWh += space_GWh;
+		excess_dispatch_GWh -= space_GWh;
+	}
+
+	// penalize any remaining excess
+	if (excess_dispatch_GWh > 0) {
+		this->score -= excess_dispatch_GWh;
+	}
+	this->excess_dispatch_GWh = excess_dispatch_GWh;
+	this->total_excess_dispatch_GWh += excess_dispatch_GWh;
+
+	// determine next weather states (no transition, so jump straight there)
+	double next_wind_speed_ratio = this->generateWindRatio();
+	double next_cloud_cover_ratio = this->generateCloudRatio();
+	double next_wave_res_s = this->generateWaveResource();
+
+	this->wind_speed_ratio = next_wind_speed_ratio;
+	this->cloud_cover_ratio = next_cloud_cover_ratio;
+	this->wave_res_s = next_wave_res_s;
+	this->smog_ratio = smog_ratio;
+	this->hour_of_day++;
+
+	// compute renewable production, get next demand
+	this->computeProduction();
+	this->current_energy_demand_GWh = this->drawDemand();
+	this->actual_energy_demand_GWh_vec.push_back(this->current_energy_demand_GWh);
+
+	return;
+}	// end GridSimulator::commitHour()
+
+
+double GridSimulator::runDay(const std::vector<int>& merit_order) {
+	/*
+	 *	Method to run a complete game under the given merit order policy,
+	 *	returns final score
+	 */
+
+	this->start();
+	while (!this->isFinished()) {
+		this->dispatchMeritOrder(merit_order);
+		this->commitHour();
+	}
+
+	return this->score;
+}	// end GridSimulator::runDay()
+
+
+bool GridSimulator::isFinished(void) {
+	return this->hour_of_day >= HOURS_PER_GAME;
+}	// end GridSimulator::isFinished()
+
+
+int GridSimulator::getHourOfDay(void) {
+	return this->hour_of_day;
+}	// end GridSimulator::getHourOfDay()
+
+
+int GridSimulator::getNumPlants(void) {
+	return int(this->plant_model_vec.size());
+}	// end GridSimulator::getNumPlants()
+
+
+int GridSimulator::getDispatch(int i) {
+	return this->plant_model_vec[i].mustered_GWh;
+}	// end GridSimulator::getDispatch()
+
+
+int GridSimulator::getEnergyDemandGWh(void) {
+	return this->current_energy_demand_GWh;
+}	// end GridSimulator::getEnergyDemandGWh()
+
+
+int GridSimulator::getCoalMarbles(void) {
+	return this->total_coal_marbles;
+}	// end GridSimulator::getCoalMarbles()
+
+
+int GridSimulator::getCombinedMarbles(void) {
+	return this->total_combined_marbles;
+}	// end GridSimulator::getCombinedMarbles()
+
+
+int GridSimulator::getPeakerMarbles(void) {
+	return this->total_peaker_marbles;
+}	// end GridSimulator::getPeakerMarbles()
+
+
+int GridSimulator::getExcessDispatchGWh(void) {
+	return this->total_excess_dispatch_GWh;
+}	// end GridSimulator::getExcessDispatchGWh()
+
+
+int GridSimulator::getUnmetDemandGWh(void) {
+	return this->total_unmet_demand_GWh;
+}	// end GridSimulator::getUnmetDemandGWh()
+
+
+double GridSimulator::getScore(void) {
+	return this->score;
+}	// end GridSimulator::getScore()
+
+
+double GridSimulator::getSmogRatio(void) {
+	return this->smog_ratio;
+}	// end GridSimulator::getSmogRatio()
+
+
+double GridSimulator::getCloudCoverRatio(void) {
+	return this->cloud_cover_ratio;
+}	// end GridSimulator::getCloudCoverRatio()
+
+
+double GridSimulator::getWindSpeedRatio(void) {
+	return this->wind_speed_ratio;
+}	// end GridSimulator::getWindSpeedRatio()
+
+
+double GridSimulator::getWaveResource(void) {
+	return this->wave_res_s;
+}	// end GridSimulator::getWaveResource()
+
+
+const PlantModel& GridSimulator::getPlantModel(int i) {
+	return this->plant_model_vec[i];
+}	// end GridSimulator::getPlantModel()
+
+
+const std::vector<int>& GridSimulator::getActualEnergyDemandVec(void) {
+	return this->actual_energy_demand_GWh_vec;
+}	// end GridSimulator::getActualEnergyDemandVec()
+
+
+GridSimulator::~GridSimulator(void) {
+	/*
+	 *	Destructor for GridSimulator class
+	 */
+
+	return;
+}	// end GridSimulator::~GridSimulator()
@@ -23,8 +23,10 @@
 // -------- includes -------- //
 #include "../header/includes.h"
 
+#include "../header/Benchmarks.h"
 #include "../header/ESC.h"
 #include "../header/MM.h"
+#include "../header/PixelCache.h"
 
 
 // -------- function implementations -------- //
@@ -44,8 +46,601 @@ void runTests(void) {
 		}
 
 
-		// 2. [...]
-		{}
+		// 2. testing headless grid simulator
+		{
+			std::vector<int> merit_order = {
+				PLANT_FISSION, PLANT_GEOTHERMAL, PLANT_HYDRO, PLANT_STORAGE,
+				PLANT_COAL, PLANT_COMBINED, PLANT_PEAKER
+			};
+
+			GridSimulator grid_simulator(1234);
+			grid_simulator.pushPlant(PLANT_COAL, 10);
+			grid_simulator.pushPlant(PLANT_HYDRO, 3);
+			grid_simulator.pushPlant(PLANT_PEAKER, 20);
+			grid_simulator.pushPlant(PLANT_STORAGE, 2);
+			grid_simulator.pushPlant(PLANT_WIND, 5);
+			grid_simulator.pushPlant(PLANT_SOLAR, 5);
+			double score = grid_simulator.runDay(merit_order);
+
+			assert (grid_simulator.isFinished());
+			assert (grid_simulator.getUnmetDemandGWh() == 0);
+			assert (grid_simulator.getPlantModel(0).marbles_committed_vector.size() == HOURS_PER_GAME);
+			assert (grid_simulator.getPlantModel(1).charge_GWh >= 0);
+
+			// same seed, same game
+			grid_simulator.reset(1234);
+			double replay_score = grid_simulator.runDay(merit_order);
+			assert (replay_score == score);
+
+			std::cout << "\tGridSimulator: score " << score << " (seed 1234)" << std::endl;
+		}
+
+
+		// 3. testing counter-based random streams
+		{
+			RandomService random_service(1234);
+			RandomStream stream = random_service.deriveStream(RNG_WEATHER, 0);
+
+			// main thread stream is index 0, other indices are independent
+			assert (stream.getKey() == random_service.getStream(RNG_WEATHER).getKey());
+			assert (stream.getKey() != random_service.deriveStream(RNG_WEATHER, 1).getKey());
+			assert (stream.getKey() != random_service.deriveStream(RNG_DICE, 0).getKey());
+
+			// bulk fill matches sequential draws, and draws are on [0, 1)
+			std::vector<float> fill_vec(1000, 0);
+			stream.fill(&fill_vec);
+			assert (stream.getCounter() == fill_vec.size());
+			stream.setCounter(0);
+			for (size_t i = 0; i < fill_vec.size(); i++) {
+				float draw = stream.uniformFloat();
+				assert (draw == fill_vec[i]);
+				assert (draw >= 0 && draw < 1);
+			}
+
+			// jump ahead
+			stream.setCounter(500);
+			assert (stream.uniformFloat() == fill_vec[500]);
+
+			std::cout << "\tRandomStream: ok" << std::endl;
+		}
+
+
+		// 4. testing analytic forecast against sampled forecast
+		{
+			ForecastAnalytic forecast_analytic;
+			ForecastKernel forecast_kernel(FORECAST_TRIALS);
+
+			for (int i = 0; i <= 10; i++) {
+				double state = i / 10.0;
+
+				ForecastStats analytic = forecast_analytic.wind(5, state, 0.47);
+				ForecastStats sampled = forecast_kernel.wind(5, state, 0.47);
+				assert (fabs(analytic.mean_GWh - sampled.mean_GWh) < 0.05);
+				assert (analytic.min_GWh <= sampled.min_GWh + 1e-6);
+				assert (analytic.max_GWh >= sampled.max_GWh - 1e-6);
+
+				analytic = forecast_analytic.solar(5, 0.9, state, 0.1);
+				sampled = forecast_kernel.solar(5, 0.9, state, 0.1);
+				assert (fabs(analytic.mean_GWh - sampled.mean_GWh) < 0.05);
+				assert (analytic.min_GWh <= sampled.min_GWh + 1e-6);
+				assert (analytic.max_GWh >= sampled.max_GWh - 1e-6);
+			}
+
+			std::cout << "\tForecastAnalytic: ok" << std::endl;
+		}
+
+
+		// 5. testing portfolio optimizer (coarse, against plain batch games)
+		{
+			const int n_days = 4;
+			PortfolioOptimizer portfolio_optimizer(n_days, 1234, 0, 6);
+			portfolio_optimizer.run();
+
+			const std::vector<PortfolioScore>& front_vec = portfolio_optimizer.getFront();
+			assert (!front_vec.empty());
+
+			GridSimulator grid_simulator(0);
+			for (size_t i = 0; i < front_vec.size(); i++) {
+				// memoized profiles match a plain replay of the same days
+				double score = 0;
+				for (int day = 0; day < n_days; day++) {
+					grid_simulator.clearPlants();
+					grid_simulator.reset(deriveSeed(1234, RNG_BATCH, day));
+					for (int type = 0; type < N_PLANT_TYPES; type++) {
+						if (front_vec[i].tokens[type] > 0) {
+							grid_simulator.pushPlantTokens(type, front_vec[i].tokens[type]);
+						}
+					}
+					score += grid_simulator.runDay(portfolio_optimizer.getMeritOrder());
+				}
+				assert (fabs(score / n_days - front_vec[i].score) < 1e-9);
+
+				// front is mutually non-dominated
+				for (size_t j = 0; j < front_vec.size(); j++) {
+					assert (
+						i == j ||
+						front_vec[j].score < front_vec[i].score ||
+						front_vec[j].emissions > front_vec[i].emissions
+					);
+				}
+			}
+
+			std::cout << "\tPortfolioOptimizer: ok" << std::endl;
+		}
+
+
+		// 6. testing dispatch solver (schedule replays to the optimum, which
+		//    is never worse than merit order)
+		{
+			std::vector<int> merit_order_vec = {
+				PLANT_FISSION, PLANT_GEOTHERMAL, PLANT_HYDRO, PLANT_STORAGE,
+				PLANT_COMBINED, PLANT_PEAKER, PLANT_COAL
+			};
+			DispatchSolver dispatch_solver(0);
+
+			for (int day = 0; day < 2; day++) {
+				// solveExpected() plays day 0 of a batch with this base seed
+				unsigned long long seed = deriveSeed(1234 + day, RNG_BATCH, 0);
+
+				GridSimulator grid_simulator(0);
+				grid_simulator.reset(seed);
+				grid_simulator.pushPlantTokens(PLANT_COAL, 8);
+				grid_simulator.pushPlantTokens(PLANT_HYDRO, 4);
+				grid_simulator.pushPlantTokens(PLANT_PEAKER, 8);
+				grid_simulator.pushPlantTokens(PLANT_STORAGE, 6);
+				grid_simulator.pushPlantTokens(PLANT_WIND, 6);
+				grid_simulator.pushPlantTokens(PLANT_TIDAL, 4);
+				double merit_score = grid_simulator.runDay(merit_order_vec);
+
+				dispatch_solver.solveExpected(
+					{
+						{PLANT_COAL, 8}, {PLANT_HYDRO, 4}, {PLANT_PEAKER, 8},
+						{PLANT_STORAGE, 6}, {PLANT_WIND, 6}, {PLANT_TIDAL, 4}
+					},
+					1,
+					1234 + day
+				);
+				double optimal_score = dispatch_solver.getOptimalScore();
+				assert (optimal_score >= merit_score - 1e-9);
+
+				std::vector<DispatchAction> schedule_vec = dispatch_solver.getSchedule();
+				grid_simulator.reset(seed);
+				grid_simulator.start();
+				for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+					for (int i = 0; i < grid_simulator.getNumPlants(); i++) {
+						switch (grid_simulator.getPlantModel(i).type) {
+							case (PLANT_COAL):
+								grid_simulator.setDispatch(i, schedule_vec[hour].coal_GWh);
+								break;
+
+							case (PLANT_HYDRO):
+								grid_simulator.setDispatch(i, schedule_vec[hour].hydro_GWh);
+								break;
+
+							case (PLANT_PEAKER):
+								grid_simulator.setDispatch(i, schedule_vec[hour].peaker_GWh);
+								break;
+
+							case (PLANT_STORAGE):
+								grid_simulator.setDispatch(i, schedule_vec[hour].storage_GWh);
+								break;
+
+							default:
+								// do nothing!
+								break;
+						}
+					}
+					grid_simulator.commitHour();
+				}
+				assert (fabs(grid_simulator.getScore() - optimal_score) < 1e-9);
+			}
+
+			std::cout << "\tDispatchSolver: ok" << std::endl;
+		}
+
+
+		// 7. testing session log (binary round trip and playback by frame)
+		{
+			std::string path = (
+				std::filesystem::temp_directory_path() / "MM_test_session.mms"
+			).string();
+
+			SessionLog session_log;
+			session_log.reset(0xFEEDFACECAFEBEEFULL);
+			session_log.pushEvent(0, SESSION_PHASE, 0);
+			session_log.pushEvent(120, SESSION_KEY_PRESS, 57);
+			session_log.pushEvent(120, SESSION_KEY_RELEASE, 57);
+			session_log.pushEvent(100000, SESSION_KEY_PRESS, -1);
+			session_log.pushEvent(100000, SESSION_END, -113);
+			session_log.write(path);
+
+			SessionLog replay_log;
+			replay_log.read(path);
+			assert (replay_log.getSeed() == 0xFEEDFACECAFEBEEFULL);
+			assert (replay_log.getNumEvents() == session_log.getNumEvents());
+			for (int i = 0; i < session_log.getNumEvents(); i++) {
+				assert (replay_log.getEvent(i).frame == session_log.getEvent(i).frame);
+				assert (replay_log.getEvent(i).type == session_log.getEvent(i).type);
+				assert (replay_log.getEvent(i).value == session_log.getEvent(i).value);
+			}
+
+			SessionEvent event;
+			assert (replay_log.nextEvent(0, &event) && event.type == SESSION_PHASE);
+			assert (!replay_log.nextEvent(119, &event));
+			assert (replay_log.nextEvent(120, &event) && event.type == SESSION_KEY_PRESS);
+			assert (replay_log.nextEvent(120, &event) && event.type == SESSION_KEY_RELEASE);
+			assert (!replay_log.nextEvent(120, &event));
+			assert (replay_log.hasEvent(100000, SESSION_END, -113));
+			assert (!replay_log.hasEvent(120, SESSION_PHASE, 0));
+
+			// not a session log
+			std::ofstream(path) << "not a session";
+			bool caught = false;
+			try {
+				replay_log.read(path);
+			}
+			catch (const std::runtime_error&) {
+				caught = true;
+			}
+			assert (caught);
+			std::filesystem::remove(path);
+
+			std::cout << "\tSessionLog: ok" << std::endl;
+		}
+
+
+		// 8. testing atlas packer (every sheet placed, in bounds, no overlap)
+		{
+			const int page_size = 2048;
+			const int padding = 2;
+			AtlasPacker atlas_packer(page_size, padding);
+
+			// the game's sheets, plus one too large for a page
+			atlas_packer.pushRect("coal", 128, 1152);
+			atlas_packer.pushRect("combined", 128, 1152);
+			atlas_packer.pushRect("fission", 128, 1152);
+			atlas_packer.pushRect("geothermal", 128, 1152);
+			atlas_packer.pushRect("hydro", 128, 640);
+			atlas_packer.pushRect("peaker", 128, 896);
+			atlas_packer.pushRect("foreground", 640, 1440);
+			atlas_packer.pushRect("overcast", 640, 480);
+			atlas_packer.pushRect("sky disk", 960, 1920);
+			atlas_packer.pushRect("spacebar", 512, 640);
+			atlas_packer.pushRect("marble", 32, 608);
+			atlas_packer.pushRect("clouds", 64, 192);
+			atlas_packer.pushRect("emissions", 8, 16);
+			atlas_packer.pushRect("wind sock", 48, 128);
+			for (int i = 0; i < 12; i++) {
+				atlas_packer.pushRect("tile " + std::to_string(i), 128, 128);
+				atlas_packer.pushRect("icon " + std::to_string(i), 32, 32);
+			}
+			atlas_packer.pushRect("wasd", 256, 2304);
+
+			int n_pages = atlas_packer.pack();
+			assert (n_pages >= 1);
+
+			for (int i = 0; i < atlas_packer.getNumRects(); i++) {
+				AtlasRect rect = atlas_packer.getRect(i);
+				if (rect.key == "wasd") {
+					assert (rect.page == -1);
+					continue;
+				}
+
+				assert (rect.page >= 0 && rect.page < n_pages);
+				assert (rect.x >= 0 && rect.x + rect.width <= page_size);
+				assert (rect.y >= 0 && rect.y + rect.height <= atlas_packer.getPageHeight(rect.page));
+
+				for (int j = 0; j < i; j++) {
+					AtlasRect other = atlas_packer.getRect(j);
+					assert (
+						other.page != rect.page ||
+						rect.x + rect.width + padding <= other.x ||
+						other.x + other.width + padding <= rect.x ||
+						rect.y + rect.height + padding <= other.y ||
+						other.y + other.height + padding <= rect.y
+					);
+				}
+			}
+
+			std::cout << "\tAtlasPacker: " << n_pages << " page(s), " <<
+				int(round(100 * atlas_packer.getOccupancy())) << "% occupancy" <<
+				std::endl;
+		}
+
+
+		// 9. testing pixel cache (round trip, invalidation by hash and by size,
+		//    pruning of unused entries)
+		{
+			std::string path = (
+				std::filesystem::temp_directory_path() / "MM_test_pixels.mmpc"
+			).string();
+			std::filesystem::remove(path);
+
+			const unsigned char pixels_a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+			const unsigned char pixels_b[4] = {9, 10, 11, 12};
+			unsigned int width = 0;
+			unsigned int height = 0;
+
+			{
+				PixelCache pixel_cache;
+				pixel_cache.open(path);
+				assert (pixel_cache.getNumEntries() == 0);
+				assert (pixel_cache.find("a.png", 1, &width, &height) == NULL);
+
+				pixel_cache.store("a.png", 1, 2, 1, pixels_a);
+				pixel_cache.store("b.png", 2, 1, 1, pixels_b);
+				assert (pixel_cache.save(true));
+				assert (!pixel_cache.save(true));	// nothing missed since
+			}
+
+			{
+				PixelCache pixel_cache;
+				pixel_cache.open(path);
+				assert (pixel_cache.getNumEntries() == 2);
+
+				const char* pixels_ptr = pixel_cache.find("a.png", 1, &width, &height);
+				assert (pixels_ptr != NULL && width == 2 && height == 1);
+				for (int i = 0; i < 8; i++) {
+					assert ((unsigned char)pixels_ptr[i] == pixels_a[i]);
+				}
+
+				// source changed
+				assert (pixel_cache.find("b.png", 3, &width, &height) == NULL);
+				assert (pixel_cache.getNumHits() == 1);
+				assert (pixel_cache.getNumMisses() == 1);
+
+				// "b.png" was not used this run, so it is pruned at shutdown
+				pixel_cache.store("c.png", 3, 1, 1, pixels_b);
+				assert (pixel_cache.save(true));
+				assert (pixel_cache.getNumEntries() == 2);
+				assert (pixel_cache.find("b.png", 2, &width, &height) == NULL);
+				assert (pixel_cache.find("c.png", 3, &width, &height) != NULL);
+			}
+
+			// pixels cut short
+			std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+			{
+				PixelCache pixel_cache;
+				pixel_cache.open(path);
+				assert (pixel_cache.getNumEntries() == 0);
+			}
+			std::filesystem::remove(path);
+
+			std::cout << "\tPixelCache: ok" << std::endl;
+		}
+
+
+		// 10. testing replay determinism (record a scripted session while
+		//     replaying it headless, then replay that recording headless and
+		//     compare final state)
+		{
+			std::string path = (
+				std::filesystem::temp_directory_path() / "MM_test_replay.mms"
+			).string();
+
+			// menu, tutorial, then cycle through plant, capacity, and play keys
+			const int n_frames = 2400;
+			const std::vector<sf::Keyboard::Key> key_cycle_vec = {
+				sf::Keyboard::D, sf::Keyboard::W, sf::Keyboard::W, sf::Keyboard::W,
+				sf::Keyboard::D, sf::Keyboard::W, sf::Keyboard::W, sf::Keyboard::Space,
+				sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::Space, sf::Keyboard::Right,
+				sf::Keyboard::Enter, sf::Keyboard::Left, sf::Keyboard::W, sf::Keyboard::Space,
+				sf::Keyboard::Space, sf::Keyboard::E, sf::Keyboard::E, sf::Keyboard::W,
+				sf::Keyboard::Space, sf::Keyboard::N
+			};
+
+			SessionLog script_log;
+			script_log.reset(2022);
+			script_log.pushEvent(40, SESSION_KEY_PRESS, sf::Keyboard::Space);
+			script_log.pushEvent(41, SESSION_KEY_RELEASE, sf::Keyboard::Space);
+			script_log.pushEvent(80, SESSION_KEY_PRESS, sf::Keyboard::Space);
+			script_log.pushEvent(81, SESSION_KEY_RELEASE, sf::Keyboard::Space);
+			int frame = 200;
+			for (int i = 0; frame < n_frames; i++) {
+				sf::Keyboard::Key key = key_cycle_vec[i % key_cycle_vec.size()];
+				script_log.pushEvent(frame, SESSION_KEY_PRESS, key);
+				script_log.pushEvent(frame + 2, SESSION_KEY_RELEASE, key);
+				frame += 9 + (i * 7) % 13;
+			}
+			script_log.pushEvent(n_frames, SESSION_END, 0);
+
+			double recorded_score = 0;
+			{
+				randomService().reseed(script_log.getSeed());
+				Game game(getRenderWindowPtr("Test 10"));
+				game.replaySession(script_log, 0);
+				game.recordSession(path);
+				game.run();
+				recorded_score = game.getScore();
+			}
+
+			SessionLog recorded_log;
+			recorded_log.read(path);
+			SessionEvent end_event =
+				recorded_log.getEvent(recorded_log.getNumEvents() - 1);
+			assert (recorded_log.getSeed() == script_log.getSeed());
+			assert (recorded_log.getNumEvents() > script_log.getNumEvents());	// (phases)
+			assert (end_event.type == SESSION_END);
+			assert (end_event.value == int(round(4 * recorded_score)));
+
+			{
+				randomService().reseed(recorded_log.getSeed());
+				Game game(getRenderWindowPtr("Test 10"));
+				game.replaySession(recorded_log, 0);
+				game.run();
+				assert (game.getNumReplayDivergences() == 0);
+				assert (game.getScore() == recorded_score);
+			}
+			std::filesystem::remove(path);
+
+			std::cout << "\tSession replay: score " << recorded_score <<
+				" (seed " << script_log.getSeed() << ")" << std::endl;
+		}
+
+
+		// 11. testing particle pool (capacity overflow, swap remove of vanished
+		//     particles)
+		{
+			Assets assets;
+			ParticlePool particle_pool(4, NULL, &assets);
+
+			// full pool drops spawns
+			for (int i = 0; i < 4; i++) {
+				assert (particle_pool.spawn(PARTICLE_STEAM, i, 0));
+			}
+			assert (!particle_pool.spawn(PARTICLE_SMOKE, 4, 0));
+			assert (particle_pool.getNumParticles() == 4);
+			particle_pool.clear();
+			assert (particle_pool.getNumParticles() == 0);
+
+			// two old particles ahead of two young ones (all fade alike), so
+			// removing the old ones moves the young ones into their slots
+			const int n_steps_apart = 100;
+			particle_pool.spawn(PARTICLE_STEAM, 0, 0);
+			particle_pool.spawn(PARTICLE_SMOKE, 1, 0);
+			for (int i = 0; i < n_steps_apart; i++) {
+				particle_pool.update(SECONDS_PER_FRAME, 1);
+			}
+			particle_pool.spawn(PARTICLE_STEAM, 2, 0);
+			particle_pool.spawn(PARTICLE_SMOKE, 3, 0);
+
+			int old_steps = 0;
+			while (particle_pool.getNumParticles() == 4 && old_steps < 1000) {
+				particle_pool.update(SECONDS_PER_FRAME, 1);
+				old_steps++;
+			}
+			assert (particle_pool.getNumParticles() == 2);	// (both in one pass)
+
+			// moved particles kept their own state, so vanish on time
+			int young_steps = old_steps;
+			while (particle_pool.getNumParticles() == 2 && young_steps < 1000) {
+				particle_pool.update(SECONDS_PER_FRAME, 1);
+				young_steps++;
+			}
+			assert (particle_pool.getNumParticles() == 0);
+			assert (young_steps - old_steps == n_steps_apart);
+
+			// freed slots are reused
+			for (int i = 0; i < 4; i++) {
+				assert (particle_pool.spawn(PARTICLE_SMOKE, i, 0));
+			}
+			assert (!particle_pool.spawn(PARTICLE_STEAM, 4, 0));
+
+			std::cout << "\tParticlePool: ok (particles vanish after " <<
+				old_steps + n_steps_apart << " steps)" << std::endl;
+		}
+
+
+		// 12. testing text cache (keyed by font, size, and string, not colour;
+		//     idle entries evicted)
+		{
+			Assets assets;
+			FontId bold_font_id =
+				assets.loadFont("assets/font/OpenSans-Bold.ttf", "bold");
+			FontId teletype_font_id =
+				assets.loadFont("assets/font/Roboto-Thin.ttf", "teletype");
+			assets.warmGlyphs(bold_font_id, 16);
+			assets.warmGlyphs(bold_font_id, 20);
+			assets.warmGlyphs(teletype_font_id, 16);
+
+			const int max_idle_frames = 2;
+			TextCache text_cache(&assets, max_idle_frames);
+
+			TextCacheEntry* entry_ptr = text_cache.get(bold_font_id, 16, "Score: 0");
+			assert (text_cache.get(bold_font_id, 16, "Score: 0") == entry_ptr);
+			assert (
+				text_cache.get(bold_font_id, 16, "Score: 0", sf::Color(255, 0, 0, 255)) ==
+				entry_ptr
+			);
+			assert (entry_ptr->text.getFillColor() == sf::Color(255, 0, 0, 255));
+			assert (text_cache.get(bold_font_id, 20, "Score: 0") != entry_ptr);
+			assert (text_cache.get(teletype_font_id, 16, "Score: 0") != entry_ptr);
+			assert (text_cache.get(bold_font_id, 16, "Score: 1") != entry_ptr);
+			assert (text_cache.getNumEntries() == 4);
+
+			text_cache.endFrame();
+			assert (fabs(text_cache.getHitRate() - 2.0 / 6) < 1e-9);
+
+			// only "Score: 0" is fetched, so the others go idle and are evicted
+			for (int i = 0; i <= max_idle_frames; i++) {
+				assert (text_cache.getNumEntries() == 4);
+				assert (text_cache.get(bold_font_id, 16, "Score: 0") == entry_ptr);
+				text_cache.endFrame();
+			}
+			assert (text_cache.getNumEntries() == 1);
+			assert (text_cache.getHitRate() == 1);
+			assert (text_cache.get(bold_font_id, 16, "Score: 0") == entry_ptr);
+			assert (assets.getNumGlyphMisses() == 0);
+
+			// not a valid idle limit
+			bool caught = false;
+			try {
+				TextCache bad_text_cache(&assets, -1);
+			}
+			catch (const std::runtime_error&) {
+				caught = true;
+			}
+			assert (caught);
+
+			std::cout << "\tTextCache: ok" << std::endl;
+		}
+
+
+		// 13. testing asset pack (build, open, and find round trip; truncated
+		//     packs rejected)
+		{
+			std::filesystem::path root_dir =
+				std::filesystem::temp_directory_path() / "MM_test_pack";
+			std::string path = (
+				std::filesystem::temp_directory_path() / "MM_test_pack.mmpk"
+			).string();
+			std::filesystem::remove_all(root_dir);
+			std::filesystem::create_directories(root_dir / "sub");
+
+			const std::string a_str = "megawatts";
+			const std::string b_str(1000, 'm');
+			std::ofstream((root_dir / "a.txt").string(), std::ios::binary) << a_str;
+			std::ofstream((root_dir / "sub" / "b.bin").string(), std::ios::binary) << b_str;
+
+			assert (AssetPack::build(root_dir.generic_string(), path) == 2);
+
+			{
+				AssetPack asset_pack;
+				asset_pack.open(path);
+				assert (asset_pack.isOpen());
+				assert (asset_pack.getNumEntries() == 2);
+
+				size_t size = 0;
+				const char* data_ptr =
+					asset_pack.find((root_dir / "a.txt").generic_string(), &size);
+				assert (data_ptr != NULL && std::string(data_ptr, size) == a_str);
+				assert ((unsigned long long)data_ptr % ASSET_PACK_ALIGNMENT == 0);
+
+				data_ptr =
+					asset_pack.find((root_dir / "sub" / "b.bin").generic_string(), &size);
+				assert (data_ptr != NULL && std::string(data_ptr, size) == b_str);
+				assert ((unsigned long long)data_ptr % ASSET_PACK_ALIGNMENT == 0);
+
+				assert (asset_pack.find("c.txt", &size) == NULL);
+			}
+
+			// last entry cut short
+			std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+			bool caught = false;
+			try {
+				AssetPack asset_pack;
+				asset_pack.open(path);
+			}
+			catch (const std::runtime_error&) {
+				caught = true;
+			}
+			assert (caught);
+
+			std::filesystem::remove_all(root_dir);
+			std::filesystem::remove(path);
+
+			std::cout << "\tAssetPack: ok" << std::endl;
+		}
 	}
 	catch (...) {
 		std::cerr << "\n*** A test has failed! ***\n" << std::endl;
@@ -58,6 +653,199 @@ void runTests(void) {
 }	// end runTests()
 
 
+void benchmarkStartup(void) {
+	/*
+	 *	Benchmark of image loading at startup, decoding every PNG (as every
+	 *	launch did before the pixel cache) against loading it from the pixel
+	 *	cache (as every launch after the first now does), over every PNG in
+	 *	the asset tree
+	 */
+
+	std::cout << "Running startup benchmark ... " << std::endl;
+
+	// read sources up front (the same either way)
+	std::vector<std::string> path_vec;
+	for (
+		const std::filesystem::directory_entry& dir_entry :
+		std::filesystem::recursive_directory_iterator("assets")
+	) {
+		if (dir_entry.is_regular_file() && dir_entry.path().extension() == ".png") {
+			path_vec.push_back(dir_entry.path().generic_string());
+		}
+	}
+	std::vector<std::string> source_vec;
+	for (size_t i = 0; i < path_vec.size(); i++) {
+		std::ifstream in_stream(path_vec[i], std::ios::binary);
+		source_vec.push_back(
+			std::string(
+				(std::istreambuf_iterator<char>(in_stream)),
+				std::istreambuf_iterator<char>()
+			)
+		);
+	}
+
+	std::filesystem::path cache_path =
+		std::filesystem::temp_directory_path() / "MM_benchmark_pixels.mmpc";
+	std::filesystem::remove(cache_path);
+
+	PixelCache pixel_cache;
+	pixel_cache.open(cache_path.string());
+
+	const int n_launches = 5;
+	double time_ms[2] = {0, 0};
+	sf::Image image;
+
+	// cold, decode every PNG
+	for (int launch = 0; launch < n_launches; launch++) {
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < source_vec.size(); i++) {
+			PixelCache::hashBytes(source_vec[i].data(), source_vec[i].size());
+			if (!image.loadFromMemory(source_vec[i].data(), source_vec[i].size())) {
+				std::stringstream error_ss;
+				error_ss << "EXCEPTION: benchmarkStartup(): Cannot decode \"" <<
+					path_vec[i] << "\".";
+				throw std::runtime_error(error_ss.str());
+			}
+		}
+		time_ms[0] += std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - start
+		).count();
+	}
+
+	// fill and write the cache (first launch, not timed)
+	for (size_t i = 0; i < source_vec.size(); i++) {
+		image.loadFromMemory(source_vec[i].data(), source_vec[i].size());
+		pixel_cache.store(
+			path_vec[i],
+			PixelCache::hashBytes(source_vec[i].data(), source_vec[i].size()),
+			image.getSize().x,
+			image.getSize().y,
+			image.getPixelsPtr()
+		);
+	}
+	pixel_cache.save(true);
+
+	// cached, hash source and copy pixels out of the mapping
+	for (int launch = 0; launch < n_launches; launch++) {
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < source_vec.size(); i++) {
+			unsigned int width = 0;
+			unsigned int height = 0;
+			const char* pixels_ptr = pixel_cache.find(
+				path_vec[i],
+				PixelCache::hashBytes(source_vec[i].data(), source_vec[i].size()),
+				&width,
+				&height
+			);
+			if (pixels_ptr == NULL) {
+				std::stringstream error_ss;
+				error_ss << "EXCEPTION: benchmarkStartup(): Pixel cache missed \"" <<
+					path_vec[i] << "\".";
+				throw std::runtime_error(error_ss.str());
+			}
+			image.create(width, height, (const sf::Uint8*)pixels_ptr);
+		}
+		time_ms[1] += std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - start
+		).count();
+	}
+
+	std::stringstream title_ss;
+	title_ss << "images at startup (" << path_vec.size() << " PNGs, ms per launch)";
+	printBenchmark(
+		title_ss.str(),
+		"PNG decode",
+		time_ms[0] / n_launches,
+		"pixel cache",
+		time_ms[1] / n_launches
+	);
+
+	std::filesystem::remove(cache_path);
+
+	std::cout << "\n*** Startup benchmark complete! ***\n" << std::endl;
+
+	return;
+}	// end benchmarkStartup()
+
+
+void benchmarkAssetHandles(void) {
+	/*
+	 *	Benchmark of Assets::getTexture() by interned handle against by string
+	 *	key (as every per-frame fetch did before handles), on the game's
+	 *	loaded textures
+	 */
+
+	std::cout << "Running asset lookup benchmark ... " << std::endl;
+
+	Assets assets;
+	AssetLoader asset_loader(0);
+	Game::queueAssets(&asset_loader);
+	asset_loader.start();
+	while (!asset_loader.isFinished()) {
+		if (asset_loader.upload(&assets, 1) == 0) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	std::vector<TextureId> texture_id_vec;
+	std::vector<std::string> texture_key_vec;
+	for (int i = 0; i < assets.getNumTextures(); i++) {
+		TextureId texture_id;
+		texture_id.idx = i;
+		texture_id_vec.push_back(texture_id);
+		texture_key_vec.push_back(assets.getTextureKey(texture_id));
+	}
+
+	// same call sequence for both (a frame draws a mix of keys)
+	const int n_lookups = 1 << 22;
+	RandomStream random_stream(deriveSeed(1234, RNG_BATCH, 0));
+	std::vector<int> call_vec(n_lookups, 0);
+	for (int i = 0; i < n_lookups; i++) {
+		call_vec[i] = random_stream.uniformInt(0, int(texture_id_vec.size()) - 1);
+	}
+
+	double time_ns[2] = {0, 0};
+	unsigned long long checksum[2] = {0, 0};
+	for (int mode = 0; mode < 2; mode++) {
+		auto start = std::chrono::steady_clock::now();
+		if (mode == 0) {
+			for (int i = 0; i < n_lookups; i++) {
+				checksum[mode] += (unsigned long long)(
+					assets.getTexture(texture_key_vec[call_vec[i]])
+				);
+			}
+		}
+		else {
+			for (int i = 0; i < n_lookups; i++) {
+				checksum[mode] += (unsigned long long)(
+					assets.getTexture(texture_id_vec[call_vec[i]])
+				);
+			}
+		}
+		time_ns[mode] = std::chrono::duration<double, std::nano>(
+			std::chrono::steady_clock::now() - start
+		).count() / n_lookups;
+	}
+
+	std::stringstream title_ss;
+	title_ss << "Assets::getTexture() (" << texture_id_vec.size() <<
+		" textures, ns per lookup)";
+	printBenchmark(
+		title_ss.str(),
+		"string key",
+		time_ns[0],
+		"handle",
+		time_ns[1]
+	);
+	std::cout << "\t\tchecksums match          " <<
+		(checksum[0] == checksum[1] ? "yes" : "NO") << std::endl;
+
+	std::cout << "\n*** Asset lookup benchmark complete! ***\n" << std::endl;
+
+	return;
+}	// end benchmarkAssetHandles()
+
+
 void renderSplashScreen(sf::RenderWindow* window_ptr) {
 	/*
 	 *	Renders the splash screen for Megawatts & Marbles - The Energy Planning Game
@@ -72,10 +860,13 @@ void renderSplashScreen(sf::RenderWindow* window_ptr) {
 	sf::Event event;
 	sf::Time time_elapsed = sf::Time::Zero;
 
+	FramePacer frame_pacer;
+	frame_pacer.setVerticalSync(window_ptr, true);
+
 	// load assets
 	sf::Texture MM_txtr;
 	MM_txtr.setSmooth(true);
-	assert (MM_txtr.loadFromFile("assets/images/MM_256x116.png"));
+	assert (loadAsset(&MM_txtr, "assets/images/MM_256x116.png"));
 	sf::Sprite MM_sprite(MM_txtr);
 	MM_sprite.setPosition(
 		(SCREEN_WIDTH - 256) / 2,
@@ -84,7 +875,7 @@ void renderSplashScreen(sf::RenderWindow* window_ptr) {
 
 	sf::Texture IESVic_txtr;
 	IESVic_txtr.setSmooth(true);
-	assert (IESVic_txtr.loadFromFile("assets/images/IESVic_512x88.png"));
+	assert (loadAsset(&IESVic_txtr, "assets/images/IESVic_512x88.png"));
 	sf::Sprite IESVic_sprite(IESVic_txtr);
 	IESVic_sprite.setPosition(
 		16,
@@ -93,7 +884,7 @@ void renderSplashScreen(sf::RenderWindow* window_ptr) {
 
 	sf::Texture SFML_txtr;
 	SFML_txtr.setSmooth(true);
-	assert (SFML_txtr.loadFromFile("assets/ESC_brand/SFML_256x128.png"));
+	assert (loadAsset(&SFML_txtr, "assets/ESC_brand/SFML_256x128.png"));
 	sf::Sprite SFML_sprite(SFML_txtr);
 	SFML_sprite.setPosition(
 		SCREEN_WIDTH - 272,
@@ -135,7 +926,7 @@ void renderSplashScreen(sf::RenderWindow* window_ptr) {
     legal_str += "CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.";
 
 	sf::Font font;
-	assert (font.loadFromFile("assets/ESC_brand/OpenSans-Bold.ttf"));
+	assert (loadAsset(&font, "assets/ESC_brand/OpenSans-Bold.ttf"));
 	sf::Text legal_text(legal_str, font, 16);
 	int text_width = ceil(1.02 * legal_text.getLocalBounds().width);
 	int text_height = ceil(1.02 * legal_text.getLocalBounds().height);
@@ -245,6 +1036,12 @@ void renderSplashScreen(sf::RenderWindow* window_ptr) {
 		if (animation_finished) {
 			break;
 		}
+
+		// sleep until next "clock tick"
+		frame_pacer.waitUntil(
+			(frame + 1) * SECONDS_PER_FRAME,
+			clock.getElapsedTime().asSeconds()
+		);
 	}
 
 	// clear and flip
@@ -258,123 +1055,236 @@ void renderSplashScreen(sf::RenderWindow* window_ptr) {
 // -------- class implementations -------- //
 
 
-// ---- Marble ---- //
-Marble::Marble(
-	double position_x,
-	double position_y,
+// ---- MarbleBatch ---- //
+MarbleBatch::MarbleBatch(
 	sf::RenderWindow* window_ptr,
-	Assets* assets_ptr,
-	sf::Color shader_colour,
-	bool charge
-) {
+	Assets* assets_ptr
+) :
+glass_array(sf::Triangles),
+core_array(sf::Quads)
+{
 	/*
-	 *	Constructor for Marble class
+	 *	Constructor for MarbleBatch class
 	 */
 
-	this->charge = charge;
-	this->height = 32;
-	this->frame = 0;
-	this->glow_frame = 0;
-	this->tile = 0;
-	this->width = 32;
- 	this->texture_key = "marble";
-	this->shader_colour = shader_colour;
+	this->region_flag = false;
 
-	if (this->charge) {
-		this->scale = 0.04;
-		this->target_x = position_x;
-		this->target_y = position_y;
-		this->position_x = SCREEN_WIDTH / 2;
-		this->position_y = SCREEN_HEIGHT / 2;
-	}
-	else {
-		this->scale = 1;
-		this->position_x = position_x;
-	 	this->position_y = position_y;
-		this->target_x = SCREEN_WIDTH / 2;
-		this->target_y = SCREEN_HEIGHT / 2;
+	// precompute circle geometry (same points as sf::CircleShape)
+	for (int i = 0; i < MARBLE_GLASS_POINTS; i++) {
+		double angle = (2 * M_PI * i) / MARBLE_GLASS_POINTS - M_PI / 2;
+		this->circle_vec.push_back(sf::Vector2f(cos(angle), sin(angle)));
 	}
-	this->init_dist = sqrt(
-		pow(this->position_x - this->target_x, 2) +
-		pow(this->position_y - this->target_y, 2)
-	);
 
- 	this->window_ptr = window_ptr;
+	this->window_ptr = window_ptr;
 
- 	this->assets_ptr = assets_ptr;
+	this->assets_ptr = assets_ptr;
+	this->texture_id = this->assets_ptr->internTexture("marble");
 
 	// stream out and return
-    //std::cout << "Marble object created at " << this << "." << std::endl;
-  	return;
-}	// end Marble::Marble()
+	//std::cout << "MarbleBatch object created at " << this << "." << std::endl;
+	return;
+}	// end MarbleBatch::MarbleBatch()
 
 
-bool Marble::isFinished(void) {
+void MarbleBatch::pushGlass(
+	double position_x,
+	double position_y,
+	double radius,
+	sf::Color colour
+) {
 	/*
-	 *	Method to check if marble has vanished (and hence can be destroyed)
+	 *	Method to push a marble glass circle (as a triangle fan)
 	 */
 
-	double dist_2_target = sqrt(
-		pow(this->position_x - this->target_x, 2) +
-		pow(this->position_y - this->target_y, 2)
-	);
-	if (dist_2_target <= 4 || this->scale <= 0.03) {
-		return true;
-	}
-	else {
-		return false;
+	sf::Vector2f centre(position_x, position_y);
+	for (int i = 0; i < MARBLE_GLASS_POINTS; i++) {
+		int j = (i + 1) % MARBLE_GLASS_POINTS;
+
+		this->glass_array.append(sf::Vertex(centre, colour));
+		this->glass_array.append(
+			sf::Vertex(centre + float(radius) * this->circle_vec[i], colour)
+		);
+		this->glass_array.append(
+			sf::Vertex(centre + float(radius) * this->circle_vec[j], colour)
+		);
 	}
-}	// end Marble::isFinished()
 
+	return;
+}	// end MarbleBatch::pushGlass()
 
-void Marble::drawFrame(void) {
+
+void MarbleBatch::pushCore(
+	double position_x,
+	double position_y,
+	double half_width,
+	sf::IntRect tile_rect,
+	sf::Color colour
+) {
 	/*
-	 *	Method to draw Marble frame
+	 *	Method to push a marble core quad, centred on the given position, with
+	 *	the given tile of the marble texture (wherever the atlas put it)
 	 */
 
-	// init
-	sf::CircleShape glass;
-	glass.setRadius(this->width / 2);
-	glass.setFillColor(MARBLE_COLOUR_GLASS);
-	glass.setOrigin(this->width / 2, this->height / 2);
+	if (!this->region_flag) {
+		this->region = this->assets_ptr->getRegion(this->texture_id);
+		this->region_flag = true;
+	}
 
-	sf::Sprite sprite(
- 		*(this->assets_ptr->getTexture(this->texture_key)),
- 		sf::IntRect(
-			0,
-			this->tile * this->height,
-			this->width,
-			this->height
-		)
- 	);
-	sprite.setOrigin(this->width / 2, this->height / 2);
+	float left = position_x - half_width;
+	float right = position_x + half_width;
+	float top = position_y - half_width;
+	float bottom = position_y + half_width;
 
-	// transformations
- 	sprite.setPosition(
-		this->position_x,
-		this->position_y
+	float tex_left = this->region.rect.left + tile_rect.left;
+	float tex_right = tex_left + tile_rect.width;
+	float tex_top = this->region.rect.top + tile_rect.top;
+	float tex_bottom = tex_top + tile_rect.height;
+
+	this->core_array.append(
+		sf::Vertex(sf::Vector2f(left, top), colour, sf::Vector2f(tex_left, tex_top))
 	);
-	double split = fabs(cos((1.5 * M_PI * this->glow_frame) / FRAMES_PER_SECOND));
-	sprite.setColor(
-		sf::Color(
-			split * this->shader_colour.r + (1 - split) * 255,
-			split * this->shader_colour.g + (1 - split) * 255,
-			split * this->shader_colour.b + (1 - split) * 255,
-			255
+	this->core_array.append(
+		sf::Vertex(sf::Vector2f(right, top), colour, sf::Vector2f(tex_right, tex_top))
+	);
+	this->core_array.append(
+		sf::Vertex(
+			sf::Vector2f(right, bottom),
+			colour,
+			sf::Vector2f(tex_right, tex_bottom)
 		)
 	);
-	sf::Vector2f scale = sprite.getScale();
-	sprite.setScale(
-		scale.x * this->scale * (1 + split),
-		scale.y * this->scale * (1 + split)
+	this->core_array.append(
+		sf::Vertex(
+			sf::Vector2f(left, bottom),
+			colour,
+			sf::Vector2f(tex_left, tex_bottom)
+		)
 	);
 
-	glass.setPosition(
-		this->position_x,
-		this->position_y
+	return;
+}	// end MarbleBatch::pushCore()
+
+
+void MarbleBatch::draw(void) {
+	/*
+	 *	Method to draw everything pushed (all glass, then all cores), then
+	 *	clear for the next frame (vertex arrays keep their capacity)
+	 */
+
+	if (this->glass_array.getVertexCount() > 0) {
+		this->window_ptr->draw(this->glass_array);
+	}
+
+	if (this->core_array.getVertexCount() > 0) {
+		sf::RenderStates states;
+		states.texture = this->region.texture_ptr;
+		this->window_ptr->draw(this->core_array, states);
+	}
+
+	this->glass_array.clear();
+	this->core_array.clear();
+	this->region_flag = false;
+	return;
+}	// end MarbleBatch::draw()
+
+
+MarbleBatch::~MarbleBatch(void) {
+	/*
+	 *	Destructor for MarbleBatch class
+	 */
+
+	// stream out and return
+	//std::cout << "MarbleBatch object at " << this << " destroyed." << std::endl;
+	return;
+}	// end MarbleBatch::~MarbleBatch()
+
+
+// ---- Marble ---- //
+Marble::Marble(
+	double position_x,
+	double position_y,
+	sf::RenderWindow* window_ptr,
+	Assets* assets_ptr,
+	sf::Color shader_colour,
+	bool charge
+) {
+	/*
+	 *	Constructor for Marble class
+	 */
+
+	this->charge = charge;
+	this->height = 32;
+	this->frame = 0;
+	this->glow_frame = 0;
+	this->tile = 0;
+	this->width = 32;
+ 	this->texture_key = "marble";
+	this->shader_colour = shader_colour;
+
+	if (this->charge) {
+		this->scale = 0.04;
+		this->target_x = position_x;
+		this->target_y = position_y;
+		this->position_x = SCREEN_WIDTH / 2;
+		this->position_y = SCREEN_HEIGHT / 2;
+	}
+	else {
+		this->scale = 1;
+		this->position_x = position_x;
+	 	this->position_y = position_y;
+		this->target_x = SCREEN_WIDTH / 2;
+		this->target_y = SCREEN_HEIGHT / 2;
+	}
+	this->init_dist = sqrt(
+		pow(this->position_x - this->target_x, 2) +
+		pow(this->position_y - this->target_y, 2)
+	);
+	this->prev_glow_frame = this->glow_frame;
+	this->prev_position_x = this->position_x;
+	this->prev_position_y = this->position_y;
+	this->prev_scale = this->scale;
+
+ 	this->window_ptr = window_ptr;
+
+ 	this->assets_ptr = assets_ptr;
+
+	// stream out and return
+    //std::cout << "Marble object created at " << this << "." << std::endl;
+  	return;
+}	// end Marble::Marble()
+
+
+bool Marble::isFinished(void) {
+	/*
+	 *	Method to check if marble has vanished (and hence can be destroyed)
+	 */
+
+	double dist_2_target = sqrt(
+		pow(this->position_x - this->target_x, 2) +
+		pow(this->position_y - this->target_y, 2)
 	);
-	scale = glass.getScale();
-	glass.setScale(scale.x * this->scale, scale.y * this->scale);
+	if (dist_2_target <= 4 || this->scale <= 0.03) {
+		return true;
+	}
+	else {
+		return false;
+	}
+}	// end Marble::isFinished()
+
+
+void Marble::update(double dt_s) {
+	/*
+	 *	Method to advance Marble by dt_s (motion is per 60 Hz frame, so scaled
+	 *	by frames elapsed)
+	 */
+
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
+	// keep last state (to interpolate between when drawing)
+	this->prev_glow_frame = this->glow_frame;
+	this->prev_position_x = this->position_x;
+	this->prev_position_y = this->position_y;
+	this->prev_scale = this->scale;
 
 	// update scale (based on distance to target)
 	double dist_2_target = sqrt(
@@ -392,12 +1302,8 @@ void Marble::drawFrame(void) {
 	double delta_x = this->target_x - this->position_x;
 	double delta_y = this->target_y - this->position_y;
 	double denom = sqrt(pow(delta_x, 2) + pow(delta_y, 2));
-	this->position_x += 12 * this->scale * (delta_x / denom);
-	this->position_y += 12 * this->scale * (delta_y / denom);
-
-	// draw
-	this->window_ptr->draw(glass);
-	this->window_ptr->draw(sprite);
+	this->position_x += 12 * this->scale * (delta_x / denom) * n_frames;
+	this->position_y += 12 * this->scale * (delta_y / denom) * n_frames;
 
 	// increment frame and tile, return
 	if (this->frame >= 0.005 * FRAMES_PER_SECOND) {
@@ -416,9 +1322,52 @@ void Marble::drawFrame(void) {
 		this->frame = 0;
 	}
 	else {
-		this->frame++;
+		this->frame += n_frames;
 	}
-	this->glow_frame++;
+	this->glow_frame += n_frames;
+	return;
+}	// end Marble::update()
+
+
+void Marble::drawFrame(double render_ratio, MarbleBatch* batch_ptr) {
+	/*
+	 *	Method to push Marble frame to the given batch, render_ratio of the way
+	 *	from the last state to the current one
+	 */
+
+	// interpolate
+	double glow_frame = this->prev_glow_frame +
+		render_ratio * (this->glow_frame - this->prev_glow_frame);
+	double position_x = this->prev_position_x +
+		render_ratio * (this->position_x - this->prev_position_x);
+	double position_y = this->prev_position_y +
+		render_ratio * (this->position_y - this->prev_position_y);
+	double marble_scale = this->prev_scale +
+		render_ratio * (this->scale - this->prev_scale);
+
+	// glow
+	double split = fabs(cos((1.5 * M_PI * glow_frame) / FRAMES_PER_SECOND));
+	sf::Color core_colour(
+		split * this->shader_colour.r + (1 - split) * 255,
+		split * this->shader_colour.g + (1 - split) * 255,
+		split * this->shader_colour.b + (1 - split) * 255,
+		255
+	);
+
+	// push and return
+	batch_ptr->pushGlass(
+		position_x,
+		position_y,
+		marble_scale * this->width / 2,
+		MARBLE_COLOUR_GLASS
+	);
+	batch_ptr->pushCore(
+		position_x,
+		position_y,
+		marble_scale * (1 + split) * this->width / 2,
+		sf::IntRect(0, this->tile * this->height, this->width, this->height),
+		core_colour
+	);
 	return;
 }	// end Marble::drawFrame()
 
@@ -434,554 +1383,1439 @@ Marble::~Marble(void) {
 }	// end Marble::~Marble()
 
 
-// ---- Emissions Hierarchy ---- //
+// ---- Emissions ---- //
 
 
-// ---- Particle ---- //
-Particle::Particle(
-	double position_x,
-	double position_y,
+// ---- ParticlePool ---- //
+ParticlePool::ParticlePool(
+	int capacity,
 	sf::RenderWindow* window_ptr,
 	Assets* assets_ptr
-) {
+) :
+alpha_vec(capacity, 0),
+angle_vec(capacity, 0),
+position_x_vec(capacity, 0),
+position_y_vec(capacity, 0),
+scale_vec(capacity, 0),
+prev_alpha_vec(capacity, 0),
+prev_angle_vec(capacity, 0),
+prev_position_x_vec(capacity, 0),
+prev_position_y_vec(capacity, 0),
+prev_scale_vec(capacity, 0),
+type_vec(capacity, 0),
+vertex_array(sf::Quads)
+{
 	/*
-	 *	Constructor for Particle class
+	 *	Constructor for ParticlePool class
 	 */
 
-	this->height = 8;
-	this->width = 8;
-	this->alpha = 255;
-	this->angle = 0;
-	this->position_x = position_x;
-	this->position_y = position_y;
-	this->scale = 1;
-	this->texture_key = "emissions";
+	this->capacity = capacity;
+	this->n_particles = 0;
 
 	this->window_ptr = window_ptr;
 
 	this->assets_ptr = assets_ptr;
+	this->texture_id = this->assets_ptr->internTexture("emissions");
 
 	// stream out and return
-    //std::cout << "Particle object created at " << this << "." << std::endl;
-  	return;
-}	// end Particle::Particle()
+	std::cout << "ParticlePool object created at " << this << " (capacity " <<
+		this->capacity << ")." << std::endl;
+	return;
+}	// end ParticlePool::ParticlePool()
 
 
-bool Particle::isFinished(void) {
+void ParticlePool::remove(int i) {
 	/*
-	 *	Method to check if particle has vanished (and hence can be destroyed)
+	 *	Method to remove particle i, by moving the last particle into its slot
+	 *	(order is not kept, so no shifting)
 	 */
 
-	if (this->alpha <= 0) {
-		return true;
-	}
-	else {
-		return false;
-	}
-}	// end Particle::isFinished()
+	int last = this->n_particles - 1;
 
+	this->alpha_vec[i] = this->alpha_vec[last];
+	this->angle_vec[i] = this->angle_vec[last];
+	this->position_x_vec[i] = this->position_x_vec[last];
+	this->position_y_vec[i] = this->position_y_vec[last];
+	this->scale_vec[i] = this->scale_vec[last];
+	this->prev_alpha_vec[i] = this->prev_alpha_vec[last];
+	this->prev_angle_vec[i] = this->prev_angle_vec[last];
+	this->prev_position_x_vec[i] = this->prev_position_x_vec[last];
+	this->prev_position_y_vec[i] = this->prev_position_y_vec[last];
+	this->prev_scale_vec[i] = this->prev_scale_vec[last];
+	this->type_vec[i] = this->type_vec[last];
 
-void Particle::drawFrame(double wind_speed_ratio) {
-	/*
-	 *	Method to draw particle frame
-	 */
+	this->n_particles--;
+	return;
+}	// end ParticlePool::remove()
 
-	// init
- 	sf::Sprite sprite(
- 		*(this->assets_ptr->getTexture(this->texture_key)),
- 		sf::IntRect(
-			0,
-			this->sprite_idx * this->height,
-			this->width,
-			this->height
-		)
- 	);
-	sprite.setOrigin(this->width / 2, this->height / 2);
 
- 	// transformations
- 	sprite.setPosition(
-		this->position_x,
-		this->position_y
-	);
-	sprite.setColor(sf::Color(255, 255, 255, this->alpha));
-	sprite.setRotation(this->angle);
-	sf::Vector2f scale = sprite.getScale();
-	sprite.setScale(scale.x * this->scale, scale.y * this->scale);
+int ParticlePool::getNumParticles(void) {
+	return this->n_particles;
+}	// end ParticlePool::getNumParticles()
+
+
+bool ParticlePool::spawn(int type, double position_x, double position_y) {
+	/*
+	 *	Method to spawn a particle of the given type (see ParticleType) at the
+	 *	given position (false, and dropped, if the pool is full)
+	 */
 
-	// update position, alpha, angle, and scale
-	this->position_x += 2 * wind_speed_ratio;
-	this->position_y -= 1;
-	this->alpha -= 1.5;
-	if (this->alpha < 0) {
-		this->alpha = 0;
+	if (this->n_particles >= this->capacity) {
+		return false;
 	}
-	this->angle += 5 * wind_speed_ratio;
-	this->scale += 0.02;
 
- 	// draw and return
- 	this->window_ptr->draw(sprite);
- 	return;
-}	// end of Particle::drawFrame()
+	int i = this->n_particles;
+	this->alpha_vec[i] = 255;
+	this->angle_vec[i] = 0;
+	this->position_x_vec[i] = position_x;
+	this->position_y_vec[i] = position_y;
+	this->scale_vec[i] = 1;
+	this->prev_alpha_vec[i] = this->alpha_vec[i];
+	this->prev_angle_vec[i] = this->angle_vec[i];
+	this->prev_position_x_vec[i] = this->position_x_vec[i];
+	this->prev_position_y_vec[i] = this->position_y_vec[i];
+	this->prev_scale_vec[i] = this->scale_vec[i];
+	this->type_vec[i] = type;
+
+	this->n_particles++;
+	return true;
+}	// end ParticlePool::spawn()
 
 
-Particle::~Particle(void) {
+void ParticlePool::clear(void) {
 	/*
-	 *	Destructor for Particle class
+	 *	Method to remove all particles
 	 */
 
-	// stream out and return
-  	//std::cout << "Particle object at " << this << " destroyed." << std::endl;
-  	return;
-}	// end Particle::~Particle()
-
+	this->n_particles = 0;
+	return;
+}	// end ParticlePool::clear()
 
-// ---- Particle <-- Steam ---- //
 
-Steam::Steam(
-	double position_x,
-	double position_y,
-	sf::RenderWindow* window_ptr,
-	Assets* assets_ptr
-) :
-Particle(
-	position_x,
-	position_y,
-	window_ptr,
-	assets_ptr
-) {
+void ParticlePool::update(double dt_s, double wind_speed_ratio) {
 	/*
-	 *	Constructor for Steam class
+	 *	Method to remove vanished particles, then advance the rest by dt_s
+	 *	(every particle moves alike, so the update is a set of flat loops
+	 *	over the arrays, which the compiler can vectorize)
 	 */
 
-	this->sprite_idx = 0;
+	// remove vanished particles
+	int idx = 0;
+	while (idx < this->n_particles) {
+		if (this->alpha_vec[idx] <= 0) {
+			this->remove(idx);
+		}
+		else {
+			idx++;
+		}
+	}
 
-	// stream out and return
-  	//std::cout << "\tSteam object created at " << this << ".\n" << std::endl;
-  	return;
-}	// end Steam::Steam()
+	// per step deltas
+	float n_frames = dt_s * FRAMES_PER_SECOND;
+	float d_position_x = 2 * wind_speed_ratio * n_frames;
+	float d_position_y = -n_frames;
+	float d_alpha = 1.5 * n_frames;
+	float d_angle = 5 * wind_speed_ratio * n_frames;
+	float d_scale = 0.02 * n_frames;
 
+	// keep last state (to interpolate between when drawing), then step (one
+	// array at a time, so each loop is a plain two stream loop)
+	int n = this->n_particles;
 
-Steam::~Steam(void) {
-	/*
-	 *	Destructor for Steam class
-	 */
+	float* position_x = this->position_x_vec.data();
+	float* prev_position_x = this->prev_position_x_vec.data();
+	for (int i = 0; i < n; i++) {
+		prev_position_x[i] = position_x[i];
+		position_x[i] += d_position_x;
+	}
 
-	// stream out and return
-  	//std::cout << "\tSteam object at " << this << " destroyed.\n" << std::endl;
-  	return;
-}	// end Steam::~Steam()
+	float* position_y = this->position_y_vec.data();
+	float* prev_position_y = this->prev_position_y_vec.data();
+	for (int i = 0; i < n; i++) {
+		prev_position_y[i] = position_y[i];
+		position_y[i] += d_position_y;
+	}
 
+	float* angle = this->angle_vec.data();
+	float* prev_angle = this->prev_angle_vec.data();
+	for (int i = 0; i < n; i++) {
+		prev_angle[i] = angle[i];
+		angle[i] += d_angle;
+	}
 
-// ---- Particle <-- Smoke ---- //
+	float* scale = this->scale_vec.data();
+	float* prev_scale = this->prev_scale_vec.data();
+	for (int i = 0; i < n; i++) {
+		prev_scale[i] = scale[i];
+		scale[i] += d_scale;
+	}
 
-Smoke::Smoke(
-	double position_x,
-	double position_y,
-	sf::RenderWindow* window_ptr,
-	Assets* assets_ptr
-) :
-Particle(
-	position_x,
-	position_y,
-	window_ptr,
-	assets_ptr
-) {
+	float* alpha = this->alpha_vec.data();
+	float* prev_alpha = this->prev_alpha_vec.data();
+	for (int i = 0; i < n; i++) {
+		prev_alpha[i] = alpha[i];
+		float faded = alpha[i] - d_alpha;
+		alpha[i] = faded < 0 ? 0 : faded;
+	}
+
+	return;
+}	// end ParticlePool::update()
+
+
+void ParticlePool::drawFrame(double render_ratio) {
 	/*
-	 *	Constructor for Smoke class
+	 *	Method to draw all particles (one quad each, in a single draw call),
+	 *	render_ratio of the way from the last state to the current one
 	 */
 
-	this->sprite_idx = 1;
+	if (this->n_particles == 0) {
+		return;
+	}
 
-	// stream out and return
-  	//std::cout << "\tSmoke object created at " << this << ".\n" << std::endl;
-  	return;
-}	// end Smoke::Smoke()
+	AtlasRegion region = this->assets_ptr->getRegion(this->texture_id);
+
+	float ratio = render_ratio;
+	float half_size = 4;	// particle tiles are 8 x 8
+	float degrees_to_radians = M_PI / 180;
+	float corner_x[4] = {-1, 1, 1, -1};
+	float corner_y[4] = {-1, -1, 1, 1};
+
+	this->vertex_array.resize(4 * this->n_particles);
+	for (int i = 0; i < this->n_particles; i++) {
+		// interpolate
+		float alpha = this->prev_alpha_vec[i] +
+			ratio * (this->alpha_vec[i] - this->prev_alpha_vec[i]);
+		float angle = this->prev_angle_vec[i] +
+			ratio * (this->angle_vec[i] - this->prev_angle_vec[i]);
+		float position_x = this->prev_position_x_vec[i] +
+			ratio * (this->position_x_vec[i] - this->prev_position_x_vec[i]);
+		float position_y = this->prev_position_y_vec[i] +
+			ratio * (this->position_y_vec[i] - this->prev_position_y_vec[i]);
+		float scale = this->prev_scale_vec[i] +
+			ratio * (this->scale_vec[i] - this->prev_scale_vec[i]);
+
+		// rotated and scaled quad (as sf::Sprite, about its centre)
+		float cos_angle = half_size * scale * cos(degrees_to_radians * angle);
+		float sin_angle = half_size * scale * sin(degrees_to_radians * angle);
+		float tex_left = region.rect.left;
+		float tex_top = region.rect.top + 2 * half_size * this->type_vec[i];
+		sf::Color colour(255, 255, 255, alpha);
+
+		for (int j = 0; j < 4; j++) {
+			sf::Vertex* vertex_ptr = &(this->vertex_array[4 * i + j]);
+			vertex_ptr->position = sf::Vector2f(
+				position_x + corner_x[j] * cos_angle - corner_y[j] * sin_angle,
+				position_y + corner_x[j] * sin_angle + corner_y[j] * cos_angle
+			);
+			vertex_ptr->color = colour;
+			vertex_ptr->texCoords = sf::Vector2f(
+				tex_left + half_size * (1 + corner_x[j]),
+				tex_top + half_size * (1 + corner_y[j])
+			);
+		}
+	}
+
+	sf::RenderStates states;
+	states.texture = region.texture_ptr;
+	this->window_ptr->draw(this->vertex_array, states);
+	return;
+}	// end ParticlePool::drawFrame()
 
 
-Smoke::~Smoke(void) {
+ParticlePool::~ParticlePool(void) {
 	/*
-	 *	Destructor for Smoke class
+	 *	Destructor for ParticlePool class
 	 */
 
 	// stream out and return
-  	//std::cout << "\tSmoke object at " << this << " destroyed.\n" << std::endl;
-  	return;
-}	// end Smoke::~Smoke()
+	std::cout << "ParticlePool object at " << this << " destroyed." << std::endl;
+	return;
+}	// end ParticlePool::~ParticlePool()
 
 
-// ---- Sky Disk ---- //
+// ---- LayerCache ---- //
 
-SkyDisk::SkyDisk(sf::RenderWindow* window_ptr, Assets* assets_ptr)
-{
+LayerCache::LayerCache(sf::RenderWindow* window_ptr) {
 	/*
-	 *	Constructor for Sky Disk
+	 *	Constructor for LayerCache class (the render texture is created on
+	 *	first redraw, so a cache that is never drawn costs nothing)
 	 */
 
-	this->angle = 180;
+	this->created_flag = false;
+	this->fallback_flag = false;
+	this->valid_flag = false;
+	this->n_redraws = 0;
 	this->window_ptr = window_ptr;
-	this->assets_ptr = assets_ptr;
 
 	// stream out and return
- 	std::cout << "SkyDisk object created at " << this << "." << std::endl;
- 	return;
-}	// end SkyDisk::SkyDisk()
+	std::cout << "LayerCache object created at " << this << "." << std::endl;
+	return;
+}	// end LayerCache::LayerCache()
 
 
-void SkyDisk::buildSprites(void) {
+void LayerCache::create(void) {
 	/*
-	 *	Method to build sprites (to finish construction once assets available!)
+	 *	Method to create the (screen sized) render texture
 	 */
 
-	// day sprite
-	this->day_sprite.setTexture(*(this->assets_ptr->getTexture("sky disk")));
-	this->day_sprite.setTextureRect(sf::IntRect(0, 0, 960, 960));
-	this->day_sprite.setOrigin(960 / 2, 960 / 2);
-	sf::Vector2f scale = this->day_sprite.getScale();
-	this->day_sprite.setScale(scale.x * 2 * sqrt(2), scale.y * 2 * sqrt(2));
-	this->day_sprite.setPosition(
-		SCREEN_WIDTH / 2,
-		SCREEN_HEIGHT
-	);
-	this->day_sprite.setRotation(this->angle);
+	this->created_flag = true;
 
-	// night sprite
-	this->night_sprite.setTexture(*(this->assets_ptr->getTexture("sky disk")));
-	this->night_sprite.setTextureRect(sf::IntRect(0, 960, 960, 960));
-	this->night_sprite.setOrigin(960 / 2, 960 / 2);
-	scale = this->night_sprite.getScale();
-	this->night_sprite.setScale(scale.x * 2 * sqrt(2), scale.y * 2 * sqrt(2));
-	this->night_sprite.setPosition(
-		SCREEN_WIDTH / 2,
-		SCREEN_HEIGHT
-	);
-	this->night_sprite.setRotation(this->angle);
+	if (!this->render_texture.create(SCREEN_WIDTH, SCREEN_HEIGHT)) {
+		std::cout << "LayerCache::create(): render texture not available, " <<
+			"drawing straight to window." << std::endl;
+		this->fallback_flag = true;
+		return;
+	}
 
+	this->sprite.setTexture(this->render_texture.getTexture(), true);
 	return;
-}	// end of SkyDisk::buildSprite()
+}	// end LayerCache::create()
 
 
-double SkyDisk::getAlphaVar(void) {
+bool LayerCache::needsRedraw(std::initializer_list<double> inputs) {
 	/*
-	 *	Method to compute alpha_var (for dawn/dusk transitions)
+	 *	Method to check the layer's inputs against those it was last drawn
+	 *	with (true if it must be redrawn)
 	 */
 
-	double alpha_var = 0;
-	int angle = (int)(this->angle) % 360;
+	if (!this->created_flag) {
+		this->create();
+	}
 
-	if (angle >= 60 && angle <= 120) {
-		alpha_var = (1.0 / 60.0) * angle - 1.0;
+	if (this->fallback_flag) {
+		return true;
 	}
-	else if (angle >= 240 && angle <= 300) {
-		alpha_var = (-1.0 / 60.0) * angle + 5.0;
+
+	bool changed_flag = !this->valid_flag ||
+		this->input_vec.size() != inputs.size();
+
+	size_t i = 0;
+	for (auto itr = inputs.begin(); !changed_flag && itr != inputs.end(); itr++) {
+		changed_flag = *itr != this->input_vec[i];
+		i++;
 	}
-	else if (angle > 120 && angle < 240) {
-		alpha_var = 1;
+
+	if (changed_flag) {
+		this->input_vec.assign(inputs.begin(), inputs.end());
 	}
 
-	return alpha_var;
-}	// end SkyDisk::getAlphaVar()
+	return changed_flag;
+}	// end LayerCache::needsRedraw()
 
 
-void SkyDisk::drawFrame(double hour_of_day) {
+sf::RenderTarget* LayerCache::beginRedraw(void) {
 	/*
-	 *	Method to draw frame of Sky Disk
+	 *	Method to start a redraw, returns the target to draw the layer to
 	 */
 
-	// angle as function of hour of day
-	this->angle = (360.0 / 24.0) * hour_of_day + 180.0;
-	this->day_sprite.setRotation(this->angle);
-	this->night_sprite.setRotation(this->angle);
+	if (this->fallback_flag) {
+		return this->window_ptr;
+	}
 
-	// alpha as function of angle
-	double alpha_var = this->getAlphaVar();
-	double night_alpha = 255 * alpha_var;
-	double day_alpha = 255 * (1 - alpha_var);
-	this->day_sprite.setColor(sf::Color(255, 255, 255, day_alpha));
-	this->night_sprite.setColor(sf::Color(255, 255, 255, night_alpha));
+	this->render_texture.clear(sf::Color::Transparent);
+	return &(this->render_texture);
+}	// end LayerCache::beginRedraw()
 
-	// backing rectangle (for reddish dawn/dusk transitions)
-	sf::RectangleShape backing_rect(sf::Vector2f(SCREEN_WIDTH, SCREEN_HEIGHT));
-	backing_rect.setFillColor(sf::Color(255, 64, 0, 255));
-	this->window_ptr->draw(backing_rect);
 
-	// draw day/night skies
-	this->window_ptr->draw(this->day_sprite);
-	this->window_ptr->draw(this->night_sprite);
+void LayerCache::endRedraw(void) {
+	/*
+	 *	Method to finish a redraw
+	 */
+
+	this->n_redraws++;
+	if (this->fallback_flag) {
+		return;
+	}
 
+	this->render_texture.display();
+	this->valid_flag = true;
 	return;
-}	// end of SkyDisk::drawFrame()
+}	// end LayerCache::endRedraw()
 
 
-SkyDisk::~SkyDisk(void) {
+void LayerCache::draw(void) {
 	/*
-	 *	Destructor for Sky Disk
+	 *	Method to blit the cached layer to the window. Colours in the render
+	 *	texture are already multiplied by alpha (by alpha blending onto a
+	 *	transparent texture), so they are blitted as premultiplied.
+	 */
+
+	if (this->fallback_flag || !this->valid_flag) {
+		return;
+	}
+
+	sf::RenderStates states;
+	states.blendMode = sf::BlendMode(
+		sf::BlendMode::One,
+		sf::BlendMode::OneMinusSrcAlpha
+	);
+	this->window_ptr->draw(this->sprite, states);
+	return;
+}	// end LayerCache::draw()
+
+
+void LayerCache::invalidate(void) {
+	/*
+	 *	Method to force a redraw on next needsRedraw()
+	 */
+
+	this->valid_flag = false;
+	return;
+}	// end LayerCache::invalidate()
+
+
+int LayerCache::getNumRedraws(void) {
+	return this->n_redraws;
+}	// end LayerCache::getNumRedraws()
+
+
+LayerCache::~LayerCache(void) {
+	/*
+	 *	Destructor for LayerCache class
 	 */
 
 	// stream out and return
- 	std::cout << "SkyDisk object at " << this << " destroyed." << std::endl;
- 	return;
-}	// end of SkyDisk::~SkyDisk()
+	std::cout << "LayerCache object at " << this << " destroyed." << std::endl;
+	return;
+}	// end LayerCache::~LayerCache()
 
 
-// ---- OvercastClouds ---- //
+// ---- BarChart ---- //
 
-OvercastClouds::OvercastClouds(sf::RenderWindow* window_ptr, Assets* assets_ptr) {
+BarChart::BarChart(
+	std::string title,
+	std::string x_label,
+	std::string y_label,
+	int n_x,
+	int n_y,
+	sf::RenderWindow* window_ptr,
+	Assets* assets_ptr
+) :
+layer(window_ptr),
+line_array(sf::Lines),
+bar_array(sf::Quads)
+{
 	/*
-	 *	Constructor for OvercastClouds class
+	 *	Constructor for BarChart class (n_x slots along x, values 0 to n_y
+	 *	along y)
 	 */
 
-	this->window_ptr = window_ptr;
+	if (n_x <= 0 || n_y <= 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: BarChart::BarChart(): chart \"" << title <<
+			"\" has " << n_x << " x slots and " << n_y << " y ticks.";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->dirty_flag = true;
+	this->n_x = n_x;
+	this->n_y = n_y;
+	this->n_x_ticks = 0;
+	this->title = title;
+	this->x_label = x_label;
+	this->y_label = y_label;
 	this->assets_ptr = assets_ptr;
 
+	this->title_font_id = this->assets_ptr->internFont("bold");
+	this->label_font_id = this->assets_ptr->internFont("teletype");
+
 	// stream out and return
- 	std::cout << "OvercastClouds object created at " << this << "." << std::endl;
- 	return;
-}	// end of OvercastClouds::OvercastClouds()
+	std::cout << "BarChart object created at " << this << "." << std::endl;
+	return;
+}	// end BarChart::BarChart()
 
 
-sf::Color OvercastClouds::getShading(
-	double cloud_cover_ratio,
-	double hour_of_day
+void BarChart::pushBar(
+	double centre_x,
+	double bottom_y,
+	double width,
+	double height,
+	sf::Color colour
 ) {
 	/*
-	 *	Method to get shading based on hour of day
+	 *	Method to push a bar (quad) to bar_array
 	 */
 
-	sf::Color colour(255, 255, 255, 255 * cloud_cover_ratio);
-	double scalar = 1;
-	double angle = (360.0 / 24.0) * hour_of_day + 180.0;
-	int angle_int = (int)(angle) % 360;
+	double left_x = centre_x - width / 2;
+	double right_x = centre_x + width / 2;
+	double top_y = bottom_y - height;
 
-	if (angle_int >= 60 && angle_int <= 120) {
-		scalar = (-1.0 / 120.0) * angle_int + (3.0 / 2.0);
+	this->bar_array.append(sf::Vertex(sf::Vector2f(left_x, top_y), colour));
+	this->bar_array.append(sf::Vertex(sf::Vector2f(right_x, top_y), colour));
+	this->bar_array.append(sf::Vertex(sf::Vector2f(right_x, bottom_y), colour));
+	this->bar_array.append(sf::Vertex(sf::Vector2f(left_x, bottom_y), colour));
+
+	return;
+}	// end BarChart::pushBar()
+
+
+void BarChart::build(sf::RenderTarget* target_ptr) {
+	/*
+	 *	Method to build and draw the chart to the given target
+	 */
+
+	double pixels_per_y = round((0.75 * SCREEN_HEIGHT) / this->n_y);
+	double pixels_per_x = round((0.75 * SCREEN_WIDTH) / (this->n_x + 1));
+	double origin_x = 0.125 * SCREEN_WIDTH;
+	double max_x = 0.875 * SCREEN_WIDTH;
+	double origin_y = 0.875 * SCREEN_HEIGHT;
+	double min_y = 0.125 * SCREEN_HEIGHT - 5;
+	double legend_x = 0.895 * SCREEN_WIDTH;
+
+	sf::Font* label_font_ptr = this->assets_ptr->getFont(this->label_font_id);
+	sf::Text label_txt;
+	label_txt.setFont(*label_font_ptr);
+
+	// axes and grid
+	sf::Color grid_colour(128, 128, 128, 150);
+	this->line_array.clear();
+	this->line_array.append(sf::Vertex(sf::Vector2f(origin_x, origin_y)));
+	this->line_array.append(sf::Vertex(sf::Vector2f(origin_x, min_y)));
+	this->line_array.append(sf::Vertex(sf::Vector2f(origin_x, origin_y)));
+	this->line_array.append(sf::Vertex(sf::Vector2f(max_x, origin_y)));
+	for (int i = 0; i <= this->n_y; i++) {
+		this->line_array.append(
+			sf::Vertex(sf::Vector2f(origin_x, origin_y - i * pixels_per_y), grid_colour)
+		);
+		this->line_array.append(
+			sf::Vertex(sf::Vector2f(max_x, origin_y - i * pixels_per_y), grid_colour)
+		);
 	}
-	else if (angle_int >= 240 && angle_int <= 300) {
-		scalar = (1.0 / 120.0) * angle_int - (3.0 / 2.0);
+	target_ptr->draw(this->line_array);
+
+	// y ticks and label
+	label_txt.setCharacterSize(16);
+	for (int i = 0; i <= this->n_y; i++) {
+		label_txt.setString(std::to_string(i));
+		this->assets_ptr->checkGlyphs(this->label_font_id, 16, std::to_string(i));
+		label_txt.setOrigin(
+			label_txt.getLocalBounds().width / 2,
+			label_txt.getLocalBounds().height / 2
+		);
+		label_txt.setPosition(
+			0.105 * SCREEN_WIDTH,
+			origin_y - i * pixels_per_y - 5
+		);
+		target_ptr->draw(label_txt);
 	}
-	else if (angle_int > 120 && angle_int < 240) {
-		scalar = 0.5;
+
+	label_txt.setCharacterSize(24);
+	label_txt.setString(this->y_label);
+	this->assets_ptr->checkGlyphs(this->label_font_id, 24, this->y_label);
+	label_txt.setOrigin(
+		label_txt.getLocalBounds().width / 2,
+		label_txt.getLocalBounds().height / 2
+	);
+	label_txt.setPosition(
+		0.075 * SCREEN_WIDTH,
+		0.5 * (origin_y + min_y)
+	);
+	label_txt.setRotation(-90);
+	target_ptr->draw(label_txt);
+	label_txt.setRotation(0);
+
+	// x ticks and label
+	label_txt.setCharacterSize(16);
+	for (int i = 0; i < this->n_x_ticks; i++) {
+		label_txt.setString(std::to_string(i));
+		this->assets_ptr->checkGlyphs(this->label_font_id, 16, std::to_string(i));
+		label_txt.setOrigin(label_txt.getLocalBounds().width / 2, 0);
+		label_txt.setPosition(
+			origin_x + (i + 0.5) * pixels_per_x,
+			0.885 * SCREEN_HEIGHT
+		);
+		target_ptr->draw(label_txt);
+	}
+
+	label_txt.setCharacterSize(24);
+	label_txt.setString(this->x_label);
+	this->assets_ptr->checkGlyphs(this->label_font_id, 24, this->x_label);
+	label_txt.setOrigin(
+		label_txt.getLocalBounds().width / 2,
+		label_txt.getLocalBounds().height / 2
+	);
+	label_txt.setPosition(
+		0.5 * (origin_x + max_x),
+		0.925 * SCREEN_HEIGHT
+	);
+	target_ptr->draw(label_txt);
+
+	// bars (stacked first, then markers in front)
+	this->bar_array.clear();
+	for (int i = 0; i < this->n_x; i++) {
+		double stack_y = 0;
+		for (size_t j = 0; j < this->series_vec.size(); j++) {
+			const ChartSeries& series = this->series_vec[j];
+			if (!series.stacked_flag || i >= int(series.value_vec.size())) {
+				continue;
+			}
+			this->pushBar(
+				origin_x + (i + 0.5) * pixels_per_x,
+				origin_y - pixels_per_y * stack_y - 1,
+				0.8 * pixels_per_x,
+				pixels_per_y * series.value_vec[i],
+				series.colour
+			);
+			stack_y += series.value_vec[i];
+		}
+	}
+	for (size_t j = 0; j < this->series_vec.size(); j++) {
+		const ChartSeries& series = this->series_vec[j];
+		if (series.stacked_flag) {
+			continue;
+		}
+		for (int i = 0; i < this->n_x && i < int(series.value_vec.size()); i++) {
+			this->pushBar(
+				origin_x + (i + 0.5) * pixels_per_x,
+				origin_y - 1,
+				pixels_per_x / 4,
+				pixels_per_y * series.value_vec[i],
+				series.colour
+			);
+		}
 	}
-	//std::cout << scalar << std::endl;
 
-	colour.r = scalar * 255;
-	colour.g = scalar * 255;
-	colour.b = scalar * 255;
-	return colour;
-}	// end OvercastClouds::getShading()
+	// legend (swatches batched with the bars)
+	label_txt.setCharacterSize(20);
+	label_txt.setString("Legend");
+	this->assets_ptr->checkGlyphs(this->label_font_id, 20, "Legend");
+	label_txt.setOrigin(0, label_txt.getLocalBounds().height / 2);
+	label_txt.setPosition(legend_x, min_y);
+	double legend_txt_h = label_txt.getLocalBounds().height;
+	target_ptr->draw(label_txt);
+
+	label_txt.setCharacterSize(16);
+	for (size_t j = 0; j < this->series_vec.size(); j++) {
+		double entry_y = min_y + legend_txt_h + 25 * (j + 1);
+		this->pushBar(
+			legend_x + 8,
+			entry_y + 8,
+			16,
+			16,
+			this->series_vec[j].colour
+		);
+
+		label_txt.setString(this->series_vec[j].label);
+		this->assets_ptr->checkGlyphs(this->label_font_id, 16, this->series_vec[j].label);
+		label_txt.setOrigin(0, label_txt.getLocalBounds().height / 2);
+		label_txt.setPosition(legend_x + 25, entry_y - 2);
+		target_ptr->draw(label_txt);
+	}
+	target_ptr->draw(this->bar_array);
+
+	// title
+	this->assets_ptr->checkGlyphs(this->title_font_id, 24, this->title);
+	sf::Text title_txt(
+		this->title,
+		*(this->assets_ptr->getFont(this->title_font_id)),
+		24
+	);
+	title_txt.setOrigin(
+		title_txt.getLocalBounds().width / 2,
+		title_txt.getLocalBounds().height / 2
+	);
+	title_txt.setPosition(
+		SCREEN_WIDTH / 2,
+		70
+	);
+	target_ptr->draw(title_txt);
+
+	return;
+}	// end BarChart::build()
 
 
-void OvercastClouds::buildSprites(void) {
+void BarChart::setNumXTicks(int n_x_ticks) {
 	/*
-	 *	Method to build sprites (to finish construction once assets available!)
+	 *	Method to set how many x slots are labelled
 	 */
 
-	// overcast sky sprite
-	this->overcast_sky_sprite.setTexture(*(this->assets_ptr->getTexture("overcast")));
-	sf::Vector2f scale = this->overcast_sky_sprite.getScale();
-	this->overcast_sky_sprite.setScale(scale.x * 2, scale.y * 2);
+	if (n_x_ticks > this->n_x) {
+		n_x_ticks = this->n_x;
+	}
 
-	// cloud sprites (fill list with random clouds in random places)
-	int rand_frame = 0;
-	int size_scalar = 3;
-	double rand_pos_x = 0;
-	double rand_pos_y = 0;
-	for (int i = 0; i < 64; i++) {
-		sf::Sprite* cloud_sprite_ptr = new sf::Sprite(
-			*(this->assets_ptr->getTexture("clouds"))
-		);
-		scale = cloud_sprite_ptr->getScale();
-		cloud_sprite_ptr->setScale(scale.x * size_scalar, scale.y * size_scalar);
+	if (n_x_ticks != this->n_x_ticks) {
+		this->n_x_ticks = n_x_ticks;
+		this->dirty_flag = true;
+	}
 
-		rand_frame = round(5 * ((double)rand() / RAND_MAX));
-		cloud_sprite_ptr->setTextureRect(sf::IntRect(0, rand_frame * 32, 64, 32));
+	return;
+}	// end BarChart::setNumXTicks()
 
-		rand_pos_x = SCREEN_WIDTH * ((double)rand() / RAND_MAX) -
-			size_scalar * 64;
-		rand_pos_y = (SCREEN_HEIGHT / 2) * ((double)rand() / RAND_MAX) -
-			size_scalar * 32;
-		cloud_sprite_ptr->setPosition(
-			rand_pos_x,
-			rand_pos_y
-		);
 
-		this->cloud_sprite_ptr_list.push_back(cloud_sprite_ptr);
-	}
+void BarChart::setNumSeries(int n_series) {
+	/*
+	 *	Method to set the number of series (dropping any past n_series)
+	 */
 
+	if (n_series != int(this->series_vec.size())) {
+		this->series_vec.resize(n_series);
+		this->dirty_flag = true;
+	}
 
 	return;
-}	// end OvercastClouds::buildSprites()
+}	// end BarChart::setNumSeries()
 
 
-void OvercastClouds::drawFrame(
-	double wind_speed_ratio,
-	double cloud_cover_ratio,
-	double hour_of_day
+void BarChart::setSeries(
+	int idx,
+	std::string label,
+	sf::Color colour,
+	bool stacked_flag,
+	const std::vector<double>& value_vec
 ) {
 	/*
-	 *	Method to draw frame of OvercastClouds
+	 *	Method to set a series (the chart is only marked for rebuild if this
+	 *	changes anything)
 	 */
 
-	// shading as a function of hour of day
-	sf::Color shading = this->getShading(cloud_cover_ratio, hour_of_day);
-	this->overcast_sky_sprite.setColor(shading);
-	for (
- 		auto itr = this->cloud_sprite_ptr_list.begin();
- 		itr != this->cloud_sprite_ptr_list.end();
- 		itr++
- 	) {
- 		(*itr)->setColor(shading);
- 	}
+	if (idx < 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: BarChart::setSeries(): series index " << idx <<
+			" is not valid.";
+		throw std::runtime_error(error_ss.str());
+	}
 
-	// overcast sky
-	this->window_ptr->draw(this->overcast_sky_sprite);
+	if (idx >= int(this->series_vec.size())) {
+		this->setNumSeries(idx + 1);
+	}
 
-	// clouds
+	ChartSeries& series = this->series_vec[idx];
+	if (
+		series.label != label ||
+		series.colour != colour ||
+		series.stacked_flag != stacked_flag ||
+		series.value_vec != value_vec
+	) {
+		series.label = label;
+		series.colour = colour;
+		series.stacked_flag = stacked_flag;
+		series.value_vec = value_vec;
+		this->dirty_flag = true;
+	}
 
-	if (wind_speed_ratio > 0) {
-		// remove finished clouds
-		auto itr = this->cloud_sprite_ptr_list.begin();
-		sf::Vector2f cloud_posn;
-		while (itr != this->cloud_sprite_ptr_list.end()) {
-			cloud_posn = (*itr)->getPosition();
-			if (cloud_posn.x >= SCREEN_WIDTH + 64) {
-				delete *itr;
-				itr = this->cloud_sprite_ptr_list.erase(itr);
-			}
-			else {
-				itr++;
-			}
-		}
+	return;
+}	// end BarChart::setSeries()
 
-		// update cloud positions
-		for (
-	 		auto itr = this->cloud_sprite_ptr_list.begin();
-	 		itr != this->cloud_sprite_ptr_list.end();
-	 		itr++
-	 	) {
-			cloud_posn = (*itr)->getPosition();
-			(*itr)->setPosition(
-				cloud_posn.x + wind_speed_ratio,
-				cloud_posn.y
-			);
-		}
 
-		// add new clouds
-		int rand_frame = 0;
-		int size_scalar = 3;
-		double rand_pos_x = 0;
-		double rand_pos_y = 0;
-		sf::Vector2f scale;
-		while (this->cloud_sprite_ptr_list.size() < 64) {
-			sf::Sprite* cloud_sprite_ptr = new sf::Sprite(
-				*(this->assets_ptr->getTexture("clouds"))
-			);
-			scale = cloud_sprite_ptr->getScale();
-			cloud_sprite_ptr->setScale(scale.x * size_scalar, scale.y * size_scalar);
-
-			rand_frame = round(5 * ((double)rand() / RAND_MAX));
-			cloud_sprite_ptr->setTextureRect(sf::IntRect(0, rand_frame * 32, 64, 32));
-
-			rand_pos_x = -1 * size_scalar * 64;
-			rand_pos_y = (SCREEN_HEIGHT / 2) * ((double)rand() / RAND_MAX) -
-				size_scalar * 32;
-			cloud_sprite_ptr->setPosition(
-				rand_pos_x,
-				rand_pos_y
-			);
+void BarChart::draw(void) {
+	/*
+	 *	Method to draw the chart (rebuilding it first if its data changed)
+	 */
 
-			this->cloud_sprite_ptr_list.push_back(cloud_sprite_ptr);
-		}
+	if (this->dirty_flag) {
+		this->layer.invalidate();
+		this->dirty_flag = false;
 	}
 
-	// draw clouds
-	for (
- 		auto itr = this->cloud_sprite_ptr_list.begin();
- 		itr != this->cloud_sprite_ptr_list.end();
- 		itr++
- 	) {
-		this->window_ptr->draw(*(*itr));
+	if (this->layer.needsRedraw({})) {
+		this->build(this->layer.beginRedraw());
+		this->layer.endRedraw();
 	}
+	this->layer.draw();
 
 	return;
-}	// end OvercastClouds::drawFrame();
+}	// end BarChart::draw()
 
 
-OvercastClouds::~OvercastClouds(void) {
+int BarChart::getNumBuilds(void) {
+	return this->layer.getNumRedraws();
+}	// end BarChart::getNumBuilds()
+
+
+BarChart::~BarChart(void) {
 	/*
-	 *	Destructor for OvercastClouds class
+	 *	Destructor for BarChart class
 	 */
 
-	// clean up clouds
-	for (
- 		auto itr = this->cloud_sprite_ptr_list.begin();
- 		itr != this->cloud_sprite_ptr_list.end();
- 		itr++
- 	) {
- 		delete (*itr);
- 	}
-	this->cloud_sprite_ptr_list.clear();
-
 	// stream out and return
-	std::cout << "OvercastClouds object at " << this << " destroyed." << std::endl;
+	std::cout << "BarChart object at " << this << " destroyed." << std::endl;
 	return;
-}	// end OvercastClouds::~OvercastClouds()
+}	// end BarChart::~BarChart()
 
 
-// ---- Foreground (and Plinko City) ---- //
+// ---- AssetLoader ---- //
 
-Foreground::Foreground(sf::RenderWindow* window_ptr, Assets* assets_ptr) {
+AssetLoader::AssetLoader(int n_workers) {
 	/*
-	 *	Constructor for Foreground
+	 *	Constructor for AssetLoader class (n_workers = 0 for all cores but
+	 *	one, which is left to the render thread)
 	 */
 
-	this->window_ptr = window_ptr;
-	this->assets_ptr = assets_ptr;
+	if (n_workers <= 0) {
+		n_workers = int(std::thread::hardware_concurrency()) - 1;
+	}
+	if (n_workers <= 0) {
+		n_workers = 1;
+	}
+
+	this->started_flag = false;
+	this->n_decoded = 0;
+	this->n_uploaded = 0;
+
+	this->pool_ptr = new WorkStealingPool(n_workers);
 
 	// stream out and return
- 	std::cout << "Foreground object created at " << this << "." << std::endl;
- 	return;
-}	// end of Foreground::Foreground()
+	std::cout << "AssetLoader object created at " << this << "." << std::endl;
+	return;
+}	// end AssetLoader::AssetLoader()
 
 
-void Foreground::buildSprites(void) {
+void AssetLoader::queue(int type, std::string path, std::string key) {
 	/*
-	 *	Method to build sprites (to finish construction once assets available!)
+	 *	Method to queue an asset to be decoded (only before start())
 	 */
 
-	// terrain sprite
-	this->terrain_sprite.setTexture(*(this->assets_ptr->getTexture("foreground")));
-	this->terrain_sprite.setTextureRect(sf::IntRect(0, 0, 640, 480));
-	sf::Vector2f scale = this->terrain_sprite.getScale();
-	this->terrain_sprite.setScale(scale.x * 2, scale.y * 2);
-
-	// city (powered) sprite
-	this->city_powered_sprite.setTexture(*(this->assets_ptr->getTexture("foreground")));
-	this->city_powered_sprite.setTextureRect(sf::IntRect(0, 480, 640, 480));
-	scale = this->city_powered_sprite.getScale();
-	this->city_powered_sprite.setScale(scale.x * 2, scale.y * 2);
+	if (this->started_flag) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: AssetLoader::queue(): Cannot queue \"" << key <<
+			"\", loader already started.";
+		throw std::runtime_error(error_ss.str());
+	}
 
-	// city (unpowered) sprite
-	this->city_unpowered_sprite.setTexture(*(this->assets_ptr->getTexture("foreground")));
-	this->city_unpowered_sprite.setTextureRect(sf::IntRect(0, 960, 640, 480));
-	scale = this->city_unpowered_sprite.getScale();
-	this->city_unpowered_sprite.setScale(scale.x * 2, scale.y * 2);
+	DecodedAsset asset;
+	asset.type = type;
+	asset.path = path;
+	asset.key = key;
+	asset.decoded_flag = false;
+	asset.ok_flag = false;
+	asset.channel_count = 0;
+	asset.sample_rate = 0;
+	this->asset_vec.push_back(asset);
 
 	return;
-}	// end Foreground::buildSprites()
+}	// end AssetLoader::queue()
 
 
-sf::Color Foreground::getShading(double hour_of_day) {
+void AssetLoader::decode(int idx) {
 	/*
-	 *	Method to get shading based on hour of day
+	 *	Method to decode the given asset (run on the worker pool; touches
+	 *	nothing but its own asset until marked decoded)
 	 */
 
-	sf::Color colour(255, 255, 255, 255);
-	double scalar = 1;
-	double angle = (360.0 / 24.0) * hour_of_day + 180.0;
-	int angle_int = (int)(angle) % 360;
+	DecodedAsset& asset = this->asset_vec[idx];
+	bool ok_flag = false;
 
-	if (angle_int >= 60 && angle_int <= 120) {
-		scalar = (-1.0 / 120.0) * angle_int + (3.0 / 2.0);
+	switch (asset.type) {
+		case (DECODED_TEXTURE): {
+			ok_flag = loadAsset(&(asset.image), asset.path);
+			break;
+		}
+
+		case (DECODED_SOUND): {
+			sf::InputSoundFile sound_file;
+			{
+				std::lock_guard<std::mutex> lock(this->open_mutex);
+				ok_flag = openAsset(&sound_file, asset.path);
+			}
+
+			if (ok_flag) {
+				asset.sample_vec.resize(sound_file.getSampleCount());
+				sf::Uint64 n_read = sound_file.read(
+					asset.sample_vec.data(),
+					asset.sample_vec.size()
+				);
+				asset.sample_vec.resize(n_read);
+				asset.channel_count = sound_file.getChannelCount();
+				asset.sample_rate = sound_file.getSampleRate();
+			}
+			break;
+		}
+
+		default: {
+			// do nothing!
+			break;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(this->decoded_mutex);
+	asset.ok_flag = ok_flag;
+	asset.decoded_flag = true;
+	this->n_decoded++;
+
+	return;
+}	// end AssetLoader::decode()
+
+
+void AssetLoader::queueTexture(std::string path, std::string key) {
+	/*
+	 *	Method to queue a texture (decoded to an image, uploaded by upload())
+	 */
+
+	this->queue(DECODED_TEXTURE, path, key);
+	return;
+}	// end AssetLoader::queueTexture()
+
+
+void AssetLoader::queueSound(std::string path, std::string key) {
+	/*
+	 *	Method to queue a sound (decoded to samples, uploaded by upload())
+	 */
+
+	this->queue(DECODED_SOUND, path, key);
+	return;
+}	// end AssetLoader::queueSound()
+
+
+void AssetLoader::start(void) {
+	/*
+	 *	Method to start decoding all queued assets in the background (does not
+	 *	block; does nothing if already started)
+	 */
+
+	if (this->started_flag) {
+		return;
+	}
+	this->started_flag = true;
+
+	for (int i = 0; i < int(this->asset_vec.size()); i++) {
+		this->pool_ptr->push(i, [this, i]() { this->decode(i); });
+	}
+	this->pool_thread = std::thread(&WorkStealingPool::run, this->pool_ptr);
+
+	return;
+}	// end AssetLoader::start()
+
+
+int AssetLoader::upload(Assets* assets_ptr, double budget_s) {
+	/*
+	 *	Method to upload decoded assets into the given Assets, in the order
+	 *	queued, for up to budget_s (but at least one, if one is ready); returns
+	 *	the number uploaded. Must be called from the render thread.
+	 */
+
+	this->start();
+
+	sf::Clock clock;
+	int n_uploads = 0;
+
+	while (this->n_uploaded < int(this->asset_vec.size())) {
+		if (n_uploads > 0 && clock.getElapsedTime().asSeconds() >= budget_s) {
+			break;
+		}
+
+		DecodedAsset& asset = this->asset_vec[this->n_uploaded];
+		{
+			std::lock_guard<std::mutex> lock(this->decoded_mutex);
+			if (!asset.decoded_flag) {
+				break;
+			}
+		}
+
+		if (!asset.ok_flag) {
+			std::stringstream error_ss;
+			error_ss << "EXCEPTION: AssetLoader::upload(): Cannot decode asset at \"" <<
+				asset.path << "\".";
+			throw std::runtime_error(error_ss.str());
+		}
+
+		// upload, then free the decoded copy
+		switch (asset.type) {
+			case (DECODED_TEXTURE):
+				assets_ptr->loadTexture(asset.image, asset.key);
+				asset.image = sf::Image();
+				break;
+
+			case (DECODED_SOUND):
+				assets_ptr->loadSound(
+					asset.sample_vec,
+					asset.channel_count,
+					asset.sample_rate,
+					asset.key
+				);
+				std::vector<sf::Int16>().swap(asset.sample_vec);
+				break;
+
+			default:
+				// do nothing!
+				break;
+		}
+
+		this->n_uploaded++;
+		n_uploads++;
+	}
+
+	return n_uploads;
+}	// end AssetLoader::upload()
+
+
+bool AssetLoader::isFinished(void) {
+	/*
+	 *	Method to check if all queued assets have been uploaded
+	 */
+
+	return this->n_uploaded >= int(this->asset_vec.size());
+}	// end AssetLoader::isFinished()
+
+
+int AssetLoader::getNumQueued(void) {
+	return this->asset_vec.size();
+}	// end AssetLoader::getNumQueued()
+
+
+int AssetLoader::getNumDecoded(void) {
+	std::lock_guard<std::mutex> lock(this->decoded_mutex);
+	return this->n_decoded;
+}	// end AssetLoader::getNumDecoded()
+
+
+int AssetLoader::getNumUploaded(void) {
+	return this->n_uploaded;
+}	// end AssetLoader::getNumUploaded()
+
+
+double AssetLoader::getProgress(void) {
+	/*
+	 *	Method to get loading progress (0 to 1), decoding and uploading each
+	 *	counting half
+	 */
+
+	if (this->asset_vec.empty()) {
+		return 1;
+	}
+
+	return double(this->getNumDecoded() + this->n_uploaded) /
+		(2 * this->asset_vec.size());
+}	// end AssetLoader::getProgress()
+
+
+AssetLoader::~AssetLoader(void) {
+	/*
+	 *	Destructor for AssetLoader class
+	 */
+
+	if (this->pool_thread.joinable()) {
+		this->pool_thread.join();
+	}
+	delete this->pool_ptr;
+
+	// stream out and return
+	std::cout << "AssetLoader object at " << this << " destroyed." << std::endl;
+	return;
+}	// end AssetLoader::~AssetLoader()
+
+
+// ---- Sky Disk ---- //
+
+SkyDisk::SkyDisk(sf::RenderWindow* window_ptr, Assets* assets_ptr)
+{
+	/*
+	 *	Constructor for Sky Disk
+	 */
+
+	this->angle = 180;
+	this->window_ptr = window_ptr;
+	this->assets_ptr = assets_ptr;
+
+	// stream out and return
+ 	std::cout << "SkyDisk object created at " << this << "." << std::endl;
+ 	return;
+}	// end SkyDisk::SkyDisk()
+
+
+void SkyDisk::buildSprites(void) {
+	/*
+	 *	Method to build sprites (to finish construction once assets available!)
+	 */
+
+	// day sprite
+	this->day_sprite.setTexture(*(this->assets_ptr->getTexture("sky disk")));
+	this->day_sprite.setTextureRect(sf::IntRect(0, 0, 960, 960));
+	this->day_sprite.setOrigin(960 / 2, 960 / 2);
+	sf::Vector2f scale = this->day_sprite.getScale();
+	this->day_sprite.setScale(scale.x * 2 * sqrt(2), scale.y * 2 * sqrt(2));
+	this->day_sprite.setPosition(
+		SCREEN_WIDTH / 2,
+		SCREEN_HEIGHT
+	);
+	this->day_sprite.setRotation(this->angle);
+
+	// night sprite
+	this->night_sprite.setTexture(*(this->assets_ptr->getTexture("sky disk")));
+	this->night_sprite.setTextureRect(sf::IntRect(0, 960, 960, 960));
+	this->night_sprite.setOrigin(960 / 2, 960 / 2);
+	scale = this->night_sprite.getScale();
+	this->night_sprite.setScale(scale.x * 2 * sqrt(2), scale.y * 2 * sqrt(2));
+	this->night_sprite.setPosition(
+		SCREEN_WIDTH / 2,
+		SCREEN_HEIGHT
+	);
+	this->night_sprite.setRotation(this->angle);
+
+	return;
+}	// end of SkyDisk::buildSprite()
+
+
+double SkyDisk::getAlphaVar(void) {
+	/*
+	 *	Method to compute alpha_var (for dawn/dusk transitions)
+	 */
+
+	double alpha_var = 0;
+	int angle = (int)(this->angle) % 360;
+
+	if (angle >= 60 && angle <= 120) {
+		alpha_var = (1.0 / 60.0) * angle - 1.0;
+	}
+	else if (angle >= 240 && angle <= 300) {
+		alpha_var = (-1.0 / 60.0) * angle + 5.0;
+	}
+	else if (angle > 120 && angle < 240) {
+		alpha_var = 1;
+	}
+
+	return alpha_var;
+}	// end SkyDisk::getAlphaVar()
+
+
+void SkyDisk::drawFrame(double hour_of_day, sf::RenderTarget* target_ptr) {
+	/*
+	 *	Method to draw frame of Sky Disk
+	 */
+
+	// angle as function of hour of day
+	this->angle = (360.0 / 24.0) * hour_of_day + 180.0;
+	this->day_sprite.setRotation(this->angle);
+	this->night_sprite.setRotation(this->angle);
+
+	// alpha as function of angle
+	double alpha_var = this->getAlphaVar();
+	double night_alpha = 255 * alpha_var;
+	double day_alpha = 255 * (1 - alpha_var);
+	this->day_sprite.setColor(sf::Color(255, 255, 255, day_alpha));
+	this->night_sprite.setColor(sf::Color(255, 255, 255, night_alpha));
+
+	// backing rectangle (for reddish dawn/dusk transitions)
+	sf::RectangleShape backing_rect(sf::Vector2f(SCREEN_WIDTH, SCREEN_HEIGHT));
+	backing_rect.setFillColor(sf::Color(255, 64, 0, 255));
+	target_ptr->draw(backing_rect);
+
+	// draw day/night skies
+	target_ptr->draw(this->day_sprite);
+	target_ptr->draw(this->night_sprite);
+
+	return;
+}	// end of SkyDisk::drawFrame()
+
+
+SkyDisk::~SkyDisk(void) {
+	/*
+	 *	Destructor for Sky Disk
+	 */
+
+	// stream out and return
+ 	std::cout << "SkyDisk object at " << this << " destroyed." << std::endl;
+ 	return;
+}	// end of SkyDisk::~SkyDisk()
+
+
+// ---- OvercastClouds ---- //
+
+OvercastClouds::OvercastClouds(sf::RenderWindow* window_ptr, Assets* assets_ptr) {
+	/*
+	 *	Constructor for OvercastClouds class
+	 */
+
+	this->cloud_dx = 0;
+	this->window_ptr = window_ptr;
+	this->assets_ptr = assets_ptr;
+	this->cloud_texture_id = this->assets_ptr->internTexture("clouds");
+
+	// stream out and return
+ 	std::cout << "OvercastClouds object created at " << this << "." << std::endl;
+ 	return;
+}	// end of OvercastClouds::OvercastClouds()
+
+
+sf::Color OvercastClouds::getShading(
+	double cloud_cover_ratio,
+	double hour_of_day
+) {
+	/*
+	 *	Method to get shading based on hour of day
+	 */
+
+	sf::Color colour(255, 255, 255, 255 * cloud_cover_ratio);
+	double scalar = 1;
+	double angle = (360.0 / 24.0) * hour_of_day + 180.0;
+	int angle_int = (int)(angle) % 360;
+
+	if (angle_int >= 60 && angle_int <= 120) {
+		scalar = (-1.0 / 120.0) * angle_int + (3.0 / 2.0);
+	}
+	else if (angle_int >= 240 && angle_int <= 300) {
+		scalar = (1.0 / 120.0) * angle_int - (3.0 / 2.0);
+	}
+	else if (angle_int > 120 && angle_int < 240) {
+		scalar = 0.5;
+	}
+	//std::cout << scalar << std::endl;
+
+	colour.r = scalar * 255;
+	colour.g = scalar * 255;
+	colour.b = scalar * 255;
+	return colour;
+}	// end OvercastClouds::getShading()
+
+
+void OvercastClouds::buildSprites(void) {
+	/*
+	 *	Method to build sprites (to finish construction once assets available!)
+	 */
+
+	// overcast sky sprite
+	this->overcast_sky_sprite.setTexture(*(this->assets_ptr->getTexture("overcast")));
+	sf::Vector2f scale = this->overcast_sky_sprite.getScale();
+	this->overcast_sky_sprite.setScale(scale.x * 2, scale.y * 2);
+
+	// cloud sprites (fill list with random clouds in random places)
+	int rand_frame = 0;
+	int size_scalar = 3;
+	double rand_pos_x = 0;
+	double rand_pos_y = 0;
+	for (int i = 0; i < 64; i++) {
+		sf::Sprite* cloud_sprite_ptr = new sf::Sprite(
+			*(this->assets_ptr->getTexture(this->cloud_texture_id))
+		);
+		scale = cloud_sprite_ptr->getScale();
+		cloud_sprite_ptr->setScale(scale.x * size_scalar, scale.y * size_scalar);
+
+		rand_frame = round(5 * randomStream(RNG_CLOUDS).uniform());
+		cloud_sprite_ptr->setTextureRect(sf::IntRect(0, rand_frame * 32, 64, 32));
+
+		rand_pos_x = SCREEN_WIDTH * randomStream(RNG_CLOUDS).uniform() -
+			size_scalar * 64;
+		rand_pos_y = (SCREEN_HEIGHT / 2) * randomStream(RNG_CLOUDS).uniform() -
+			size_scalar * 32;
+		cloud_sprite_ptr->setPosition(
+			rand_pos_x,
+			rand_pos_y
+		);
+
+		this->cloud_sprite_ptr_list.push_back(cloud_sprite_ptr);
+	}
+
+
+	return;
+}	// end OvercastClouds::buildSprites()
+
+
+void OvercastClouds::update(double dt_s, double wind_speed_ratio) {
+	/*
+	 *	Method to advance clouds by dt_s
+	 */
+
+	this->cloud_dx = 0;
+	if (wind_speed_ratio <= 0) {
+		return;
+	}
+	this->cloud_dx = wind_speed_ratio * dt_s * FRAMES_PER_SECOND;
+
+	// remove finished clouds
+	auto itr = this->cloud_sprite_ptr_list.begin();
+	sf::Vector2f cloud_posn;
+	while (itr != this->cloud_sprite_ptr_list.end()) {
+		cloud_posn = (*itr)->getPosition();
+		if (cloud_posn.x >= SCREEN_WIDTH + 64) {
+			delete *itr;
+			itr = this->cloud_sprite_ptr_list.erase(itr);
+		}
+		else {
+			itr++;
+		}
+	}
+
+	// update cloud positions
+	for (
+ 		auto itr = this->cloud_sprite_ptr_list.begin();
+ 		itr != this->cloud_sprite_ptr_list.end();
+ 		itr++
+ 	) {
+		cloud_posn = (*itr)->getPosition();
+		(*itr)->setPosition(
+			cloud_posn.x + this->cloud_dx,
+			cloud_posn.y
+		);
+	}
+
+	// add new clouds
+	int rand_frame = 0;
+	int size_scalar = 3;
+	double rand_pos_x = 0;
+	double rand_pos_y = 0;
+	sf::Vector2f scale;
+	while (this->cloud_sprite_ptr_list.size() < 64) {
+		sf::Sprite* cloud_sprite_ptr = new sf::Sprite(
+			*(this->assets_ptr->getTexture(this->cloud_texture_id))
+		);
+		scale = cloud_sprite_ptr->getScale();
+		cloud_sprite_ptr->setScale(scale.x * size_scalar, scale.y * size_scalar);
+
+		rand_frame = round(5 * randomStream(RNG_CLOUDS).uniform());
+		cloud_sprite_ptr->setTextureRect(sf::IntRect(0, rand_frame * 32, 64, 32));
+
+		rand_pos_x = -1 * size_scalar * 64;
+		rand_pos_y = (SCREEN_HEIGHT / 2) * randomStream(RNG_CLOUDS).uniform() -
+			size_scalar * 32;
+		cloud_sprite_ptr->setPosition(
+			rand_pos_x,
+			rand_pos_y
+		);
+
+		this->cloud_sprite_ptr_list.push_back(cloud_sprite_ptr);
+	}
+
+	return;
+}	// end OvercastClouds::update()
+
+
+void OvercastClouds::drawOvercast(
+	double cloud_cover_ratio,
+	double hour_of_day,
+	sf::RenderTarget* target_ptr
+) {
+	/*
+	 *	Method to draw the overcast sky (static between hours, unlike the
+	 *	clouds)
+	 */
+
+	// shading as a function of hour of day
+	this->overcast_sky_sprite.setColor(
+		this->getShading(cloud_cover_ratio, hour_of_day)
+	);
+	target_ptr->draw(this->overcast_sky_sprite);
+
+	return;
+}	// end OvercastClouds::drawOvercast()
+
+
+void OvercastClouds::drawClouds(
+	double cloud_cover_ratio,
+	double hour_of_day,
+	double render_ratio
+) {
+	/*
+	 *	Method to draw the clouds, render_ratio of the way from the last
+	 *	update to the current one
+	 */
+
+	// shading as a function of hour of day
+	sf::Color shading = this->getShading(cloud_cover_ratio, hour_of_day);
+	for (
+ 		auto itr = this->cloud_sprite_ptr_list.begin();
+ 		itr != this->cloud_sprite_ptr_list.end();
+ 		itr++
+ 	) {
+ 		(*itr)->setColor(shading);
+ 	}
+
+	// draw clouds (all drift together, so interpolate with one offset)
+	sf::Transform lag_transform;
+	lag_transform.translate(-(1 - render_ratio) * this->cloud_dx, 0);
+	for (
+ 		auto itr = this->cloud_sprite_ptr_list.begin();
+ 		itr != this->cloud_sprite_ptr_list.end();
+ 		itr++
+ 	) {
+		this->window_ptr->draw(*(*itr), lag_transform);
+	}
+
+	return;
+}	// end OvercastClouds::drawClouds()
+
+
+void OvercastClouds::drawFrame(
+	double cloud_cover_ratio,
+	double hour_of_day,
+	double render_ratio
+) {
+	/*
+	 *	Method to draw frame of OvercastClouds (overcast sky and clouds),
+	 *	render_ratio of the way from the last update to the current one
+	 */
+
+	this->drawOvercast(cloud_cover_ratio, hour_of_day, this->window_ptr);
+	this->drawClouds(cloud_cover_ratio, hour_of_day, render_ratio);
+
+	return;
+}	// end OvercastClouds::drawFrame();
+
+
+OvercastClouds::~OvercastClouds(void) {
+	/*
+	 *	Destructor for OvercastClouds class
+	 */
+
+	// clean up clouds
+	for (
+ 		auto itr = this->cloud_sprite_ptr_list.begin();
+ 		itr != this->cloud_sprite_ptr_list.end();
+ 		itr++
+ 	) {
+ 		delete (*itr);
+ 	}
+	this->cloud_sprite_ptr_list.clear();
+
+	// stream out and return
+	std::cout << "OvercastClouds object at " << this << " destroyed." << std::endl;
+	return;
+}	// end OvercastClouds::~OvercastClouds()
+
+
+// ---- Foreground (and Plinko City) ---- //
+
+Foreground::Foreground(sf::RenderWindow* window_ptr, Assets* assets_ptr) {
+	/*
+	 *	Constructor for Foreground
+	 */
+
+	this->window_ptr = window_ptr;
+	this->assets_ptr = assets_ptr;
+
+	// stream out and return
+ 	std::cout << "Foreground object created at " << this << "." << std::endl;
+ 	return;
+}	// end of Foreground::Foreground()
+
+
+void Foreground::buildSprites(void) {
+	/*
+	 *	Method to build sprites (to finish construction once assets available!)
+	 */
+
+	// terrain sprite
+	this->terrain_sprite.setTexture(*(this->assets_ptr->getTexture("foreground")));
+	this->terrain_sprite.setTextureRect(sf::IntRect(0, 0, 640, 480));
+	sf::Vector2f scale = this->terrain_sprite.getScale();
+	this->terrain_sprite.setScale(scale.x * 2, scale.y * 2);
+
+	// city (powered) sprite
+	this->city_powered_sprite.setTexture(*(this->assets_ptr->getTexture("foreground")));
+	this->city_powered_sprite.setTextureRect(sf::IntRect(0, 480, 640, 480));
+	scale = this->city_powered_sprite.getScale();
+	this->city_powered_sprite.setScale(scale.x * 2, scale.y * 2);
+
+	// city (unpowered) sprite
+	this->city_unpowered_sprite.setTexture(*(this->assets_ptr->getTexture("foreground")));
+	this->city_unpowered_sprite.setTextureRect(sf::IntRect(0, 960, 640, 480));
+	scale = this->city_unpowered_sprite.getScale();
+	this->city_unpowered_sprite.setScale(scale.x * 2, scale.y * 2);
+
+	return;
+}	// end Foreground::buildSprites()
+
+
+sf::Color Foreground::getShading(double hour_of_day) {
+	/*
+	 *	Method to get shading based on hour of day
+	 */
+
+	sf::Color colour(255, 255, 255, 255);
+	double scalar = 1;
+	double angle = (360.0 / 24.0) * hour_of_day + 180.0;
+	int angle_int = (int)(angle) % 360;
+
+	if (angle_int >= 60 && angle_int <= 120) {
+		scalar = (-1.0 / 120.0) * angle_int + (3.0 / 2.0);
 	}
 	else if (angle_int >= 240 && angle_int <= 300) {
 		scalar = (1.0 / 120.0) * angle_int - (3.0 / 2.0);
@@ -998,7 +2832,11 @@ sf::Color Foreground::getShading(double hour_of_day) {
 }	// end Foreground::getShading()
 
 
-void Foreground::drawFrame(bool powered_flag, double hour_of_day) {
+void Foreground::drawFrame(
+	bool powered_flag,
+	double hour_of_day,
+	sf::RenderTarget* target_ptr
+) {
 	/*
 	 *	Method to draw frame of Foreground
 	 */
@@ -1009,14 +2847,14 @@ void Foreground::drawFrame(bool powered_flag, double hour_of_day) {
 	this->city_unpowered_sprite.setColor(shading);
 
 	// terrain
-	this->window_ptr->draw(this->terrain_sprite);
+	target_ptr->draw(this->terrain_sprite);
 
 	// city
 	if (powered_flag) {
-		this->window_ptr->draw(this->city_powered_sprite);
+		target_ptr->draw(this->city_powered_sprite);
 	}
 	else {
-		this->window_ptr->draw(this->city_unpowered_sprite);
+		target_ptr->draw(this->city_unpowered_sprite);
 	}
 
 	return;
@@ -1103,21 +2941,18 @@ void WindSock::buildSprites(void) {
 }	// end of WindSock::buildSprites()
 
 
-void WindSock::drawFrame(double wind_speed_ratio, double hour_of_day) {
+void WindSock::update(double dt_s, double wind_speed_ratio) {
 	/*
-	 *	Method to draw frame of WindSock
+	 *	Method to advance WindSock by dt_s (sock flutters 12 times a second)
 	 */
 
-	// shading
-	sf::Color shading = this->getShading(hour_of_day);
+	double n_frames = dt_s * FRAMES_PER_SECOND;
 
-	// sock
-	this->sock_sprite.setColor(shading);
 	if (wind_speed_ratio <= 0) {
 		this->sock_sprite.setRotation(90);
 	}
-	else if (this->frame % int(FRAMES_PER_SECOND / 12) == 0) {
-		double sock_amp = ((double)rand() / RAND_MAX) * 6;
+	else if (fmod(this->frame, FRAMES_PER_SECOND / 12) < n_frames) {
+		double sock_amp = randomStream(RNG_WINDSOCK).uniform() * 6;
 		double sock_angle = 0;
 		if (wind_speed_ratio >= 1) {
 			sock_angle = sock_amp * sin(this->frame);
@@ -1127,13 +2962,28 @@ void WindSock::drawFrame(double wind_speed_ratio, double hour_of_day) {
 		}
 		this->sock_sprite.setRotation(sock_angle);
 	}
+
+	this->frame += n_frames;
+	return;
+}	// end of WindSock::update()
+
+
+void WindSock::drawFrame(double hour_of_day) {
+	/*
+	 *	Method to draw frame of WindSock
+	 */
+
+	// shading
+	sf::Color shading = this->getShading(hour_of_day);
+
+	// sock
+	this->sock_sprite.setColor(shading);
 	this->window_ptr->draw(this->sock_sprite);
 
 	// tower
 	this->tower_sprite.setColor(shading);
 	this->window_ptr->draw(this->tower_sprite);
 
-	this->frame++;
 	return;
 }	// end of WindSock::drawFrame()
 
@@ -1159,7 +3009,9 @@ Plant::Plant(
 	double scale,
 	sf::RenderWindow* window_ptr,
 	Assets* assets_ptr
-) {
+) :
+muster_batch(window_ptr, assets_ptr)
+{
 	/*
 	 *	Constructor for Plant class
 	 */
@@ -1173,7 +3025,6 @@ Plant::Plant(
 	this->frame = 0;
 	this->muster_frame = 0;
 	this->line_frame = 0;
-	this->price_per_GW = 1;
 	this->pulse_frame = 0;
 	this->height = 128;
 	this->last_production_GWh = 0;
@@ -1181,6 +3032,7 @@ Plant::Plant(
 	this->marble_frame = 0;
 	this->marble_iters = 0;
 	this->marbles_committed = 0;
+	this->marbles_released = 0;
 	this->n_blits = 0;
 	this->n_sprites = 0;
 	this->sprite_idx = 1;
@@ -1191,11 +3043,17 @@ Plant::Plant(
 	this->position_y = position_y;
 	this->prod_GW = 0;
 	this->scale = scale;
-	this->texture_key = "null";
-	this->marble_colour = sf::Color(255, 255, 255, 255);
 	this->window_ptr = window_ptr;
 	this->assets_ptr = assets_ptr;
 
+	// resolve asset handles once (drawing is by handle)
+	this->setKind(PLANT_NULL);
+	this->marble_texture_id = this->assets_ptr->internTexture("marble");
+	this->token_texture_id = this->assets_ptr->internTexture("capacity token");
+	this->power_capacity_texture_id = this->assets_ptr->internTexture("power capacity");
+	this->price_texture_id = this->assets_ptr->internTexture("price per GW");
+	this->bold_font_id = this->assets_ptr->internFont("bold");
+
 	// stream out and return
  	std::cout << "Plant object created at " << this << "." << std::endl;
  	return;
@@ -1265,44 +3123,13 @@ int Plant::getPositionY(void) {
 }	// end Plant::getPositionY()
 
 
-int Plant::getTextureIndex(void) {
-		if(this->texture_key == "coal"){
-			return 0;
-		}
-		else if(this->texture_key == "combined"){
-			return 1;
-		}
-		else if(this->texture_key == "fission"){
-			return 2;
-		}
-		else if(this->texture_key == "geothermal"){
-			return 3;
-		}
-		else if(this->texture_key == "hydro"){
-			return 4;
-		}
-		else if(this->texture_key == "peaker"){
-			return 5;
-		}
-		else if(this->texture_key == "solar"){
-			return 6;
-		}
-		else if(this->texture_key == "storage"){
-			return 7;
-		}
-		else if(this->texture_key == "tidal selection" || this->texture_key == "tidal"){
-			return 8;
-		}
-		else if(this->texture_key == "wave selection" || this->texture_key == "wave"){
-			return 9;
-		}
-		else if(this->texture_key == "wind selection" || this->texture_key == "wind"){
-			return 10;
-		}
-		else{
-			return -1;
-		}
-}// end Plant::getTextureIndex()
+PlantKind Plant::getKind(void) {
+	/*
+	 *	Getter for kind attribute
+	 */
+
+	return this->kind;
+}	// end Plant::getKind()
 
 
 int Plant::getMarblesCommitted(int i) {
@@ -1378,52 +3205,63 @@ void Plant::setPositionY(int position_y) {
 }	// end Plant::setPositionY()
 
 
+void Plant::setTextureKey(std::string texture_key) {
+	/*
+	 *	Method to set texture_key, and the texture handle drawn from
+	 */
+
+	this->texture_key = texture_key;
+	this->texture_id = this->assets_ptr->internTexture(texture_key);
+
+	// empty slots are drawn green while selected
+	if (texture_key == "null") {
+		this->selected_texture_id = this->assets_ptr->internTexture("null green");
+	}
+	else {
+		this->selected_texture_id = this->texture_id;
+	}
+
+	return;
+}	// end Plant::setTextureKey()
+
+
+void Plant::setKind(PlantKind kind) {
+	/*
+	 *	Method to set the plant kind, along with its texture, marble colour,
+	 *	and price (see PlantDescriptor)
+	 */
+
+	const PlantDescriptor& descriptor = plantDescriptor(kind);
+
+	this->kind = kind;
+	this->price_per_GW = descriptor.tokens_per_GW;
+	this->marble_colour = sf::Color(
+		descriptor.marble_rgba[0],
+		descriptor.marble_rgba[1],
+		descriptor.marble_rgba[2],
+		descriptor.marble_rgba[3]
+	);
+	this->setTextureKey(descriptor.texture_key);
+
+	return;
+}	// end Plant::setKind()
+
+
 void Plant::setPlantTexture(int plant_num) {
 	/*
-	*	Sets temporary texture during plant selection
+	*	Sets temporary texture (and kind) during plant selection
 	*/
 
-	switch (plant_num) {
-		case (-2):
-			this->texture_key = "blank";
-			break;
-		case (-1):
-			this->texture_key = "null";
-			break;
-		case (0):
-			this->texture_key = "coal";
-			break;
-		case (1):
-			this->texture_key = "combined";
-			break;
-		case (2):
-			this->texture_key = "fission";
-			break;
-		case (3):
-			this->texture_key = "geothermal";
-			break;
-		case (4):
-			this->texture_key = "hydro";
-			break;
-		case (5):
-			this->texture_key = "peaker";
-			break;
-		case (6):
-			this->texture_key = "solar";
-			break;
-		case (7):
-			this->texture_key = "storage";
-			break;
-		case (8):
-			this->texture_key = "tidal selection";
-			break;
-		case (9):
-			this->texture_key = "wave selection";
-			break;
-		case (10):
-			this->texture_key = "wind selection";
-			break;
-	}// end switch(plant_num)
+	if (plant_num == -2) {
+		this->kind = PLANT_NULL;
+		this->setTextureKey("blank");
+	}
+	else if (plant_num >= PLANT_NULL && plant_num < N_PLANT_TYPES) {
+		this->kind = PlantKind(plant_num);
+		this->setTextureKey(plantDescriptor(plant_num).selection_texture_key);
+	}
+
+	return;
 }// end Plant::setPlantTexture()
 
 
@@ -1511,7 +3349,7 @@ void Plant::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -1588,11 +3426,11 @@ void Plant::drawTokens(void) {
 	 *	Method to draw tokens invested into plant
 	 */
 
-	sf::Sprite token_sprite(*(this->assets_ptr->getTexture("capacity token")));
+	sf::Sprite token_sprite(*(this->assets_ptr->getTexture(this->token_texture_id)));
 
 	int n_tokens = this->capacity_GW / GW_PER_TOKEN;
 	// if storage need to count differently
-	if (this->getTextureIndex() == 7) {
+	if (this->getKind() == PLANT_STORAGE) {
 		n_tokens = this->capacity_GW * STORAGE_TOKENS_PER_GW;
 	}
 	double token_spacing = 0;
@@ -1619,12 +3457,12 @@ void Plant::drawCapacity(void) {
 	 */
 
 	 // skip for null plants
- 	if (this->getTextureIndex() <= -1) {
+ 	if (this->getKind() == PLANT_NULL) {
  		return;
  	}
 
 	// assemble sprite
-	sf::Sprite power_cap_sprite(*(this->assets_ptr->getTexture("power capacity")));
+	sf::Sprite power_cap_sprite(*(this->assets_ptr->getTexture(this->power_capacity_texture_id)));
 	double power_cap_width = power_cap_sprite.getLocalBounds().width;
 	double power_cap_height = power_cap_sprite.getLocalBounds().height;
 	power_cap_sprite.setOrigin(power_cap_width / 2, power_cap_height / 2);
@@ -1635,15 +3473,16 @@ void Plant::drawCapacity(void) {
 
 	// assemble text
 	std::string power_cap_str;
-	if (this->getTextureIndex() == 7) {	// Storage
+	if (this->getKind() == PLANT_STORAGE) {
 		power_cap_str = ": " + std::to_string(int(this->capacity_GW)) + " GWh";
 	}
 	else {
 		power_cap_str = ": " + std::to_string(int(this->capacity_GW)) + " GW";
 	}
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 16, power_cap_str);
 	sf::Text power_cap_txt(
 		power_cap_str,
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		16
 	);
 	double cap_txt_width = power_cap_txt.getLocalBounds().width;
@@ -1668,12 +3507,12 @@ void Plant::drawPrice(void) {
 	 */
 
 	// skip for null plants
-	if (this->getTextureIndex() <= -1) {
+	if (this->getKind() == PLANT_NULL) {
 		return;
 	}
 
 	// assemble sprite
-	sf::Sprite price_sprite(*(this->assets_ptr->getTexture("price per GW")));
+	sf::Sprite price_sprite(*(this->assets_ptr->getTexture(this->price_texture_id)));
 	double price_sprite_width = price_sprite.getLocalBounds().width;
 	double price_sprite_height = price_sprite.getLocalBounds().height;
 	price_sprite.setOrigin(price_sprite_width / 2, price_sprite_height / 2);
@@ -1684,9 +3523,10 @@ void Plant::drawPrice(void) {
 
 	// assemble text
 	std::string price_str = ": " + std::to_string(int(this->price_per_GW));
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 16, price_str);
 	sf::Text price_txt(
 		price_str,
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		16
 	);
 	double price_txt_width = price_txt.getLocalBounds().width;
@@ -1720,15 +3560,18 @@ void Plant::drawPrice(void) {
 }	// end Plant::drawPrice()
 
 
-void Plant::drawMarbles(void) {
+void Plant::updateMarbles(double dt_s) {
 	/*
-	 *	Method to render marbles (if any)
+	 *	Method to advance marbles (if any) by dt_s
 	 */
 
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
 	// if no marbles, reset and return
 	if (this->marble_ptr_list.empty()) {
 		this->marble_frame = 0;
 		this->marble_iters = 0;
+		this->marbles_released = 0;
 		this->pulse_flag = false;
 		return;
 	}
@@ -1745,6 +3588,44 @@ void Plant::drawMarbles(void) {
 		}
 	}
 
+	// update released marbles (with space between, so can see)
+	this->marbles_released = 0;
+	for (
+		auto itr = this->marble_ptr_list.begin();
+		itr != this->marble_ptr_list.end();
+		itr++
+	) {
+		(*itr)->update(dt_s);
+		this->marbles_released++;
+
+		if (this->marbles_released > this->marble_iters) {
+			break;
+		}
+	}
+
+	// update marble_frames and marble_iters, return
+	if (this->marble_frame >= FRAMES_PER_SECOND / 10) {
+		this->marble_frame = 0;
+		this->marble_iters++;
+	}
+	else {
+		this->marble_frame += n_frames;
+	}
+	this->line_frame += n_frames;
+	return;
+}	// end Plant::updateMarbles()
+
+
+void Plant::drawMarbles(double render_ratio, MarbleBatch* batch_ptr) {
+	/*
+	 *	Method to render power line and push released marbles (if any) to the
+	 *	given batch
+	 */
+
+	if (this->marble_ptr_list.empty()) {
+		return;
+	}
+
 	// draw power line
 	double line_alpha = 42 * fabs(cos((2.5 * M_PI * this->line_frame) / FRAMES_PER_SECOND));
 	sf::Vertex line[2] = {
@@ -1765,32 +3646,21 @@ void Plant::drawMarbles(void) {
 	};
 	this->window_ptr->draw(line, 2, sf::Lines);
 
-	// draw marbles (with space between, so can see)
-	int n_iters = 0;
+	// draw released marbles
+	int n_drawn = 0;
 	for (
 		auto itr = this->marble_ptr_list.begin();
 		itr != this->marble_ptr_list.end();
 		itr++
 	) {
-		(*itr)->drawFrame();
-
-		if (n_iters >= this->marble_iters) {
+		if (n_drawn >= this->marbles_released) {
 			break;
 		}
-		else {
-			n_iters++;
-		}
-	}
 
-	// update marble_frames and marble_iters, return
-	if (this->marble_frame >= FRAMES_PER_SECOND / 10) {
-		this->marble_frame = 0;
-		this->marble_iters++;
-	}
-	else {
-		this->marble_frame++;
+		(*itr)->drawFrame(render_ratio, batch_ptr);
+		n_drawn++;
 	}
-	this->line_frame++;
+
 	return;
 }	// end Plant::drawMarbles()
 
@@ -1804,9 +3674,11 @@ void Plant::drawMusteredMarbles(void) {
 		return;
 	}
 
+	std::string marble_counter_str = std::to_string(this->marble_counter);
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 24, marble_counter_str);
 	sf::Text marble_counter_text(
-		std::to_string(this->marble_counter),
-		*(this->assets_ptr->getFont("bold")),
+		marble_counter_str,
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		24
 	);
 	//marble_counter_text.setFillColor(this->marble_colour);
@@ -1842,83 +3714,99 @@ void Plant::drawMusteredMarbles(void) {
 	double pos_x = 0;
 	double pos_y = 0;
 	double phase = 0;
+	double alpha = 255 * (
+		1 + cos((1.5 * M_PI * this->muster_frame) / FRAMES_PER_SECOND)
+	) / 2;
+	sf::Color glass_colour(
+		MARBLE_COLOUR_GLASS_MUSTER.r,
+		MARBLE_COLOUR_GLASS_MUSTER.g,
+		MARBLE_COLOUR_GLASS_MUSTER.b,
+		alpha
+	);
+	sf::Color core_colour(
+		this->marble_colour.r,
+		this->marble_colour.g,
+		this->marble_colour.b,
+		alpha
+	);
 	for (
 		auto itr = this->marble_sprite_ptr_list.begin();
 		itr != this->marble_sprite_ptr_list.end();
 		itr++
 	) {
-		sf::CircleShape glass;
-		glass.setRadius(16);
-		glass.setFillColor(
-			sf::Color(
-				MARBLE_COLOUR_GLASS_MUSTER.r,
-				MARBLE_COLOUR_GLASS_MUSTER.g,
-				MARBLE_COLOUR_GLASS_MUSTER.b,
-				255 * (
-					1 + cos((1.5 * M_PI * this->muster_frame) / FRAMES_PER_SECOND)
-				) / 2
-			)
-		);
-		glass.setOrigin(16, 16);
-
 		pos_x = this->position_x + 45 * cos(
 			(2 * M_PI * this->muster_frame) / (3 * FRAMES_PER_SECOND) + phase
 		);
 		pos_y = this->position_y - this->height / 2 + 45 * sin(
 			(2 * M_PI * this->muster_frame) / (3 * FRAMES_PER_SECOND) + phase
 		);
-		(*itr)->setPosition(
-			pos_x,
-			pos_y
-		);
-		glass.setPosition(
-			pos_x,
-			pos_y
-		);
 		phase += d_phase;
 
-		(*itr)->setColor(
-			sf::Color(
-				this->marble_colour.r,
-				this->marble_colour.g,
-				this->marble_colour.b,
-				255 * (
-					1 + cos((1.5 * M_PI * this->muster_frame) / FRAMES_PER_SECOND)
-				) / 2
-			)
+		this->muster_batch.pushGlass(pos_x, pos_y, 16, glass_colour);
+		this->muster_batch.pushCore(
+			pos_x,
+			pos_y,
+			16,
+			(*itr)->getTextureRect(),
+			core_colour
 		);
-
-		this->window_ptr->draw(glass);
-		this->window_ptr->draw(*(*itr));
 	}
+	this->muster_batch.draw();
 
 	this->window_ptr->draw(counter_back);
 	this->window_ptr->draw(marble_counter_text);
-	this->muster_frame++;
 	return;
 }	// end Plant::drawMusteredMarbles()
 
 
-void Plant::drawFrame(bool selected, bool play_phase) {
+void Plant::update(
+	double dt_s,
+	double wind_speed_ratio,
+	ParticlePool* particle_pool_ptr
+) {
 	/*
-	 *	Method to draw frame of Plant object
+	 *	Method to advance Plant (marbles and animation) by dt_s, emitting any
+	 *	particles into the given pool
 	 */
 
-	// change texture key if selected and a blank plant
-	if (selected) {
-		if (this->texture_key == "null") {
-			this->texture_key = "null green";
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
+	this->updateMarbles(dt_s);
+	this->emitSteam(particle_pool_ptr);
+	this->emitSmoke(particle_pool_ptr);
+
+	// state-dependent blitting
+	if (this->running_flag && this->frame >= FRAMES_PER_BLIT) {
+		this->sprite_idx++;
+		this->frame = 0;
+		if (this->sprite_idx > this->n_sprites - 1) {
+			this->sprite_idx = 1;
 		}
 	}
-	else{
-		if (this->texture_key == "null green") {
-				this->texture_key = "null";
-		}
+
+	// pulsing and mustered marbles
+	if (this->pulse_flag) {
+		this->pulse_frame += n_frames;
+	}
+	if (this->marble_counter > 0) {
+		this->muster_frame += n_frames;
 	}
 
-	// init
+	this->frame += n_frames;
+	return;
+}	// end Plant::update()
+
+
+void Plant::drawFrame(bool selected, bool play_phase) {
+	/*
+	 *	Method to draw frame of Plant object
+	 */
+
+	// init (empty slots have their own selected texture)
 	sf::Sprite sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(
+			selected ? this->selected_texture_id : this->texture_id
+		)),
 		sf::IntRect(0, 0, this->width, this->height)
 		);
 
@@ -1936,16 +3824,8 @@ void Plant::drawFrame(bool selected, bool play_phase) {
 				this->sprite_idx * this->height,
 				this->width,
 				this->height
-			)
-		);
-
-		if (this->frame >= FRAMES_PER_BLIT) {
-			this->sprite_idx++;
-			this->frame = 0;
-			if (this->sprite_idx > this->n_sprites - 1) {
-				this->sprite_idx = 1;
-			}
-		}
+			)
+		);
 	}
 
 	// transformations
@@ -1958,7 +3838,6 @@ void Plant::drawFrame(bool selected, bool play_phase) {
 		double pulse = 1 + 0.05 * cos((2 * M_PI * this->pulse_frame) / FRAMES_PER_SECOND);
 		sf::Vector2f scale = sprite.getScale();
 		sprite.setScale(pulse * scale.x, pulse * scale.y);
-		this->pulse_frame++;
 	}
 
 	// draw plant
@@ -1980,7 +3859,6 @@ void Plant::drawFrame(bool selected, bool play_phase) {
 		this->drawMusteredMarbles();
 	}
 
-	this->frame++;
 	return;
 }	// end Plant::drawFrame()
 
@@ -2005,21 +3883,6 @@ Plant::~Plant(void) {
  	}
  	this->marble_sprite_ptr_list.clear();
 
-	// delete particles
- 	auto itr_steam = this->steam_ptr_list.begin();
- 	while (itr_steam != this->steam_ptr_list.end()) {
- 		delete *itr_steam;
- 		itr_steam = this->steam_ptr_list.erase(itr_steam);
- 	}
- 	this->steam_ptr_list.clear();
-
- 	auto itr_smoke = this->smoke_ptr_list.begin();
- 	while (itr_smoke != this->smoke_ptr_list.end()) {
- 		delete *itr_smoke;
- 		itr_smoke = this->smoke_ptr_list.erase(itr_smoke);
- 	}
- 	this->smoke_ptr_list.clear();
-
 	// stream out and return
  	std::cout << "Plant object at " << this << " destroyed." << std::endl;
  	return;
@@ -2050,8 +3913,7 @@ Plant(
 	this->height = 128;
  	this->n_sprites = 9;
  	this->width = 128;
-	this->texture_key = "coal";
-	this->marble_colour = MARBLE_COLOUR_COAL;
+	this->setKind(PLANT_COAL);
 
 	// stream out and return
  	std::cout << "\tCoal object created at " << this << ".\n" << std::endl;
@@ -2059,110 +3921,58 @@ Plant(
 }	// end Coal::Coal()
 
 
-void Coal::drawSteam(double wind_speed_ratio) {
+void Coal::emitSteam(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw steam particles
+	 *	Method to emit steam particles (one fixed step's worth) into the
+	 *	given pool
 	 */
 
-	// remove finished particles
-	auto itr = this->steam_ptr_list.begin();
-	while (itr != this->steam_ptr_list.end()) {
-		if ((*itr)->isFinished()) {
-			delete *itr;
-			itr = this->steam_ptr_list.erase(itr);
-		}
-		else {
-			itr++;
-		}
-	}
-
 	// spawn new particles
 	if (this->running_flag) {
-		double rand_pos_x = 51 * ((double)rand() / RAND_MAX);
+		double rand_pos_x = 51 * randomStream(RNG_PARTICLES).uniform();
 		double pos_y = 32;
-		this->steam_ptr_list.push_back(
-			new Steam(
-				this->position_x + rand_pos_x - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_STEAM,
+			this->position_x + rand_pos_x - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
 	}
 
-	// draw particles
-	for (
-		auto itr = this->steam_ptr_list.begin();
-		itr != this->steam_ptr_list.end();
-		itr++
-	) {
-		(*itr)->drawFrame(wind_speed_ratio);
-	}
-
 	return;
-}	// end Coal::drawSteam()
+}	// end Coal::emitSteam()
 
 
-void Coal::drawSmoke(double wind_speed_ratio) {
+void Coal::emitSmoke(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw smoke particles
+	 *	Method to emit smoke particles (one fixed step's worth) into the
+	 *	given pool
 	 */
 
-	// remove finished particles
-	auto itr = this->smoke_ptr_list.begin();
-	while (itr != this->smoke_ptr_list.end()) {
-		if ((*itr)->isFinished()) {
-			delete *itr;
-			itr = this->smoke_ptr_list.erase(itr);
-		}
-		else {
-			itr++;
-		}
-	}
-
 	// spawn new particles
 	if (this->running_flag) {
-		double rand_pos_x_1 = 40 + 6 * ((double)rand() / RAND_MAX);
-		double rand_pos_x_2 = 40 + 6 * ((double)rand() / RAND_MAX) + 17;
-		double rand_pos_x_3 = 40 + 6 * ((double)rand() / RAND_MAX) + 34;
+		double rand_pos_x_1 = 40 + 6 * randomStream(RNG_PARTICLES).uniform();
+		double rand_pos_x_2 = 40 + 6 * randomStream(RNG_PARTICLES).uniform() + 17;
+		double rand_pos_x_3 = 40 + 6 * randomStream(RNG_PARTICLES).uniform() + 34;
 		double pos_y = 22;
-		this->smoke_ptr_list.push_back(
-			new Smoke(
-				this->position_x + rand_pos_x_1 - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_SMOKE,
+			this->position_x + rand_pos_x_1 - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
-		this->smoke_ptr_list.push_back(
-			new Smoke(
-				this->position_x + rand_pos_x_2 - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_SMOKE,
+			this->position_x + rand_pos_x_2 - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
-		this->smoke_ptr_list.push_back(
-			new Smoke(
-				this->position_x + rand_pos_x_3 - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_SMOKE,
+			this->position_x + rand_pos_x_3 - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
 	}
 
-	// draw particles
-	for (
-		auto itr = this->smoke_ptr_list.begin();
-		itr != this->smoke_ptr_list.end();
-		itr++
-	) {
-		(*itr)->drawFrame(wind_speed_ratio);
-	}
-
 	return;
-}	// end Coal::drawSmoke()
+}	// end Coal::emitSmoke()
 
 
 void Coal::incMarbles(void) {
@@ -2181,7 +3991,7 @@ void Coal::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -2258,7 +4068,7 @@ void Coal::commitMarbles(void) {
 	if (this->has_run) {
 		for (int i = 0; i < this->last_production_GWh; i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -2306,8 +4116,7 @@ Plant(
 	this->height = 128;
  	this->n_sprites = 9;
  	this->width = 128;
-	this->texture_key = "combined";
-	this->marble_colour = MARBLE_COLOUR_COMBINED;
+	this->setKind(PLANT_COMBINED);
 
 	// stream out and return
  	std::cout << "\tCombined object created at " << this << ".\n" << std::endl;
@@ -2315,91 +4124,46 @@ Plant(
 }	// end Combined::Combined()
 
 
-void Combined::drawSteam(double wind_speed_ratio) {
+void Combined::emitSteam(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw steam particles
+	 *	Method to emit steam particles (one fixed step's worth) into the
+	 *	given pool
 	 */
 
-	// remove finished particles
-	auto itr = this->steam_ptr_list.begin();
-	while (itr != this->steam_ptr_list.end()) {
-		if ((*itr)->isFinished()) {
-			delete *itr;
-			itr = this->steam_ptr_list.erase(itr);
-		}
-		else {
-			itr++;
-		}
-	}
-
 	// spawn new particles
 	if (this->running_flag) {
-		double rand_pos_x = 51 * ((double)rand() / RAND_MAX);
+		double rand_pos_x = 51 * randomStream(RNG_PARTICLES).uniform();
 		double pos_y = 32;
-		this->steam_ptr_list.push_back(
-			new Steam(
-				this->position_x + rand_pos_x - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_STEAM,
+			this->position_x + rand_pos_x - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
 	}
 
-	// draw particles
-	for (
-		auto itr = this->steam_ptr_list.begin();
-		itr != this->steam_ptr_list.end();
-		itr++
-	) {
-		(*itr)->drawFrame(wind_speed_ratio);
-	}
-
 	return;
-}	// end Combined::drawSteam()
+}	// end Combined::emitSteam()
 
 
-void Combined::drawSmoke(double wind_speed_ratio) {
+void Combined::emitSmoke(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw smoke particles
+	 *	Method to emit smoke particles (one fixed step's worth) into the
+	 *	given pool
 	 */
-	// remove finished particles
-	auto itr = this->smoke_ptr_list.begin();
-	while (itr != this->smoke_ptr_list.end()) {
-		if ((*itr)->isFinished()) {
-			delete *itr;
-			itr = this->smoke_ptr_list.erase(itr);
-		}
-		else {
-			itr++;
-		}
-	}
 
 	// spawn new particles
 	if (this->running_flag) {
-		double rand_pos_x = 98 + 19 * ((double)rand() / RAND_MAX);
+		double rand_pos_x = 98 + 19 * randomStream(RNG_PARTICLES).uniform();
 		double pos_y = 22;
-		this->smoke_ptr_list.push_back(
-			new Smoke(
-				this->position_x + rand_pos_x - this->width /2 ,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_SMOKE,
+			this->position_x + rand_pos_x - this->width /2,
+			this->position_y + pos_y - this->height
 		);
 	}
 
-	// draw particles
-	for (
-		auto itr = this->smoke_ptr_list.begin();
-		itr != this->smoke_ptr_list.end();
-		itr++
-	) {
-		(*itr)->drawFrame(wind_speed_ratio);
-	}
-
 	return;
-}	// end Combined::drawSmoke()
+}	// end Combined::emitSmoke()
 
 
 void Combined::incMarbles(void) {
@@ -2418,7 +4182,7 @@ void Combined::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -2495,7 +4259,7 @@ void Combined::commitMarbles(void) {
 	if (this->has_run) {
 		for (int i = 0; i < this->last_production_GWh; i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -2543,9 +4307,7 @@ Plant(
 	this->height = 128;
  	this->n_sprites = 9;
  	this->width = 128;
-	this->texture_key = "fission";
-	this->marble_colour = MARBLE_COLOUR_FISSION;
-	this->price_per_GW = FISSION_TOKENS_PER_GW;
+	this->setKind(PLANT_FISSION);
 
 	// stream out and return
  	std::cout << "\tFission object created at " << this << ".\n" << std::endl;
@@ -2553,48 +4315,25 @@ Plant(
 }	// end Fission::Fission()
 
 
-void Fission::drawSteam(double wind_speed_ratio) {
+void Fission::emitSteam(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw steam particles
+	 *	Method to emit steam particles (one fixed step's worth) into the
+	 *	given pool
 	 */
 
-	// remove finished particles
-	auto itr = this->steam_ptr_list.begin();
-	while (itr != this->steam_ptr_list.end()) {
-		if ((*itr)->isFinished()) {
-			delete *itr;
-			itr = this->steam_ptr_list.erase(itr);
-		}
-		else {
-			itr++;
-		}
-	}
-
 	// spawn new particles
 	if (this->running_flag) {
-		double rand_pos_x = 51 * ((double)rand() / RAND_MAX);
+		double rand_pos_x = 51 * randomStream(RNG_PARTICLES).uniform();
 		double pos_y = 32;
-		this->steam_ptr_list.push_back(
-			new Steam(
-				this->position_x + rand_pos_x - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_STEAM,
+			this->position_x + rand_pos_x - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
 	}
 
-	// draw particles
-	for (
-		auto itr = this->steam_ptr_list.begin();
-		itr != this->steam_ptr_list.end();
-		itr++
-	) {
-		(*itr)->drawFrame(wind_speed_ratio);
-	}
-
 	return;
-}	// end Fission::drawSteam()
+}	// end Fission::emitSteam()
 
 
 void Fission::incMarbles(void) {
@@ -2610,7 +4349,7 @@ void Fission::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -2684,7 +4423,7 @@ void Fission::commitMarbles(void) {
 	if (this->has_run) {
 		for (int i = 0; i < this->last_production_GWh; i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -2732,8 +4471,7 @@ Plant(
 	this->height = 128;
  	this->n_sprites = 9;
  	this->width = 128;
-	this->texture_key = "geothermal";
-	this->marble_colour = MARBLE_COLOUR_GEOTHERMAL;
+	this->setKind(PLANT_GEOTHERMAL);
 
 	// stream out and return
  	std::cout << "\tGeothermal object created at " << this << ".\n" << std::endl;
@@ -2741,97 +4479,114 @@ Plant(
 }	// end Geothermal::Geothermal()
 
 
-void Geothermal::drawSteam(double wind_speed_ratio) {
+void Geothermal::emitSteam(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw steam particles
+	 *	Method to emit steam particles (one fixed step's worth) into the
+	 *	given pool
 	 */
 
-	// remove finished particles
-	auto itr = this->steam_ptr_list.begin();
-	while (itr != this->steam_ptr_list.end()) {
-		if ((*itr)->isFinished()) {
-			delete *itr;
-			itr = this->steam_ptr_list.erase(itr);
-		}
-		else {
-			itr++;
-		}
-	}
-
 	// spawn new particles
 	if (this->running_flag) {
-		double rand_pos_x = 51 * ((double)rand() / RAND_MAX);
+		double rand_pos_x = 51 * randomStream(RNG_PARTICLES).uniform();
 		double pos_y = 32;
-		this->steam_ptr_list.push_back(
-			new Steam(
-				this->position_x + rand_pos_x - this->width / 2,
-				this->position_y + pos_y - this->height,
-				this->window_ptr,
-				this->assets_ptr
-			)
+		particle_pool_ptr->spawn(
+			PARTICLE_STEAM,
+			this->position_x + rand_pos_x - this->width / 2,
+			this->position_y + pos_y - this->height
 		);
 
-		if ((double)rand() / RAND_MAX >= 0.9) {
-			rand_pos_x = 96 + 32 * ((double)rand() / RAND_MAX);
+		if (randomStream(RNG_PARTICLES).uniform() >= 0.9) {
+			rand_pos_x = 96 + 32 * randomStream(RNG_PARTICLES).uniform();
 			pos_y = 124;
-			this->steam_ptr_list.push_back(
-				new Steam(
-					this->position_x + rand_pos_x - this->width / 2,
-					this->position_y + pos_y - this->height,
-					this->window_ptr,
-					this->assets_ptr
-				)
+			particle_pool_ptr->spawn(
+				PARTICLE_STEAM,
+				this->position_x + rand_pos_x - this->width / 2,
+				this->position_y + pos_y - this->height
 			);
 		}
 	}
 	else {
-		if ((double)rand() / RAND_MAX >= 0.9) {
-			double rand_pos_x = 96 + 32 * ((double)rand() / RAND_MAX);
+		if (randomStream(RNG_PARTICLES).uniform() >= 0.9) {
+			double rand_pos_x = 96 + 32 * randomStream(RNG_PARTICLES).uniform();
 			double pos_y = 124;
-			this->steam_ptr_list.push_back(
-				new Steam(
-					this->position_x + rand_pos_x - this->width / 2,
-					this->position_y + pos_y - this->height,
-					this->window_ptr,
-					this->assets_ptr
-				)
+			particle_pool_ptr->spawn(
+				PARTICLE_STEAM,
+				this->position_x + rand_pos_x - this->width / 2,
+				this->position_y + pos_y - this->height
 			);
 		}
 	}
 
-	// draw particles
-	for (
-		auto itr = this->steam_ptr_list.begin();
-		itr != this->steam_ptr_list.end();
-		itr++
-	) {
-		(*itr)->drawFrame(wind_speed_ratio);
-	}
-
 	return;
-}	// end Geothermal::drawSteam()
+}	// end Geothermal::emitSteam()
 
 
-void Geothermal::drawFrame(bool selected, bool play_phase) {
+void Geothermal::update(
+	double dt_s,
+	double wind_speed_ratio,
+	ParticlePool* particle_pool_ptr
+) {
 	/*
-	 *	Method to draw frame of Geothermal object
+	 *	Method to advance Geothermal (plant, then drill txt) by dt_s
 	 */
 
-	// change texture key if selected and a blank plant
-	if (selected) {
-		if (this->texture_key == "null") {
-			this->texture_key = "null green";
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
+	Plant::update(dt_s, wind_speed_ratio, particle_pool_ptr);
+
+	// drill txt drifts up and fades out
+	int alpha = 0;
+	int pos_y = 0;
+	sf::Vector2f posn;
+	sf::Color txt_colour;
+	auto itr_txt = this->drill_txt_ptr_list.begin();
+	while (itr_txt != this->drill_txt_ptr_list.end()) {
+		// update state
+		posn = (*itr_txt)->getPosition();
+		pos_y = posn.y - 2 * n_frames;
+		if (pos_y < this->position_y - 190) {
+			pos_y = this->position_y - 190;
 		}
-	}
-	else{
-		if (this->texture_key == "null green") {
-				this->texture_key = "null";
+		(*itr_txt)->setPosition(posn.x, pos_y);
+
+		txt_colour = (*itr_txt)->getFillColor();
+		alpha = txt_colour.a - int(round(2 * n_frames));
+		if (alpha < 0) {
+			alpha = 0;
+		}
+		(*itr_txt)->setFillColor(
+			sf::Color(
+				txt_colour.r,
+				txt_colour.g,
+				txt_colour.b,
+				alpha
+			)
+		);
+
+		// increment, clearing finished elements
+		if (txt_colour.a <= 0) {
+			delete *itr_txt;
+	 		itr_txt = this->drill_txt_ptr_list.erase(itr_txt);
+		}
+		else {
+			itr_txt++;
 		}
 	}
 
-	// init
+	return;
+}	// end Geothermal::update()
+
+
+void Geothermal::drawFrame(bool selected, bool play_phase) {
+	/*
+	 *	Method to draw frame of Geothermal object
+	 */
+
+	// init (empty slots have their own selected texture)
 	sf::Sprite sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(
+			selected ? this->selected_texture_id : this->texture_id
+		)),
 		sf::IntRect(0, 0, this->width, this->height)
 		);
 
@@ -2851,14 +4606,6 @@ void Geothermal::drawFrame(bool selected, bool play_phase) {
 				this->height
 			)
 		);
-
-		if (this->frame >= FRAMES_PER_BLIT) {
-			this->sprite_idx++;
-			this->frame = 0;
-			if (this->sprite_idx > this->n_sprites - 1) {
-				this->sprite_idx = 1;
-			}
-		}
 	}
 
 	// transformations
@@ -2871,7 +4618,6 @@ void Geothermal::drawFrame(bool selected, bool play_phase) {
 		double pulse = 1 + 0.05 * cos((2 * M_PI * this->pulse_frame) / FRAMES_PER_SECOND);
 		sf::Vector2f scale = sprite.getScale();
 		sprite.setScale(pulse * scale.x, pulse * scale.y);
-		this->pulse_frame++;
 	}
 
 	// draw plant
@@ -2912,48 +4658,14 @@ void Geothermal::drawFrame(bool selected, bool play_phase) {
 		}
 	}
 	*/
-	int alpha = 0;
-	int pos_y = 0;
-	sf::Vector2f posn;
-	sf::Color txt_colour;
-	auto itr_txt = this->drill_txt_ptr_list.begin();
-	while (itr_txt != this->drill_txt_ptr_list.end()) {
-		// update state
-		posn = (*itr_txt)->getPosition();
-		pos_y = posn.y - 2;
-		if (pos_y < this->position_y - 190) {
-			pos_y = this->position_y - 190;
-		}
-		(*itr_txt)->setPosition(posn.x, pos_y);
-
-		txt_colour = (*itr_txt)->getFillColor();
-		alpha = txt_colour.a - 2;
-		if (alpha < 0) {
-			alpha = 0;
-		}
-		(*itr_txt)->setFillColor(
-			sf::Color(
-				txt_colour.r,
-				txt_colour.g,
-				txt_colour.b,
-				alpha
-			)
-		);
-
-		// draw
+	for (
+		auto itr_txt = this->drill_txt_ptr_list.begin();
+		itr_txt != this->drill_txt_ptr_list.end();
+		itr_txt++
+	) {
 		this->window_ptr->draw(**itr_txt);
-
-		// increment, clearing finished elements
-		if (txt_colour.a <= 0) {
-			delete *itr_txt;
-	 		itr_txt = this->drill_txt_ptr_list.erase(itr_txt);
-		}
-		else {
-			itr_txt++;
-		}
 	}
 
-	this->frame++;
 	return;
 }	// end Plant::drawFrame()
 
@@ -2974,7 +4686,7 @@ void Geothermal::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -3051,7 +4763,7 @@ void Geothermal::commitMarbles(void) {
 	if (this->has_run) {
 		for (int i = 0; i < this->last_production_GWh; i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -3070,9 +4782,10 @@ void Geothermal::drillSuccess(bool success) {
 	 */
 
 	if (success) {
+		this->assets_ptr->checkGlyphs(this->bold_font_id, 16, "SUCCESS! (+1 GW)");
 		sf::Text* drill_txt_ptr = new sf::Text(
 			"SUCCESS! (+1 GW)",
-			*(this->assets_ptr->getFont("bold")),
+			*(this->assets_ptr->getFont(this->bold_font_id)),
 			16
 		);
 		drill_txt_ptr->setOrigin(
@@ -3089,9 +4802,10 @@ void Geothermal::drillSuccess(bool success) {
 		this->assets_ptr->getSound("transition complete")->play();
 	}
 	else {
+		this->assets_ptr->checkGlyphs(this->bold_font_id, 16, "FAILURE! (+0 GW)");
 		sf::Text* drill_txt_ptr = new sf::Text(
 			"FAILURE! (+0 GW)",
-			*(this->assets_ptr->getFont("bold")),
+			*(this->assets_ptr->getFont(this->bold_font_id)),
 			16
 		);
 		drill_txt_ptr->setOrigin(
@@ -3157,11 +4871,10 @@ Plant(
  	this->width = 128;
 	this->capacity_GWh = 0;
 	this->charge_GWh = 0;
-	this->texture_key = "hydro";
-	this->marble_colour = MARBLE_COLOUR_HYDRO;
+	this->setKind(PLANT_HYDRO);
 
 	sf::Sprite* marble_sprite = new sf::Sprite(
-		*(this->assets_ptr->getTexture("marble"))
+		*(this->assets_ptr->getTexture(this->marble_texture_id))
 	);
 	marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 	marble_sprite->setColor(this->marble_colour);
@@ -3182,15 +4895,17 @@ void Hydro::drawFrame(bool selected, bool play_phase) {
 
 	// init
 	sf::Sprite sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 	sf::RectangleShape charge_rect(
 		sf::Vector2f(45, 74 * this->charge_GWh / this->capacity_GWh)
 	);
+	std::string charge_str = std::to_string(int(round(this->charge_GWh)));
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 18, charge_str);
 	sf::Text charge_text(
-		std::to_string(int(round(this->charge_GWh))),
-		*(this->assets_ptr->getFont("bold")),
+		charge_str,
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		18
 	);
 
@@ -3220,14 +4935,6 @@ void Hydro::drawFrame(bool selected, bool play_phase) {
 			}
 		}
 		*/
-
-		if (this->frame >= FRAMES_PER_BLIT) {
-			this->sprite_idx++;
-			this->frame = 0;
-			if (this->sprite_idx > this->n_sprites - 1) {
-				this->sprite_idx = 1;
-			}
-		}
 	}
 
 	// transformations
@@ -3283,8 +4990,6 @@ void Hydro::drawFrame(bool selected, bool play_phase) {
 			pulse * scale.x / sprite_scale_x,
 			pulse * scale.y / sprite_scale_y
 		);
-
-		this->pulse_frame++;
 	}
 
 	// draw and return
@@ -3304,7 +5009,6 @@ void Hydro::drawFrame(bool selected, bool play_phase) {
 	if (play_phase) {
 		this->drawMusteredMarbles();
 	}
-	this->frame++;
 	return;
 }	// end Hydro::drawFrame()
 
@@ -3362,7 +5066,7 @@ void Hydro::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -3433,7 +5137,7 @@ void Hydro::commitMarbles(void) {
 
 	if (this->charge_GWh > 0) {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -3485,9 +5189,7 @@ Plant(
 	this->height = 128;
  	this->n_sprites = 7;
  	this->width = 128;
-	this->texture_key = "peaker";
-	this->marble_colour = MARBLE_COLOUR_PEAKER;
-	this->price_per_GW = PEAKER_TOKENS_PER_GW;
+	this->setKind(PLANT_PEAKER);
 
 	// stream out and return
  	std::cout << "\tPeaker object created at " << this << ".\n" << std::endl;
@@ -3495,48 +5197,25 @@ Plant(
 }	// end Peaker::Peaker()
 
 
-void Peaker::drawSmoke(double wind_speed_ratio) {
+void Peaker::emitSmoke(ParticlePool* particle_pool_ptr) {
 	/*
-	 *	Method to draw smoke particles
+	 *	Method to emit smoke particles (one fixed step's worth) into the
+	 *	given pool
 	 */
 
- 	// remove finished particles
- 	auto itr = this->smoke_ptr_list.begin();
- 	while (itr != this->smoke_ptr_list.end()) {
- 		if ((*itr)->isFinished()) {
- 			delete *itr;
- 			itr = this->smoke_ptr_list.erase(itr);
- 		}
- 		else {
- 			itr++;
- 		}
- 	}
-
  	// spawn new particles
  	if (this->running_flag) {
- 		double rand_pos_x = 98 + 19 * ((double)rand() / RAND_MAX);
+ 		double rand_pos_x = 98 + 19 * randomStream(RNG_PARTICLES).uniform();
  		double pos_y = 22;
- 		this->smoke_ptr_list.push_back(
- 			new Smoke(
- 				this->position_x + rand_pos_x - this->width / 2,
- 				this->position_y + pos_y - this->height,
- 				this->window_ptr,
- 				this->assets_ptr
- 			)
+ 		particle_pool_ptr->spawn(
+ 			PARTICLE_SMOKE,
+ 			this->position_x + rand_pos_x - this->width / 2,
+ 			this->position_y + pos_y - this->height
  		);
  	}
 
- 	// draw particles
- 	for (
- 		auto itr = this->smoke_ptr_list.begin();
- 		itr != this->smoke_ptr_list.end();
- 		itr++
- 	) {
- 		(*itr)->drawFrame(wind_speed_ratio);
- 	}
-
  	return;
-}	// end Peaker::drawSmoke()
+}	// end Peaker::emitSmoke()
 
 
 Peaker::~Peaker(void) {
@@ -3574,8 +5253,7 @@ Plant(
 	this->height = 128;
  	this->n_sprites = 1;
  	this->width = 128;
-	this->texture_key = "solar";
-	this->marble_colour = MARBLE_COLOUR_SOLAR;
+	this->setKind(PLANT_SOLAR);
 
 	// stream out and return
  	std::cout << "\tSolar object created at " << this << ".\n" << std::endl;
@@ -3590,7 +5268,7 @@ void Solar::drawFrame(bool selected, bool play_phase) {
 
 	// init
 	sf::Sprite sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 	sf::RectangleShape output_rect(
@@ -3638,8 +5316,6 @@ void Solar::drawFrame(bool selected, bool play_phase) {
 			pulse * scale.x / sprite_scale_x,
 			pulse * scale.y / sprite_scale_y
 		);
-
-		this->pulse_frame++;
 	}
 
 	// draw and return
@@ -3656,7 +5332,6 @@ void Solar::drawFrame(bool selected, bool play_phase) {
 	if (play_phase) {
 		this->drawMusteredMarbles();
 	}
-	this->frame++;
 	return;
 }	// end Solar::drawFrame()
 
@@ -3666,21 +5341,14 @@ double Solar::getProduction(double solar_res_kWm2) {
 	 *	Method to compute and return solar production.
 	 */
 
-	if (solar_res_kWm2 <= 0) {
-		solar_res_kWm2 = 0;
-	}
-
-	double prod_GW = this->capacity_GW * solar_res_kWm2;
-	if (prod_GW > this->capacity_GW) {
-		prod_GW = this->capacity_GW;
-	}
+	double prod_GW = this->capacity_GW * solarProductionRatio(solar_res_kWm2);
 
 	this->prod_GW = prod_GW;
 
 	if (this->marble_counter < 128) {
 		for (int i = 0; i < round(prod_GW); i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -3738,9 +5406,7 @@ Plant(
  	this->width = 128;
 	this->capacity_GWh = 0;
 	this->charge_GWh = 0;
-	this->texture_key = "storage";
-	this->marble_colour = MARBLE_COLOUR_STORAGE;
-	this->price_per_GW = STORAGE_TOKENS_PER_GW;
+	this->setKind(PLANT_STORAGE);
 
 	// stream out and return
  	std::cout << "\tStorage object created at " << this << ".\n" << std::endl;
@@ -3761,7 +5427,7 @@ void Storage::incMarbles(void) {
 	}
 	else {
 		sf::Sprite* marble_sprite = new sf::Sprite(
-			*(this->assets_ptr->getTexture("marble"))
+			*(this->assets_ptr->getTexture(this->marble_texture_id))
 		);
 		marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 		marble_sprite->setColor(this->marble_colour);
@@ -3861,12 +5527,14 @@ void Storage::drawFrame(bool selected, bool play_phase) {
 
 	// init
 	sf::Sprite sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
+	std::string charge_str = std::to_string(int(round(this->charge_GWh)));
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 18, charge_str);
 	sf::Text charge_text(
-		std::to_string(int(round(this->charge_GWh))),
-		*(this->assets_ptr->getFont("bold")),
+		charge_str,
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		18
 	);
 
@@ -3911,8 +5579,6 @@ void Storage::drawFrame(bool selected, bool play_phase) {
 			pulse * scale.x / sprite_scale_x,
 			pulse * scale.y / sprite_scale_y
 		);
-
-		this->pulse_frame++;
 	}
 
 	// draw and return
@@ -3931,7 +5597,6 @@ void Storage::drawFrame(bool selected, bool play_phase) {
 	if (play_phase) {
 		this->drawMusteredMarbles();
 	}
-	this->frame++;
 	return;
 }	// end Storage::drawFrame()
 
@@ -4014,8 +5679,7 @@ Plant(
  	this->width = 128;
 	this->angle = 0;
 	this->design_speed_ms = 0.47;
-	this->texture_key = "tidal";
-	this->marble_colour = MARBLE_COLOUR_TIDAL;
+	this->setKind(PLANT_TIDAL);
 
 	// stream out and return
  	std::cout << "\tTidal object created at " << this << ".\n" << std::endl;
@@ -4023,6 +5687,29 @@ Plant(
 }	// end Tidal::Tidal()
 
 
+void Tidal::update(
+	double dt_s,
+	double wind_speed_ratio,
+	ParticlePool* particle_pool_ptr
+) {
+	/*
+	 *	Method to advance Tidal by dt_s
+	 */
+
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
+	Plant::update(dt_s, wind_speed_ratio, particle_pool_ptr);
+
+	// update angle, and bob faster while producing
+	this->angle += 2 * (this->prod_GW / this->capacity_GW) * n_frames;
+	if (this->prod_GW > 0) {
+		this->frame += n_frames;
+	}
+
+	return;
+}	// end Tidal::update()
+
+
 void Tidal::drawFrame(bool selected, bool play_phase) {
 	/*
 	 *	Method to draw frame of Tidal object
@@ -4030,14 +5717,14 @@ void Tidal::drawFrame(bool selected, bool play_phase) {
 
 	// init
 	sf::Sprite body_sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 	std::vector<sf::Sprite> blade_sprite_vec;
 	for (int i = 0; i < 3; i++) {
 		blade_sprite_vec.push_back(
 			sf::Sprite(
-				*(this->assets_ptr->getTexture(this->texture_key)),
+				*(this->assets_ptr->getTexture(this->texture_id)),
 				sf::IntRect(0, this->height, this->width, this->height)
 			)
 		);
@@ -4098,13 +5785,8 @@ void Tidal::drawFrame(bool selected, bool play_phase) {
 				2 * cos((2 * M_PI * this->pulse_frame) / FRAMES_PER_SECOND)
 			);
 		}
-
-		this->pulse_frame++;
 	}
 
-	// update angle
-	this->angle += 2 * (this->prod_GW / this->capacity_GW);
-
 	// draw, increment frame, and return
 	water_rect.setFillColor(
 		sf::Color(0, 80, 255, 255)
@@ -4118,9 +5800,6 @@ void Tidal::drawFrame(bool selected, bool play_phase) {
 		sf::Color(0, 80, 255, 100)
 	);
 	this->window_ptr->draw(water_rect);
-	if (this->prod_GW > 0) {
-		this->frame++;
-	}
 	if (this->draw_tokens) {
 		//this->drawTokens();
 		this->drawCapacity();
@@ -4132,7 +5811,6 @@ void Tidal::drawFrame(bool selected, bool play_phase) {
 	if (play_phase) {
 		this->drawMusteredMarbles();
 	}
-	this->frame++;
 	return;
 }	// end Tidal::drawFrame()
 
@@ -4142,32 +5820,14 @@ double Tidal::getProduction(double tidal_res_ms) {
 	 *	Method to compute and return tidal production.
 	 */
 
-	if (tidal_res_ms <= 0) {
-		tidal_res_ms = 0;
-	}
-
 	// compute production based on derived dimensionless performance
-	double prod = 0;
-	double prod_GW = 0;
-	if (tidal_res_ms > 0) {
-		double turb_speed = (tidal_res_ms - this->design_speed_ms) /
-			this->design_speed_ms;
-
-		// look-up on dimensionless performance curve, get dimensionless production [ ]
-		 if (turb_speed < -0.71 || turb_speed > 0.65) {
-			 prod = 0;
-		 } else if (turb_speed >= -0.71 && turb_speed <= 0) {
-			 prod = 1.69215 * exp(1.25909 * turb_speed) - 0.69215;
-		 } else {
-			 prod = 1;
-		 }
-	}
-	prod_GW = this->capacity_GW * prod;
+	double prod_GW = this->capacity_GW *
+		tidalProductionRatio(tidal_res_ms, this->design_speed_ms);
 
 	if (this->marble_counter < 128) {
 		for (int i = 0; i < round(prod_GW); i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -4234,8 +5894,7 @@ Plant(
 	this->design_period_s = 8.5;	// specific to Robertson et al (2021) model
 	this->wave_res_m = 0;
 	this->wave_res_s = 0;
-	this->texture_key = "wave";
-	this->marble_colour = MARBLE_COLOUR_WAVE;
+	this->setKind(PLANT_WAVE);
 
 	// stream out and return
  	std::cout << "\tWave object created at " << this << ".\n" << std::endl;
@@ -4243,6 +5902,28 @@ Plant(
 }	// end Wave::Wave()
 
 
+void Wave::update(
+	double dt_s,
+	double wind_speed_ratio,
+	ParticlePool* particle_pool_ptr
+) {
+	/*
+	 *	Method to advance Wave by dt_s
+	 */
+
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
+	Plant::update(dt_s, wind_speed_ratio, particle_pool_ptr);
+
+	// heave faster while there are waves
+	if (this->wave_res_m > 0) {
+		this->frame += n_frames;
+	}
+
+	return;
+}	// end Wave::update()
+
+
 void Wave::drawFrame(bool selected, bool play_phase) {
 	/*
 	 *	Method to draw frame of Wave object
@@ -4259,7 +5940,7 @@ void Wave::drawFrame(bool selected, bool play_phase) {
 	double trig_arg = (2 * M_PI * this->frame * SECONDS_PER_FRAME) /
 		this->wave_res_s;
 	sf::Sprite WEC_arm(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(
 			0,
 			0,
@@ -4268,7 +5949,7 @@ void Wave::drawFrame(bool selected, bool play_phase) {
 	);
 	WEC_arm.setOrigin(64, 64);
 	sf::Sprite WEC_spar(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(
 			0,
 			this->height,
@@ -4277,7 +5958,7 @@ void Wave::drawFrame(bool selected, bool play_phase) {
 	);
 	WEC_spar.setOrigin(64, 64);
 	sf::Sprite WEC_float(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(
 			0,
 			2 * this->height,
@@ -4387,8 +6068,6 @@ void Wave::drawFrame(bool selected, bool play_phase) {
 			pulse * scale.x,
 			pulse * scale.y
 		);
-
-		this->pulse_frame++;
 	}
 
 	// draw, increment frame, and return
@@ -4403,9 +6082,6 @@ void Wave::drawFrame(bool selected, bool play_phase) {
 		sf::Color(0, 80, 255, 100)
 	);
 	this->window_ptr->draw(wave_column);
-	if (this->wave_res_m > 0) {
-		this->frame++;
-	}
 	if (this->draw_tokens) {
 		//this->drawTokens();
 		this->drawCapacity();
@@ -4417,7 +6093,6 @@ void Wave::drawFrame(bool selected, bool play_phase) {
 	if (play_phase) {
 		this->drawMusteredMarbles();
 	}
-	this->frame++;
 	return;
 
 }	// end Wave::drawFrame()
@@ -4435,39 +6110,18 @@ double Wave::getProduction(double wave_res_s) {
 
 	// compute production based on *very* simplified dimensionless performance
 	// from the model of Robertson et al (2021)
-	// ASSUMPTION: H_s = c * T_e^2, with random c < 0.2184 (deep-water breaking condition)
-	double prod_GW = 0;
-	double prod = 0;
 
 	// generate wave_res_m from Rayleigh distribution
-	double sigma = 0.028;	// Rayleigh scale parameter (mode of dist)
-	double roll = (double)rand() / RAND_MAX;
-	if (roll == 1) {
-		roll = 0.999999;
-	}
-	double scalar = sigma * sqrt(2 * log(1 / (1 - roll)));
-	double wave_res_m = scalar * pow(this->wave_res_s, 2);
-	if (wave_res_m > 0.2184 * pow(this->wave_res_s, 2)) {
-		wave_res_m = 0.2 * pow(this->wave_res_s, 2);
-	}
-	this->wave_res_m = wave_res_m;
+	double roll = randomStream(RNG_WAVE).uniform();
+	this->wave_res_m = waveHeight(this->wave_res_s, roll);
 
-	if (wave_res_m > 0) {
-		prod = 0.289 * wave_res_m -
-			0.00111 * pow(wave_res_m, 2) * wave_res_s -
-			0.0169 * wave_res_s;
-		if (prod <= 0) {
-			prod = 0;
-		} else if (prod >= 1) {
-			prod = 1;
-		}
-	}
-	prod_GW = this->capacity_GW * prod;
+	double prod_GW = this->capacity_GW *
+		waveProductionRatio(this->wave_res_s, this->wave_res_m);
 
 	if (this->marble_counter < 128) {
 		for (int i = 0; i < round(prod_GW); i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -4533,8 +6187,7 @@ Plant(
  	this->width = 128;
 	this->angle = 0;
 	this->design_speed_ms = 0.47;
-	this->texture_key = "wind";
-	this->marble_colour = MARBLE_COLOUR_WIND;
+	this->setKind(PLANT_WIND);
 
 	// stream out and return
  	std::cout << "\tWind object created at " << this << ".\n" << std::endl;
@@ -4542,6 +6195,26 @@ Plant(
 }	// end Wind::Wind()
 
 
+void Wind::update(
+	double dt_s,
+	double wind_speed_ratio,
+	ParticlePool* particle_pool_ptr
+) {
+	/*
+	 *	Method to advance Wind by dt_s
+	 */
+
+	double n_frames = dt_s * FRAMES_PER_SECOND;
+
+	Plant::update(dt_s, wind_speed_ratio, particle_pool_ptr);
+
+	// update angle
+	this->angle += 6 * (this->prod_GW / this->capacity_GW) * n_frames;
+
+	return;
+}	// end Wind::update()
+
+
 void Wind::drawFrame(bool selected, bool play_phase) {
 	/*
 	 *	Method to draw frame of Wind object
@@ -4549,14 +6222,14 @@ void Wind::drawFrame(bool selected, bool play_phase) {
 
 	// init
 	sf::Sprite body_sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 	std::vector<sf::Sprite> blade_sprite_vec;
 	for (int i = 0; i < 3; i++) {
 		blade_sprite_vec.push_back(
 			sf::Sprite(
-				*(this->assets_ptr->getTexture(this->texture_key)),
+				*(this->assets_ptr->getTexture(this->texture_id)),
 				sf::IntRect(0, this->height, this->width, this->height)
 			)
 		);
@@ -4611,13 +6284,8 @@ void Wind::drawFrame(bool selected, bool play_phase) {
 				6 * cos((2 * M_PI * this->pulse_frame) / FRAMES_PER_SECOND)
 			);
 		}
-
-		this->pulse_frame++;
 	}
 
-	// update angle
-	this->angle += 6 * (this->prod_GW / this->capacity_GW);
-
 	// draw and return
 	this->window_ptr->draw(body_sprite);
 	for (int i = 0; i < blade_sprite_vec.size(); i++) {
@@ -4634,7 +6302,6 @@ void Wind::drawFrame(bool selected, bool play_phase) {
 	if (play_phase) {
 		this->drawMusteredMarbles();
 	}
-	this->frame++;
 	return;
 }	// end Wind::drawFrame()
 
@@ -4644,37 +6311,14 @@ double Wind::getProduction(double wind_res_ms) {
 	 *	Method to compute and return wind production.
 	 */
 
-	if (wind_res_ms <= 0) {
-		wind_res_ms = 0;
-	}
-
 	// compute production based on derived dimensionless performance
-	double prod = 0;
-	double prod_GW = 0;
-	if (wind_res_ms > 0) {
-		double turb_speed = (wind_res_ms - this->design_speed_ms) /
-			this->design_speed_ms;
-
-		// look-up on dimensionless performance curve, get dimensionless production [ ]
-		if (turb_speed < -0.76 || turb_speed > 0.68) {
-			prod = 0;
-		} else if (turb_speed >= -0.76 && turb_speed <= 0) {
-			prod = 1.03273 * exp(-5.97588 * pow(turb_speed, 2)) -
-				0.03273;
-		} else {
-			prod = 0.16154 * exp(-9.30254 * pow(turb_speed, 2)) +
-				0.83846;
-		}
-	}
-	if (prod > 1) {
-		prod = 1;
-	}
-	prod_GW = this->capacity_GW * prod;
+	double prod_GW = this->capacity_GW *
+		windProductionRatio(wind_res_ms, this->design_speed_ms);
 
 	if (this->marble_counter < 128) {
 		for (int i = 0; i < round(prod_GW); i++) {
 			sf::Sprite* marble_sprite = new sf::Sprite(
-				*(this->assets_ptr->getTexture("marble"))
+				*(this->assets_ptr->getTexture(this->marble_texture_id))
 			);
 			marble_sprite->setTextureRect(sf::IntRect(0, 9 * 32, 32, 32));
 			marble_sprite->setColor(this->marble_colour);
@@ -4854,7 +6498,7 @@ void PhaseManager::nextValidIndex(std::vector<Plant*>* plant_ptr_vec){
 	// determine which points in vector are valid
 	std::vector <bool> is_index_valid;
 	for (int i = 0; i < plant_ptr_vec->size(); i++) {
-		if (plant_ptr_vec->at(i)->getTextureIndex() == -1){
+		if (plant_ptr_vec->at(i)->getKind() == PLANT_NULL){
 			is_index_valid.push_back(false);
 		}
 		else{
@@ -4883,7 +6527,7 @@ void PhaseManager::prevValidIndex(std::vector<Plant*>* plant_ptr_vec){
 	// determine which points in vector are valid
 	std::vector <bool> is_index_valid;
 	for (int i = 0; i < plant_ptr_vec->size(); i++) {
-		if (plant_ptr_vec->at(i)->getTextureIndex() == -1){
+		if (plant_ptr_vec->at(i)->getKind() == PLANT_NULL){
 			is_index_valid.push_back(false);
 		}
 		else{
@@ -4925,17 +6569,17 @@ void PhaseManager::incIndex(std::vector<Plant*> plant_ptr_vec){
 
 	// clear and re-build plant taboo list
 	this->plant_taboo_list.clear();
-	int texture_idx = 0;
+	PlantKind kind = PLANT_NULL;
 	for (int i = 0; i < plant_ptr_vec.size(); i++) {
 		// skip current position
 		if (i == this->index) {
 			continue;
 		}
 
-		// push back non-null texture indices
-		texture_idx = plant_ptr_vec[i]->getTextureIndex();
-		if (texture_idx >= 0) {
-			this->plant_taboo_list.push_back(texture_idx);
+		// push back non-null plant kinds
+		kind = plant_ptr_vec[i]->getKind();
+		if (kind != PLANT_NULL) {
+			this->plant_taboo_list.push_back(kind);
 		}
 	}
 
@@ -5034,17 +6678,17 @@ void PhaseManager::decIndex(std::vector<Plant*> plant_ptr_vec){
 
 	// clear and re-build plant taboo list
 	this->plant_taboo_list.clear();
-	int texture_idx = 0;
+	PlantKind kind = PLANT_NULL;
 	for (int i = 0; i < plant_ptr_vec.size(); i++) {
 		// skip current position
 		if (i == this->index) {
 			continue;
 		}
 
-		// push back non-null texture indices
-		texture_idx = plant_ptr_vec[i]->getTextureIndex();
-		if (texture_idx >= 0) {
-			this->plant_taboo_list.push_back(texture_idx);
+		// push back non-null plant kinds
+		kind = plant_ptr_vec[i]->getKind();
+		if (kind != PLANT_NULL) {
+			this->plant_taboo_list.push_back(kind);
 		}
 	}
 
@@ -5124,13 +6768,7 @@ void PhaseManager::decCapacityTokens(){
 
 
 int PhaseManager::hydroStorageTable(int GW_capacity){
-	std::vector<int> capacities = {16, 29, 40, 49, 56, 63, 70, 77, 84, 91, 98, 104, 110, 116, 122, 128, 134, 140};
-	if (GW_capacity > capacities.size()) {
-		return capacities.back();
-	}
-	else{
-		return capacities[capacity-1];
-	}
+	return hydroStorageGWh(GW_capacity);
 }	// end PhaseManager::hydroStorageTable(int)
 
 
@@ -5183,6 +6821,16 @@ PictorialTutorial::PictorialTutorial(
 	this->window_ptr = window_ptr;
 	this->assets_ptr = assets_ptr;
 
+	// resolve asset handles once (drawing is by handle)
+	for (size_t i = 0; i < this->texture_keys.size(); i++) {
+		this->texture_ids.push_back(
+			this->assets_ptr->internTexture(this->texture_keys[i])
+		);
+	}
+	this->wasd_texture_id = this->assets_ptr->internTexture("wasd");
+	this->spacebar_texture_id = this->assets_ptr->internTexture("spacebar");
+	this->bold_font_id = this->assets_ptr->internFont("bold");
+
 	// stream out and return
 	std::cout << "\nPictorialTutorial object created at " << this << "." << std::endl;
 	return;
@@ -5197,6 +6845,41 @@ void PictorialTutorial::reset(){
 } // end PictorialTutorial::reset()
 
 
+void PictorialTutorial::update(double dt_s) {
+	/*
+	*	Method to advance the highlighted sprites by dt_s (drawFrame() only
+	*	draws them)
+	*/
+
+	for (int i = 0; i < this->texture_ids.size(); i++) {
+		bool wasd_flag = this->texture_ids[i].idx == this->wasd_texture_id.idx;
+		bool spacebar_flag = this->texture_ids[i].idx == this->spacebar_texture_id.idx;
+
+		// advance highlighting
+		if (
+			(wasd_flag && (this->show_wasd_instructions_ad || this->show_wasd_instructions_ws)) ||
+			(spacebar_flag && this->show_spacebar_instructions)
+		) {
+			if (this->frame >= FRAMES_PER_BLIT) {
+				this->sprite_idx[i]++;
+				this->frame = 0;
+				if (this->sprite_idx[i] > this->n_sprites[i] - 1) {
+					this->sprite_idx[i] = 0;
+				}
+			}
+		}
+
+		// back to plain wasd
+		else if (wasd_flag) {
+			this->sprite_idx[i] = 0;
+		}
+	}
+	this->frame += dt_s * FRAMES_PER_SECOND;
+
+	return;
+}	// end PictorialTutorial::update()
+
+
 void PictorialTutorial::drawFrame(int phase) {
 	/*
 	*	Method to draw frame highlighting PictorialTutorial object
@@ -5204,20 +6887,20 @@ void PictorialTutorial::drawFrame(int phase) {
 
 	sf::Text info_txt(
 		"CONTROLS",
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		20
 	);
 
-	for (int i = 0; i < texture_keys.size(); i++) {
+	for (int i = 0; i < this->texture_ids.size(); i++) {
 
 		// init
 		sf::Sprite sprite(
-			*(this->assets_ptr->getTexture(this->texture_keys[i])),
+			*(this->assets_ptr->getTexture(this->texture_ids[i])),
 			sf::IntRect(0, 0, this->widths[i], this->heights[i])
 		);
 
 		// draw ad highlighting
-		if (this->show_wasd_instructions_ad && this->texture_keys[i] == "wasd") {
+		if (this->show_wasd_instructions_ad && this->texture_ids[i].idx == this->wasd_texture_id.idx) {
 			sprite.setTextureRect(
 				sf::IntRect(
 					0,
@@ -5226,19 +6909,12 @@ void PictorialTutorial::drawFrame(int phase) {
 					this->heights[i]
 				)
 			);
-			if (this->frame >= FRAMES_PER_BLIT) {
-				this->sprite_idx[i]++;
-				this->frame = 0;
-				if (this->sprite_idx[i] > this->n_sprites[i] - 1) {
-					this->sprite_idx[i] = 0;
-				}
-			}
 			// set text
 			info_txt.setString("MOVE LEFT AND RIGHT");
 		}
 
 		// draw ws highlighting
-		else if (this->show_wasd_instructions_ws && this->texture_keys[i] == "wasd") {
+		else if (this->show_wasd_instructions_ws && this->texture_ids[i].idx == this->wasd_texture_id.idx) {
 			sprite.setTextureRect(
 				sf::IntRect(
 					0,
@@ -5247,13 +6923,6 @@ void PictorialTutorial::drawFrame(int phase) {
 					this->heights[i]
 				)
 			);
-			if (this->frame >= FRAMES_PER_BLIT) {
-				this->sprite_idx[i]++;
-				this->frame = 0;
-				if (this->sprite_idx[i] > this->n_sprites[i] - 1) {
-					this->sprite_idx[i] = 0;
-				}
-			}
 
 			// set text
 			switch (phase) {
@@ -5271,20 +6940,8 @@ void PictorialTutorial::drawFrame(int phase) {
 			}
 
 		}
-		// draw wasd
-		else if (this->sprite_idx[i] != 0 && this->texture_keys[i] == "wasd") {
-			this->sprite_idx[i] = 0;
-			sprite.setTextureRect(
-				sf::IntRect(
-					0,
-					this->sprite_idx[i] * this->heights[i],
-					this->widths[i],
-					this->heights[i]
-				)
-			);
-		}
 		// draw spacebar
-		else if (this->show_spacebar_instructions && this->texture_keys[i] == "spacebar") {
+		else if (this->show_spacebar_instructions && this->texture_ids[i].idx == this->spacebar_texture_id.idx) {
 			sprite.setTextureRect(
 				sf::IntRect(
 					0,
@@ -5293,13 +6950,6 @@ void PictorialTutorial::drawFrame(int phase) {
 					this->heights[i]
 				)
 			);
-			if (this->frame >= FRAMES_PER_BLIT) {
-				this->sprite_idx[i]++;
-				this->frame = 0;
-				if (this->sprite_idx[i] > this->n_sprites[i] - 1) {
-					this->sprite_idx[i] = 0;
-				}
-			}
 
 			// set text
 			switch (phase) {
@@ -5324,13 +6974,14 @@ void PictorialTutorial::drawFrame(int phase) {
 		);
 
 		// draw sprite
-		if (this->texture_keys[i] != "spacebar" || this->show_spacebar_instructions) {
+		if (this->texture_ids[i].idx != this->spacebar_texture_id.idx || this->show_spacebar_instructions) {
 			this->window_ptr->draw(sprite);
 		}
 
 	}// end for each sprite
 
 	// draw descriptive text
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 20, info_txt.getString());
 	info_txt.setOrigin(
 		info_txt.getLocalBounds().width / 2,
 		info_txt.getLocalBounds().height / 2
@@ -5342,7 +6993,6 @@ void PictorialTutorial::drawFrame(int phase) {
 
 	this->window_ptr->draw(info_txt);
 
-	this->frame++;
 	return;
 }	// end PictorialTutorial::drawFrame()
 
@@ -5353,7 +7003,7 @@ void PictorialTutorial::update(PhaseManager* phase_manager, std::vector<Plant*>*
 			{
 				bool all_plants_selected = true;
 				for (int i = 0; i < plant_ptr_vec->size(); i++) {
-					if (plant_ptr_vec->at(i)->getTextureIndex() == -1) {
+					if (plant_ptr_vec->at(i)->getKind() == PLANT_NULL) {
 						all_plants_selected = false;
 					}
 				}
@@ -5417,6 +7067,11 @@ DiceRoll::DiceRoll(
 	this->window_ptr = window_ptr;
 	this->assets_ptr = assets_ptr;
 
+	// resolve asset handles once (drawing is by handle)
+	this->texture_id = this->assets_ptr->internTexture(this->texture_key);
+	this->spacebar_texture_id = this->assets_ptr->internTexture("spacebar");
+	this->bold_font_id = this->assets_ptr->internFont("bold");
+
 	// stream out and return
 	std::cout << "\nDiceRoll object created at " << this << "." << std::endl;
 	return;
@@ -5660,15 +7315,42 @@ bool DiceRoll::setGeothermalRolls(){
 
 void DiceRoll::randDiceNum(){
 	 // make value from 1-6 but not same as previous number to make animation smooth
-	 int temp =  rand() % 6 + 1;
+	 int temp = randomStream(RNG_DICE).uniformInt(1, 6);
 	 while (temp == this->dice_num) {
-		 temp =  rand() % 6 + 1;
+		 temp = randomStream(RNG_DICE).uniformInt(1, 6);
 	 }
 	this->dice_num = temp;
 	//std::cout << this->dice_num << std::endl;
 } // end DiceRoll::randDiceNum
 
 
+void DiceRoll::update(double dt_s, bool new_num) {
+	/*
+	*	Method to advance DiceRoll by dt_s (rolls a new number every blit
+	*	while rolling, so this is game state and not just animation)
+	*/
+
+	// handle frame events
+	if (this->frame >= FRAMES_PER_BLIT) {
+		this->spacebar_frame_idx++;
+		if (this->spacebar_frame_idx >= this->spacebar_frame_vec.size()) {
+			this->spacebar_frame_idx = 0;
+		}
+
+		if (new_num) {
+			this->randDiceNum();
+		}
+
+		this->sprite_idx = this->dice_num;
+
+		this->frame = 0;
+	}
+	this->frame += dt_s * FRAMES_PER_SECOND;
+
+	return;
+}	// end DiceRoll::update()
+
+
 void DiceRoll::drawFrame(bool new_num) {
 	/*
 	*	Method to draw frame of DiceRoll object
@@ -5676,57 +7358,57 @@ void DiceRoll::drawFrame(bool new_num) {
 
 	sf::Text info_txt(
 		"",
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		20
 	);
 
 	sf::Text info_txt_l(
 		"",
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		20
 	);
 
 	sf::Text info_txt_r(
 		"",
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		20
 	);
 
 	sf::Text spacebar_txt(
 		"",
-		*(this->assets_ptr->getFont("bold")),
+		*(this->assets_ptr->getFont(this->bold_font_id)),
 		20
 	);
 
 
 	// init
 	sf::Sprite sprite(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 
 	sf::Sprite sprite1(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 
 	sf::Sprite sprite2(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 
 	sf::Sprite sprite3(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 
 	sf::Sprite sprite4(
-		*(this->assets_ptr->getTexture(this->texture_key)),
+		*(this->assets_ptr->getTexture(this->texture_id)),
 		sf::IntRect(0, 0, this->width, this->height)
 	);
 
 	sf::Sprite spacebar_sprite(
-		*(this->assets_ptr->getTexture("spacebar"))
+		*(this->assets_ptr->getTexture(this->spacebar_texture_id))
 	);
 	int rolls_left_sum = 0;
 	for (int i = 0; i < this->rolls_left.size(); i++) {
@@ -5741,6 +7423,7 @@ void DiceRoll::drawFrame(bool new_num) {
 	else {
 		spacebar_txt.setString("START DRILLING (ROLL DICE)");
 	}
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 20, spacebar_txt.getString());
 	spacebar_sprite.setTextureRect(
 		sf::IntRect(
 			0,
@@ -5911,6 +7594,8 @@ void DiceRoll::drawFrame(bool new_num) {
 	// set text
 	info_txt_l.setString("                                       -                          \n\n                         SUCCESS: +1 GW");
 	info_txt_r.setString("                                       -                          \n\n                         FAILURE: +0 GW");
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 20, info_txt_l.getString());
+	this->assets_ptr->checkGlyphs(this->bold_font_id, 20, info_txt_r.getString());
 
 	// draw descriptive text
 
@@ -5942,23 +7627,6 @@ void DiceRoll::drawFrame(bool new_num) {
 	this->window_ptr->draw(spacebar_txt);
 
 
-	// handle frame events
-	if (this->frame >= FRAMES_PER_BLIT) {
-		this->spacebar_frame_idx++;
-		if (this->spacebar_frame_idx >= this->spacebar_frame_vec.size()) {
-			this->spacebar_frame_idx = 0;
-		}
-
-		if (new_num) {
-			this->randDiceNum();
-		}
-
-		this->sprite_idx = this->dice_num;
-
-		this->frame = 0;
-	}
-	this->frame++;
-
 	return;
 }	// end DiceRoll::drawFrame()
 
@@ -5977,7 +7645,7 @@ DiceRoll::~DiceRoll(void) {
 
 // ---- Game ---- //
 
-Game::Game(sf::RenderWindow* window_ptr) :
+Game::Game(sf::RenderWindow* window_ptr, AssetLoader* asset_loader_ptr) :
 key_vec(sf::Keyboard::KeyCount, false),
 assets(),
 phase_manager(),
@@ -5987,8 +7655,26 @@ overcast_clouds(window_ptr, &(this->assets)),
 foreground(window_ptr, &(this->assets)),
 music_player(&(this->assets), window_ptr),
 sky_disk(window_ptr, &(this->assets)),
+back_layer(window_ptr),
+front_layer(window_ptr),
+energy_chart(
+	"Energy Overlay",
+	"Hour of Day [\t]",
+	"Energy [GWh]",
+	HOURS_PER_GAME,
+	25,
+	window_ptr,
+	&(this->assets)
+),
 text_box(&(this->assets), window_ptr),
-wind_sock(window_ptr, &(this->assets))
+text_cache(&(this->assets), TEXT_CACHE_MAX_IDLE_FRAMES),
+wind_sock(window_ptr, &(this->assets)),
+marble_batch(window_ptr, &(this->assets)),
+particle_pool(PARTICLE_POOL_CAPACITY, window_ptr, &(this->assets)),
+forecast_kernel(FORECAST_TRIALS),
+forecast_analytic(),
+dispatch_solver(0),
+session_log()
 {
 	/*
 	 *	Constructor for Game class
@@ -5996,19 +7682,32 @@ wind_sock(window_ptr, &(this->assets))
 
 	// init attributes
 	this->draw_frame_rate = false;
+	this->idle_flag = false;
 	this->music_paused = false;
+	this->record_flag = false;
 	this->powered_flag = true;
 	this->draw_energy_overlay = false;
 	this->draw_forecast_overlay = false;
 	this->can_defer_load = true;
+	this->solving_flag = false;
+	this->solved_flag = false;
 	this->frame = 0;
 	this->rolls_rem_corr = 0;
+	this->session_mode = SESSION_OFF;
+	this->session_phase = -1;
+	this->replay_speed = 1;
+	this->n_replay_divergences = 0;
 	this->coal_marbles = 0;
 	this->combined_marbles = 0;
 	this->peaker_marbles = 0;
 	this->current_energy_demand_GWh = 0;
 	this->excess_dispatch_GWh = 0;
+	this->steps_since_render = 0;
+	this->time_str_minutes = -1;
+	this->last_active_frame = 0;
+	this->prefetch_phase = -1;
 	this->dt_s = 0;
+	this->clock_offset_s = 0;
 	this->frame_time_s = 0;
 	this->hour_of_day = 0;
 	this->next_hour_of_day = 0;
@@ -6022,8 +7721,13 @@ wind_sock(window_ptr, &(this->assets))
 	this->wave_res_s = 0;
 	this->next_wave_res_s = 0;
 	this->score = 0;
+	this->optimal_score = 0;
+	this->score_str_score = 0;
 	this->fade_alpha = 255;
 	this->points_str = "";
+	this->score_str = "";
+	this->time_str = "";
+	this->session_path = "";
 
 	this->forecast_map["demand GWh"] = 0;
 	this->forecast_map["solar forecast GWh"] = 0;
@@ -6036,6 +7740,7 @@ wind_sock(window_ptr, &(this->assets))
 	this->forecast_map["wind forecast error GWh"] = 0;
 
 	this->window_ptr = window_ptr;
+	this->frame_pacer.setVerticalSync(this->window_ptr, true);
 
 	sf::RectangleShape black_rect(sf::Vector2f(SCREEN_WIDTH, SCREEN_HEIGHT));
 	black_rect.setFillColor(sf::Color(0, 0, 0, 255));
@@ -6049,7 +7754,7 @@ wind_sock(window_ptr, &(this->assets))
 		20, 18, 17, 15, 14
 	};
 
-	this->tidal_idx_offset = round(23 * (double)rand() / RAND_MAX);
+	this->tidal_idx_offset = round(23 * randomStream(RNG_TIDAL).uniform());
 	this->tidal_res_ms_vec = {
 		0.125, 0.279, 0.265, 0.106, 0.076, 0.221,
 		0.645, 0.918, 1,     0.913, 0.744, 0.487,
@@ -6061,142 +7766,21 @@ wind_sock(window_ptr, &(this->assets))
 
 	// sf::Font
 	{
-		this->assets.loadFont("assets/font/Roboto-Thin.ttf", "teletype");
-		this->assets.loadFont("assets/font/OpenSans-Bold.ttf", "bold");
+		this->teletype_font_id =
+			this->assets.loadFont("assets/font/Roboto-Thin.ttf", "teletype");
+		this->bold_font_id =
+			this->assets.loadFont("assets/font/OpenSans-Bold.ttf", "bold");
 	}
 
-	sf::Text loading_text(
-		"Loading ...",
-		*(this->assets.getFont("bold")),
-		32
-	);
-	loading_text.setOrigin(
-		loading_text.getLocalBounds().width / 2,
-		loading_text.getLocalBounds().height / 2
-	);
-	loading_text.setPosition(
-		SCREEN_WIDTH / 2,
-		SCREEN_HEIGHT / 2
-	);
-	this->window_ptr->draw(loading_text);
-	this->window_ptr->display();
-
-	// sf::Texture
-	{
-		// in-play assets
-		this->assets.loadTexture("assets/sheets/capacity_token_32x32_1fr.png", "capacity token");
-		this->assets.loadTexture("assets/sheets/clock_32x32_3fr.png", "clock");
-		this->assets.loadTexture("assets/sheets/clouds_64x32_6fr.png", "clouds");
-		this->assets.loadTexture("assets/sheets/coal_128x128_9fr.png", "coal");
-		this->assets.loadTexture("assets/sheets/combined_128x128_9fr.png", "combined");
-		this->assets.loadTexture("assets/sheets/emissions_8x8_2fr.png", "emissions");
-		this->assets.loadTexture("assets/sheets/energy_demand_32x32_1fr.png", "energy demand");
-		this->assets.loadTexture("assets/sheets/fission_128x128_9fr.png", "fission");
-		this->assets.loadTexture("assets/sheets/foreground_640x480_3fr.png", "foreground");
-		this->assets.loadTexture("assets/sheets/geothermal_128x128_9fr.png", "geothermal");
-		this->assets.loadTexture("assets/sheets/hydro_128x128_5fr.png", "hydro");
-		this->assets.loadTexture("assets/sheets/marble_32x32_19fr.png", "marble");
-		this->assets.loadTexture("assets/images/MM_256x116.png", "MM logo");
-		this->assets.loadTexture("assets/sheets/overcast_640x480_1fr.png", "overcast");
-		this->assets.loadTexture("assets/sheets/peaker_128x128_7fr.png", "peaker");
-		this->assets.loadTexture("assets/sheets/power_cap_32x32_1fr.png", "power capacity");
-		this->assets.loadTexture("assets/sheets/price_per_GW_32x32_1fr.png", "price per GW");
-		this->assets.loadTexture("assets/sheets/skydisk_960x960_2fr.png", "sky disk");
-		this->assets.loadTexture("assets/sheets/solar_128x128_1fr.png", "solar");
-		this->assets.loadTexture("assets/sheets/storage_128x128_1fr.png", "storage");
-		this->assets.loadTexture("assets/sheets/tidal_128x128_2fr.png", "tidal");
-		this->assets.loadTexture("assets/sheets/wave_128x128_3fr.png", "wave");
-		this->assets.loadTexture("assets/sheets/wind_128x128_2fr.png", "wind");
-		this->assets.loadTexture("assets/sheets/wind_sock_48x64_2fr.png", "wind sock");
-		this->assets.loadTexture("assets/sheets/wasd_256x256_9fr.png", "wasd");
-		this->assets.loadTexture("assets/sheets/spacebar_512x128_5fr.png", "spacebar");
-		this->assets.loadTexture("assets/sheets/dice_32x32_6fr.png", "dice");
-
-		// selection assets
-		this->assets.loadTexture("assets/sheets/blank_128x128_1fr.png", "blank");
-		this->assets.loadTexture("assets/sheets/null_128x128_1fr.png", "null");
-		this->assets.loadTexture("assets/sheets/null_green_128x128_1fr.png", "null green");
-		this->assets.loadTexture("assets/sheets/tidal_128x128_1fr.png", "tidal selection");
-		this->assets.loadTexture("assets/sheets/wave_128x128_1fr.png", "wave selection");
-		this->assets.loadTexture("assets/sheets/wind_128x128_1fr.png", "wind selection");
+	// sf::Texture, sf::Sound (decoded in the background, see AssetLoader)
+	if (asset_loader_ptr != NULL) {
+		this->loadAssets(asset_loader_ptr);
 	}
 
-	// sf::Sound
-	{
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-electronics-power-up-2602.ogg",
-			"powering up"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/power-down.ogg",
-			"powering down"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-quick-lock-sound-2854.ogg",
-			"A D key"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-computer-digital-lock-2859.ogg",
-			"S key"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/W-key.ogg",
-			"W key"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-magical-coin-win-1936.ogg",
-			"capacity token"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/token-return.ogg",
-			"token return"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-synthetic-power-bass-transition-2296.ogg",
-			"dispatch"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-arcade-retro-changing-tab-206.ogg",
-			"P key"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-positive-notification-951.ogg",
-			"transition complete"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-melodic-clock-strike-1057.ogg",
-			"clock chime"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-single-book-paging-1101.ogg",
-			"page right"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/page-left.ogg",
-			"page left"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-quick-paper-crumple-sound-2996.ogg",
-			"paper crumple"
-		);
-
-		this->assets.loadSound(
-			"assets/audio/samples/mixkit-apartment-buzzer-bell-press-932.ogg",
-			"buzzer"
-		);
+	else {
+		AssetLoader asset_loader(0);
+		Game::queueAssets(&asset_loader);
+		this->loadAssets(&asset_loader);
 	}
 
 	// sf::Music
@@ -6251,44 +7835,252 @@ wind_sock(window_ptr, &(this->assets))
 	this->sky_disk.buildSprites();
 	this->wind_sock.buildSprites();
 
-	sf::Vector2f scale;
-	double scalar = 1.5;
+	sf::Vector2f scale;
+	double scalar = 1.5;
+
+	this->capacity_token_sprite.setTexture(*(this->assets.getTexture("capacity token")));
+	this->capacity_token_sprite.setOrigin(16, 16);
+	scale = this->capacity_token_sprite.getScale();
+	this->capacity_token_sprite.setScale(scalar * scale.x, scalar * scale.y);
+
+	this->energy_demand_sprite.setTexture(*(this->assets.getTexture("energy demand")));
+	this->energy_demand_sprite.setOrigin(16, 16);
+	scale = this->energy_demand_sprite.getScale();
+	this->energy_demand_sprite.setScale(scalar * scale.x, scalar * scale.y);
+
+	this->clock_face_sprite.setTexture(*(this->assets.getTexture("clock")));
+	this->clock_face_sprite.setTextureRect(sf::IntRect(0, 0, 32, 32));
+	this->clock_face_sprite.setOrigin(16, 16);
+	scale = this->clock_face_sprite.getScale();
+	this->clock_face_sprite.setScale(scalar * scale.x, scalar * scale.y);
+
+	this->clock_minute_sprite.setTexture(*(this->assets.getTexture("clock")));
+	this->clock_minute_sprite.setTextureRect(sf::IntRect(0, 32, 32, 32));
+	this->clock_minute_sprite.setOrigin(16, 16);
+	scale = this->clock_minute_sprite.getScale();
+	this->clock_minute_sprite.setScale(scalar * scale.x, scalar * scale.y);
+
+	this->clock_hour_sprite.setTexture(*(this->assets.getTexture("clock")));
+	this->clock_hour_sprite.setTextureRect(sf::IntRect(0, 64, 32, 32));
+	this->clock_hour_sprite.setOrigin(16, 16);
+	scale = this->clock_hour_sprite.getScale();
+	this->clock_hour_sprite.setScale(scalar * scale.x, scalar * scale.y);
+
+	// frame rate overlay text (string changes every frame, so kept out of text_cache)
+	this->frame_rate_text.setFont(*(this->assets.getFont(this->teletype_font_id)));
+	this->frame_rate_text.setCharacterSize(12);
+
+	// init plant_ptr_vec with 6x base class (as "null plant")
+	this->initPlants();
+
+	// stream out and return
+	std::cout << "\nGame object created at " << this << "." << std::endl;
+	return;
+}	// end Game::Game()
+
+
+void Game::queueAssets(AssetLoader* asset_loader_ptr) {
+	/*
+	 *	Method to queue the game's textures and sounds on the given loader
+	 *	(static, so that main() can start decoding before Game exists); those
+	 *	used only in some phases are registered lazily instead (see
+	 *	loadAssets())
+	 */
+
+	// sf::Texture
+	// in-play assets
+	asset_loader_ptr->queueTexture("assets/sheets/capacity_token_32x32_1fr.png", "capacity token");
+	asset_loader_ptr->queueTexture("assets/sheets/clock_32x32_3fr.png", "clock");
+	asset_loader_ptr->queueTexture("assets/sheets/clouds_64x32_6fr.png", "clouds");
+	asset_loader_ptr->queueTexture("assets/sheets/coal_128x128_9fr.png", "coal");
+	asset_loader_ptr->queueTexture("assets/sheets/combined_128x128_9fr.png", "combined");
+	asset_loader_ptr->queueTexture("assets/sheets/emissions_8x8_2fr.png", "emissions");
+	asset_loader_ptr->queueTexture("assets/sheets/energy_demand_32x32_1fr.png", "energy demand");
+	asset_loader_ptr->queueTexture("assets/sheets/fission_128x128_9fr.png", "fission");
+	asset_loader_ptr->queueTexture("assets/sheets/foreground_640x480_3fr.png", "foreground");
+	asset_loader_ptr->queueTexture("assets/sheets/geothermal_128x128_9fr.png", "geothermal");
+	asset_loader_ptr->queueTexture("assets/sheets/hydro_128x128_5fr.png", "hydro");
+	asset_loader_ptr->queueTexture("assets/sheets/marble_32x32_19fr.png", "marble");
+	asset_loader_ptr->queueTexture("assets/images/MM_256x116.png", "MM logo");
+	asset_loader_ptr->queueTexture("assets/sheets/overcast_640x480_1fr.png", "overcast");
+	asset_loader_ptr->queueTexture("assets/sheets/peaker_128x128_7fr.png", "peaker");
+	asset_loader_ptr->queueTexture("assets/sheets/power_cap_32x32_1fr.png", "power capacity");
+	asset_loader_ptr->queueTexture("assets/sheets/price_per_GW_32x32_1fr.png", "price per GW");
+	asset_loader_ptr->queueTexture("assets/sheets/skydisk_960x960_2fr.png", "sky disk");
+	asset_loader_ptr->queueTexture("assets/sheets/solar_128x128_1fr.png", "solar");
+	asset_loader_ptr->queueTexture("assets/sheets/storage_128x128_1fr.png", "storage");
+	asset_loader_ptr->queueTexture("assets/sheets/tidal_128x128_2fr.png", "tidal");
+	asset_loader_ptr->queueTexture("assets/sheets/wave_128x128_3fr.png", "wave");
+	asset_loader_ptr->queueTexture("assets/sheets/wind_128x128_2fr.png", "wind");
+	asset_loader_ptr->queueTexture("assets/sheets/wind_sock_48x64_2fr.png", "wind sock");
+
+	// selection assets
+	asset_loader_ptr->queueTexture("assets/sheets/blank_128x128_1fr.png", "blank");
+	asset_loader_ptr->queueTexture("assets/sheets/null_128x128_1fr.png", "null");
+	asset_loader_ptr->queueTexture("assets/sheets/null_green_128x128_1fr.png", "null green");
+
+	// sf::Sound
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/mixkit-quick-lock-sound-2854.ogg",
+		"A D key"
+	);
+
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/mixkit-computer-digital-lock-2859.ogg",
+		"S key"
+	);
+
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/W-key.ogg",
+		"W key"
+	);
+
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/mixkit-arcade-retro-changing-tab-206.ogg",
+		"P key"
+	);
+
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/mixkit-single-book-paging-1101.ogg",
+		"page right"
+	);
+
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/page-left.ogg",
+		"page left"
+	);
+
+	asset_loader_ptr->queueSound(
+		"assets/audio/samples/mixkit-quick-paper-crumple-sound-2996.ogg",
+		"paper crumple"
+	);
+
+	return;
+}	// end Game::queueAssets()
+
+
+void Game::loadAssets(AssetLoader* asset_loader_ptr) {
+	/*
+	 *	Method to upload the given loader's assets, a budget per frame, while
+	 *	drawing loading progress; then pack the atlas and resolve handles
+	 */
+
+	int frame = 0;
+	sf::Clock clock;
+	sf::Text loading_text("", *(this->assets.getFont(this->bold_font_id)), 32);
+
+	sf::RectangleShape bar_frame(sf::Vector2f(SCREEN_WIDTH / 3, 8));
+	bar_frame.setOrigin(SCREEN_WIDTH / 6, 4);
+	bar_frame.setPosition(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 48);
+	bar_frame.setFillColor(sf::Color(0, 0, 0, 255));
+	bar_frame.setOutlineColor(sf::Color(255, 255, 255, 255));
+	bar_frame.setOutlineThickness(1);
+
+	sf::RectangleShape bar_fill(sf::Vector2f(0, 8));
+	bar_fill.setPosition(SCREEN_WIDTH / 3, SCREEN_HEIGHT / 2 + 44);
+	bar_fill.setFillColor(sf::Color(255, 255, 255, 255));
+
+	asset_loader_ptr->start();
+
+	while (!asset_loader_ptr->isFinished()) {
+		asset_loader_ptr->upload(&(this->assets), ASSET_UPLOAD_BUDGET_S);
+
+		double progress = asset_loader_ptr->getProgress();
+
+		std::stringstream loading_ss;
+		loading_ss << "Loading ...  " << int(100 * progress) << " %";
+		loading_text.setString(loading_ss.str());
+		loading_text.setOrigin(
+			loading_text.getLocalBounds().width / 2,
+			loading_text.getLocalBounds().height / 2
+		);
+		loading_text.setPosition(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+
+		bar_fill.setSize(sf::Vector2f(progress * SCREEN_WIDTH / 3, 8));
+
+		this->window_ptr->clear();
+		this->window_ptr->draw(loading_text);
+		this->window_ptr->draw(bar_frame);
+		this->window_ptr->draw(bar_fill);
+		this->window_ptr->display();
+
+		frame++;
+		this->frame_pacer.waitUntil(
+			frame * SECONDS_PER_FRAME,
+			clock.getElapsedTime().asSeconds()
+		);
+	}
+
+	// pack the sheets drawn in batches into atlas pages (see MarbleBatch,
+	// ParticlePool, and Assets::getRegion())
+	this->assets.buildAtlas({"emissions", "marble"}, ATLAS_PAGE_SIZE, ATLAS_PADDING);
 
-	this->capacity_token_sprite.setTexture(*(this->assets.getTexture("capacity token")));
-	this->capacity_token_sprite.setOrigin(16, 16);
-	scale = this->capacity_token_sprite.getScale();
-	this->capacity_token_sprite.setScale(scalar * scale.x, scalar * scale.y);
+	// rasterize glyphs for every (font, size) drawn, so no text's first
+	// appearance rasterizes mid-frame (text boxes: 0.015 and 0.02 * SCREEN_HEIGHT)
+	std::vector<unsigned int> bold_size_vec = {
+		(unsigned int)(0.015 * SCREEN_HEIGHT), 16, 18,
+		(unsigned int)(0.02 * SCREEN_HEIGHT), 20, 24, 30, 32
+	};
+	std::vector<unsigned int> teletype_size_vec = {12, 16, 20, 24, 32};
 
-	this->energy_demand_sprite.setTexture(*(this->assets.getTexture("energy demand")));
-	this->energy_demand_sprite.setOrigin(16, 16);
-	scale = this->energy_demand_sprite.getScale();
-	this->energy_demand_sprite.setScale(scalar * scale.x, scalar * scale.y);
+	int n_glyphs = 0;
+	for (size_t i = 0; i < bold_size_vec.size(); i++) {
+		n_glyphs += this->assets.warmGlyphs(this->bold_font_id, bold_size_vec[i]);
+	}
+	for (size_t i = 0; i < teletype_size_vec.size(); i++) {
+		n_glyphs += this->assets.warmGlyphs(this->teletype_font_id, teletype_size_vec[i]);
+	}
 
-	this->clock_face_sprite.setTexture(*(this->assets.getTexture("clock")));
-	this->clock_face_sprite.setTextureRect(sf::IntRect(0, 0, 32, 32));
-	this->clock_face_sprite.setOrigin(16, 16);
-	scale = this->clock_face_sprite.getScale();
-	this->clock_face_sprite.setScale(scalar * scale.x, scalar * scale.y);
+	std::cout << "\tglyph warmup: " << n_glyphs << " glyphs over " <<
+		bold_size_vec.size() + teletype_size_vec.size() << " font sizes, " <<
+		this->assets.getGlyphPageBytes() / 1024 << " KB of glyph pages" << std::endl;
 
-	this->clock_minute_sprite.setTexture(*(this->assets.getTexture("clock")));
-	this->clock_minute_sprite.setTextureRect(sf::IntRect(0, 32, 32, 32));
-	this->clock_minute_sprite.setOrigin(16, 16);
-	scale = this->clock_minute_sprite.getScale();
-	this->clock_minute_sprite.setScale(scalar * scale.x, scalar * scale.y);
+	// register phase specific assets lazily (loaded on first fetch, prefetched
+	// on phase changes, evicted when cold; see prefetchAssets())
+	this->assets.registerTexture("assets/sheets/wasd_256x256_9fr.png", "wasd");
+	this->assets.registerTexture("assets/sheets/spacebar_512x128_5fr.png", "spacebar");
+	this->assets.registerTexture("assets/sheets/dice_32x32_6fr.png", "dice");
+	this->assets.registerTexture("assets/sheets/tidal_128x128_1fr.png", "tidal selection");
+	this->assets.registerTexture("assets/sheets/wave_128x128_1fr.png", "wave selection");
+	this->assets.registerTexture("assets/sheets/wind_128x128_1fr.png", "wind selection");
 
-	this->clock_hour_sprite.setTexture(*(this->assets.getTexture("clock")));
-	this->clock_hour_sprite.setTextureRect(sf::IntRect(0, 64, 32, 32));
-	this->clock_hour_sprite.setOrigin(16, 16);
-	scale = this->clock_hour_sprite.getScale();
-	this->clock_hour_sprite.setScale(scalar * scale.x, scalar * scale.y);
+	this->assets.registerSound(
+		"assets/audio/samples/mixkit-electronics-power-up-2602.ogg",
+		"powering up"
+	);
+	this->assets.registerSound("assets/audio/samples/power-down.ogg", "powering down");
+	this->assets.registerSound(
+		"assets/audio/samples/mixkit-magical-coin-win-1936.ogg",
+		"capacity token"
+	);
+	this->assets.registerSound("assets/audio/samples/token-return.ogg", "token return");
+	this->assets.registerSound(
+		"assets/audio/samples/mixkit-synthetic-power-bass-transition-2296.ogg",
+		"dispatch"
+	);
+	this->assets.registerSound(
+		"assets/audio/samples/mixkit-positive-notification-951.ogg",
+		"transition complete"
+	);
+	this->assets.registerSound(
+		"assets/audio/samples/mixkit-melodic-clock-strike-1057.ogg",
+		"clock chime"
+	);
+	this->assets.registerSound(
+		"assets/audio/samples/mixkit-apartment-buzzer-bell-press-932.ogg",
+		"buzzer"
+	);
 
-	// init plant_ptr_vec with 6x base class (as "null plant")
-	this->initPlants();
+	// resolve handles drawn by Game every frame
+	this->energy_demand_texture_id = this->assets.internTexture("energy demand");
+	this->logo_texture_id = this->assets.internTexture("MM logo");
+	this->solar_texture_id = this->assets.internTexture("solar");
+	this->tidal_texture_id = this->assets.internTexture("tidal selection");
+	this->wave_texture_id = this->assets.internTexture("wave selection");
+	this->wind_texture_id = this->assets.internTexture("wind selection");
 
-	// stream out and return
-	std::cout << "\nGame object created at " << this << "." << std::endl;
 	return;
-}	// end Game::Game()
+}	// end Game::loadAssets()
 
 
 void Game::renderTitle(void) {
@@ -6312,7 +8104,7 @@ void Game::renderTitle(void) {
 	sf::RectangleShape black_rect(sf::Vector2f(SCREEN_WIDTH, SCREEN_HEIGHT));
 	black_rect.setFillColor(sf::Color(0, 0, 0, black_rect_alpha));
 
-	sf::Sprite MM_logo(*(this->assets.getTexture("MM logo")));
+	sf::Sprite MM_logo(*(this->assets.getTexture(this->logo_texture_id)));
 	MM_logo.setOrigin(
 		MM_logo.getLocalBounds().width / 2,
 		MM_logo.getLocalBounds().height / 2
@@ -6322,9 +8114,10 @@ void Game::renderTitle(void) {
 		SCREEN_HEIGHT / 2
 	);
 
+	this->assets.checkGlyphs(this->bold_font_id, 32, "Press any key to play");
 	sf::Text blink_instructions(
 		"Press any key to play",
-		*(this->assets.getFont("bold")),
+		*(this->assets.getFont(this->bold_font_id)),
 		32
 	);
 	blink_instructions.setOrigin(
@@ -6397,13 +8190,28 @@ void Game::renderTitle(void) {
 	// animation (blocking while loop)
 	while (this->window_ptr->isOpen() && !animation_finished) {
 		// mark time
-		this->time_since_run_s = this->clock.getElapsedTime().asSeconds();
+		this->time_since_run_s = this->getRunTimeSeconds();
 
 		// if clock tick
 		if (
 			this->time_since_run_s >= (this->frame + 1) * SECONDS_PER_FRAME
 		) {
-			// state dependent animation
+			// update scene (one fixed step, while shown)
+			if (animation_state > 0 && animation_state < 4) {
+				this->overcast_clouds.update(SECONDS_PER_FRAME, wind_speed_ratio);
+				this->wind_sock.update(SECONDS_PER_FRAME, wind_speed_ratio);
+				for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
+					this->plant_ptr_vec[i]->update(
+						SECONDS_PER_FRAME,
+						wind_speed_ratio,
+						&(this->particle_pool)
+					);
+				}
+				this->particle_pool.update(SECONDS_PER_FRAME, wind_speed_ratio);
+			}
+
+			// state dependent animation (title renders every step, so no
+			// interpolation)
 			switch (animation_state) {
 				case (0):	// fade in
 					this->window_ptr->clear();
@@ -6445,26 +8253,25 @@ void Game::renderTitle(void) {
 					}
 
 					//	sky disk
-					this->sky_disk.drawFrame(hour_of_day);
+					this->sky_disk.drawFrame(hour_of_day, this->window_ptr);
 
 					//	overcast and clouds
 					this->overcast_clouds.drawFrame(
-						wind_speed_ratio,
 						cloud_cover_ratio,
-						hour_of_day
+						hour_of_day,
+						1
 					);
 
 					// foreground + Plinko City
-					this->foreground.drawFrame(true, hour_of_day);
+					this->foreground.drawFrame(true, hour_of_day, this->window_ptr);
 
 					// wind sock
-					this->wind_sock.drawFrame(wind_speed_ratio, hour_of_day);
+					this->wind_sock.drawFrame(hour_of_day);
 
 					// draw objects
+					this->particle_pool.drawFrame(1);
 					for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 						//this->plant_ptr_vec[i]->drawMarbles();
-						this->plant_ptr_vec[i]->drawSteam(wind_speed_ratio);
-						this->plant_ptr_vec[i]->drawSmoke(wind_speed_ratio);
 						this->plant_ptr_vec[i]->drawFrame(false, false);
 					}
 
@@ -6485,26 +8292,25 @@ void Game::renderTitle(void) {
 					this->window_ptr->clear();
 
 					//	sky disk
-					this->sky_disk.drawFrame(hour_of_day);
+					this->sky_disk.drawFrame(hour_of_day, this->window_ptr);
 
 					//	overcast and clouds
 					this->overcast_clouds.drawFrame(
-						wind_speed_ratio,
 						cloud_cover_ratio,
-						hour_of_day
+						hour_of_day,
+						1
 					);
 
 					// foreground + Plinko City
-					this->foreground.drawFrame(true, hour_of_day);
+					this->foreground.drawFrame(true, hour_of_day, this->window_ptr);
 
 					// wind sock
-					this->wind_sock.drawFrame(wind_speed_ratio, hour_of_day);
+					this->wind_sock.drawFrame(hour_of_day);
 
 					// draw objects
+					this->particle_pool.drawFrame(1);
 					for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 						//this->plant_ptr_vec[i]->drawMarbles();
-						this->plant_ptr_vec[i]->drawSteam(wind_speed_ratio);
-						this->plant_ptr_vec[i]->drawSmoke(wind_speed_ratio);
 						this->plant_ptr_vec[i]->drawFrame(false, false);
 					}
 
@@ -6527,26 +8333,25 @@ void Game::renderTitle(void) {
 					}
 
 					//	sky disk
-					this->sky_disk.drawFrame(hour_of_day);
+					this->sky_disk.drawFrame(hour_of_day, this->window_ptr);
 
 					//	overcast and clouds
 					this->overcast_clouds.drawFrame(
-						wind_speed_ratio,
 						cloud_cover_ratio,
-						hour_of_day
+						hour_of_day,
+						1
 					);
 
 					// foreground + Plinko City
-					this->foreground.drawFrame(true, hour_of_day);
+					this->foreground.drawFrame(true, hour_of_day, this->window_ptr);
 
 					// wind sock
-					this->wind_sock.drawFrame(wind_speed_ratio, hour_of_day);
+					this->wind_sock.drawFrame(hour_of_day);
 
 					// draw objects
+					this->particle_pool.drawFrame(1);
 					for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 						//this->plant_ptr_vec[i]->drawMarbles();
-						this->plant_ptr_vec[i]->drawSteam(wind_speed_ratio);
-						this->plant_ptr_vec[i]->drawSmoke(wind_speed_ratio);
 						this->plant_ptr_vec[i]->drawFrame(false, false);
 					}
 
@@ -6576,7 +8381,7 @@ void Game::renderTitle(void) {
 			}
 
 			// handle events
-			while (this->window_ptr->pollEvent(event)) {
+			while (this->pollEvent(&event)) {
 				switch (event.type) {
 					case (sf::Event::Closed):	// receive "close window" signal
 						this->window_ptr->close();
@@ -6603,7 +8408,7 @@ void Game::renderTitle(void) {
 			}
 
 			// flip display, increment frame, increment hour_of_day
-			this->window_ptr->display();
+			this->displayFrame();
 			this->frame++;
 			hour_of_day += 0.5 / FRAMES_PER_SECOND;
 
@@ -6622,6 +8427,9 @@ void Game::renderTitle(void) {
 			}
 			this->plant_ptr_vec[3]->getProduction(solar_res_kWm2);
 		}
+
+		// sleep until next clock tick
+		this->waitNextStep();
 	}
 
 	this->clearPlants();
@@ -6638,7 +8446,7 @@ void Game::handleEvents(void) {
 	sf::Event event;
 
 	// while there is an event left to handle ...
-	while (this->window_ptr->pollEvent(event))
+	while (this->pollEvent(&event))
 	{
 		switch (event.type) {
 			case (sf::Event::Closed):	// receive "close window" signal
@@ -6787,50 +8595,50 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 			// display plant information
 			case (sf::Keyboard::I):
 				{
-					int texture_key = this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex();
+					PlantKind kind = this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind();
 					std::string feed_str = "";
-					switch (texture_key) {
-						case (0):	// Coal
+					switch (kind) {
+						case (PLANT_COAL):
 							feed_str = TEXT_COAL;
 							break;
 
-						case (1):	// Combined
+						case (PLANT_COMBINED):
 							feed_str = TEXT_COMBINED;
 							break;
 
-						case (2):	// Fission
+						case (PLANT_FISSION):
 							feed_str = TEXT_FISSION;
 							break;
 
-						case (3):	// Geothermal
+						case (PLANT_GEOTHERMAL):
 							feed_str = TEXT_GEOTHERMAL;
 							break;
 
-						case (4):	// Hydro
+						case (PLANT_HYDRO):
 							feed_str = TEXT_HYDRO;
 							break;
 
-						case (5):	// Peaker
+						case (PLANT_PEAKER):
 							feed_str = TEXT_PEAKER;
 							break;
 
-						case (6):	// Solar
+						case (PLANT_SOLAR):
 							feed_str = TEXT_SOLAR;
 							break;
 
-						case (7):	// Storage
+						case (PLANT_STORAGE):
 							feed_str = TEXT_STORAGE;
 							break;
 
-						case (8):	// Tidal
+						case (PLANT_TIDAL):
 							feed_str = TEXT_TIDAL;
 							break;
 
-						case (9):	// Wave
+						case (PLANT_WAVE):
 							feed_str = TEXT_WAVE;
 							break;
 
-						case (10):	// Wind
+						case (PLANT_WIND):
 							feed_str = TEXT_WIND;
 							break;
 
@@ -6923,8 +8731,8 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							int total_dispatch_GWh = 0;
 							double smog_ratio = this->smog_ratio;
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-								int texture_key = this->plant_ptr_vec[i]->getTextureIndex();
-								if (texture_key < 0) {
+								PlantKind kind = this->plant_ptr_vec[i]->getKind();
+								if (kind == PLANT_NULL) {
 									continue;
 								}
 
@@ -6937,34 +8745,32 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 									this->plant_ptr_vec[i]->setPulseFlag(true);
 								}
 
-								switch (texture_key) {
-									case (0):	// Coal
+								// emissions
+								const PlantDescriptor& descriptor = plantDescriptor(kind);
+								if (descriptor.emission_points > 0) {
+									this->score -= descriptor.emission_points * this->plant_ptr_vec[i]->getMusteredMarbles();
+									smog_ratio += descriptor.smog_per_marble * this->plant_ptr_vec[i]->getMusteredMarbles();
+								}
+
+								switch (kind) {
+									case (PLANT_COAL):
 										this->coal_marbles += this->plant_ptr_vec[i]->getMusteredMarbles();
-										this->score -= this->plant_ptr_vec[i]->getMusteredMarbles();
-										smog_ratio += 0.001 * this->plant_ptr_vec[i]->getMusteredMarbles();
 										break;
-									case (1):	// Combined
+									case (PLANT_COMBINED):
 										this->combined_marbles += this->plant_ptr_vec[i]->getMusteredMarbles();
-										this->score -= 0.5 * this->plant_ptr_vec[i]->getMusteredMarbles();
-										smog_ratio += 0.0005 * this->plant_ptr_vec[i]->getMusteredMarbles();
 										break;
-									case (5):	// Peaker
+									case (PLANT_PEAKER):
 										this->peaker_marbles += this->plant_ptr_vec[i]->getMusteredMarbles();
-										this->score -= 0.75 * this->plant_ptr_vec[i]->getMusteredMarbles();
-										smog_ratio += 0.00075 * this->plant_ptr_vec[i]->getMusteredMarbles();
 										break;
 									default:
 										// do nothing!
 										break;
 								}
 							}
-							if (total_dispatch_GWh >= this->current_energy_demand_GWh) {
-								this->score += this->current_energy_demand_GWh;
-							}
-							else {
-								this->score += total_dispatch_GWh -
-									this->current_energy_demand_GWh;
-							}
+							this->score += demandPoints(
+								total_dispatch_GWh,
+								this->current_energy_demand_GWh
+							);
 							if (total_dispatch_GWh > 0) {
 								this->assets.getSound("dispatch")->play();
 							}
@@ -6975,8 +8781,8 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 							// commit marbles
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-								int texture_key = this->plant_ptr_vec[i]->getTextureIndex();
-								if (texture_key < 0) {
+								PlantKind kind = this->plant_ptr_vec[i]->getKind();
+								if (kind == PLANT_NULL) {
 									continue;
 								}
 								this->plant_ptr_vec[i]->commitMarbles();
@@ -7020,8 +8826,8 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 									if (excess_dispatch_GWh <= 0) {
 										break;
 									}
-									int texture_key = this->plant_ptr_vec[i]->getTextureIndex();
-									if (texture_key == 7) {
+									PlantKind kind = this->plant_ptr_vec[i]->getKind();
+									if (kind == PLANT_STORAGE) {
 										double excess_before_GWh = excess_dispatch_GWh;
 										excess_dispatch_GWh =
 											this->plant_ptr_vec[i]->commitCharge(excess_dispatch_GWh);
@@ -7200,40 +9006,34 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							// compute renewable production
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 								if (	// Solar
-									this->plant_ptr_vec[i]->getTextureIndex() == 6
+									this->plant_ptr_vec[i]->getKind() == PLANT_SOLAR
 								) {
 									this->plant_ptr_vec[i]->getProduction(
 										this->generateSolarResource()
 									);
 								}
 								else if (	// Tidal
-									this->plant_ptr_vec[i]->getTextureIndex() == 8
+									this->plant_ptr_vec[i]->getKind() == PLANT_TIDAL
 								) {
-									double tidal_res_ms =
+									double tidal_res_ms = tidalResource(
 										this->tidal_res_ms_vec[
 											(int(this->hour_of_day) +
 											this->tidal_idx_offset) % 23
-										];
-
-									tidal_res_ms *= 1 + (0.1 * ((double)rand() / RAND_MAX) - 0.05);
-									if (tidal_res_ms < 0) {
-										tidal_res_ms = 0;
-									}
-									else if (tidal_res_ms > 1) {
-										tidal_res_ms = 1;
-									}
+										],
+										randomStream(RNG_TIDAL)
+									);
 
 									this->plant_ptr_vec[i]->getProduction(tidal_res_ms);
 								}
 								else if (	// Wave
-									this->plant_ptr_vec[i]->getTextureIndex() == 9
+									this->plant_ptr_vec[i]->getKind() == PLANT_WAVE
 								) {
 									this->plant_ptr_vec[i]->getProduction(
 										this->wave_res_s
 									);
 								}
 								else if (	// Wind
-									this->plant_ptr_vec[i]->getTextureIndex() == 10
+									this->plant_ptr_vec[i]->getKind() == PLANT_WIND
 								) {
 									this->plant_ptr_vec[i]->getProduction(
 										this->wind_speed_ratio
@@ -7243,14 +9043,16 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 							// get next demand
 							if (this->hour_of_day < 23) {
-								this->current_energy_demand_GWh =
-									this->energy_demand_GWh_vec[int(this->hour_of_day)] +
-									int(4 * ((double)rand() / RAND_MAX)) - 2;
+								this->current_energy_demand_GWh = drawDemandGWh(
+									this->energy_demand_GWh_vec[int(this->hour_of_day)],
+									randomStream(RNG_DEMAND)
+								);
 							}
 							else {
-								this->current_energy_demand_GWh =
-									this->energy_demand_GWh_vec[0] +
-									int(4 * ((double)rand() / RAND_MAX)) - 2;
+								this->current_energy_demand_GWh = drawDemandGWh(
+									this->energy_demand_GWh_vec[0],
+									randomStream(RNG_DEMAND)
+								);
 							}
 							this->actual_energy_demand_GWh_vec.push_back(
 								this->current_energy_demand_GWh
@@ -7268,7 +9070,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							// go to selecting capacities
 							bool plants_selected = false;
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-								if (this->plant_ptr_vec[i]->getTextureIndex() != -1) {
+								if (this->plant_ptr_vec[i]->getKind() != PLANT_NULL) {
 									plants_selected = true;
 									break;
 								}
@@ -7280,43 +9082,43 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 								this->pictorial_tutorial.show_spacebar_instructions = false;
 								this->phase_manager.setPhase(3);
 								this->phase_manager.setIndex(0);
-								if (this->plant_ptr_vec[0]->getTextureIndex() == -1) {
+								if (this->plant_ptr_vec[0]->getKind() == PLANT_NULL) {
 									this->phase_manager.nextValidIndex(&this->plant_ptr_vec);
 								}
 
 								// create correct plant objects
 								for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-									int texture_key = this->plant_ptr_vec[i]->getTextureIndex();
-									switch (texture_key) {
-										case (0):
+									PlantKind kind = this->plant_ptr_vec[i]->getKind();
+									switch (kind) {
+										case (PLANT_COAL):
 											{
 												Plant* plant = new Coal(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (1):
+										case (PLANT_COMBINED):
 											{
 												Plant* plant = new Combined(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (2):
+										case (PLANT_FISSION):
 											{
 												Plant* plant = new Fission(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (3):
+										case (PLANT_GEOTHERMAL):
 											{
 												Plant* plant = new Geothermal(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (4):
+										case (PLANT_HYDRO):
 											{
 												Plant* plant = new Hydro(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
@@ -7325,21 +9127,21 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (5):
+										case (PLANT_PEAKER):
 											{
 												Plant* plant = new Peaker(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (6):
+										case (PLANT_SOLAR):
 											{
 												Plant* plant = new Solar(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (7):
+										case (PLANT_STORAGE):
 											{
 												Plant* plant = new Storage(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
@@ -7348,21 +9150,21 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (8):
+										case (PLANT_TIDAL):
 											{
 												Plant* plant = new Tidal(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (9):
+										case (PLANT_WAVE):
 											{
 												Plant* plant = new Wave(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
 												this->pushPlant(i, plant);
 											}
 											break;
-										case (10):
+										case (PLANT_WIND):
 											{
 												Plant* plant = new Wind(0, 0, 1, this->window_ptr, &(this->assets));
 												plant->setRunning(true);
@@ -7373,15 +9175,15 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 											// plant was set to null
 											this->plant_ptr_vec[i]->setPlantTexture(-2);
 											break;
-									} // end switch(texture_key)
+									} // end switch(kind)
 
 									// if regular plant
-									//if (texture_key != -1) { //
-									if (texture_key >= 0) {
+									//if (kind != PLANT_NULL) { //
+									if (kind != PLANT_NULL) {
 										this->phase_manager.decCapacityTokens();
 
 										// if storage
-										if (texture_key == 7) {
+										if (kind == PLANT_STORAGE) {
 											// reduce capacity tokens extra times depending on storage tokens per GW
 											for (size_t i = 0; i < STORAGE_TOKENS_PER_GW-1; i++) {
 												this->phase_manager.decCapacityTokens();
@@ -7389,21 +9191,21 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 											this->plant_ptr_vec[i]->setPowerCapacity(STORAGE_GW_PER_INCREMENT);
 										}
 										// if geothermal, have to reduce by amount of tokens assigned to it
-										else if (texture_key == 3) {
+										else if (kind == PLANT_GEOTHERMAL) {
 											for (size_t i = 0; i < CAPACITY_PER_GEOTHERMAL_ROLL/GW_PER_TOKEN-1; i++) {
 												this->phase_manager.decCapacityTokens();
 											}
 											this->plant_ptr_vec[i]->setPowerCapacity(CAPACITY_PER_GEOTHERMAL_ROLL);
 										}
 										// if fission have to reduce tokens based on fission tokesn per GW
-										else if (texture_key == 2){
+										else if (kind == PLANT_FISSION){
 											for (size_t i = 0; i < FISSION_TOKENS_PER_GW-1; i++) {
 												this->phase_manager.decCapacityTokens();
 											}
 											this->plant_ptr_vec[i]->setPowerCapacity(GW_PER_TOKEN);
 										}
 										// if peaker have to reduce tokens based on peaker tokesn per GW
-										else if (texture_key == 5){
+										else if (kind == PLANT_PEAKER){
 											for (size_t i = 0; i < PEAKER_TOKENS_PER_GW-1; i++) {
 												this->phase_manager.decCapacityTokens();
 											}
@@ -7437,7 +9239,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 								);
 							}
 
-							//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+							//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 
 						}
 						this->assets.getSound("P key")->play();
@@ -7455,7 +9257,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							// init all plants (other than hydro) as off
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 								if (	// Hydro
-									this->plant_ptr_vec[i]->getTextureIndex() != 4
+									this->plant_ptr_vec[i]->getKind() != PLANT_HYDRO
 								) {
 									this->plant_ptr_vec[i]->setRunning(false);
 								}
@@ -7466,7 +9268,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							{
 								bool geothermal_in_plant_ptr_vec = false;
 								for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-									if(this->plant_ptr_vec[i]->getTextureIndex() == 3){
+									if(this->plant_ptr_vec[i]->getKind() == PLANT_GEOTHERMAL){
 										this->phase_manager.setGeothermalPresent(i,true);
 										this->dice_roll.setRollsLeft(i,
 											this->plant_ptr_vec[i]->getCapacityGW()/CAPACITY_PER_GEOTHERMAL_ROLL);
@@ -7485,52 +9287,45 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 							this->phase_manager.setIndex(0);
 
-							if (this->plant_ptr_vec[0]->getTextureIndex() == -1) {
+							if (this->plant_ptr_vec[0]->getKind() == PLANT_NULL) {
 								this->phase_manager.nextValidIndex(&this->plant_ptr_vec);
 							}
 
 							// compute initial renewable production
-							this->wind_speed_ratio = (double)rand() / RAND_MAX;
-							this->cloud_cover_ratio = (double)rand() / RAND_MAX;
-							this->wave_res_s =
-								(15 - 5.75) * ((double)rand() / RAND_MAX) - 5.75;
+							this->wind_speed_ratio = randomStream(RNG_WEATHER).uniform();
+							this->cloud_cover_ratio = randomStream(RNG_WEATHER).uniform();
+							this->wave_res_s = initialWaveResource(randomStream(RNG_WEATHER));
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 								if (	// Solar
-									this->plant_ptr_vec[i]->getTextureIndex() == 6
+									this->plant_ptr_vec[i]->getKind() == PLANT_SOLAR
 								) {
 									this->plant_ptr_vec[i]->getProduction(
 										this->generateSolarResource()
 									);
 								}
 								else if (	// Tidal
-									this->plant_ptr_vec[i]->getTextureIndex() == 8
+									this->plant_ptr_vec[i]->getKind() == PLANT_TIDAL
 								) {
-									double tidal_res_ms =
+									double tidal_res_ms = tidalResource(
 										this->tidal_res_ms_vec[
 											(int(this->hour_of_day) +
 											this->tidal_idx_offset) % 23
-										];
-
-									tidal_res_ms *= 1 + (0.1 * ((double)rand() / RAND_MAX) - 0.05);
-									if (tidal_res_ms < 0) {
-										tidal_res_ms = 0;
-									}
-									else if (tidal_res_ms > 1) {
-										tidal_res_ms = 1;
-									}
+										],
+										randomStream(RNG_TIDAL)
+									);
 
 									this->plant_ptr_vec[i]->getProduction(tidal_res_ms);
 
 								}
 								else if (	// Wave
-									this->plant_ptr_vec[i]->getTextureIndex() == 9
+									this->plant_ptr_vec[i]->getKind() == PLANT_WAVE
 								) {
 									this->plant_ptr_vec[i]->getProduction(
 										this->wave_res_s
 									);
 								}
 								else if (	// Wind
-									this->plant_ptr_vec[i]->getTextureIndex() == 10
+									this->plant_ptr_vec[i]->getKind() == PLANT_WIND
 								) {
 									this->plant_ptr_vec[i]->getProduction(
 										this->wind_speed_ratio
@@ -7539,9 +9334,10 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							}
 
 							// set initial demand
-							this->current_energy_demand_GWh =
-								this->energy_demand_GWh_vec[int(this->hour_of_day)] +
-								int(4 * ((double)rand() / RAND_MAX)) - 2;
+							this->current_energy_demand_GWh = drawDemandGWh(
+								this->energy_demand_GWh_vec[int(this->hour_of_day)],
+								randomStream(RNG_DEMAND)
+							);
 							this->actual_energy_demand_GWh_vec.push_back(
 								this->current_energy_demand_GWh
 							);
@@ -7551,7 +9347,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							// ---------------------------------------------------------------------------
 							/*
 							for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-								if (this->plant_ptr_vec[i]->getTextureIndex() == 4) {
+								if (this->plant_ptr_vec[i]->getKind() == PLANT_HYDRO) {
 									this->plant_ptr_vec[i]
 										->setEnergyCapacity(
 											this->phase_manager.hydroStorageTable(
@@ -7559,7 +9355,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 											)
 										);
 								}
-								else if (this->plant_ptr_vec[i]->getTextureIndex() == 7) {
+								else if (this->plant_ptr_vec[i]->getKind() == PLANT_STORAGE) {
 									this->plant_ptr_vec[i]->setEnergyCapacity(
 										this->plant_ptr_vec[i]->getCapacityGW()
 									);
@@ -7718,9 +9514,9 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 						// set plant_num to previous plant
 						this->phase_manager.setPlantNum(
 							this->plant_ptr_vec[this->phase_manager.getIndex()]
-							->getTextureIndex());
+							->getKind());
 
-						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 
 						this->assets.getSound("A D key")->play();
 						break;
@@ -7733,7 +9529,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							this->plant_ptr_vec[this->phase_manager.getIndex()]
 							->getCapacityGW());
 
-						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 
 						this->assets.getSound("A D key")->play();
 						break;
@@ -7763,9 +9559,9 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 						// set plant_num to next plant
 						this->phase_manager.setPlantNum(
 							this->plant_ptr_vec[this->phase_manager.getIndex()]
-							->getTextureIndex());
+							->getKind());
 
-						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 
 						this->assets.getSound("A D key")->play();
 						break;
@@ -7778,7 +9574,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							this->plant_ptr_vec[this->phase_manager.getIndex()]
 							->getCapacityGW());
 
-						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+						//this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 
 						this->assets.getSound("A D key")->play();
 						break;
@@ -7828,31 +9624,16 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 						->setPlantTexture(this->phase_manager.getPlantNum());
 
 						// update price
-						{
-							int texture_idx = this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex();
-							switch (texture_idx) {
-								case (2):	// Fission
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(FISSION_TOKENS_PER_GW);
-									break;
-
-								case (5):	// Peaker
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(PEAKER_TOKENS_PER_GW);
-									break;
-
-								case (7):	// Storage
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(STORAGE_TOKENS_PER_GW);
-									break;
-
-								default:	// all other plants
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(1);
-									break;
-							}
-						}
+						this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(
+							plantDescriptor(
+								this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind()
+							).tokens_per_GW
+						);
 
 						if (
-							this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex() >= 0
+							this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind() != PLANT_NULL
 						) {
-							this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+							this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 						}
 						else {
 							this->text_box.makeBox(
@@ -7872,16 +9653,16 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 					case (3):
 						// setting capacities
 						{
-							int texture_key = this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex();
+							PlantKind kind = this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind();
 							int last_tokens = 0;
 							int next_tokens = 0;
-							switch (texture_key) {
-								case (-1):
+							switch (kind) {
+								case (PLANT_NULL):
 									// null plant - do nothing
 									std::cout << "null plant" << std::endl;
 									break;
 
-								case (2):
+								case (PLANT_FISSION):
 									// fission - cannot exceed 9 GW capacity
 									// give a bit of leeway in case of floating point error in the future
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
@@ -7905,7 +9686,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 									break;
 
 								// special case for geothermal, need to make big investment to search for power
-								case (3):
+								case (PLANT_GEOTHERMAL):
 									// storage set capacity_GWh and charge_GWh based on capacity
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() / GW_PER_TOKEN;
@@ -7927,7 +9708,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 									break;
 
-								case (4):
+								case (PLANT_HYDRO):
 									// hydro - set capacity_GWh and charge_GWh based on table
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() / GW_PER_TOKEN;
@@ -7946,7 +9727,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 									break;
 
-								case (5):
+								case (PLANT_PEAKER):
 									// peaker - cannot exceed 9 GW capacity
 									// give a bit of leeway in case of floating point error in the future
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
@@ -7970,7 +9751,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 									break;
 
 									// special case for this, should use more tokens, also need to do same for geothermal
-								case (7):
+								case (PLANT_STORAGE):
 									// storage set capacity_GWh and charge_GWh based on capacity
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() * STORAGE_TOKENS_PER_GW;
@@ -8008,7 +9789,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 										getCapacityGW() / GW_PER_TOKEN;
 
 									break;
-							} // end switch(texture_key)
+							} // end switch(kind)
 
 							// if change, play sound
 							if (last_tokens != next_tokens) {
@@ -8057,31 +9838,16 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 							->setPlantTexture(this->phase_manager.getPlantNum());
 
 						// update price
-						{
-							int texture_idx = this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex();
-							switch (texture_idx) {
-								case (2):	// Fission
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(FISSION_TOKENS_PER_GW);
-									break;
-
-								case (5):	// Peaker
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(PEAKER_TOKENS_PER_GW);
-									break;
-
-								case (7):	// Storage
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(STORAGE_TOKENS_PER_GW);
-									break;
-
-								default:	// all other plants
-									this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(1);
-									break;
-							}
-						}
+						this->plant_ptr_vec[this->phase_manager.getIndex()]->setPrice(
+							plantDescriptor(
+								this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind()
+							).tokens_per_GW
+						);
 
 						if (
-							this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex() >= 0
+							this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind() != PLANT_NULL
 						) {
-							this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex());
+							this->plantInfo(this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind());
 						}
 						else {
 							this->text_box.makeBox(
@@ -8102,16 +9868,16 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 						// call decreaseCapactiy()
 						// setting capacities
 						{
-							int texture_key = this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex();
+							PlantKind kind = this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind();
 							int last_tokens = 0;
 							int next_tokens = 0;
-							switch (texture_key) {
-								case (-1):
+							switch (kind) {
+								case (PLANT_NULL):
 									// null plant - do nothing
 									std::cout << "null plant" << std::endl;
 									break;
 
-								case (2):
+								case (PLANT_FISSION):
 										last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() / GW_PER_TOKEN;
 
@@ -8132,7 +9898,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 									break;
 
 								// special case for geothermal, need to make big investment to search for power
-								case (3):
+								case (PLANT_GEOTHERMAL):
 										last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() / GW_PER_TOKEN;
 
@@ -8152,7 +9918,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 									break;
 
-								case (4):
+								case (PLANT_HYDRO):
 									// hydro - set capacity_GWh and charge_GWh based on table
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() / GW_PER_TOKEN;
@@ -8170,7 +9936,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 									break;
 
-								case (5):
+								case (PLANT_PEAKER):
 									// peaker - cannot exceed 9 GW capacity
 									// need to check all plants that are peaker gas
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
@@ -8192,7 +9958,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 
 									break;
 
-								case (7):
+								case (PLANT_STORAGE):
 									// storage set capacity_GWh and charge_GWh based on capacity
 									last_tokens = this->plant_ptr_vec[this->phase_manager.getIndex()]->
 										getCapacityGW() * STORAGE_TOKENS_PER_GW;
@@ -8227,7 +9993,7 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 										getCapacityGW() / GW_PER_TOKEN;
 
 									break;
-							} // end switch(texture_key)
+							} // end switch(kind)
 
 							// if change, play sound
 							if (last_tokens != next_tokens) {
@@ -8268,6 +10034,75 @@ void Game::handleKeys(sf::Keyboard::Key key, bool key_press) {
 }	// end Game::handleKeys()
 
 
+void Game::renderBackground(double render_ratio) {
+	/*
+	 *	Method to render the background layers. The sky disk and overcast sky
+	 *	(back layer) and the smog dome and foreground (front layer) only
+	 *	change with their inputs (which hold still outside of hour
+	 *	transitions), so they are drawn from cache; clouds and wind sock
+	 *	move every step, so they are drawn live.
+	 */
+
+	//	1. sky disk, 2a. overcast
+	if (this->back_layer.needsRedraw({this->hour_of_day, this->cloud_cover_ratio})) {
+		sf::RenderTarget* target_ptr = this->back_layer.beginRedraw();
+		this->sky_disk.drawFrame(this->hour_of_day, target_ptr);
+		this->overcast_clouds.drawOvercast(
+			this->cloud_cover_ratio,
+			this->hour_of_day,
+			target_ptr
+		);
+		this->back_layer.endRedraw();
+	}
+	this->back_layer.draw();
+
+	//	2b. clouds
+	this->overcast_clouds.drawClouds(
+		this->cloud_cover_ratio,
+		this->hour_of_day,
+		render_ratio
+	);
+
+	//	3. smog dome (circ, behind city), 4. foreground + Plinko City
+	if (
+		this->front_layer.needsRedraw(
+			{this->hour_of_day, this->smog_ratio, double(this->powered_flag)}
+		)
+	) {
+		sf::RenderTarget* target_ptr = this->front_layer.beginRedraw();
+
+		sf::CircleShape smog_circ;
+		smog_circ.setFillColor(
+			sf::Color(
+				SMOG_COLOUR.r,
+				SMOG_COLOUR.g,
+				SMOG_COLOUR.b,
+				this->smog_ratio * 200
+			)
+		);
+		double radius = 1.1 * SCREEN_HEIGHT / 3;
+		smog_circ.setRadius(radius);
+		smog_circ.setOrigin(radius, radius);
+		smog_circ.setPosition(
+			sf::Vector2f(
+				SCREEN_WIDTH / 2,
+				SCREEN_HEIGHT / 2
+			)
+		);
+		target_ptr->draw(smog_circ);
+
+		this->foreground.drawFrame(this->powered_flag, this->hour_of_day, target_ptr);
+		this->front_layer.endRedraw();
+	}
+	this->front_layer.draw();
+
+	//	5. wind sock
+	this->wind_sock.drawFrame(this->hour_of_day);
+
+	return;
+}	// end Game::renderBackground()
+
+
 void Game::renderOverlays(void) {
 	/*
 	 *	Helper function to handle the rendering of overlays
@@ -8283,21 +10118,21 @@ void Game::renderOverlays(void) {
 
 	// selection overlay
 	if (this->phase_manager.getPhase() == 2) {
-		sf::Text select_instructions_txt(
-			"SELECT PLANT TYPES",
-			*(this->assets.getFont("bold")),
-			32
+		TextCacheEntry* select_instructions_ptr = this->text_cache.get(
+			this->bold_font_id,
+			32,
+			"SELECT PLANT TYPES"
 		);
-		select_instructions_txt.setOrigin(
-			select_instructions_txt.getLocalBounds().width / 2,
-			select_instructions_txt.getLocalBounds().height / 2
+		select_instructions_ptr->text.setOrigin(
+			select_instructions_ptr->bounds.width / 2,
+			select_instructions_ptr->bounds.height / 2
 		);
-		select_instructions_txt.setPosition(
+		select_instructions_ptr->text.setPosition(
 			SCREEN_WIDTH / 2,
 			2 * SCREEN_HEIGHT / 3
 		);
 
-		this->window_ptr->draw(select_instructions_txt);
+		this->window_ptr->draw(select_instructions_ptr->text);
 	}
 
 	// capacity tokens overlay
@@ -8308,44 +10143,43 @@ void Game::renderOverlays(void) {
 
 		int n_tokens = this->phase_manager.getCapacityTokens();
 		std::string tokens_str = " : " + std::to_string(n_tokens);
-		sf::Text tokens_txt(
+		TextCacheEntry* tokens_ptr = this->text_cache.get(
+			this->bold_font_id,
+			32,
 			tokens_str,
-			*(this->assets.getFont("bold")),
-			32
+			sf::Color(rgb, rgb, rgb, 255)
 		);
 
-		tokens_txt.setFillColor(sf::Color(rgb, rgb, rgb, 255));
-		sf::Rect tokens_txt_rect = tokens_txt.getLocalBounds();
-		double tokens_txt_h = tokens_txt_rect.height;
-		double tokens_txt_w = tokens_txt_rect.width;
-		tokens_txt.setOrigin(tokens_txt_w, 0);
-		tokens_txt.setPosition(
+		double tokens_txt_h = tokens_ptr->bounds.height;
+		double tokens_txt_w = tokens_ptr->bounds.width;
+		tokens_ptr->text.setOrigin(tokens_txt_w, 0);
+		tokens_ptr->text.setPosition(
 			SCREEN_WIDTH - 32,
 			tokens_txt_h - 2
 		);
-		this->window_ptr->draw(tokens_txt);
+		this->window_ptr->draw(tokens_ptr->text);
 
 		this->capacity_token_sprite.setRotation(this->frame);
 		this->capacity_token_sprite.setPosition(
-			tokens_txt.getPosition().x - tokens_txt_w - 24,
+			tokens_ptr->text.getPosition().x - tokens_txt_w - 24,
 			19 + tokens_txt_h + 6 * sin((2 * M_PI * this->frame) / FRAMES_PER_SECOND)
 		);
 		this->window_ptr->draw(this->capacity_token_sprite);
 
-		sf::Text tokens_instructions_txt(
-			"SET PLANT CAPACITIES",
-			*(this->assets.getFont("bold")),
-			32
+		TextCacheEntry* tokens_instructions_ptr = this->text_cache.get(
+			this->bold_font_id,
+			32,
+			"SET PLANT CAPACITIES"
 		);
-		tokens_instructions_txt.setOrigin(
-			tokens_instructions_txt.getLocalBounds().width / 2,
-			tokens_instructions_txt.getLocalBounds().height / 2
+		tokens_instructions_ptr->text.setOrigin(
+			tokens_instructions_ptr->bounds.width / 2,
+			tokens_instructions_ptr->bounds.height / 2
 		);
-		tokens_instructions_txt.setPosition(
+		tokens_instructions_ptr->text.setPosition(
 			SCREEN_WIDTH / 2,
 			2 * SCREEN_HEIGHT / 3
 		);
-		this->window_ptr->draw(tokens_instructions_txt);
+		this->window_ptr->draw(tokens_instructions_ptr->text);
 	}
 
 	// energy demand, score, and clock overlays
@@ -8357,21 +10191,20 @@ void Game::renderOverlays(void) {
 		// energy demand overlay
 		int energy_demand = this->current_energy_demand_GWh;
 		std::string energy_demand_str = " : " + std::to_string(energy_demand) + " GWh";
-		sf::Text energy_demand_txt(
+		TextCacheEntry* energy_demand_ptr = this->text_cache.get(
+			this->bold_font_id,
+			32,
 			energy_demand_str,
-			*(this->assets.getFont("bold")),
-			32
-		);
-		energy_demand_txt.setFillColor(sf::Color(rgb, rgb, rgb, 255));
-		sf::Rect energy_demand_txt_rect = energy_demand_txt.getLocalBounds();
-		double energy_demand_txt_h = energy_demand_txt_rect.height;
-		double energy_demand_txt_w = energy_demand_txt_rect.width;
-		energy_demand_txt.setOrigin(energy_demand_txt_w, 0);
-		energy_demand_txt.setPosition(
+			sf::Color(rgb, rgb, rgb, 255)
+		);
+		double energy_demand_txt_h = energy_demand_ptr->bounds.height;
+		double energy_demand_txt_w = energy_demand_ptr->bounds.width;
+		energy_demand_ptr->text.setOrigin(energy_demand_txt_w, 0);
+		energy_demand_ptr->text.setPosition(
 			SCREEN_WIDTH - 32,
 			energy_demand_txt_h - 15
 		);
-		this->window_ptr->draw(energy_demand_txt);
+		this->window_ptr->draw(energy_demand_ptr->text);
 
 		this->energy_demand_sprite.setPosition(
 			SCREEN_WIDTH - energy_demand_txt_w - 48,
@@ -8379,65 +10212,37 @@ void Game::renderOverlays(void) {
 		);
 		this->window_ptr->draw(this->energy_demand_sprite);
 
-		// score overlay
-		std::string score_str = "Score: " + std::to_string(this->score);
-		while (score_str.back() == '0') {
-			score_str.pop_back();
-			if (score_str.back() == '.') {
-				score_str.pop_back();
-				break;
-			}
-		}
-		sf::Text score_txt(
-			score_str,
-			*(this->assets.getFont("bold")),
-			30
-		);
-		score_txt.setFillColor(sf::Color(rgb, rgb, rgb, 255));
-		sf::Rect score_txt_rect = energy_demand_txt.getLocalBounds();
-		double score_txt_h = energy_demand_txt_rect.height;
-		double score_txt_w = energy_demand_txt_rect.width;
-		score_txt.setOrigin(score_txt_w / 2, score_txt_h / 2);
-		score_txt.setPosition(
+		// score overlay (centred as per energy demand text)
+		TextCacheEntry* score_ptr = this->text_cache.get(
+			this->bold_font_id,
+			30,
+			this->getScoreString(),
+			sf::Color(rgb, rgb, rgb, 255)
+		);
+		double score_txt_h = energy_demand_ptr->bounds.height;
+		double score_txt_w = energy_demand_ptr->bounds.width;
+		score_ptr->text.setOrigin(score_txt_w / 2, score_txt_h / 2);
+		score_ptr->text.setPosition(
 			SCREEN_WIDTH / 2,
 			score_txt_h - 5
 		);
-		this->window_ptr->draw(score_txt);
+		this->window_ptr->draw(score_ptr->text);
 
 		// clock overlay
-		int hour = int(this->hour_of_day);
 		int min = int((this->hour_of_day - int(hour_of_day)) * 60);
-		std::string time_str = "";
-		if (hour < 10) {
-			time_str += "0" + std::to_string(hour);
-		}
-		else {
-			time_str += std::to_string(hour);
-		}
-		time_str += ":";
-		if (min < 10) {
-			time_str += "0" + std::to_string(min);
-		}
-		else {
-			time_str += std::to_string(min);
-		}
-		sf::Text time_txt(
-			time_str,
-			*(this->assets.getFont("bold")),
-			32
+		TextCacheEntry* time_ptr = this->text_cache.get(
+			this->bold_font_id,
+			32,
+			this->getTimeString(),
+			sf::Color(rgb, rgb, rgb, 255)
 		);
 
-		time_txt.setFillColor(sf::Color(rgb, rgb, rgb, 255));
-		sf::Rect time_txt_rect = time_txt.getLocalBounds();
-		double time_txt_h = ceil(time_txt_rect.height);
-		double time_txt_w = ceil(time_txt_rect.width);
-
 		this->clock_face_sprite.setPosition(26, 26);
-		time_txt.setPosition(
+		time_ptr->text.setPosition(
 			this->clock_face_sprite.getPosition().x + 28,
 			5
 		);
-		this->window_ptr->draw(time_txt);
+		this->window_ptr->draw(time_ptr->text);
 		this->window_ptr->draw(this->clock_face_sprite);
 
 		this->clock_minute_sprite.setPosition(26, 26);
@@ -8451,7 +10256,7 @@ void Game::renderOverlays(void) {
 
 	// dice roll overlay
 	if (this->phase_manager.getPhase() == 4) {
-		// if dice are still rolling get a new dice number
+		// if dice are still rolling show they are (new numbers roll in update())
 		if (this->dice_roll.getRollingDice()) {
 			this->dice_roll.drawFrame(true);
 		}
@@ -8464,33 +10269,33 @@ void Game::renderOverlays(void) {
 			if (this->phase_manager.getGeothermalPresent(i)) {
 				int num_rolls_rem = 3 * this->dice_roll.getRollsLeft(i) -
 					this->rolls_rem_corr;
-				sf::Text rolls_txt(
-					"WELLS REMAINING: " + std::to_string(num_rolls_rem),
-					*(this->assets.getFont("bold")),
-					16
+				TextCacheEntry* rolls_ptr = this->text_cache.get(
+					this->bold_font_id,
+					16,
+					"WELLS REMAINING: " + std::to_string(num_rolls_rem)
 				);
-				rolls_txt.setOrigin(
-					rolls_txt.getLocalBounds().width / 2,
-					rolls_txt.getLocalBounds().height / 2
+				rolls_ptr->text.setOrigin(
+					rolls_ptr->bounds.width / 2,
+					rolls_ptr->bounds.height / 2
 				);
-				rolls_txt.setPosition(
+				rolls_ptr->text.setPosition(
 					this->plant_ptr_vec[i]->getPositionX(),
 					this->plant_ptr_vec[i]->getPositionY() - 140
 				);
-				this->window_ptr->draw(rolls_txt);
+				this->window_ptr->draw(rolls_ptr->text);
 			}
 		}
 	}
 
 	// points text overlay
 	if (!this->points_str.empty()) {
-		sf::Text points_text(
-			this->points_str,
-			*(this->assets.getFont("bold")),
-			14
+		TextCacheEntry* points_ptr = this->text_cache.get(
+			this->bold_font_id,
+			14,
+			this->points_str
 		);
-		points_text.setOrigin(points_text.getLocalBounds().width / 2, 0);
-		points_text.setPosition(
+		points_ptr->text.setOrigin(points_ptr->bounds.width / 2, 0);
+		points_ptr->text.setPosition(
 			SCREEN_WIDTH / 2,
 		 	60 + 4 * (1 + cos((M_PI * this->frame) / FRAMES_PER_SECOND)) / 2
 		);
@@ -8501,8 +10306,8 @@ void Game::renderOverlays(void) {
 		backing_rect.setOutlineThickness(TEXT_BOX_OUTLINE_THICKNESS);
 		backing_rect.setSize(
 			sf::Vector2f(
-				1.05 * points_text.getLocalBounds().width,
-				1.1 * points_text.getLocalBounds().height
+				1.05 * points_ptr->bounds.width,
+				1.1 * points_ptr->bounds.height
 			)
 		);
 		backing_rect.setOrigin(backing_rect.getLocalBounds().width / 2, 0);
@@ -8512,7 +10317,7 @@ void Game::renderOverlays(void) {
 		);
 
 		this->window_ptr->draw(backing_rect);
-		this->window_ptr->draw(points_text);
+		this->window_ptr->draw(points_ptr->text);
 	}
 
 	// smog overlay (rect, general "smoginess")
@@ -8535,24 +10340,24 @@ void Game::renderOverlays(void) {
 		this->window_ptr->draw(backing_rect);
 
 		// draw title
-		sf::Text title_txt(
-			"Forecast Overlay",
-			*(this->assets.getFont("bold")),
-			24
+		TextCacheEntry* title_ptr = this->text_cache.get(
+			this->bold_font_id,
+			24,
+			"Forecast Overlay"
 		);
-		title_txt.setOrigin(
-			title_txt.getLocalBounds().width / 2,
-			title_txt.getLocalBounds().height / 2
+		title_ptr->text.setOrigin(
+			title_ptr->bounds.width / 2,
+			title_ptr->bounds.height / 2
 		);
-		title_txt.setPosition(
+		title_ptr->text.setPosition(
 			SCREEN_WIDTH / 2,
 			70
 		);
-		this->window_ptr->draw(title_txt);
+		this->window_ptr->draw(title_ptr->text);
 
 		// demand forecast
 		sf::Sprite energy_demand_sprite(
-			*(this->assets.getTexture("energy demand"))
+			*(this->assets.getTexture(this->energy_demand_texture_id))
 		);
 		energy_demand_sprite.setOrigin(
 			energy_demand_sprite.getLocalBounds().width,
@@ -8568,20 +10373,20 @@ void Game::renderOverlays(void) {
 		std::string energy_demand_str = " : ";
 		energy_demand_str += std::to_string(this->forecast_map["demand GWh"]);
 		energy_demand_str += " +/- 2 GWh";
-		sf::Text energy_demand_txt(
-			energy_demand_str,
-			*(this->assets.getFont("bold")),
-			24
+		TextCacheEntry* energy_demand_ptr = this->text_cache.get(
+			this->bold_font_id,
+			24,
+			energy_demand_str
 		);
-		energy_demand_txt.setOrigin(
+		energy_demand_ptr->text.setOrigin(
 			0,
-			energy_demand_txt.getLocalBounds().height / 2
+			energy_demand_ptr->bounds.height / 2
 		);
-		energy_demand_txt.setPosition(
+		energy_demand_ptr->text.setPosition(
 			SCREEN_WIDTH / 5,
 			SCREEN_HEIGHT / 5 - 6
 		);
-		this->window_ptr->draw(energy_demand_txt);
+		this->window_ptr->draw(energy_demand_ptr->text);
 
 
 		// renewable production forecast
@@ -8592,16 +10397,14 @@ void Game::renderOverlays(void) {
 		std::vector<double> forecast_return_vec = {0, 0};
 		std::string renewable_str;
 		sf::Sprite renewable_sprite;
-		sf::Text renewable_txt;
-		renewable_txt.setFont(*(this->assets.getFont("bold")));
-		renewable_txt.setCharacterSize(24);
+		TextCacheEntry* renewable_ptr = NULL;
 		for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-			int texture_key = this->plant_ptr_vec[i]->getTextureIndex();
-			switch (texture_key) {
-				case (6):	// Solar
+			PlantKind kind = this->plant_ptr_vec[i]->getKind();
+			switch (kind) {
+				case (PLANT_SOLAR):
 					n_renewables++;
 					renewable_sprite.setTexture(
-						*(this->assets.getTexture("solar"))
+						*(this->assets.getTexture(this->solar_texture_id))
 					);
 					renewable_sprite.setOrigin(
 						renewable_sprite.getLocalBounds().width,
@@ -8626,25 +10429,29 @@ void Game::renderOverlays(void) {
 						this->forecast_map["solar forecast error GWh"]
 					);
 					renewable_str += " GWh";
-					renewable_txt.setString(renewable_str);
-					renewable_txt.setOrigin(
+					renewable_ptr = this->text_cache.get(
+						this->bold_font_id,
+						24,
+						renewable_str
+					);
+					renewable_ptr->text.setOrigin(
 						0,
-						renewable_txt.getLocalBounds().height / 2
+						renewable_ptr->bounds.height / 2
 					);
-					renewable_txt.setPosition(
+					renewable_ptr->text.setPosition(
 						SCREEN_WIDTH / 5 + 30,
 						SCREEN_HEIGHT / 5 + n_renewables * (
 							renewable_sprite.getLocalBounds().height
 						)
 					);
-					this->window_ptr->draw(renewable_txt);
+					this->window_ptr->draw(renewable_ptr->text);
 
 					break;
 
-				case (8):	// Tidal
+				case (PLANT_TIDAL):
 					n_renewables++;
 					renewable_sprite.setTexture(
-						*(this->assets.getTexture("tidal selection"))
+						*(this->assets.getTexture(this->tidal_texture_id))
 					);
 					renewable_sprite.setOrigin(
 						renewable_sprite.getLocalBounds().width,
@@ -8669,25 +10476,29 @@ void Game::renderOverlays(void) {
 						this->forecast_map["tidal forecast error GWh"]
 					);
 					renewable_str += " GWh";
-					renewable_txt.setString(renewable_str);
-					renewable_txt.setOrigin(
+					renewable_ptr = this->text_cache.get(
+						this->bold_font_id,
+						24,
+						renewable_str
+					);
+					renewable_ptr->text.setOrigin(
 						0,
-						renewable_txt.getLocalBounds().height / 2
+						renewable_ptr->bounds.height / 2
 					);
-					renewable_txt.setPosition(
+					renewable_ptr->text.setPosition(
 						SCREEN_WIDTH / 5 + 30,
 						SCREEN_HEIGHT / 5 + n_renewables * (
 							renewable_sprite.getLocalBounds().height
 						)
 					);
-					this->window_ptr->draw(renewable_txt);
+					this->window_ptr->draw(renewable_ptr->text);
 
 					break;
 
-				case (9):	// Wave
+				case (PLANT_WAVE):
 					n_renewables++;
 					renewable_sprite.setTexture(
-						*(this->assets.getTexture("wave selection"))
+						*(this->assets.getTexture(this->wave_texture_id))
 					);
 					renewable_sprite.setOrigin(
 						renewable_sprite.getLocalBounds().width,
@@ -8712,25 +10523,29 @@ void Game::renderOverlays(void) {
 						this->forecast_map["wave forecast error GWh"]
 					);
 					renewable_str += " GWh";
-					renewable_txt.setString(renewable_str);
-					renewable_txt.setOrigin(
+					renewable_ptr = this->text_cache.get(
+						this->bold_font_id,
+						24,
+						renewable_str
+					);
+					renewable_ptr->text.setOrigin(
 						0,
-						renewable_txt.getLocalBounds().height / 2
+						renewable_ptr->bounds.height / 2
 					);
-					renewable_txt.setPosition(
+					renewable_ptr->text.setPosition(
 						SCREEN_WIDTH / 5 + 30,
 						SCREEN_HEIGHT / 5 + n_renewables * (
 							renewable_sprite.getLocalBounds().height
 						)
 					);
-					this->window_ptr->draw(renewable_txt);
+					this->window_ptr->draw(renewable_ptr->text);
 
 					break;
 
-				case (10):	// Wind
+				case (PLANT_WIND):
 					n_renewables++;
 					renewable_sprite.setTexture(
-						*(this->assets.getTexture("wind selection"))
+						*(this->assets.getTexture(this->wind_texture_id))
 					);
 					renewable_sprite.setOrigin(
 						renewable_sprite.getLocalBounds().width,
@@ -8755,18 +10570,22 @@ void Game::renderOverlays(void) {
 						this->forecast_map["wind forecast error GWh"]
 					);
 					renewable_str += " GWh";
-					renewable_txt.setString(renewable_str);
-					renewable_txt.setOrigin(
+					renewable_ptr = this->text_cache.get(
+						this->bold_font_id,
+						24,
+						renewable_str
+					);
+					renewable_ptr->text.setOrigin(
 						0,
-						renewable_txt.getLocalBounds().height / 2
+						renewable_ptr->bounds.height / 2
 					);
-					renewable_txt.setPosition(
+					renewable_ptr->text.setPosition(
 						SCREEN_WIDTH / 5 + 30,
 						SCREEN_HEIGHT / 5 + n_renewables * (
 							renewable_sprite.getLocalBounds().height
 						)
 					);
-					this->window_ptr->draw(renewable_txt);
+					this->window_ptr->draw(renewable_ptr->text);
 
 					break;
 
@@ -8789,282 +10608,59 @@ void Game::renderOverlays(void) {
 		backing_rect.setFillColor(sf::Color(0, 0, 0, 200));
 		this->window_ptr->draw(backing_rect);
 
-		double pixels_per_GWh = round((0.75 * SCREEN_HEIGHT) / 25);
-		double pixels_per_hour = round((0.75 * SCREEN_WIDTH) / 25);
-		double origin_x = 0.125 * SCREEN_WIDTH;
-		double max_x = 0.875 * SCREEN_WIDTH;
-		double origin_y = 0.875 * SCREEN_HEIGHT;
-		double min_y = 0.125 * SCREEN_HEIGHT - 5;
-
-		// draw vertical axis
-		sf::Vertex vert_vertex_array[2] = {
-			sf::Vertex(sf::Vector2f(origin_x, origin_y)),
-			sf::Vertex(sf::Vector2f(origin_x, min_y))
-		};
-		this->window_ptr->draw(vert_vertex_array, 2, sf::Lines);
-		for (int i = 0; i < 26; i++) {
-			sf::Text y_tick(
-				std::to_string(i),
-				*(this->assets.getFont("teletype")),
-				16
-			);
-			y_tick.setOrigin(
-				y_tick.getLocalBounds().width / 2,
-				y_tick.getLocalBounds().height / 2
-			);
-			y_tick.setPosition(
-				0.105 * SCREEN_WIDTH,
-				origin_y - i * pixels_per_GWh - 5
-			);
-			this->window_ptr->draw(y_tick);
-
-			sf::Vertex grid_array[2] = {
-				sf::Vertex(
-					sf::Vector2f(origin_x, origin_y - i * pixels_per_GWh),
-					sf::Color(128, 128, 128, 150)
-				),
-				sf::Vertex(
-					sf::Vector2f(max_x, origin_y - i * pixels_per_GWh),
-					sf::Color(128, 128, 128, 150)
-				)
-			};
-			this->window_ptr->draw(grid_array, 2, sf::Lines);
-		}
-		sf::Text vert_label(
-			"Energy [GWh]",
-			*(this->assets.getFont("teletype")),
-			24
-		);
-		vert_label.setOrigin(
-			vert_label.getLocalBounds().width / 2,
-			vert_label.getLocalBounds().height / 2
-		);
-		vert_label.setPosition(
-			0.075 * SCREEN_WIDTH,
-			0.5 * (origin_y + min_y)
-		);
-		vert_label.setRotation(-90);
-		this->window_ptr->draw(vert_label);
-
-		// draw horizontal axis
-		sf::Vertex horiz_vertex_array[2] = {
-			sf::Vertex(sf::Vector2f(origin_x, origin_y)),
-			sf::Vertex(sf::Vector2f(max_x, origin_y))
-		};
-		this->window_ptr->draw(horiz_vertex_array, 2, sf::Lines);
-		for (int i = 0; i <= this->hour_of_day; i++) {
-			if (i >= 24) {
-				break;
-			}
-			sf::Text x_tick(
-				std::to_string(i),
-				*(this->assets.getFont("teletype")),
-				16
-			);
-			x_tick.setOrigin(x_tick.getLocalBounds().width / 2, 0);
-			x_tick.setPosition(
-				origin_x + (i + 0.5) * pixels_per_hour,
-				0.885 * SCREEN_HEIGHT
-			);
-			this->window_ptr->draw(x_tick);
+		// chart data (the chart is only rebuilt when these change)
+		int n_hours_labelled = int(this->hour_of_day) + 1;
+		int n_hours_dispatched = ceil(this->hour_of_day);
+		if (n_hours_labelled > HOURS_PER_GAME) {
+			n_hours_labelled = HOURS_PER_GAME;
 		}
-		sf::Text horiz_label(
-			"Hour of Day [\t]",
-			*(this->assets.getFont("teletype")),
-			24
-		);
-		horiz_label.setOrigin(
-			horiz_label.getLocalBounds().width / 2,
-			horiz_label.getLocalBounds().height / 2
-		);
-		horiz_label.setPosition(
-			0.5 * (origin_x + max_x),
-			0.925 * SCREEN_HEIGHT
-		);
-		this->window_ptr->draw(horiz_label);
-
-		// draw dispatch columns
-		int dispatch_cumul_sum = 0;
-		for (int i = 0; i < this->hour_of_day; i++) {
-			if (i >= 24) {
-				break;
-			}
-			for (int j = 0; j < this->plant_ptr_vec.size(); j++) {
-				if (this->plant_ptr_vec[j]->getTextureIndex() < 0) {
-					continue;
-				}
-				sf::RectangleShape disp_rect(
-					sf::Vector2f(
-						0.8 * pixels_per_hour,
-						pixels_per_GWh * this->plant_ptr_vec[j]->getMarblesCommitted(i)
-					)
-				);
-				disp_rect.setOrigin(
-					disp_rect.getLocalBounds().width / 2,
-					disp_rect.getLocalBounds().height
-				);
-				disp_rect.setPosition(
-					origin_x + (i + 0.5) * pixels_per_hour,
-					origin_y - pixels_per_GWh * dispatch_cumul_sum - 1
-				);
-				disp_rect.setFillColor(
-					this->plant_ptr_vec[j]->getMarbleColour()
-				);
-				dispatch_cumul_sum +=
-					this->plant_ptr_vec[j]->getMarblesCommitted(i);
-				this->window_ptr->draw(disp_rect);
-			}
-			dispatch_cumul_sum = 0;
+		if (n_hours_dispatched > HOURS_PER_GAME) {
+			n_hours_dispatched = HOURS_PER_GAME;
 		}
+		this->energy_chart.setNumXTicks(n_hours_labelled);
 
-		// draw actual demands
-		for (int i = 0; i <= this->hour_of_day; i++) {
-			if (i >= 24) {
-				break;
-			}
-			sf::RectangleShape demand_rect(
-				sf::Vector2f(
-					pixels_per_hour / 4,
-					pixels_per_GWh * this->actual_energy_demand_GWh_vec[i]
-				)
-			);
-			demand_rect.setOrigin(
-				demand_rect.getLocalBounds().width / 2,
-				demand_rect.getLocalBounds().height
-			);
-			demand_rect.setPosition(
-				origin_x + (i + 0.5) * pixels_per_hour,
-				origin_y - 1
-			);
-			this->window_ptr->draw(demand_rect);
+		this->chart_value_vec.clear();
+		for (
+			int i = 0;
+			i < n_hours_labelled &&
+			i < int(this->actual_energy_demand_GWh_vec.size());
+			i++
+		) {
+			this->chart_value_vec.push_back(this->actual_energy_demand_GWh_vec[i]);
 		}
-
-		// draw legend
-		sf::Text legend_txt(
-			"Legend",
-			*(this->assets.getFont("teletype")),
-			20
-		);
-		legend_txt.setOrigin(0, legend_txt.getLocalBounds().height / 2);
-		legend_txt.setPosition(0.895 * SCREEN_WIDTH, min_y);
-		double legend_txt_h = legend_txt.getLocalBounds().height;
-		this->window_ptr->draw(legend_txt);
-
-		sf::RectangleShape demand_rect(sf::Vector2f(16, 16));
-		demand_rect.setOrigin(0, demand_rect.getLocalBounds().height / 2);
-		demand_rect.setPosition(
-			0.895 * SCREEN_WIDTH,
-			min_y + legend_txt_h + 25
-		);
-		this->window_ptr->draw(demand_rect);
-
-		sf::Text demand_txt(
+		this->energy_chart.setSeries(
+			0,
 			"Demand",
-			*(this->assets.getFont("teletype")),
-			16
+			sf::Color::White,
+			false,
+			this->chart_value_vec
 		);
-		demand_txt.setOrigin(0, demand_txt.getLocalBounds().height / 2);
-		demand_txt.setPosition(
-			0.895 * SCREEN_WIDTH + 25,
-			min_y + legend_txt_h + 25 - 2
-		);
-		this->window_ptr->draw(demand_txt);
 
-		for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-			if (this->plant_ptr_vec[i]->getTextureIndex() < 0) {
+		int n_series = 1;
+		for (int j = 0; j < this->plant_ptr_vec.size(); j++) {
+			PlantKind kind = this->plant_ptr_vec[j]->getKind();
+			if (kind == PLANT_NULL) {
 				continue;
 			}
-			sf::RectangleShape plant_rect(sf::Vector2f(16, 16));
-			plant_rect.setOrigin(0, plant_rect.getLocalBounds().height / 2);
-			plant_rect.setPosition(
-				0.895 * SCREEN_WIDTH,
-				min_y + legend_txt_h + 25 * (i + 2)
-			);
-			plant_rect.setFillColor(
-				this->plant_ptr_vec[i]->getMarbleColour()
-			);
-			this->window_ptr->draw(plant_rect);
-
-			sf::Text plant_txt(
-				"plant",
-				*(this->assets.getFont("teletype")),
-				16
-			);
-			plant_txt.setOrigin(0, plant_txt.getLocalBounds().height / 2);
-			plant_txt.setPosition(
-				0.895 * SCREEN_WIDTH + 25,
-				min_y + legend_txt_h + 25 * (i + 2) - 2
-			);
-
-			int texture_index = this->plant_ptr_vec[i]->getTextureIndex();
-			switch (texture_index) {
-				case (0):	// Coal
-					plant_txt.setString("Coal");
-					break;
-
-				case (1):	// Combined
-					plant_txt.setString("Combined");
-					break;
-
-				case (2):	// Fission
-					plant_txt.setString("Fission");
-					break;
-
-				case (3):	// Geothermal
-					plant_txt.setString("Geothermal");
-					break;
-
-				case (4):	// Hydro
-					plant_txt.setString("Hydro");
-					break;
-
-				case (5):	// Peaker
-					plant_txt.setString("Peaker");
-					break;
-
-				case (6):	// Solar
-					plant_txt.setString("Solar");
-					break;
-
-				case (7):	// Storage
-					plant_txt.setString("Storage");
-					break;
-
-				case (8):	// Tidal
-					plant_txt.setString("Tidal");
-					break;
-
-				case (9):	// Wave
-					plant_txt.setString("Wave");
-					break;
-
-				case (10):	// Wind
-					plant_txt.setString("Wind");
-					break;
 
-				default:
-					// do nothing!
-					break;
+			this->chart_value_vec.clear();
+			for (int i = 0; i < n_hours_dispatched; i++) {
+				this->chart_value_vec.push_back(
+					this->plant_ptr_vec[j]->getMarblesCommitted(i)
+				);
 			}
-
-			this->window_ptr->draw(plant_txt);
+			this->energy_chart.setSeries(
+				n_series,
+				plantDescriptor(kind).name,
+				this->plant_ptr_vec[j]->getMarbleColour(),
+				true,
+				this->chart_value_vec
+			);
+			n_series++;
 		}
+		this->energy_chart.setNumSeries(n_series);
 
-		// draw title
-		sf::Text title_txt(
-			"Energy Overlay",
-			*(this->assets.getFont("bold")),
-			24
-		);
-		title_txt.setOrigin(
-			title_txt.getLocalBounds().width / 2,
-			title_txt.getLocalBounds().height / 2
-		);
-		title_txt.setPosition(
-			SCREEN_WIDTH / 2,
-			70
-		);
-		this->window_ptr->draw(title_txt);
+		this->energy_chart.draw();
 	}
 
 	// game over overlay
@@ -9073,53 +10669,80 @@ void Game::renderOverlays(void) {
 		sf::RectangleShape background_rect;
 		background_rect.setFillColor(sf::Color(64, 64, 64, 230));
 
-		// set text font, size, and string
-		sf::Text game_over_text;
-		sf::Text score_text;
-		sf::Text message_text;
-		game_over_text.setFont(*(this->assets.getFont("teletype")));
-		game_over_text.setCharacterSize(32);
-		score_text.setFont(*(this->assets.getFont("teletype")));
-		score_text.setCharacterSize(32);
-		message_text.setFont(*(this->assets.getFont("teletype")));
-		message_text.setCharacterSize(32);
-
-		std::string score_str = "Score: " + std::to_string(this->score);
-		while (score_str.back() == '0') {
-			score_str.pop_back();
-			if (score_str.back() == '.') {
-				score_str.pop_back();
+		// set text strings
+		std::string efficiency_str =
+			"Best possible: " + std::to_string(this->optimal_score);
+		if (this->solving_flag) {
+			efficiency_str = "Best possible: solving ...";
+		}
+		while (efficiency_str.back() == '0') {
+			efficiency_str.pop_back();
+			if (efficiency_str.back() == '.') {
+				efficiency_str.pop_back();
 				break;
 			}
 		}
-		game_over_text.setString("Game Over");
-		score_text.setString(score_str);
-		message_text.setString("Press any key to restart.");
+		if (this->optimal_score > 0) {
+			efficiency_str += " (" +
+				std::to_string(int(round(100 * this->score / this->optimal_score))) +
+				"%)";
+		}
+
+		TextCacheEntry* game_over_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			32,
+			"Game Over"
+		);
+		TextCacheEntry* score_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			32,
+			this->getScoreString()
+		);
+		TextCacheEntry* efficiency_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			32,
+			efficiency_str
+		);
+		TextCacheEntry* message_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			32,
+			"Press any key to restart."
+		);
 
 		// place game over text
-		int text_width = ceil(1.01 * game_over_text.getLocalBounds().width);
-		int text_height = ceil(1.01 * game_over_text.getLocalBounds().height) + 4;
-		game_over_text.setPosition(
+		int text_width = ceil(1.01 * game_over_ptr->bounds.width);
+		int text_height = ceil(1.01 * game_over_ptr->bounds.height) + 4;
+		game_over_ptr->text.setPosition(
 			(SCREEN_WIDTH - text_width) / 2,
 			(SCREEN_HEIGHT - text_height) / 2 + text_height
 		);
 
 		// place score text
-		text_width = ceil(1.01 * score_text.getLocalBounds().width);
-		score_text.setPosition(
+		text_width = ceil(1.01 * score_ptr->bounds.width);
+		score_ptr->text.setPosition(
 			(SCREEN_WIDTH - text_width) / 2,
 			(SCREEN_HEIGHT - text_height) / 2 + text_height * 3
 		);
 
-		// place message text
-		text_width = ceil(1.01 * message_text.getLocalBounds().width);
-		message_text.setPosition(
+		// place efficiency text
+		text_width = ceil(1.01 * efficiency_ptr->bounds.width);
+		efficiency_ptr->text.setPosition(
 			(SCREEN_WIDTH - text_width) / 2,
-			(SCREEN_HEIGHT - text_height) / 2 + text_height * 5
+			(SCREEN_HEIGHT - text_height) / 2 + text_height * 4
+		);
+
+		// place message text (widest, sizes rectangle)
+		text_width = std::max(
+			text_width,
+			int(ceil(1.01 * message_ptr->bounds.width))
+		);
+		message_ptr->text.setPosition(
+			(SCREEN_WIDTH - ceil(1.01 * message_ptr->bounds.width)) / 2,
+			(SCREEN_HEIGHT - text_height) / 2 + text_height * 6
 		);
 
 		// size rectangle
-		sf::Vector2f size_vec(text_width + 4, text_height * 6 - 10);
+		sf::Vector2f size_vec(text_width + 4, text_height * 7 - 10);
 		background_rect.setSize(size_vec);
 		background_rect.setPosition(
 			(SCREEN_WIDTH - text_width) / 2 - 2,
@@ -9128,9 +10751,10 @@ void Game::renderOverlays(void) {
 
 		// draw
 		this->window_ptr->draw(background_rect);
-		this->window_ptr->draw(game_over_text);
-		this->window_ptr->draw(score_text);
-		this->window_ptr->draw(message_text);
+		this->window_ptr->draw(game_over_ptr->text);
+		this->window_ptr->draw(score_ptr->text);
+		this->window_ptr->draw(efficiency_ptr->text);
+		this->window_ptr->draw(message_ptr->text);
 	}
 
 	// text box overlay
@@ -9142,11 +10766,6 @@ void Game::renderOverlays(void) {
 		sf::RectangleShape background_rect;
 		background_rect.setFillColor(sf::Color(64, 64, 64, 192));
 
-		// set text font and size
-		sf::Text frame_text;
-		frame_text.setFont(*(this->assets.getFont("teletype")));
-		frame_text.setCharacterSize(12);
-
 		// set text string
 		std::stringstream ss;
 
@@ -9158,21 +10777,36 @@ void Game::renderOverlays(void) {
 		  	double(this->frame) / this->time_since_run_s <<
 			"\n  Frame Time (dt):  " << std::setprecision(4) <<
 			this->dt_s <<
-		  " s\n";
+		  " s\n  Text Cache:         " << std::setprecision(4) <<
+			100 * this->text_cache.getHitRate() << " % hits (" <<
+			this->text_cache.getNumEntries() << " texts)" <<
+			"\n  Missed Frames:    " << this->frame_pacer.getNumMissed() <<
+			" (slept " << std::setprecision(4) <<
+			100 * this->frame_pacer.getSleepRatio() << " %)" <<
+			"\n  Idle:                    " <<
+			(this->idle_flag ? "yes" : "no") <<
+			"\n  Lazy Assets:       " << std::setprecision(3) <<
+			double(this->assets.getResidentBytes()) / (1024 * 1024) << " MB (" <<
+			this->assets.getNumLazyLoads() << " loads, " <<
+			this->assets.getNumEvictions() << " evictions)" <<
+			"\n  Glyph Pages:        " <<
+			this->assets.getGlyphPageBytes() / 1024 << " KB (" <<
+			this->assets.getNumGlyphMisses() << " misses)\n";
 
 		std::string frame_str = ss.str();
-		frame_text.setString(frame_str);
+		this->frame_rate_text.setString(frame_str);
+		this->assets.checkGlyphs(this->teletype_font_id, 12, frame_str);
 
 		// size rectangle
 		sf::Vector2f size_vec(
-			ceil(1.05 * frame_text.getLocalBounds().width),
-			60
+			ceil(1.05 * this->frame_rate_text.getLocalBounds().width),
+			135
 		);
 		background_rect.setSize(size_vec);
 
 		// draw
 		this->window_ptr->draw(background_rect);
-		this->window_ptr->draw(frame_text);
+		this->window_ptr->draw(this->frame_rate_text);
 	}
 
 	// track overlay
@@ -9184,14 +10818,15 @@ void Game::renderOverlays(void) {
 		sf::RectangleShape background_rect;
 		background_rect.setFillColor(sf::Color(64, 64, 64, 192));
 
-		// set text font, size, and string
-		sf::Text music_paused_text;
-		music_paused_text.setFont(*(this->assets.getFont("teletype")));
-		music_paused_text.setCharacterSize(16);
-		music_paused_text.setString("MUSIC PAUSED");
-		int text_width = ceil(1.01 * music_paused_text.getLocalBounds().width);
-		int text_height = ceil(1.01 * music_paused_text.getLocalBounds().height) + 4;
-		music_paused_text.setPosition(
+		// get text
+		TextCacheEntry* music_paused_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			16,
+			"MUSIC PAUSED"
+		);
+		int text_width = ceil(1.01 * music_paused_ptr->bounds.width);
+		int text_height = ceil(1.01 * music_paused_ptr->bounds.height) + 4;
+		music_paused_ptr->text.setPosition(
 			(SCREEN_WIDTH - text_width) / 2,
 			SCREEN_HEIGHT - text_height - 8
 		);
@@ -9206,7 +10841,7 @@ void Game::renderOverlays(void) {
 
 		// draw
 		this->window_ptr->draw(background_rect);
-		this->window_ptr->draw(music_paused_text);
+		this->window_ptr->draw(music_paused_ptr->text);
 	}
 
 	// quit round overlay
@@ -9215,14 +10850,15 @@ void Game::renderOverlays(void) {
 		sf::RectangleShape background_rect;
 		background_rect.setFillColor(sf::Color(64, 64, 64, 192));
 
-		// set text font, size, and string
-		sf::Text quit_game_text;
-		quit_game_text.setFont(*(this->assets.getFont("teletype")));
-		quit_game_text.setCharacterSize(32);
-		quit_game_text.setString("Are you sure you want to quit and restart? (Y/N)");
-		int text_width = ceil(1.01 * quit_game_text.getLocalBounds().width);
-		int text_height = ceil(1.01 * quit_game_text.getLocalBounds().height) + 4;
-		quit_game_text.setPosition(
+		// get text
+		TextCacheEntry* quit_game_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			32,
+			"Are you sure you want to quit and restart? (Y/N)"
+		);
+		int text_width = ceil(1.01 * quit_game_ptr->bounds.width);
+		int text_height = ceil(1.01 * quit_game_ptr->bounds.height) + 4;
+		quit_game_ptr->text.setPosition(
 			(SCREEN_WIDTH - text_width) / 2,
 			(SCREEN_HEIGHT - text_height) / 2 + 30
 		);
@@ -9237,7 +10873,7 @@ void Game::renderOverlays(void) {
 
 		// draw
 		this->window_ptr->draw(background_rect);
-		this->window_ptr->draw(quit_game_text);
+		this->window_ptr->draw(quit_game_ptr->text);
 	}
 
 	// quit game overlay
@@ -9246,14 +10882,15 @@ void Game::renderOverlays(void) {
 		sf::RectangleShape background_rect;
 		background_rect.setFillColor(sf::Color(64, 64, 64, 192));
 
-		// set text font, size, and string
-		sf::Text quit_game_text;
-		quit_game_text.setFont(*(this->assets.getFont("teletype")));
-		quit_game_text.setCharacterSize(32);
-		quit_game_text.setString("Are you sure you want to quit and close the game? (Y/N)");
-		int text_width = ceil(1.01 * quit_game_text.getLocalBounds().width);
-		int text_height = ceil(1.01 * quit_game_text.getLocalBounds().height) + 4;
-		quit_game_text.setPosition(
+		// get text
+		TextCacheEntry* quit_game_ptr = this->text_cache.get(
+			this->teletype_font_id,
+			32,
+			"Are you sure you want to quit and close the game? (Y/N)"
+		);
+		int text_width = ceil(1.01 * quit_game_ptr->bounds.width);
+		int text_height = ceil(1.01 * quit_game_ptr->bounds.height) + 4;
+		quit_game_ptr->text.setPosition(
 			(SCREEN_WIDTH - text_width) / 2,
 			(SCREEN_HEIGHT - text_height) / 2 + 30
 		);
@@ -9268,7 +10905,7 @@ void Game::renderOverlays(void) {
 
 		// draw
 		this->window_ptr->draw(background_rect);
-		this->window_ptr->draw(quit_game_text);
+		this->window_ptr->draw(quit_game_ptr->text);
 	}
 
 	// wasd overlays
@@ -9293,58 +10930,24 @@ void Game::renderOverlays(void) {
 
 void Game::render(void) {
 	/*
-	 *	Method to render the game to the screen
+	 *	Method to render the game to the screen (interpolating between the
+	 *	last two fixed steps)
 	 */
 
-	// clear back buffer
-	this->window_ptr->clear();
-
-	// draw backgrounds
-
-	//	1. sky disk
-	this->sky_disk.drawFrame(this->hour_of_day);
+	double render_ratio = this->getRenderRatio();
 
-	//	2. overcast and clouds
-	this->overcast_clouds.drawFrame(
-		this->wind_speed_ratio,
-		this->cloud_cover_ratio,
-		this->hour_of_day
-	);
-
-	//	3. smog dome (circ, behind city)
-	sf::CircleShape smog_circ;
-	smog_circ.setFillColor(
-		sf::Color(
-			SMOG_COLOUR.r,
-			SMOG_COLOUR.g,
-			SMOG_COLOUR.b,
-			this->smog_ratio * 200
-		)
-	);
-	double radius = 1.1 * SCREEN_HEIGHT / 3;
-	smog_circ.setRadius(radius);
-	smog_circ.setOrigin(radius, radius);
-	smog_circ.setPosition(
-		sf::Vector2f(
-			SCREEN_WIDTH / 2,
-			SCREEN_HEIGHT / 2
-		)
-	);
-	this->window_ptr->draw(smog_circ);
-
-	//	4. foreground + Plinko City
-	this->foreground.drawFrame(this->powered_flag, this->hour_of_day);
+	// clear back buffer
+	this->window_ptr->clear();
 
-	//	5. wind sock
-	this->wind_sock.drawFrame(this->wind_speed_ratio, this->hour_of_day);
+	// draw backgrounds
+	this->renderBackground(render_ratio);
 
 	// draw objects if not at main menu
 	if (this->phase_manager.getPhase() != 0) {
 		//std::cout << this->plant_ptr_vec.size() << std::endl;
+		this->particle_pool.drawFrame(render_ratio);
 		for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-			this->plant_ptr_vec[i]->drawMarbles();
-			this->plant_ptr_vec[i]->drawSteam(this->wind_speed_ratio);
-			this->plant_ptr_vec[i]->drawSmoke(this->wind_speed_ratio);
+			this->plant_ptr_vec[i]->drawMarbles(render_ratio, &(this->marble_batch));
 			this->plant_ptr_vec[i]->drawFrame(
 				i == this->phase_manager.getIndex(),
 				this->phase_manager.getPhase() == 1
@@ -9352,25 +10955,28 @@ void Game::render(void) {
 
 			if (
 				this->can_defer_load &&
-				this->plant_ptr_vec[i]->getTextureIndex() == 7 &&	// Storage
+				this->plant_ptr_vec[i]->getKind() == PLANT_STORAGE &&
 				this->phase_manager.getPhase() == 1
 			) {
-				sf::Text load_defer_txt(
-					"[L]: DEFER LOAD",
-					*(this->assets.getFont("bold")),
-					16
+				TextCacheEntry* load_defer_ptr = this->text_cache.get(
+					this->bold_font_id,
+					16,
+					"[L]: DEFER LOAD"
 				);
-				load_defer_txt.setOrigin(
-					load_defer_txt.getLocalBounds().width / 2,
-					load_defer_txt.getLocalBounds().height / 2
+				load_defer_ptr->text.setOrigin(
+					load_defer_ptr->bounds.width / 2,
+					load_defer_ptr->bounds.height / 2
 				);
-				load_defer_txt.setPosition(
+				load_defer_ptr->text.setPosition(
 					this->plant_ptr_vec[i]->getPositionX(),
 					this->plant_ptr_vec[i]->getPositionY() - 128
 				);
-				this->window_ptr->draw(load_defer_txt);
+				this->window_ptr->draw(load_defer_ptr->text);
 			}
 		}
+
+		// in flight marbles, all plants in one batch
+		this->marble_batch.draw();
 	}
 
 	// switch between phases
@@ -9406,8 +11012,8 @@ void Game::render(void) {
 		case (3):
 			/* TESTING */
 		//	/*
-				if (this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex() == 4
-							|| this->plant_ptr_vec[this->phase_manager.getIndex()]->getTextureIndex() == 7) {
+				if (this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind() == PLANT_HYDRO
+							|| this->plant_ptr_vec[this->phase_manager.getIndex()]->getKind() == PLANT_STORAGE) {
 								std::cout << "Index:\t"
 								<< this->phase_manager.getIndex()
 								<< "\tCapacity:\t"
@@ -9433,185 +11039,694 @@ void Game::render(void) {
 		//	*/
 			/* END TESTING */
 
-			/*
-			for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-				this->plant_ptr_vec[i]->drawSteam(this->wind_speed_ratio);
-				this->plant_ptr_vec[i]->drawSmoke(this->wind_speed_ratio);
-				this->plant_ptr_vec[i]->drawFrame(i == this->phase_manager.getIndex());
-			}
-			*/
-			break;// end of case 3: selecting capacities
+			/*
+			for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
+				this->plant_ptr_vec[i]->drawSteam(this->wind_speed_ratio);
+				this->plant_ptr_vec[i]->drawSmoke(this->wind_speed_ratio);
+				this->plant_ptr_vec[i]->drawFrame(i == this->phase_manager.getIndex());
+			}
+			*/
+			break;// end of case 3: selecting capacities
+
+		case (4):
+			/* TESTING */
+			/*
+				std::cout << "geothermal bool values:\t"
+				<< this->phase_manager.getGeothermalPresent(0)
+				<< "\t" << this->phase_manager.getGeothermalPresent(1)
+				<< "\t" << this->phase_manager.getGeothermalPresent(2)
+				<< "\t" << this->phase_manager.getGeothermalPresent(3)
+				<< std::endl;
+			*/
+			/* END TESTING */
+
+			break; // end of case 4: rolling for geothermal
+
+		case (5): // game over screen
+			// does nothing for now
+			break; // end of case 5: game over
+
+		// menu
+		default:
+			// probably just call drawMenu or something for final product
+			// init rectangle
+			sf::RectangleShape background_rect;
+			background_rect.setFillColor(sf::Color(64, 64, 64, 230));
+
+			// get text
+			TextCacheEntry* menu_ptr = this->text_cache.get(
+				this->teletype_font_id,
+				32,
+				"You are at the menu.\nPress Spacebar to play."
+			);
+			int text_width = ceil(1.01 * menu_ptr->bounds.width);
+			int text_height = ceil(1.01 * menu_ptr->bounds.height) + 4;
+			menu_ptr->text.setPosition(
+				(SCREEN_WIDTH - text_width) / 2,
+				(SCREEN_HEIGHT - text_height) / 2 + 26
+			);
+
+			// size rectangle
+			sf::Vector2f size_vec(text_width + 4, text_height + 2);
+			background_rect.setSize(size_vec);
+			background_rect.setPosition(
+				(SCREEN_WIDTH - text_width) / 2 - 2,
+				(SCREEN_HEIGHT - text_height) / 2 + 32
+			);
+
+			// draw
+			this->window_ptr->draw(background_rect);
+			this->window_ptr->draw(menu_ptr->text);
+
+	} //end switch phase
+
+	if (this->fade_alpha > 0) {
+		sf::RectangleShape black_rect(sf::Vector2f(SCREEN_WIDTH, SCREEN_HEIGHT));
+		black_rect.setFillColor(
+			sf::Color(0, 0, 0, this->fade_alpha)
+		);
+
+		this->window_ptr->draw(black_rect);
+	}
+	else {
+		// draw overlays
+		this->renderOverlays();
+	}
+	this->text_cache.endFrame();
+
+	// blit back buffer to front buffer
+	this->displayFrame();
+
+	return;
+}	// end Game::render()
+
+
+void Game::initPlants() {
+	std::vector<int> position_x_vec = {
+		32 + 64,
+		32 + 128 + 32 + 64,
+		32 + 128 + 32 + 128 + 32 + 64,
+		int(SCREEN_WIDTH) - 32 - 128 - 32 - 128 - 32 - 64,
+		int(SCREEN_WIDTH) - 32 - 128 - 32 - 64,
+		int(SCREEN_WIDTH) - 32 - 64
+	};
+	for (int i = 0; i < position_x_vec.size(); i++) {
+		this->plant_ptr_vec.push_back(
+			new Plant(
+				position_x_vec[i],	// position_x
+				SCREEN_HEIGHT - 64,	// position_y
+				1,
+				this->window_ptr,
+				&(this->assets)
+			)
+		);
+	}
+} // end Game::initPlants()
+
+
+void Game::clearPlants(void) {
+	/*
+	 *	Method to clear plant_ptr_vec
+	 */
+
+	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
+ 		delete this->plant_ptr_vec[i];
+ 	}
+ 	this->plant_ptr_vec.clear();
+
+	// along with their particles
+	this->particle_pool.clear();
+
+	return;
+}	// end Game::clearPlants()
+
+
+void Game::run(void) {
+	/*
+	 *	Method to run instance of Game
+	 */
+
+	// stream out seconds per frame
+	std::cout << "Running game (frames per second: " <<
+		FRAMES_PER_SECOND << ") ...\n" << std::endl;
+
+	// start music_player
+	this->music_player.play();
+
+	// render title screen (blocks until complete)
+	this->renderTitle();
+
+	// while window is open (i.e., game is alive) ...
+	while (this->window_ptr->isOpen()) {
+		// update time elapsed since run()
+		this->time_since_run_s = this->getRunTimeSeconds();
+
+		// if "clock tick" ...
+		if (
+			this->time_since_run_s >= (this->frame + 1) * SECONDS_PER_FRAME
+		) {
+			// handle events, update (one fixed step), and log transitions
+			if (this->fade_alpha == 0) {
+				this->handleEvents();
+			}
+			this->update(SECONDS_PER_FRAME);
+			this->logPhase();
+			this->prefetchAssets();
+
+			// increment frame count, render if caught up
+			this->frame++;
+			if (this->renderDue()) {
+				this->render();
+			}
+
+			// evict cold lazy assets (between frames, so none are in use)
+			this->assets.endFrame();
+		}
+
+		// sleep until next "clock tick"
+		this->waitNextStep();
+	}
+
+	// report pacing (not paced if headless)
+	if (this->frame_pacer.getNumWaits() > 0) {
+		this->frame_pacer.printReport();
+	}
+
+	// close out session log
+	if (this->record_flag) {
+		this->record_log.pushEvent(
+			this->frame,
+			SESSION_END,
+			int(round(4 * this->score))
+		);
+		this->record_log.write(this->session_path);
+		std::cout << "\nsession recorded to " << this->session_path << " (" <<
+			this->record_log.getNumEvents() << " events, " << this->frame <<
+			" frames)" << std::endl;
+	}
+
+	return;
+}	// end Game::run()
+
+
+double Game::getScore(void) {
+	return this->score;
+}	// end Game::getScore()
+
+
+int Game::getNumReplayDivergences(void) {
+	return this->n_replay_divergences;
+}	// end Game::getNumReplayDivergences()
+
+
+void Game::recordSession(std::string path) {
+	/*
+	 *	Method to record this session (seed, key events, phase transitions) to
+	 *	the given path; the log is rewritten at every phase transition, so a
+	 *	crashed session is still kept up to its last phase. May be combined
+	 *	with replaySession(), to record the replay (i.e. re-record a session)
+	 */
+
+	if (this->session_mode == SESSION_OFF) {
+		this->session_mode = SESSION_RECORD;
+	}
+	this->record_flag = true;
+	this->session_path = path;
+	this->record_log.reset(randomService().getSeed());
+
+	std::cout << "\nrecording session to " << path << std::endl;
+	return;
+}	// end Game::recordSession()
+
+
+void Game::replaySession(const SessionLog& session_log, int replay_speed) {
+	/*
+	 *	Method to replay a recorded session instead of taking key input (the
+	 *	random service must have been reseeded from the log before this Game
+	 *	was constructed); replay_speed is a multiple of real time, or 0 to
+	 *	fast-forward with the window hidden, no display, and no sound
+	 */
+
+	this->session_mode = SESSION_REPLAY;
+	this->session_log = session_log;
+	this->session_log.rewind();
+	this->replay_speed = replay_speed;
+	if (this->replay_speed < 0) {
+		this->replay_speed = 0;
+	}
+
+	if (this->replay_speed != 1) {
+		// frames come back to back, don't wait on vertical sync
+		this->frame_pacer.setVerticalSync(this->window_ptr, false);
+	}
+	if (this->replay_speed == 0) {
+		this->window_ptr->setVisible(false);
+		sf::Listener::setGlobalVolume(0);
+	}
+
+	std::cout << "\nreplaying session (" << this->session_log.getNumEvents() <<
+		" events, speed ";
+	if (this->replay_speed == 0) {
+		std::cout << "headless";
+	}
+	else {
+		std::cout << this->replay_speed << "x";
+	}
+	std::cout << ")" << std::endl;
+
+	return;
+}	// end Game::replaySession()
+
+
+void Game::setTargetFrameRate(double target_rate) {
+	/*
+	 *	Method to set the target frame (render) rate. Renders only follow
+	 *	fixed steps, so this is capped at FRAMES_PER_SECOND; below that, steps
+	 *	are caught up in pairs (or more) between renders, by renderDue().
+	 */
+
+	if (target_rate > FRAMES_PER_SECOND) {
+		target_rate = FRAMES_PER_SECOND;
+	}
+	this->frame_pacer.setTargetRate(target_rate);
+
+	std::cout << "\ntarget frame rate: " << this->frame_pacer.getTargetRate() <<
+		" fps" << std::endl;
+	return;
+}	// end Game::setTargetFrameRate()
+
+
+void Game::setAssetBudget(double budget_MB) {
+	/*
+	 *	Method to set the memory budget [MB] of lazily loaded assets (see
+	 *	Assets); colder assets are evicted while over it
+	 */
+
+	this->assets.setResidencyBudget(
+		(unsigned long long)(round(budget_MB * 1024 * 1024))
+	);
+
+	std::cout << "\nasset residency budget: " << budget_MB << " MB" << std::endl;
+	return;
+}	// end Game::setAssetBudget()
+
+
+double Game::getRunTimeSeconds(void) {
+	/*
+	 *	Method to get the time since run(), which paces frames; in a replay
+	 *	this is scaled by the replay speed, or always a frame ahead when
+	 *	fast-forwarding (so frames run back to back). Less any time dropped
+	 *	by renderDue().
+	 */
+
+	if (this->session_mode == SESSION_REPLAY) {
+		if (this->replay_speed == 0) {
+			return (this->frame + 1) * SECONDS_PER_FRAME;
+		}
+		return this->replay_speed * this->clock.getElapsedTime().asSeconds() -
+			this->clock_offset_s;
+	}
+
+	return this->clock.getElapsedTime().asSeconds() - this->clock_offset_s;
+}	// end Game::getRunTimeSeconds()
+
+
+double Game::getRenderRatio(void) {
+	/*
+	 *	Method to get how far the clock is into the next fixed step (0 to 1),
+	 *	i.e. how far to interpolate from the last state to the current one
+	 */
+
+	double render_ratio = (
+		this->getRunTimeSeconds() - this->frame * SECONDS_PER_FRAME
+	) * FRAMES_PER_SECOND;
+
+	if (render_ratio < 0) {
+		render_ratio = 0;
+	}
+	else if (render_ratio > 1) {
+		render_ratio = 1;
+	}
+
+	return render_ratio;
+}	// end Game::getRenderRatio()
+
+
+bool Game::checkIdle(void) {
+	/*
+	 *	Method to check if the game is idle, i.e. nothing but slow ambient
+	 *	animation has changed for IDLE_DELAY_SECONDS: no input (any event),
+	 *	fades, marbles, particles, dice, time transitions, or track info
+	 *	fades (a text box opens on input, so it is always done expanding by
+	 *	then). Any of these marks the current frame active, so input ends
+	 *	idle on the step it arrives.
+	 */
+
+	bool active_flag = (
+		this->fade_alpha > 0 ||
+		this->hour_of_day != this->next_hour_of_day ||
+		this->particle_pool.getNumParticles() > 0 ||
+		(this->phase_manager.getPhase() == 4 && this->dice_roll.getRollingDice()) ||
+		this->music_player.isRenderingTrackInfo()
+	);
+	for (int i = 0; !active_flag && i < this->plant_ptr_vec.size(); i++) {
+		if (!this->plant_ptr_vec[i]->marblesFinished()) {
+			active_flag = true;
+		}
+	}
+
+	if (active_flag) {
+		this->last_active_frame = this->frame;
+	}
+
+	this->idle_flag = (
+		this->frame - this->last_active_frame >=
+		IDLE_DELAY_SECONDS * FRAMES_PER_SECOND
+	);
+	return this->idle_flag;
+}	// end Game::checkIdle()
+
+
+bool Game::renderDue(void) {
+	/*
+	 *	Method to check if a render is due after a fixed step, i.e. if the
+	 *	next step is not due yet. A slow machine thus drops renders and keeps
+	 *	game time, but only up to MAX_STEPS_PER_RENDER steps in a row; past
+	 *	that the backlog is dropped (the game slows down rather than never
+	 *	rendering). Once idle (see checkIdle()), only every
+	 *	IDLE_STEPS_PER_RENDER-th step renders. A headless replay never renders.
+	 */
+
+	this->steps_since_render++;
+
+	if (this->session_mode == SESSION_REPLAY && this->replay_speed == 0) {
+		return false;
+	}
+
+	// once idle, render only every few steps (input is still polled every step)
+	if (this->checkIdle() && this->steps_since_render < IDLE_STEPS_PER_RENDER) {
+		return false;
+	}
+
+	this->time_since_run_s = this->getRunTimeSeconds();
+	double behind_s = this->time_since_run_s -
+		(this->frame + 1) * SECONDS_PER_FRAME;
+
+	if (behind_s >= 0) {
+		if (this->steps_since_render < MAX_STEPS_PER_RENDER) {
+			return false;
+		}
+
+		this->clock_offset_s += behind_s + SECONDS_PER_FRAME;
+		this->time_since_run_s -= behind_s + SECONDS_PER_FRAME;
+	}
+
+	// compute dt (between renders), update frame time
+	this->dt_s = this->time_since_run_s - this->frame_time_s;
+	this->frame_time_s = this->time_since_run_s;
+
+	this->steps_since_render = 0;
+	return true;
+}	// end Game::renderDue()
+
+
+void Game::waitNextStep(void) {
+	/*
+	 *	Method to sleep until the next fixed step is due (all game loops wait
+	 *	through here); a replay waits scaled by its speed, and a headless
+	 *	replay never waits. Idle does not slow the wakes, only the renders
+	 *	(see renderDue()), so input is still polled every step.
+	 */
+
+	double time_scale = 1;
+	if (this->session_mode == SESSION_REPLAY) {
+		time_scale = this->replay_speed;
+	}
+
+	this->frame_pacer.waitUntil(
+		(this->frame + 1) * SECONDS_PER_FRAME,
+		this->getRunTimeSeconds(),
+		time_scale
+	);
+
+	return;
+}	// end Game::waitNextStep()
+
 
-		case (4):
-			/* TESTING */
-			/*
-				std::cout << "geothermal bool values:\t"
-				<< this->phase_manager.getGeothermalPresent(0)
-				<< "\t" << this->phase_manager.getGeothermalPresent(1)
-				<< "\t" << this->phase_manager.getGeothermalPresent(2)
-				<< "\t" << this->phase_manager.getGeothermalPresent(3)
-				<< std::endl;
-			*/
-			/* END TESTING */
+bool Game::pollEvent(sf::Event* event_ptr) {
+	/*
+	 *	Method to poll the next event (all event loops go through here);
+	 *	records key events when recording, and plays back recorded key events
+	 *	on their frames when replaying (real input is then ignored, save for
+	 *	closing the window, and played back keys are recorded in turn)
+	 */
 
-			break; // end of case 4: rolling for geothermal
+	if (this->session_mode == SESSION_REPLAY) {
+		SessionEvent session_event;
+		while (this->session_log.nextEvent(this->frame, &session_event)) {
+			sf::Event event;
+			switch (session_event.type) {
+				case (SESSION_KEY_PRESS):
+				case (SESSION_KEY_RELEASE):
+					if (session_event.type == SESSION_KEY_PRESS) {
+						event.type = sf::Event::KeyPressed;
+					}
+					else {
+						event.type = sf::Event::KeyReleased;
+					}
+					event.key.code = sf::Keyboard::Key(session_event.value);
+					event.key.alt = false;
+					event.key.control = false;
+					event.key.shift = false;
+					event.key.system = false;
+					*event_ptr = event;
+					this->last_active_frame = this->frame;
+
+					if (this->record_flag) {
+						this->record_log.pushEvent(
+							this->frame,
+							session_event.type,
+							session_event.value
+						);
+					}
+					return true;
 
-		case (5): // game over screen
-			// does nothing for now
-			break; // end of case 5: game over
+				case (SESSION_END):
+					std::cout << "\nreplay finished (frame " << this->frame <<
+						"): score " << this->score << ", recorded " <<
+						session_event.value / 4.0 << std::endl;
+					event.type = sf::Event::Closed;
+					*event_ptr = event;
+					return true;
 
-		// menu
-		default:
-			// probably just call drawMenu or something for final product
-			// init rectangle
-			sf::RectangleShape background_rect;
-			background_rect.setFillColor(sf::Color(64, 64, 64, 230));
+				default:
+					// do nothing! (phase transitions are checked in logPhase())
+					break;
+			}
+		}
 
-			// set text font, size, and string
-			sf::Text menu_text;
-			menu_text.setFont(*(this->assets.getFont("teletype")));
-			menu_text.setCharacterSize(32);
-			menu_text.setString("You are at the menu.\nPress Spacebar to play.");
-			int text_width = ceil(1.01 * menu_text.getLocalBounds().width);
-			int text_height = ceil(1.01 * menu_text.getLocalBounds().height) + 4;
-			menu_text.setPosition(
-				(SCREEN_WIDTH - text_width) / 2,
-				(SCREEN_HEIGHT - text_height) / 2 + 26
-			);
+		while (this->window_ptr->pollEvent(*event_ptr)) {
+			if (event_ptr->type == sf::Event::Closed) {
+				return true;
+			}
+		}
+		return false;
+	}
 
-			// size rectangle
-			sf::Vector2f size_vec(text_width + 4, text_height + 2);
-			background_rect.setSize(size_vec);
-			background_rect.setPosition(
-				(SCREEN_WIDTH - text_width) / 2 - 2,
-				(SCREEN_HEIGHT - text_height) / 2 + 32
-			);
+	if (!this->window_ptr->pollEvent(*event_ptr)) {
+		return false;
+	}
+	this->last_active_frame = this->frame;
 
-			// draw
-			this->window_ptr->draw(background_rect);
-			this->window_ptr->draw(menu_text);
+	if (this->record_flag) {
+		switch (event_ptr->type) {
+			case (sf::Event::KeyPressed):
+				this->record_log.pushEvent(
+					this->frame,
+					SESSION_KEY_PRESS,
+					event_ptr->key.code
+				);
+				break;
 
-	} //end switch phase
+			case (sf::Event::KeyReleased):
+				this->record_log.pushEvent(
+					this->frame,
+					SESSION_KEY_RELEASE,
+					event_ptr->key.code
+				);
+				break;
 
-	if (this->fade_alpha > 0) {
-		sf::RectangleShape black_rect(sf::Vector2f(SCREEN_WIDTH, SCREEN_HEIGHT));
-		black_rect.setFillColor(
-			sf::Color(0, 0, 0, this->fade_alpha)
-		);
+			default:
+				// do nothing!
+				break;
+		}
+	}
 
-		this->window_ptr->draw(black_rect);
+	return true;
+}	// end Game::pollEvent()
 
-		this->fade_alpha -= 2;
-		if (this->fade_alpha <= 0) {
-			this->fade_alpha = 0;
 
-			// init tutorial
-			// display tutorial
-			this->text_box.makeBox(
-				std::string(TEXT_TUTORIAL),
-				"bold",
-				0.02 * SCREEN_HEIGHT,
-				SCREEN_WIDTH / 8,
-				SCREEN_HEIGHT / 8,
-				SCREEN_WIDTH / 2,
-				SCREEN_HEIGHT / 3
-			);
+std::string Game::getScoreString(void) {
+	/*
+	 *	Method to get the score as displayed ("Score: " + score, trailing
+	 *	zeros trimmed), formatted only when the score changes
+	 */
 
-			//reset pictorial_tutorial
-			this->pictorial_tutorial.reset();
+	if (this->score_str.empty() || this->score != this->score_str_score) {
+		this->score_str = "Score: " + std::to_string(this->score);
+		while (this->score_str.back() == '0') {
+			this->score_str.pop_back();
+			if (this->score_str.back() == '.') {
+				this->score_str.pop_back();
+				break;
+			}
 		}
+		this->score_str_score = this->score;
 	}
-	else {
-		// draw overlays
-		this->renderOverlays();
+
+	return this->score_str;
+}	// end Game::getScoreString()
+
+
+std::string Game::getTimeString(void) {
+	/*
+	 *	Method to get the clock as displayed (HH:MM), formatted only when the
+	 *	minute changes
+	 */
+
+	int hour = int(this->hour_of_day);
+	int min = int((this->hour_of_day - int(this->hour_of_day)) * 60);
+
+	if (60 * hour + min != this->time_str_minutes) {
+		this->time_str = "";
+		if (hour < 10) {
+			this->time_str += "0";
+		}
+		this->time_str += std::to_string(hour) + ":";
+		if (min < 10) {
+			this->time_str += "0";
+		}
+		this->time_str += std::to_string(min);
+
+		this->time_str_minutes = 60 * hour + min;
 	}
 
-	// blit back buffer to front buffer
-	this->window_ptr->display();
+	return this->time_str;
+}	// end Game::getTimeString()
 
-	return;
-}	// end Game::render()
 
+void Game::displayFrame(void) {
+	/*
+	 *	Method to flip the display (all render loops go through here); a fast
+	 *	replay only shows every replay_speed-th frame, a headless one none
+	 */
 
-void Game::initPlants() {
-	std::vector<int> position_x_vec = {
-		32 + 64,
-		32 + 128 + 32 + 64,
-		32 + 128 + 32 + 128 + 32 + 64,
-		int(SCREEN_WIDTH) - 32 - 128 - 32 - 128 - 32 - 64,
-		int(SCREEN_WIDTH) - 32 - 128 - 32 - 64,
-		int(SCREEN_WIDTH) - 32 - 64
-	};
-	for (int i = 0; i < position_x_vec.size(); i++) {
-		this->plant_ptr_vec.push_back(
-			new Plant(
-				position_x_vec[i],	// position_x
-				SCREEN_HEIGHT - 64,	// position_y
-				1,
-				this->window_ptr,
-				&(this->assets)
-			)
-		);
+	if (this->session_mode == SESSION_REPLAY) {
+		if (this->replay_speed == 0) {
+			return;
+		}
+		if (this->frame % this->replay_speed != 0) {
+			return;
+		}
 	}
-} // end Game::initPlants()
 
+	this->window_ptr->display();
+	return;
+}	// end Game::displayFrame()
 
-void Game::clearPlants(void) {
+
+void Game::logPhase(void) {
 	/*
-	 *	Method to clear plant_ptr_vec
+	 *	Method to log phase transitions when recording, and to check them
+	 *	against the recording when replaying
 	 */
 
-	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
- 		delete this->plant_ptr_vec[i];
- 	}
- 	this->plant_ptr_vec.clear();
+	int phase = this->phase_manager.getPhase();
+	if (phase == this->session_phase) {
+		return;
+	}
+	this->session_phase = phase;
+
+	if (this->record_flag) {
+		this->record_log.pushEvent(this->frame, SESSION_PHASE, phase);
+		this->record_log.write(this->session_path);
+	}
+
+	if (
+		this->session_mode == SESSION_REPLAY &&
+		!this->session_log.hasEvent(this->frame, SESSION_PHASE, phase)
+	) {
+		this->n_replay_divergences++;
+		std::cout << "\nWARNING: replay diverged from recording (phase " <<
+			phase << " at frame " << this->frame << ")" << std::endl;
+	}
 
 	return;
-}	// end Game::clearPlants()
+}	// end Game::logPhase()
 
 
-void Game::run(void) {
+void Game::prefetchAssets(void) {
 	/*
-	 *	Method to run instance of Game
+	 *	Method to prefetch, on a phase change, the lazy assets used in the new
+	 *	phase and the one likely to follow it (so they are not loaded on the
+	 *	frame they are first drawn or played)
 	 */
 
-	// stream out seconds per frame
-	std::cout << "Running game (frames per second: " <<
-		FRAMES_PER_SECOND << ") ...\n" << std::endl;
+	int phase = this->phase_manager.getPhase();
+	if (phase == this->prefetch_phase) {
+		return;
+	}
+	this->prefetch_phase = phase;
 
-	// start music_player
-	this->music_player.play();
+	switch (phase) {
+		case (0):	// menu, then selecting plants
+			this->assets.prefetchTexture("wasd");
+			this->assets.prefetchTexture("spacebar");
+			break;
 
-	// render title screen (blocks until complete)
-	this->renderTitle();
+		case (2):	// selecting plants, then selecting capacities
+			this->assets.prefetchTexture("wasd");
+			this->assets.prefetchTexture("spacebar");
+			this->assets.prefetchSound("capacity token");
+			this->assets.prefetchSound("token return");
+			break;
 
-	// while window is open (i.e., game is alive) ...
-	while (this->window_ptr->isOpen()) {
-		// update time elapsed since run()
-		this->time_since_run_s = this->clock.getElapsedTime().asSeconds();
+		case (3):	// selecting capacities, then geothermal dice or playing
+			this->assets.prefetchTexture("wasd");
+			this->assets.prefetchTexture("spacebar");
+			this->assets.prefetchTexture("dice");
+			this->assets.prefetchSound("capacity token");
+			this->assets.prefetchSound("token return");
+			this->assets.prefetchSound("dispatch");
+			break;
 
-		// if "clock tick" ...
-		if (
-			this->time_since_run_s >= (this->frame + 1) * SECONDS_PER_FRAME
-		) {
-			// compute dt, update frame time
-			this->dt_s = this->time_since_run_s - this->frame_time_s;
-			this->frame_time_s = this->time_since_run_s;
+		case (4):	// geothermal dice, then playing
+			this->assets.prefetchTexture("dice");
+			this->assets.prefetchTexture("spacebar");
+			this->assets.prefetchSound("dispatch");
+			this->assets.prefetchSound("powering up");
+			this->assets.prefetchSound("powering down");
+			break;
 
-			// handle events, update, transitions, and render
-			if (this->fade_alpha == 0) {
-				this->handleEvents();
-			}
-			this->update();
-			this->render();
+		case (1):	// playing, then game over
+			this->assets.prefetchTexture("wasd");
+			this->assets.prefetchTexture("spacebar");
+			this->assets.prefetchTexture("tidal selection");
+			this->assets.prefetchTexture("wave selection");
+			this->assets.prefetchTexture("wind selection");
+			this->assets.prefetchSound("dispatch");
+			this->assets.prefetchSound("powering up");
+			this->assets.prefetchSound("powering down");
+			this->assets.prefetchSound("clock chime");
+			break;
 
-			// increment frame count
-			this->frame++;
-		}
+		default:
+			// do nothing!
+			break;
 	}
 
 	return;
-}	// end Game::run()
+}	// end Game::prefetchAssets()
 
 
 void Game::setHourDay(double hour_of_day) {
@@ -9674,16 +11789,17 @@ bool Game::transition(void) {
 	// set return flag
 	bool ret_flag = false;
 
-	// while not clock tick, wait
+	// wait for clock tick
 	while (this->time_since_run_s < (this->frame + 1) * SECONDS_PER_FRAME) {
-		this->time_since_run_s = this->clock.getElapsedTime().asSeconds();
+		this->waitNextStep();
+		this->time_since_run_s = this->getRunTimeSeconds();
 	}
 
 	// check if rolling marbles finished
 	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-		int texture_key = this->plant_ptr_vec[i]->getTextureIndex();
+		PlantKind kind = this->plant_ptr_vec[i]->getKind();
 
-		if (texture_key < 0) {
+		if (kind == PLANT_NULL) {
 			continue;
 		}
 
@@ -9773,7 +11889,7 @@ bool Game::transition(void) {
 
 	// handle select closing events, update, and render
 	sf::Event event;
-	while (this->window_ptr->pollEvent(event))
+	while (this->pollEvent(&event))
 	{
 		switch (event.type) {
 			case (sf::Event::Closed):	// receive "close window" signal
@@ -9809,38 +11925,183 @@ bool Game::transition(void) {
 					this->cloud_cover_ratio = this->next_cloud_cover_ratio;
 					this->smog_ratio = this->next_smog_ratio;
 
-					ret_flag = false;
-				}
-				break;
+					ret_flag = false;
+				}
+				break;
+
+			default:
+				// do nothing!
+				break;
+		}
+	}
+
+	// update (one fixed step), render if caught up
+	this->update(SECONDS_PER_FRAME);
+	this->frame++;
+	if (this->renderDue()) {
+		this->render();
+	}
+
+	// reset phase manager index, check time value
+	if (!ret_flag) {
+		this->phase_manager.setIndex(0);
+		if (this->hour_of_day >= 24) {
+			this->assets.getSound("clock chime")->play();
+			this->solveOptimalDispatch();
+			this->phase_manager.setPhase(5);
+			this->draw_energy_overlay = true;
+		}
+	}
+
+	return ret_flag;
+}	// end Game::transition()
+
+
+void Game::solveOptimalDispatch(void) {
+	/*
+	 *	Method to solve for the best score possible today with the built
+	 *	portfolio, given the day's actual demand and renewable production
+	 *	(runs on solve_thread, so the game over overlay shows "solving" until
+	 *	collectOptimalDispatch())
+	 */
+
+	this->collectOptimalDispatch();	// (if still solving)
+
+	std::vector<int> demand_GWh_vec(HOURS_PER_GAME, 0);
+	std::vector<int> renewable_GWh_vec(HOURS_PER_GAME, 0);
+
+	for (int i = 0; i < HOURS_PER_GAME; i++) {
+		if (i < int(this->actual_energy_demand_GWh_vec.size())) {
+			demand_GWh_vec[i] = this->actual_energy_demand_GWh_vec[i];
+		}
+	}
+
+	this->dispatch_solver.clearPortfolio();
+	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
+		PlantKind kind = this->plant_ptr_vec[i]->getKind();
+		if (kind == PLANT_NULL) {
+			continue;
+		}
+
+		switch (kind) {
+			case (PLANT_SOLAR):
+			case (PLANT_TIDAL):
+			case (PLANT_WAVE):
+			case (PLANT_WIND):
+				for (int j = 0; j < HOURS_PER_GAME; j++) {
+					renewable_GWh_vec[j] +=
+						this->plant_ptr_vec[i]->getMarblesCommitted(j);
+				}
+				break;
+
+			default:
+				this->dispatch_solver.pushPlant(
+					kind,
+					this->plant_ptr_vec[i]->getCapacityGW()
+				);
+				break;
+		}
+	}
+
+	this->dispatch_solver.setDay(demand_GWh_vec, renewable_GWh_vec);
+
+	// solve on solve_thread (collected by update() once solved_flag is set)
+	this->optimal_score = 0;
+	this->solving_flag = true;
+	this->solved_flag = false;
+	this->solve_thread = std::thread(
+		[this]() {
+			this->dispatch_solver.solve();
+			this->solved_flag = true;
+		}
+	);
+
+	return;
+}	// end Game::solveOptimalDispatch()
+
+
+void Game::collectOptimalDispatch(void) {
+	/*
+	 *	Method to collect the best possible score from solve_thread (blocks
+	 *	until solved, so update() only calls this once solved_flag is set)
+	 */
+
+	if (!this->solving_flag) {
+		return;
+	}
+
+	if (this->solve_thread.joinable()) {
+		this->solve_thread.join();
+	}
+	this->solving_flag = false;
+	this->optimal_score = this->dispatch_solver.getOptimalScore();
+
+	std::cout << "\nbest possible score: " << this->optimal_score <<
+		" (" << this->dispatch_solver.getNumStates() << " states)" << std::endl;
+
+	return;
+}	// end Game::collectOptimalDispatch()
 
-			default:
-				// do nothing!
-				break;
+
+void Game::update(double dt_s) {
+	/*
+	 *	Method to update the game state by one fixed step of dt_s (everything
+	 *	animated advances here, so render() only draws)
+	 */
+
+	// backgrounds
+	this->overcast_clouds.update(dt_s, this->wind_speed_ratio);
+	this->wind_sock.update(dt_s, this->wind_speed_ratio);
+
+	// objects if not at main menu
+	if (this->phase_manager.getPhase() != 0) {
+		for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
+			this->plant_ptr_vec[i]->update(
+				dt_s,
+				this->wind_speed_ratio,
+				&(this->particle_pool)
+			);
 		}
+		this->particle_pool.update(dt_s, this->wind_speed_ratio);
+		this->pictorial_tutorial.update(dt_s);
 	}
 
-	// render
-	this->render();
-	this->frame++;
+	// text box and track info
+	this->text_box.update(dt_s);
+	this->music_player.update(dt_s);
 
-	// reset phase manager index, check time value
-	if (!ret_flag) {
-		this->phase_manager.setIndex(0);
-		if (this->hour_of_day >= 24) {
-			this->assets.getSound("clock chime")->play();
-			this->phase_manager.setPhase(5);
-			this->draw_energy_overlay = true;
-		}
+	// best possible score (once solved)
+	if (this->solving_flag && this->solved_flag) {
+		this->collectOptimalDispatch();
 	}
 
-	return ret_flag;
-}	// end Game::transition()
+	// dice (shown with the overlays, so once faded in)
+	if (this->phase_manager.getPhase() == 4 && this->fade_alpha <= 0) {
+		this->dice_roll.update(dt_s, this->dice_roll.getRollingDice());
+	}
+
+	// fade in
+	if (this->fade_alpha > 0) {
+		this->fade_alpha -= 2 * dt_s * FRAMES_PER_SECOND;
+		if (this->fade_alpha <= 0) {
+			this->fade_alpha = 0;
 
+			// init tutorial
+			// display tutorial
+			this->text_box.makeBox(
+				std::string(TEXT_TUTORIAL),
+				"bold",
+				0.02 * SCREEN_HEIGHT,
+				SCREEN_WIDTH / 8,
+				SCREEN_HEIGHT / 8,
+				SCREEN_WIDTH / 2,
+				SCREEN_HEIGHT / 3
+			);
 
-void Game::update(void) {
-	/*
-	 *	Method to update the game state
-	 */
+			//reset pictorial_tutorial
+			this->pictorial_tutorial.reset();
+		}
+	}
 
 	 /*
 
@@ -9865,56 +12126,7 @@ void Game::update(void) {
 
 
 void Game::plantInfo(int index){
-	std::string feed_str = "";
-	switch (index) {
-		case (0):	// Coal
-			feed_str = TEXT_COAL;
-			break;
-
-		case (1):	// Combined
-			feed_str = TEXT_COMBINED;
-			break;
-
-		case (2):	// Fission
-			feed_str = TEXT_FISSION;
-			break;
-
-		case (3):	// Geothermal
-			feed_str = TEXT_GEOTHERMAL;
-			break;
-
-		case (4):	// Hydro
-			feed_str = TEXT_HYDRO;
-			break;
-
-		case (5):	// Peaker
-			feed_str = TEXT_PEAKER;
-			break;
-
-		case (6):	// Solar
-			feed_str = TEXT_SOLAR;
-			break;
-
-		case (7):	// Storage
-			feed_str = TEXT_STORAGE;
-			break;
-
-		case (8):	// Tidal
-			feed_str = TEXT_TIDAL;
-			break;
-
-		case (9):	// Wave
-			feed_str = TEXT_WAVE;
-			break;
-
-		case (10):	// Wind
-			feed_str = TEXT_WIND;
-			break;
-
-		default:
-			// do nothing!
-			break;
-	}
+	std::string feed_str = plantDescriptor(index).info_text;
 
 	if (!feed_str.empty()) {
 		this->text_box.makeBox(
@@ -9931,6 +12143,7 @@ void Game::plantInfo(int index){
 
 
 void Game::reset(void){
+	this->collectOptimalDispatch();	// (if still solving)
 	this->phase_manager.reset();
 	this->pictorial_tutorial.reset();
 	this->dice_roll.reset();
@@ -9964,7 +12177,8 @@ void Game::reset(void){
 	this->wave_res_s = 0;
 	this->next_wave_res_s = 0;
 	this->score = 0;
-	this->tidal_idx_offset = round(23 * (double)rand() / RAND_MAX);
+	this->optimal_score = 0;
+	this->tidal_idx_offset = round(23 * randomStream(RNG_TIDAL).uniform());
 	this->points_str = "";
 
 	this->forecast_map["demand GWh"] = 0;
@@ -10009,7 +12223,7 @@ void Game::deferLoad(void) {
 	bool skip_flag = true;
 	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 		if (
-			this->plant_ptr_vec[i]->getTextureIndex() == 7	// Storage
+			this->plant_ptr_vec[i]->getKind() == PLANT_STORAGE
 		) {
 			skip_flag = false;
 			break;
@@ -10028,7 +12242,7 @@ void Game::deferLoad(void) {
 
 	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 		if (
-			this->plant_ptr_vec[i]->getTextureIndex() == 7	// Storage
+			this->plant_ptr_vec[i]->getKind() == PLANT_STORAGE
 		) {
 			max_deferral_load_GW = this->plant_ptr_vec[i]->getCapacityGW();
 		}
@@ -10040,7 +12254,7 @@ void Game::deferLoad(void) {
 	std::string defer_str = "";
 	sf::Text defer_txt(
 		defer_str,
-		*(this->assets.getFont("bold")),
+		*(this->assets.getFont(this->bold_font_id)),
 		0.02 * SCREEN_HEIGHT
 	);
 
@@ -10051,7 +12265,7 @@ void Game::deferLoad(void) {
 	sf::Event event;
 	while (!defer_finished) {
 		// handle events
-		while (this->window_ptr->pollEvent(event)) {
+		while (this->pollEvent(&event)) {
 			switch (event.type) {
 				case (sf::Event::Closed):	// receive "close window" signal
 					defer_finished = true;
@@ -10128,126 +12342,102 @@ void Game::deferLoad(void) {
 		}
 
 		// update clock, render
-		this->time_since_run_s = this->clock.getElapsedTime().asSeconds();
+		this->time_since_run_s = this->getRunTimeSeconds();
 
 		// if "clock tick" ...
 		if (
 			this->time_since_run_s >= (this->frame + 1) * SECONDS_PER_FRAME
 		) {
-			// compute dt, update frame time
-			this->dt_s = this->time_since_run_s - this->frame_time_s;
-			this->frame_time_s = this->time_since_run_s;
+			// update (one fixed step)
+			this->update(SECONDS_PER_FRAME);
+			this->frame++;
 
-			// clear window
-			this->window_ptr->clear();
+			// render if caught up
+			if (this->renderDue()) {
+				double render_ratio = this->getRenderRatio();
 
-			// render layers
+				// clear window
+				this->window_ptr->clear();
 
-			//	1. sky disk
-			this->sky_disk.drawFrame(this->hour_of_day);
+				// render layers
 
-			//	2. overcast and clouds
-			this->overcast_clouds.drawFrame(
-				this->wind_speed_ratio,
-				this->cloud_cover_ratio,
-				this->hour_of_day
-			);
+				//	1. - 5. backgrounds
+				this->renderBackground(render_ratio);
 
-			//	3. smog dome (circ, behind city)
-			sf::CircleShape smog_circ;
-			smog_circ.setFillColor(
-				sf::Color(
-					SMOG_COLOUR.r,
-					SMOG_COLOUR.g,
-					SMOG_COLOUR.b,
-					this->smog_ratio * 200
-				)
-			);
-			double radius = 1.1 * SCREEN_HEIGHT / 3;
-			smog_circ.setRadius(radius);
-			smog_circ.setOrigin(radius, radius);
-			smog_circ.setPosition(
-				sf::Vector2f(
+				//	6. plant ojects
+				this->particle_pool.drawFrame(render_ratio);
+				for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
+					this->plant_ptr_vec[i]->drawMarbles(render_ratio, &(this->marble_batch));
+					this->plant_ptr_vec[i]->drawFrame(
+						i == this->phase_manager.getIndex(),
+						this->phase_manager.getPhase() == 1
+					);
+				}
+				this->marble_batch.draw();
+
+				//	7. backing_rect and defer_txt
+				defer_str = "LOAD DEFERRAL\n\n";
+				defer_str += "Deferring: " +
+					std::to_string(int(target_deferral_load_GW)) + " GW\n";
+				if (target_deferral_hour < 10) {
+					defer_str += "Deferring to: 0" +
+						std::to_string(int(target_deferral_hour)) + ":00\n\n";
+				}
+				else {
+					defer_str += "Deferring to: " +
+						std::to_string(int(target_deferral_hour)) + ":00\n\n";
+				}
+				defer_str += "[W] / [S]: change load deferred\n";
+				defer_str += "[A] / [D]: change time deferred to\n";
+				defer_str += "[Spacebar]: accept\n";
+				defer_str += "[ESC]: cancel";
+
+				defer_txt.setString(defer_str);
+				this->assets.checkGlyphs(
+					this->bold_font_id,
+					(unsigned int)(0.02 * SCREEN_HEIGHT),
+					defer_str
+				);
+				defer_txt.setOrigin(
+					defer_txt.getLocalBounds().width / 2,
+					defer_txt.getLocalBounds().height / 2
+				);
+				defer_txt.setPosition(
 					SCREEN_WIDTH / 2,
 					SCREEN_HEIGHT / 2
-				)
-			);
-			this->window_ptr->draw(smog_circ);
-
-			//	4. foreground + Plinko City
-			this->foreground.drawFrame(this->powered_flag, this->hour_of_day);
-
-			//	5. wind sock
-			this->wind_sock.drawFrame(this->wind_speed_ratio, this->hour_of_day);
-
-			//	6. plant ojects
-			for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-				this->plant_ptr_vec[i]->drawMarbles();
-				this->plant_ptr_vec[i]->drawSteam(this->wind_speed_ratio);
-				this->plant_ptr_vec[i]->drawSmoke(this->wind_speed_ratio);
-				this->plant_ptr_vec[i]->drawFrame(
-					i == this->phase_manager.getIndex(),
-					this->phase_manager.getPhase() == 1
 				);
-			}
-
-			//	7. backing_rect and defer_txt
-			defer_str = "LOAD DEFERRAL\n\n";
-			defer_str += "Deferring: " +
-				std::to_string(int(target_deferral_load_GW)) + " GW\n";
-			if (target_deferral_hour < 10) {
-				defer_str += "Deferring to: 0" +
-					std::to_string(int(target_deferral_hour)) + ":00\n\n";
-			}
-			else {
-				defer_str += "Deferring to: " +
-					std::to_string(int(target_deferral_hour)) + ":00\n\n";
-			}
-			defer_str += "[W] / [S]: change load deferred\n";
-			defer_str += "[A] / [D]: change time deferred to\n";
-			defer_str += "[Spacebar]: accept\n";
-			defer_str += "[ESC]: cancel";
-
-			defer_txt.setString(defer_str);
-			defer_txt.setOrigin(
-				defer_txt.getLocalBounds().width / 2,
-				defer_txt.getLocalBounds().height / 2
-			);
-			defer_txt.setPosition(
-				SCREEN_WIDTH / 2,
-				SCREEN_HEIGHT / 2
-			);
-
-			backing_rect.setFillColor(TEXT_BOX_BACK_COLOUR);
-			backing_rect.setOutlineColor(TEXT_BOX_OUTLINE_COLOUR);
-			backing_rect.setOutlineThickness(TEXT_BOX_OUTLINE_THICKNESS);
-			backing_rect.setSize(
-				sf::Vector2f(
-					1.05 * defer_txt.getLocalBounds().width,
-					1.1 * defer_txt.getLocalBounds().height
-				)
-			);
-			backing_rect.setOrigin(
-				backing_rect.getLocalBounds().width / 2,
-				backing_rect.getLocalBounds().height / 2
-			);
-			backing_rect.setPosition(
-				SCREEN_WIDTH / 2 + 8,
-				SCREEN_HEIGHT / 2 + 16
-			);
 
-			this->window_ptr->draw(backing_rect);
-			this->window_ptr->draw(defer_txt);
+				backing_rect.setFillColor(TEXT_BOX_BACK_COLOUR);
+				backing_rect.setOutlineColor(TEXT_BOX_OUTLINE_COLOUR);
+				backing_rect.setOutlineThickness(TEXT_BOX_OUTLINE_THICKNESS);
+				backing_rect.setSize(
+					sf::Vector2f(
+						1.05 * defer_txt.getLocalBounds().width,
+						1.1 * defer_txt.getLocalBounds().height
+					)
+				);
+				backing_rect.setOrigin(
+					backing_rect.getLocalBounds().width / 2,
+					backing_rect.getLocalBounds().height / 2
+				);
+				backing_rect.setPosition(
+					SCREEN_WIDTH / 2 + 8,
+					SCREEN_HEIGHT / 2 + 16
+				);
 
-			//	8. overlays
-			this->renderOverlays();
+				this->window_ptr->draw(backing_rect);
+				this->window_ptr->draw(defer_txt);
 
-			// flip
-			this->window_ptr->display();
+				//	8. overlays
+				this->renderOverlays();
 
-			// increment frame count
-			this->frame++;
+				// flip
+				this->displayFrame();
+			}
 		}
+
+		// sleep until next "clock tick"
+		this->waitNextStep();
 	}
 
 	return;
@@ -10256,55 +12446,19 @@ void Game::deferLoad(void) {
 
 double Game::generateWindRatio(void) {
 	/*
-	 *	Method to generate wind ratio (simple Markov process)
+	 *	Method to generate wind ratio (see weatherRatioStep())
 	 */
 
-	double inc_prob = 1 - this->wind_speed_ratio;
-	double roll = (double)rand() / RAND_MAX;
-	double wind_speed_ratio = 0;
-
-	if (roll <= inc_prob) {
-		wind_speed_ratio = this->wind_speed_ratio + 0.5 * (double)rand() / RAND_MAX;
-	}
-	else {
-		wind_speed_ratio = this->wind_speed_ratio - 0.5 * (double)rand() / RAND_MAX;
-	}
-
-	if (wind_speed_ratio > 1) {
-		wind_speed_ratio = 1;
-	}
-	else if (wind_speed_ratio < 0) {
-		wind_speed_ratio = 0;
-	}
-
-	return wind_speed_ratio;
+	return weatherRatioStep(this->wind_speed_ratio, randomStream(RNG_WEATHER));
 }	// end Game::generateWindRatio()
 
 
 double Game::generateCloudRatio(void) {
 	/*
-	 *	Method to generate cloud ratio (simple Markov process)
+	 *	Method to generate cloud ratio (see weatherRatioStep())
 	 */
 
-	double inc_prob = 1 - this->cloud_cover_ratio;
-	double roll = (double)rand() / RAND_MAX;
-	double cloud_cover_ratio = 0;
-
-	if (roll <= inc_prob) {
-		cloud_cover_ratio = this->cloud_cover_ratio + 0.5 * (double)rand() / RAND_MAX;
-	}
-	else {
-		cloud_cover_ratio = this->cloud_cover_ratio - 0.5 * (double)rand() / RAND_MAX;
-	}
-
-	if (cloud_cover_ratio > 1) {
-		cloud_cover_ratio = 1;
-	}
-	else if (cloud_cover_ratio < 0) {
-		cloud_cover_ratio = 0;
-	}
-
-	return cloud_cover_ratio;
+	return weatherRatioStep(this->cloud_cover_ratio, randomStream(RNG_WEATHER));
 }	// end Game::generateCloudRatio()
 
 
@@ -10314,382 +12468,133 @@ double Game::generateSolarResource(void) {
 	 *	(product of cloud cover and time of day)
 	 */
 
-	double solar_res_kWm2 = 0;
-
-	if (this->hour_of_day > 5.5 && this->hour_of_day < 17.5) {
-		if (this->hour_of_day <= 10) {
-			solar_res_kWm2 = (2.0 / 9.0) * this->hour_of_day - (11.0 / 9.0);
-		}
-		else if (this->hour_of_day >= 14) {
-			solar_res_kWm2 = (-2.0 / 7.0) * this->hour_of_day + 5.0;
-		}
-		else {
-			solar_res_kWm2 = 1;
-		}
-		solar_res_kWm2 *= (1 - this->cloud_cover_ratio) * (1 - this->smog_ratio);
-	}
-
-	return solar_res_kWm2;
+	return solarTimeOfDayResource(this->hour_of_day) *
+		(1 - this->cloud_cover_ratio) * (1 - this->smog_ratio);
 }	// end Game::generateSolarResource()
 
 
 double Game::generateWaveResource(void) {
 	/*
-	 *	Method to generate wave energy period (simple Markov process)
+	 *	Method to generate wave energy period (see waveResourceStep())
 	 */
 
-	double norm_res = (this->wave_res_s - 5.75) / (15 - 5.75);
-	double inc_prob = 1 - norm_res;
-	double next_norm_res = 0;
-	double next_res = 0;
-
-	double roll = (double)rand() / RAND_MAX;
-	if (roll <= inc_prob) {
-		next_norm_res = norm_res + 0.1 * (double)rand() / RAND_MAX;
-	}
-	else {
-		next_norm_res = norm_res - 0.1 * (double)rand() / RAND_MAX;
-	}
-
-	if (next_norm_res > 1) {
-		next_norm_res = 1;
-	}
-	else if (next_norm_res < 0) {
-		next_norm_res = 0;
-	}
-	next_res = (15 - 5.75) * next_norm_res + 5.75;
-
-	return next_res;
+	return waveResourceStep(this->wave_res_s, randomStream(RNG_WEATHER));
 }	// end Game::generateWaveResource()
 
 
 void Game::getForecast(void) {
 	/*
-	 *	Method to get forecast values for renewables (simple Monte Carlo)
+	 *	Method to get forecast values for renewables (quadrature where the
+	 *	next hour distribution is known, see ForecastAnalytic, otherwise
+	 *	simple Monte Carlo, see ForecastKernel)
 	 */
 
 	 this->forecast_map["demand GWh"] = this->energy_demand_GWh_vec[
  		(int(this->hour_of_day) + 1) % 23
  	];
 
-	int texture_key = 0;
-	int n_trials = 1024;
+	PlantKind kind = PLANT_NULL;
 	double mean_prod_GWh = 0;
 	double max_abs_error_GWh = 0;
-	std::vector<double> forecast_GWh_vec (n_trials, 0);
+	std::string forecast_key = "";
+	ForecastStats stats;
 	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
-		texture_key = this->plant_ptr_vec[i]->getTextureIndex();
-
-		switch (texture_key) {
-			case (6):	// Solar
-				mean_prod_GWh = 0;
-				max_abs_error_GWh = 0;
-				{
-					// init
-					double cloud_cover_ratio = 0;
-					double solar_res_kWm2 = 0;
-					double solar_prod_GWh = 0;
-
-					// Monte Carlo
-					for (int j = 0; j < n_trials; j++) {
-						// roll cloud cover ratio
-						cloud_cover_ratio = this->generateCloudRatio();
-
-						// compute solar resource
-						if (this->hour_of_day > 5.5 && this->hour_of_day < 17.5) {
-							if (this->hour_of_day <= 10) {
-								solar_res_kWm2 = (2.0 / 9.0) * this->hour_of_day - (11.0 / 9.0);
-							}
-							else if (this->hour_of_day >= 14) {
-								solar_res_kWm2 = (-2.0 / 7.0) * this->hour_of_day + 5.0;
-							}
-							else {
-								solar_res_kWm2 = 1;
-							}
-							solar_res_kWm2 *= (1 - cloud_cover_ratio) * (1 - this->smog_ratio);
-						}
-
-						// compute solar production
-						solar_prod_GWh = this->plant_ptr_vec[i]->getCapacityGW() *
-							solar_res_kWm2;
-						if (solar_prod_GWh > this->plant_ptr_vec[i]->getCapacityGW()) {
-							solar_prod_GWh = this->plant_ptr_vec[i]->getCapacityGW();
-						}
-
-						// update mean_prod_GWh
-						mean_prod_GWh += solar_prod_GWh;
-
-						// write to forecast_GWh_vec
-						forecast_GWh_vec[j] = solar_prod_GWh;
-					}
-
-					// compute mean_prod_GWh
-					mean_prod_GWh = mean_prod_GWh / double(n_trials);
-
-					// compute max_abs_error_GWh
-					for (int j = 0; j < n_trials; j++) {
-						if (
-							abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							) > max_abs_error_GWh
-						) {
-							max_abs_error_GWh = abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							);
-						}
-					}
-
-					// write to forecast_map
-					mean_prod_GWh = round(mean_prod_GWh);
-					max_abs_error_GWh = ceil(max_abs_error_GWh);
-					if (max_abs_error_GWh > mean_prod_GWh) {
-						max_abs_error_GWh = mean_prod_GWh;
-					}
-					this->forecast_map["solar forecast GWh"] = mean_prod_GWh;
-					this->forecast_map["solar forecast error GWh"] = max_abs_error_GWh;
+		kind = this->plant_ptr_vec[i]->getKind();
+
+		switch (kind) {
+			case (PLANT_SOLAR):
+				if (FORECAST_ANALYTIC) {
+					stats = this->forecast_analytic.solar(
+						this->plant_ptr_vec[i]->getCapacityGW(),
+						solarTimeOfDayResource(this->hour_of_day),
+						this->cloud_cover_ratio,
+						this->smog_ratio
+					);
+					forecast_key = "solar";
+					break;
 				}
+				stats = this->forecast_kernel.solar(
+					this->plant_ptr_vec[i]->getCapacityGW(),
+					solarTimeOfDayResource(this->hour_of_day),
+					this->cloud_cover_ratio,
+					this->smog_ratio
+				);
+				forecast_key = "solar";
 				break;
 
-			case (8):	// Tidal
-				mean_prod_GWh = 0;
-				max_abs_error_GWh = 0;
-				{
-					// init
-					double tidal_res_ms = 0;
-					double design_speed_ms = this->plant_ptr_vec[i]->getDesignSpeed();
-					double turb_speed = 0;
-					double tidal_prod = 0;
-					double tidal_prod_GWh = 0;
-
-					// Monte Carlo
-					for (int j = 0; j < n_trials; j++) {
-						// roll tidal res
-						tidal_res_ms = this->tidal_res_ms_vec[
+			case (PLANT_TIDAL):
+				if (FORECAST_ANALYTIC) {
+					stats = this->forecast_analytic.tidal(
+						this->plant_ptr_vec[i]->getCapacityGW(),
+						this->tidal_res_ms_vec[
 							(
 								int(this->hour_of_day) + 1 +
 								this->tidal_idx_offset
 							) % 23
-						];
-						tidal_res_ms *= 1 + (0.1 * ((double)rand() / RAND_MAX) - 0.05);
-						if (tidal_res_ms < 0) {
-							tidal_res_ms = 0;
-						}
-						else if (tidal_res_ms > 1) {
-							tidal_res_ms = 1;
-						}
-
-						// compute tidal production
-						if (tidal_res_ms > 0) {
-							turb_speed = (tidal_res_ms - design_speed_ms) /
-								design_speed_ms;
-
-							// look-up on dimensionless performance curve, get dimensionless production [ ]
-							 if (turb_speed < -0.71 || turb_speed > 0.65) {
-								 tidal_prod = 0;
-							 } else if (turb_speed >= -0.71 && turb_speed <= 0) {
-								 tidal_prod = 1.69215 * exp(1.25909 * turb_speed) - 0.69215;
-							 } else {
-								 tidal_prod = 1;
-							 }
-						}
-						else {
-							tidal_prod = 0;
-						}
-						tidal_prod_GWh = this->plant_ptr_vec[i]->getCapacityGW() * tidal_prod;
-
-						// update mean_prod_GWh
-						mean_prod_GWh += tidal_prod_GWh;
-
-						// write to forecast_GWh_vec
-						forecast_GWh_vec[j] = tidal_prod_GWh;
-					}
-
-					// compute mean_prod_GWh
-					mean_prod_GWh = mean_prod_GWh / double(n_trials);
-
-					// compute max_abs_error_GWh
-					for (int j = 0; j < n_trials; j++) {
-						if (
-							abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							) > max_abs_error_GWh
-						) {
-							max_abs_error_GWh = abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							);
-						}
-					}
-
-					// write to forecast_map
-					mean_prod_GWh = round(mean_prod_GWh);
-					max_abs_error_GWh = ceil(max_abs_error_GWh);
-					if (max_abs_error_GWh > mean_prod_GWh) {
-						max_abs_error_GWh = mean_prod_GWh;
-					}
-					this->forecast_map["tidal forecast GWh"] = mean_prod_GWh;
-					this->forecast_map["tidal forecast error GWh"] = max_abs_error_GWh;
+						],
+						this->plant_ptr_vec[i]->getDesignSpeed()
+					);
+					forecast_key = "tidal";
+					break;
 				}
+				stats = this->forecast_kernel.tidal(
+					this->plant_ptr_vec[i]->getCapacityGW(),
+					this->tidal_res_ms_vec[
+						(
+							int(this->hour_of_day) + 1 +
+							this->tidal_idx_offset
+						) % 23
+					],
+					this->plant_ptr_vec[i]->getDesignSpeed()
+				);
+				forecast_key = "tidal";
 				break;
 
-			case (9):	// Wave
-				mean_prod_GWh = 0;
-				max_abs_error_GWh = 0;
-				{
-					// init
-					double wave_res_s = 0;
-					double wave_res_m = 0;
-					double design_period_s = this->plant_ptr_vec[i]->getDesignPeriod();
-					double wave_prod = 0;
-					double wave_prod_GWh = 0;
-					double sigma = 0.028;	// Rayleigh scale parameter (mode of dist)
-					double roll = 0;
-					double scalar = 0;
-
-					// Monte Carlo
-					for (int j = 0; j < n_trials; j++) {
-						// roll wave resource
-						wave_res_s = this->generateWaveResource();
-
-						// wave production
-						// generate wave_res_m from Rayleigh distribution
-						roll = (double)rand() / RAND_MAX;
-						if (roll == 1) {
-							roll = 0.999999;
-						}
-						scalar = sigma * sqrt(2 * log(1 / (1 - roll)));
-						wave_res_m = scalar * pow(wave_res_s, 2);
-						if (wave_res_m > 0.2184 * pow(wave_res_s, 2)) {
-							wave_res_m = 0.2 * pow(wave_res_s, 2);
-						}
-
-						if (wave_res_m > 0) {
-							wave_prod = 0.289 * wave_res_m -
-								0.00111 * pow(wave_res_m, 2) * wave_res_s -
-								0.0169 * wave_res_s;
-							if (wave_prod <= 0) {
-								wave_prod = 0;
-							}
-							else if (wave_prod >= 1) {
-								wave_prod = 1;
-							}
-						}
-						else {
-							wave_prod = 0;
-						}
-						wave_prod_GWh = this->plant_ptr_vec[i]->getCapacityGW() * wave_prod;
-
-						// update mean_prod_GWh
-						mean_prod_GWh += wave_prod_GWh;
-
-						// write to forecast_GWh_vec
-						forecast_GWh_vec[j] = wave_prod_GWh;
-					}
-
-					// compute mean_prod_GWh
-					mean_prod_GWh = mean_prod_GWh / double(n_trials);
-
-					// compute max_abs_error_GWh
-					for (int j = 0; j < n_trials; j++) {
-						if (
-							abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							) > max_abs_error_GWh
-						) {
-							max_abs_error_GWh = abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							);
-						}
-					}
-
-					// write to forecast_map
-					mean_prod_GWh = round(mean_prod_GWh);
-					max_abs_error_GWh = ceil(max_abs_error_GWh);
-					if (max_abs_error_GWh > mean_prod_GWh) {
-						max_abs_error_GWh = mean_prod_GWh;
-					}
-					this->forecast_map["wave forecast GWh"] = mean_prod_GWh;
-					this->forecast_map["wave forecast error GWh"] = max_abs_error_GWh;
-				}
+			case (PLANT_WAVE):	// no closed form, always sampled
+				stats = this->forecast_kernel.wave(
+					this->plant_ptr_vec[i]->getCapacityGW(),
+					this->wave_res_s
+				);
+				forecast_key = "wave";
 				break;
 
-			case (10):	// Wind
-				mean_prod_GWh = 0;
-				max_abs_error_GWh = 0;
-				{
-					// init
-					double wind_speed_ratio = 0;
-					double design_speed_ms = this->plant_ptr_vec[i]->getDesignSpeed();
-					double turb_speed = 0;
-					double wind_prod = 0;
-					double wind_prod_GWh = 0;
-
-					// Monte Carlo
-					for (int j = 0; j < n_trials; j++) {
-						// roll wind speed ratio
-						wind_speed_ratio = this->generateWindRatio();
-
-						// compute wind production
-						if (wind_speed_ratio > 0) {
-							turb_speed = (wind_speed_ratio - design_speed_ms) /
-								design_speed_ms;
-
-							// look-up on dimensionless performance curve, get dimensionless production [ ]
-							if (turb_speed < -0.76 || turb_speed > 0.68) {
-								wind_prod = 0;
-							} else if (turb_speed >= -0.76 && turb_speed <= 0) {
-								wind_prod = 1.03273 * exp(-5.97588 * pow(turb_speed, 2)) -
-									0.03273;
-							} else {
-								wind_prod = 0.16154 * exp(-9.30254 * pow(turb_speed, 2)) +
-									0.83846;
-							}
-						}
-						else {
-							wind_prod = 0;
-						}
-						if (wind_prod > 1) {
-							wind_prod = 1;
-						}
-						wind_prod_GWh = this->plant_ptr_vec[i]->getCapacityGW() * wind_prod;
-
-						// update mean_prod_GWh
-						mean_prod_GWh += wind_prod_GWh;
-
-						// write to forecast_GWh_vec
-						forecast_GWh_vec[j] = wind_prod_GWh;
-					}
-
-					// compute mean_prod_GWh
-					mean_prod_GWh = mean_prod_GWh / double(n_trials);
-
-					// compute max_abs_error_GWh
-					for (int j = 0; j < n_trials; j++) {
-						if (
-							abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							) > max_abs_error_GWh
-						) {
-							max_abs_error_GWh = abs(
-								forecast_GWh_vec[j] - mean_prod_GWh
-							);
-						}
-					}
-
-					// write to forecast_map
-					mean_prod_GWh = round(mean_prod_GWh);
-					max_abs_error_GWh = ceil(max_abs_error_GWh);
-					if (max_abs_error_GWh > mean_prod_GWh) {
-						max_abs_error_GWh = mean_prod_GWh;
-					}
-					this->forecast_map["wind forecast GWh"] = mean_prod_GWh;
-					this->forecast_map["wind forecast error GWh"] = max_abs_error_GWh;
+			case (PLANT_WIND):
+				if (FORECAST_ANALYTIC) {
+					stats = this->forecast_analytic.wind(
+						this->plant_ptr_vec[i]->getCapacityGW(),
+						this->wind_speed_ratio,
+						this->plant_ptr_vec[i]->getDesignSpeed()
+					);
+					forecast_key = "wind";
+					break;
 				}
+				stats = this->forecast_kernel.wind(
+					this->plant_ptr_vec[i]->getCapacityGW(),
+					this->wind_speed_ratio,
+					this->plant_ptr_vec[i]->getDesignSpeed()
+				);
+				forecast_key = "wind";
 				break;
 
 			default:
-				// do nothing!
-				break;
+				// not renewable, do nothing!
+				continue;
+		}
+
+		// max abs error is the larger of the distances to min and max
+		max_abs_error_GWh = stats.max_GWh - stats.mean_GWh;
+		if (stats.mean_GWh - stats.min_GWh > max_abs_error_GWh) {
+			max_abs_error_GWh = stats.mean_GWh - stats.min_GWh;
+		}
+
+		// write to forecast_map
+		mean_prod_GWh = round(stats.mean_GWh);
+		max_abs_error_GWh = ceil(max_abs_error_GWh);
+		if (max_abs_error_GWh > mean_prod_GWh) {
+			max_abs_error_GWh = mean_prod_GWh;
 		}
+		this->forecast_map[forecast_key + " forecast GWh"] = mean_prod_GWh;
+		this->forecast_map[forecast_key + " forecast error GWh"] = max_abs_error_GWh;
 	}
 
 	return;
@@ -10875,7 +12780,7 @@ void Game::test1(void) {
 
 			// handle events, update, and render
 			handleEvents();
-			update();
+			update(SECONDS_PER_FRAME);
 			render();
 
 			// ---- TESTING ---- //
@@ -10931,6 +12836,12 @@ void Game::test1(void) {
 			// increment frame count
 			this->frame++;
 		}
+
+		// sleep until next "clock tick"
+		this->frame_pacer.waitUntil(
+			(this->frame + 1) * SECONDS_PER_FRAME,
+			this->clock.getElapsedTime().asSeconds()
+		);
 	}
 
 	return;
@@ -10942,6 +12853,9 @@ Game::~Game(void) {
 	 *	Destructor for Game class
 	 */
 
+	// wait on solve_thread (if still solving)
+	this->collectOptimalDispatch();
+
 	// clean up plant_ptr_vec
 	for (int i = 0; i < this->plant_ptr_vec.size(); i++) {
 		delete this->plant_ptr_vec[i];
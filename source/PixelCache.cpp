@@ -0,0 +1,392 @@
+/*
+ *	Pixel cache implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the pixel cache (see PixelCache.h for the file format).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/PixelCache.h"
+#include "../header/ByteOrder.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+
+// -------- constants -------- //
+static const char PIXEL_CACHE_MAGIC[4] = {'M', 'M', 'P', 'C'};
+static const unsigned char PIXEL_CACHE_VERSION = 1;
+static const size_t PIXEL_CACHE_HEADER_SIZE = 12;
+static const size_t PIXEL_CACHE_TOC_ENTRY_SIZE = 26;	// (plus path)
+
+
+// -------- class implementations -------- //
+
+
+// ---- PixelCache ---- //
+
+PixelCache::PixelCache(void) {
+	/*
+	 *	Constructor for PixelCache class
+	 */
+
+	this->dirty_flag = false;
+	this->n_hits = 0;
+	this->n_misses = 0;
+	this->cache_path = "";
+
+	return;
+}	// end PixelCache::PixelCache()
+
+
+void PixelCache::clear(void) {
+	/*
+	 *	Method to drop all entries and unmap the cache file
+	 */
+
+	for (size_t i = 0; i < this->entry_ptr_vec.size(); i++) {
+		delete this->entry_ptr_vec[i];
+	}
+	this->entry_ptr_vec.clear();
+	this->entry_map.clear();
+	this->mapped_file.close();
+
+	return;
+}	// end PixelCache::clear()
+
+
+unsigned long long PixelCache::hashBytes(const char* bytes_ptr, size_t n_bytes) {
+	/*
+	 *	Method to hash source file bytes (64 bit FNV-1a)
+	 */
+
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < n_bytes; i++) {
+		hash ^= (unsigned char)bytes_ptr[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}	// end PixelCache::hashBytes()
+
+
+void PixelCache::open(std::string path) {
+	/*
+	 *	Method to map the cache at the given path and read its table of
+	 *	contents (see PixelCache.h for format). A missing or unreadable cache
+	 *	is not an error; it starts empty, and save() writes a new one.
+	 */
+
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+
+	this->clear();
+	this->cache_path = path;
+	this->dirty_flag = false;
+
+	if (!std::filesystem::exists(path)) {
+		std::cout << "pixel cache: \"" << path << "\" not found, images will be " <<
+			"decoded and cached" << std::endl;
+		return;
+	}
+
+	std::string error_str = "";
+	try {
+		this->mapped_file.open(path);
+	}
+	catch (const std::exception &exception) {
+		error_str = exception.what();
+	}
+
+	const char* data_ptr = this->mapped_file.getData();
+	unsigned long long data_size = this->mapped_file.getSize();
+
+	if (!error_str.empty()) {
+		// (could not map, reported below)
+	}
+	else if (
+		data_size < PIXEL_CACHE_HEADER_SIZE ||
+		std::string(data_ptr, 4).compare(0, 4, PIXEL_CACHE_MAGIC, 4) != 0
+	) {
+		error_str = "not a pixel cache";
+	}
+	else if ((unsigned char)data_ptr[4] != PIXEL_CACHE_VERSION) {
+		error_str = "unsupported version";
+	}
+	else {
+		unsigned long long n_entries = readLE(data_ptr + 8, 4);
+		unsigned long long idx = PIXEL_CACHE_HEADER_SIZE;
+		for (unsigned long long i = 0; i < n_entries; i++) {
+			if (idx + PIXEL_CACHE_TOC_ENTRY_SIZE > data_size) {
+				error_str = "truncated";
+				break;
+			}
+
+			PixelCacheEntry* entry_ptr = new PixelCacheEntry();
+			entry_ptr->source_hash = readLE(data_ptr + idx, 8);
+			entry_ptr->width = readLE(data_ptr + idx + 8, 4);
+			entry_ptr->height = readLE(data_ptr + idx + 12, 4);
+			unsigned long long offset = readLE(data_ptr + idx + 16, 8);
+			size_t path_length = readLE(data_ptr + idx + 24, 2);
+			idx += PIXEL_CACHE_TOC_ENTRY_SIZE;
+
+			unsigned long long n_bytes =
+				4ULL * entry_ptr->width * entry_ptr->height;
+			if (
+				idx + path_length > data_size ||
+				offset > data_size ||
+				n_bytes > data_size - offset
+			) {
+				delete entry_ptr;
+				error_str = "truncated";
+				break;
+			}
+			entry_ptr->path = std::string(data_ptr + idx, path_length);
+			entry_ptr->pixels_ptr = data_ptr + offset;
+			entry_ptr->used_flag = false;
+			idx += path_length;
+
+			this->entry_map[entry_ptr->path] = this->entry_ptr_vec.size();
+			this->entry_ptr_vec.push_back(entry_ptr);
+		}
+	}
+
+	if (!error_str.empty()) {
+		std::cout << "WARNING: PixelCache::open(): \"" << path << "\" ignored (" <<
+			error_str << "), images will be decoded and cached again" << std::endl;
+		this->clear();
+		return;
+	}
+
+	std::cout << "pixel cache: \"" << path << "\" opened (" <<
+		this->entry_ptr_vec.size() << " images, " << data_size <<
+		" bytes mapped)" << std::endl;
+
+	return;
+}	// end PixelCache::open()
+
+
+const char* PixelCache::find(
+	const std::string& path,
+	unsigned long long source_hash,
+	unsigned int* width_ptr,
+	unsigned int* height_ptr
+) {
+	/*
+	 *	Method to find the decoded image of the given source (path and hash
+	 *	of its bytes); returns its RGBA pixels, and its size through width_ptr
+	 *	and height_ptr (NULL on a miss, or if the source has changed)
+	 */
+
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+
+	std::unordered_map<std::string, int>::iterator entry_iter =
+		this->entry_map.find(path);
+	if (
+		entry_iter == this->entry_map.end() ||
+		this->entry_ptr_vec[entry_iter->second]->source_hash != source_hash
+	) {
+		this->n_misses++;
+		this->dirty_flag = true;
+		return NULL;
+	}
+
+	PixelCacheEntry* entry_ptr = this->entry_ptr_vec[entry_iter->second];
+	entry_ptr->used_flag = true;
+	*width_ptr = entry_ptr->width;
+	*height_ptr = entry_ptr->height;
+	this->n_hits++;
+
+	return entry_ptr->pixels_ptr;
+}	// end PixelCache::find()
+
+
+void PixelCache::store(
+	const std::string& path,
+	unsigned long long source_hash,
+	unsigned int width,
+	unsigned int height,
+	const unsigned char* pixels_ptr
+) {
+	/*
+	 *	Method to store the decoded image (RGBA pixels) of the given source,
+	 *	replacing any stale entry; written out by save()
+	 */
+
+	PixelCacheEntry* entry_ptr = new PixelCacheEntry();
+	entry_ptr->path = path;
+	entry_ptr->source_hash = source_hash;
+	entry_ptr->width = width;
+	entry_ptr->height = height;
+	if (pixels_ptr != NULL) {
+		entry_ptr->pixel_str.assign((const char*)pixels_ptr, 4ULL * width * height);
+	}
+	entry_ptr->pixels_ptr = entry_ptr->pixel_str.data();
+	entry_ptr->used_flag = true;
+
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+
+	std::unordered_map<std::string, int>::iterator entry_iter =
+		this->entry_map.find(path);
+	if (entry_iter != this->entry_map.end()) {
+		delete this->entry_ptr_vec[entry_iter->second];
+		this->entry_ptr_vec[entry_iter->second] = entry_ptr;
+	}
+	else {
+		this->entry_map[path] = this->entry_ptr_vec.size();
+		this->entry_ptr_vec.push_back(entry_ptr);
+	}
+	this->dirty_flag = true;
+
+	return;
+}	// end PixelCache::store()
+
+
+bool PixelCache::save(bool prune_flag) {
+	/*
+	 *	Method to write the entries back to the cache file, if anything missed
+	 *	(written beside it, then renamed into place), then map it again;
+	 *	returns true if written. With prune_flag (at shutdown) only the
+	 *	entries used this run are kept, otherwise all are (so that a save
+	 *	during the run does not drop lazily loaded images not yet used).
+	 */
+
+	std::vector<std::string> used_path_vec;
+
+	{
+		std::lock_guard<std::mutex> lock(this->entry_mutex);
+
+		if (!this->dirty_flag || this->cache_path.empty()) {
+			return false;
+		}
+
+		// lay out table of contents, then pixels
+		std::vector<PixelCacheEntry*> write_ptr_vec;
+		unsigned long long offset = PIXEL_CACHE_HEADER_SIZE;
+		for (size_t i = 0; i < this->entry_ptr_vec.size(); i++) {
+			if (this->entry_ptr_vec[i]->used_flag) {
+				used_path_vec.push_back(this->entry_ptr_vec[i]->path);
+			}
+			else if (prune_flag) {
+				continue;
+			}
+			write_ptr_vec.push_back(this->entry_ptr_vec[i]);
+			offset += PIXEL_CACHE_TOC_ENTRY_SIZE + this->entry_ptr_vec[i]->path.size();
+		}
+
+		std::string bytes(PIXEL_CACHE_MAGIC, 4);
+		bytes.push_back(char(PIXEL_CACHE_VERSION));
+		writeLE(&bytes, 0, 3);
+		writeLE(&bytes, write_ptr_vec.size(), 4);
+
+		std::vector<unsigned long long> offset_vec;
+		for (size_t i = 0; i < write_ptr_vec.size(); i++) {
+			offset = alignUp(offset, ASSET_PACK_ALIGNMENT);
+			offset_vec.push_back(offset);
+
+			writeLE(&bytes, write_ptr_vec[i]->source_hash, 8);
+			writeLE(&bytes, write_ptr_vec[i]->width, 4);
+			writeLE(&bytes, write_ptr_vec[i]->height, 4);
+			writeLE(&bytes, offset, 8);
+			writeLE(&bytes, write_ptr_vec[i]->path.size(), 2);
+			bytes += write_ptr_vec[i]->path;
+
+			offset += 4ULL * write_ptr_vec[i]->width * write_ptr_vec[i]->height;
+		}
+
+		// write
+		std::string tmp_path = this->cache_path + ".tmp";
+		std::ofstream out_stream(tmp_path, std::ios::binary);
+		if (!out_stream.is_open()) {
+			std::cout << "WARNING: PixelCache::save(): Cannot open \"" << tmp_path <<
+				"\" for writing, images not cached" << std::endl;
+			return false;
+		}
+		out_stream.write(bytes.data(), bytes.size());
+
+		for (size_t i = 0; i < write_ptr_vec.size(); i++) {
+			std::string padding(offset_vec[i] - out_stream.tellp(), '\0');
+			out_stream.write(padding.data(), padding.size());
+			out_stream.write(
+				write_ptr_vec[i]->pixels_ptr,
+				4ULL * write_ptr_vec[i]->width * write_ptr_vec[i]->height
+			);
+		}
+		out_stream.close();
+
+		if (!out_stream.good()) {
+			std::cout << "WARNING: PixelCache::save(): Cannot write \"" << tmp_path <<
+				"\", images not cached" << std::endl;
+			return false;
+		}
+
+		// unmap before replacing (entries are dropped, and reread below)
+		this->clear();
+		std::filesystem::rename(tmp_path, this->cache_path);
+
+		std::cout << "pixel cache: " << write_ptr_vec.size() << " images written to \"" <<
+			this->cache_path << "\" (" << offset << " bytes)" << std::endl;
+	}
+
+	this->open(this->cache_path);
+
+	// carry over which entries were used this run (for the next save)
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+	for (size_t i = 0; i < used_path_vec.size(); i++) {
+		std::unordered_map<std::string, int>::iterator entry_iter =
+			this->entry_map.find(used_path_vec[i]);
+		if (entry_iter != this->entry_map.end()) {
+			this->entry_ptr_vec[entry_iter->second]->used_flag = true;
+		}
+	}
+
+	return true;
+}	// end PixelCache::save()
+
+
+int PixelCache::getNumEntries(void) {
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+	return this->entry_ptr_vec.size();
+}	// end PixelCache::getNumEntries()
+
+
+int PixelCache::getNumHits(void) {
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+	return this->n_hits;
+}	// end PixelCache::getNumHits()
+
+
+int PixelCache::getNumMisses(void) {
+	std::lock_guard<std::mutex> lock(this->entry_mutex);
+	return this->n_misses;
+}	// end PixelCache::getNumMisses()
+
+
+PixelCache::~PixelCache(void) {
+	this->clear();
+	return;
+}	// end PixelCache::~PixelCache()
+
+
+// -------- function implementations (process-wide cache) -------- //
+
+PixelCache& pixelCache(void) {
+	/*
+	 *	Function to get the process-wide pixel cache (empty until main()
+	 *	opens one)
+	 */
+
+	static PixelCache pixel_cache;
+	return pixel_cache;
+}	// end pixelCache()
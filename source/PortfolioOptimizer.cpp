@@ -0,0 +1,799 @@
+/*
+ *	Portfolio optimizer implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the capacity phase portfolio optimizer (--optimize mode).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/PortfolioOptimizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+
+// -------- function implementations -------- //
+
+static double emissionsWeight(int type) {
+	/*
+	 *	Helper function to get the emissions (and score penalty) per marble of
+	 *	the given plant type (as in GridSimulator::commitHour())
+	 */
+
+	return plantDescriptor(type).emission_points;
+}	// end emissionsWeight()
+
+
+int tokensPerUnit(int type) {
+	/*
+	 *	Helper function to get the smallest token investment in the given plant
+	 *	type that adds capacity (one GW, or one geothermal roll set)
+	 */
+
+	if (type == PLANT_GEOTHERMAL) {
+		return CAPACITY_PER_GEOTHERMAL_ROLL;
+	}
+
+	return tokensPerGW(type);
+}	// end tokensPerUnit()
+
+
+void runOptimizer(int n_days, int token_step) {
+	/*
+	 *	Runs the portfolio optimizer over n_days sampled days (--optimize mode)
+	 */
+
+	PortfolioOptimizer portfolio_optimizer(
+		n_days,
+		randomService().getSeed(),
+		0,
+		token_step
+	);
+	portfolio_optimizer.run();
+	portfolio_optimizer.writeFront("optimizer_front.csv");
+
+	return;
+}	// end runOptimizer()
+
+
+// ---- PortfolioOptimizer ---- //
+
+PortfolioOptimizer::PortfolioOptimizer(
+	int n_days,
+	unsigned long long seed,
+	int n_threads,
+	int token_step
+) {
+	/*
+	 *	Constructor for PortfolioOptimizer class (n_threads = 0 for all cores)
+	 */
+
+	if (n_days <= 0 || token_step <= 0) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: PortfolioOptimizer::PortfolioOptimizer(): " <<
+			"n_days and token_step must be positive (got " << n_days << ", " <<
+			token_step << ")";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	this->n_days = n_days;
+	this->n_threads = n_threads;
+	this->token_step = token_step;
+	this->seed = seed;
+
+	this->n_nodes = 0;
+	this->n_pruned = 0;
+	this->n_evaluated = 0;
+	this->n_raced = 0;
+	this->n_days_simulated = 0;
+
+	// cheapest penalty first
+	this->setMeritOrder(
+		{
+			PLANT_FISSION, PLANT_GEOTHERMAL, PLANT_HYDRO, PLANT_STORAGE,
+			PLANT_COMBINED, PLANT_PEAKER, PLANT_COAL
+		}
+	);
+
+	// stream out and return
+	std::cout << "\nPortfolioOptimizer object created at " << this << "." << std::endl;
+	return;
+}	// end PortfolioOptimizer::PortfolioOptimizer()
+
+
+void PortfolioOptimizer::setMeritOrder(const std::vector<int>& merit_order) {
+	/*
+	 *	Method to set the merit order dispatch policy portfolios are scored by
+	 */
+
+	this->merit_order = merit_order;
+
+	// the emissions bound leans on the peaker taking whatever residual is left
+	this->peaker_in_merit_order = std::find(
+		merit_order.begin(),
+		merit_order.end(),
+		PLANT_PEAKER
+	) != merit_order.end();
+
+	return;
+}	// end PortfolioOptimizer::setMeritOrder()
+
+
+void PortfolioOptimizer::buildProfiles(void) {
+	/*
+	 *	Method to simulate the portfolio independent part of every sampled day
+	 *	once: demand, weather (as renewable production ratios, through one
+	 *	1 GW plant of each renewable), and geothermal rolls
+	 *
+	 *	This holds because every random draw is per subsystem (see
+	 *	RandomSubsystem) and a portfolio holds at most one plant of each type,
+	 *	so any portfolio makes exactly these draws on the same seed.
+	 */
+
+	static const int renewable_types[4] = {
+		PLANT_SOLAR, PLANT_TIDAL, PLANT_WAVE, PLANT_WIND
+	};
+
+	GridSimulator grid_simulator(0);
+	for (int i = 0; i < 4; i++) {
+		grid_simulator.pushPlant(renewable_types[i], 1);
+	}
+
+	this->profile_vec.clear();
+	this->profile_vec.resize(this->n_days);
+
+	for (int day = 0; day < this->n_days; day++) {
+		ScenarioProfile* profile_ptr = &(this->profile_vec[day]);
+		profile_ptr->seed = deriveSeed(this->seed, RNG_BATCH, day);
+
+		for (int type = 0; type < N_PLANT_TYPES; type++) {
+			for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+				profile_ptr->production_ratio[type][hour] = 0;
+			}
+		}
+
+		// no fossil plants, so no smog (solar ratios are an upper bound)
+		grid_simulator.reset(profile_ptr->seed);
+		grid_simulator.start();
+		for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+			profile_ptr->demand_GWh[hour] = grid_simulator.getEnergyDemandGWh();
+			for (int i = 0; i < 4; i++) {
+				profile_ptr->production_ratio[renewable_types[i]][hour] =
+					grid_simulator.getPlantModel(i).production_ratio;
+			}
+
+			grid_simulator.dispatchMeritOrder(this->merit_order);
+			grid_simulator.commitHour();
+		}
+
+		// dice are drawn once, right after reset (see BatchRunner::runTask())
+		for (int n_sets = 0; n_sets <= OPTIMIZER_MAX_GEO_SETS; n_sets++) {
+			grid_simulator.reset(profile_ptr->seed);
+			profile_ptr->geothermal_GW[n_sets] =
+				grid_simulator.rollGeothermalCapacity(n_sets);
+		}
+	}
+
+	return;
+}	// end PortfolioOptimizer::buildProfiles()
+
+
+PortfolioNode PortfolioOptimizer::makeChild(
+	const PortfolioNode& parent,
+	int type,
+	int tokens
+) {
+	/*
+	 *	Method to make the child node which adds the given investment to the
+	 *	parent portfolio (capacity profiles updated incrementally)
+	 */
+
+	PortfolioNode child = parent;
+	child.tokens[type] = tokens;
+	child.last_type = type;
+	child.n_slots++;
+	child.tokens_used += tokens;
+
+	int capacity_GW = tokens / tokensPerGW(type);
+
+	switch (type) {
+		case (PLANT_COAL):
+		case (PLANT_COMBINED):
+			child.fossil_GW += capacity_GW;
+			break;
+
+		case (PLANT_PEAKER):
+			child.fossil_GW += capacity_GW;
+			child.peaker_GW += capacity_GW;
+			break;
+
+		case (PLANT_FISSION):
+		case (PLANT_HYDRO):
+		case (PLANT_STORAGE):
+			if (type == PLANT_STORAGE) {
+				child.storage_GW += capacity_GW;
+			}
+			for (size_t i = 0; i < child.clean_GWh.size(); i++) {
+				child.clean_GWh[i] += capacity_GW;
+			}
+			break;
+
+		case (PLANT_GEOTHERMAL):
+			for (int day = 0; day < this->n_days; day++) {
+				int geothermal_GW = this->profile_vec[day].geothermal_GW[
+					tokens / CAPACITY_PER_GEOTHERMAL_ROLL
+				];
+				for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+					child.clean_GWh[day * HOURS_PER_GAME + hour] += geothermal_GW;
+				}
+			}
+			break;
+
+		case (PLANT_SOLAR):
+		case (PLANT_TIDAL):
+		case (PLANT_WAVE):
+		case (PLANT_WIND):
+			for (int day = 0; day < this->n_days; day++) {
+				const double* ratio_ptr = this->profile_vec[day].production_ratio[type];
+				for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+					int production_GWh = round(capacity_GW * ratio_ptr[hour]);
+					if (production_GWh < 0) {
+						production_GWh = 0;
+					}
+
+					child.clean_GWh[day * HOURS_PER_GAME + hour] += production_GWh;
+
+					// solar falls with smog, so it is not a firm lower bound
+					if (type != PLANT_SOLAR) {
+						child.must_take_GWh[day * HOURS_PER_GAME + hour] += production_GWh;
+					}
+				}
+			}
+			break;
+
+		default:
+			// do nothing!
+			break;
+	}
+
+	return child;
+}	// end PortfolioOptimizer::makeChild()
+
+
+int PortfolioOptimizer::getReserveTokens(const PortfolioNode& node) {
+	/*
+	 *	Method to get the tokens any descendant of the given node could still
+	 *	invest (none if no slots or types are left)
+	 */
+
+	if (
+		node.n_slots >= OPTIMIZER_MAX_SLOTS ||
+		node.last_type >= N_PLANT_TYPES - 1
+	) {
+		return 0;
+	}
+
+	return TOTAL_TOKENS - node.tokens_used;
+}	// end PortfolioOptimizer::getReserveTokens()
+
+
+double PortfolioOptimizer::getFossilWeight(const PortfolioNode& node, int reserve_tokens) {
+	/*
+	 *	Method to get the smallest emissions weight of any fossil plant the
+	 *	given node (or, given reserve, its descendants) could dispatch
+	 */
+
+	static const int fossil_types[3] = {PLANT_COAL, PLANT_COMBINED, PLANT_PEAKER};
+
+	double weight = 1;
+	for (int i = 0; i < 3; i++) {
+		int type = fossil_types[i];
+		bool present = node.tokens[type] > 0;
+		bool addable = reserve_tokens > 0 && type > node.last_type;
+
+		if ((present || addable) && emissionsWeight(type) < weight) {
+			weight = emissionsWeight(type);
+		}
+	}
+
+	return weight;
+}	// end PortfolioOptimizer::getFossilWeight()
+
+
+void PortfolioOptimizer::boundDay(
+	const PortfolioNode& node,
+	int day,
+	int reserve_tokens,
+	double* score_ptr,
+	double* emissions_ptr
+) {
+	/*
+	 *	Method to bound the score (from above) and emissions (from below) of
+	 *	every portfolio with the given node's plants plus up to reserve_tokens
+	 *	more invested in types after its last, on the given day
+	 *
+	 *	Each hour is relaxed on its own (no ramping, charge, or smog limits).
+	 *	The reserve adds at most its tokens times the best clean (or fossil)
+	 *	GW per token of any addable type that hour, plus half a GW of rounding
+	 *	per renewable slot left. Dispatching another fossil marble below
+	 *	demand nets 1 - weight >= 0, so the best hour covers as much of the
+	 *	residual as fossil capacity allows, at the cheapest weight. Merit
+	 *	order dispatch leaves at least the residual beyond all clean capacity
+	 *	to fossil, and the peaker takes whatever of it is left.
+	 */
+
+	const ScenarioProfile& profile = this->profile_vec[day];
+
+	double fossil_weight = this->getFossilWeight(node, reserve_tokens);
+	int peaker_GW = this->peaker_in_merit_order ? node.peaker_GW : 0;
+
+	// reserve rates [GW/token], by type class
+	double firm_rate = 0;
+	double fossil_rate = 0;
+	int storage_reserve_GW = 0;
+	std::vector<int> renewable_vec;
+	if (reserve_tokens > 0) {
+		for (int type = node.last_type + 1; type < N_PLANT_TYPES; type++) {
+			switch (type) {
+				case (PLANT_COAL):
+				case (PLANT_COMBINED):
+				case (PLANT_PEAKER):
+					fossil_rate = std::max(fossil_rate, 1.0 / tokensPerGW(type));
+					break;
+
+				case (PLANT_STORAGE):
+					storage_reserve_GW = reserve_tokens / tokensPerGW(type);
+					firm_rate = std::max(firm_rate, 1.0 / tokensPerGW(type));
+					break;
+
+				case (PLANT_SOLAR):
+				case (PLANT_TIDAL):
+				case (PLANT_WAVE):
+				case (PLANT_WIND):
+					renewable_vec.push_back(type);
+					break;
+
+				default:
+					firm_rate = std::max(firm_rate, 1.0 / tokensPerGW(type));
+					break;
+			}
+		}
+	}
+	int fossil_reserve_GW = reserve_tokens * fossil_rate;
+	double rounding_GW = 0;
+	if (!renewable_vec.empty()) {
+		rounding_GW = 0.5 * (OPTIMIZER_MAX_SLOTS - node.n_slots);
+	}
+
+	double score = 0;
+	double emissions = 0;
+
+	for (int hour = 0; hour < HOURS_PER_GAME; hour++) {
+		int idx = day * HOURS_PER_GAME + hour;
+		int demand_GWh = profile.demand_GWh[hour];
+
+		double clean_rate = firm_rate;
+		for (size_t i = 0; i < renewable_vec.size(); i++) {
+			clean_rate = std::max(
+				clean_rate,
+				profile.production_ratio[renewable_vec[i]][hour]
+			);
+		}
+		int clean_GWh = node.clean_GWh[idx] +
+			int(reserve_tokens * clean_rate + rounding_GW);
+
+		int need_GWh = std::max(0, demand_GWh - clean_GWh);
+		int unmet_GWh = std::max(0, need_GWh - node.fossil_GW - fossil_reserve_GW);
+		int excess_GWh = std::max(
+			0,
+			node.must_take_GWh[idx] - demand_GWh - node.storage_GW - storage_reserve_GW
+		);
+
+		if (unmet_GWh > 0) {
+			score -= unmet_GWh;
+		}
+		else {
+			score += demand_GWh;
+		}
+		score -= fossil_weight * (need_GWh - unmet_GWh);
+		score -= excess_GWh;
+
+		emissions += fossil_weight * std::min(need_GWh, peaker_GW);
+	}
+
+	*score_ptr = score;
+	*emissions_ptr = emissions;
+
+	return;
+}	// end PortfolioOptimizer::boundDay()
+
+
+void PortfolioOptimizer::bound(
+	const PortfolioNode& node,
+	int reserve_tokens,
+	double* score_ptr,
+	double* emissions_ptr
+) {
+	/*
+	 *	Method to bound the mean score (from above) and mean emissions (from
+	 *	below) over the sampled days
+	 */
+
+	double score = 0;
+	double emissions = 0;
+
+	for (int day = 0; day < this->n_days; day++) {
+		double day_score = 0;
+		double day_emissions = 0;
+		this->boundDay(node, day, reserve_tokens, &day_score, &day_emissions);
+
+		score += day_score;
+		emissions += day_emissions;
+	}
+
+	*score_ptr = score / this->n_days;
+	*emissions_ptr = emissions / this->n_days;
+
+	return;
+}	// end PortfolioOptimizer::bound()
+
+
+bool PortfolioOptimizer::isDominated(double score, double emissions) {
+	/*
+	 *	Method to check if a point is (weakly) dominated by the front so far
+	 */
+
+	std::lock_guard<std::mutex> lock(this->front_mutex);
+
+	for (size_t i = 0; i < this->front_vec.size(); i++) {
+		if (
+			this->front_vec[i].score >= score &&
+			this->front_vec[i].emissions <= emissions
+		) {
+			return true;
+		}
+	}
+
+	return false;
+}	// end PortfolioOptimizer::isDominated()
+
+
+void PortfolioOptimizer::offer(const PortfolioScore& portfolio_score) {
+	/*
+	 *	Method to add a scored portfolio to the front, if it is not dominated
+	 *	(and drop any points it dominates)
+	 */
+
+	std::lock_guard<std::mutex> lock(this->front_mutex);
+
+	for (size_t i = 0; i < this->front_vec.size(); i++) {
+		if (
+			this->front_vec[i].score >= portfolio_score.score &&
+			this->front_vec[i].emissions <= portfolio_score.emissions
+		) {
+			return;
+		}
+	}
+
+	size_t n_kept = 0;
+	for (size_t i = 0; i < this->front_vec.size(); i++) {
+		if (
+			portfolio_score.score >= this->front_vec[i].score &&
+			portfolio_score.emissions <= this->front_vec[i].emissions
+		) {
+			continue;
+		}
+		this->front_vec[n_kept] = this->front_vec[i];
+		n_kept++;
+	}
+	this->front_vec.resize(n_kept);
+	this->front_vec.push_back(portfolio_score);
+
+	return;
+}	// end PortfolioOptimizer::offer()
+
+
+void PortfolioOptimizer::evaluate(const PortfolioNode& node, GridSimulator* grid_simulator_ptr) {
+	/*
+	 *	Method to score the given node's portfolio over the sampled days, and
+	 *	offer it to the front
+	 *
+	 *	Days are raced: after each day, the remaining days are filled in by
+	 *	their bounds, and evaluation stops once that cannot reach the front.
+	 */
+
+	std::vector<double> score_bound_vec(this->n_days + 1, 0);
+	std::vector<double> emissions_bound_vec(this->n_days + 1, 0);
+	for (int day = this->n_days - 1; day >= 0; day--) {
+		double day_score = 0;
+		double day_emissions = 0;
+		this->boundDay(node, day, 0, &day_score, &day_emissions);
+
+		score_bound_vec[day] = score_bound_vec[day + 1] + day_score;
+		emissions_bound_vec[day] = emissions_bound_vec[day + 1] + day_emissions;
+	}
+
+	double score = 0;
+	double emissions = 0;
+	int unmet_demand_GWh = 0;
+
+	for (int day = 0; day < this->n_days; day++) {
+		const ScenarioProfile& profile = this->profile_vec[day];
+
+		// as BatchRunner::runTask(), with the memoized geothermal roll
+		grid_simulator_ptr->clearPlants();
+		grid_simulator_ptr->reset(profile.seed);
+		for (int type = 0; type < N_PLANT_TYPES; type++) {
+			if (node.tokens[type] <= 0) {
+				continue;
+			}
+
+			if (type == PLANT_GEOTHERMAL) {
+				grid_simulator_ptr->pushPlant(
+					type,
+					profile.geothermal_GW[node.tokens[type] / CAPACITY_PER_GEOTHERMAL_ROLL]
+				);
+			}
+			else {
+				grid_simulator_ptr->pushPlantTokens(type, node.tokens[type]);
+			}
+		}
+
+		score += grid_simulator_ptr->runDay(this->merit_order);
+		emissions += grid_simulator_ptr->getCoalMarbles() +
+			0.5 * grid_simulator_ptr->getCombinedMarbles() +
+			0.75 * grid_simulator_ptr->getPeakerMarbles();
+		unmet_demand_GWh += grid_simulator_ptr->getUnmetDemandGWh();
+		this->n_days_simulated++;
+
+		if (
+			day + 1 < this->n_days &&
+			this->isDominated(
+				(score + score_bound_vec[day + 1]) / this->n_days,
+				(emissions + emissions_bound_vec[day + 1]) / this->n_days
+			)
+		) {
+			this->n_raced++;
+			return;
+		}
+	}
+
+	PortfolioScore portfolio_score;
+	portfolio_score.tokens = node.tokens;
+	portfolio_score.score = score / this->n_days;
+	portfolio_score.emissions = emissions / this->n_days;
+	portfolio_score.unmet_demand_GWh = double(unmet_demand_GWh) / this->n_days;
+
+	this->n_evaluated++;
+	this->offer(portfolio_score);
+
+	return;
+}	// end PortfolioOptimizer::evaluate()
+
+
+void PortfolioOptimizer::search(const PortfolioNode& node, GridSimulator* grid_simulator_ptr) {
+	/*
+	 *	Method to search the subtree at the given node (depth first, types
+	 *	added in index order)
+	 */
+
+	this->n_nodes++;
+
+	int reserve_tokens = this->getReserveTokens(node);
+
+	double score_bound = 0;
+	double emissions_bound = 0;
+	this->bound(node, reserve_tokens, &score_bound, &emissions_bound);
+	if (this->isDominated(score_bound, emissions_bound)) {
+		this->n_pruned++;
+		return;
+	}
+
+	this->evaluate(node, grid_simulator_ptr);
+
+	if (node.n_slots >= OPTIMIZER_MAX_SLOTS) {
+		return;
+	}
+
+	for (int type = node.last_type + 1; type < N_PLANT_TYPES; type++) {
+		int step_tokens = this->token_step * tokensPerUnit(type);
+		for (
+			int tokens = step_tokens;
+			node.tokens_used + tokens <= TOTAL_TOKENS;
+			tokens += step_tokens
+		) {
+			this->search(this->makeChild(node, type, tokens), grid_simulator_ptr);
+		}
+	}
+
+	return;
+}	// end PortfolioOptimizer::search()
+
+
+void PortfolioOptimizer::run(void) {
+	/*
+	 *	Method to run the search (single type portfolios first, to seed the
+	 *	front, then every two type subtree as a task on all cores)
+	 */
+
+	int n_threads = this->n_threads;
+	if (n_threads <= 0) {
+		n_threads = std::thread::hardware_concurrency();
+	}
+	if (n_threads <= 0) {
+		n_threads = 1;
+	}
+
+	auto start_time = std::chrono::steady_clock::now();
+
+	this->buildProfiles();
+
+	PortfolioNode root;
+	root.tokens.fill(0);
+	root.last_type = PLANT_NULL;
+	root.n_slots = 0;
+	root.tokens_used = 0;
+	root.fossil_GW = 0;
+	root.peaker_GW = 0;
+	root.storage_GW = 0;
+	root.clean_GWh.assign(this->n_days * HOURS_PER_GAME, 0);
+	root.must_take_GWh.assign(this->n_days * HOURS_PER_GAME, 0);
+
+	// single type portfolios
+	std::vector<PortfolioNode> first_vec;
+	GridSimulator grid_simulator(0);
+	for (int type = 0; type < N_PLANT_TYPES; type++) {
+		int step_tokens = this->token_step * tokensPerUnit(type);
+		for (int tokens = step_tokens; tokens <= TOTAL_TOKENS; tokens += step_tokens) {
+			first_vec.push_back(this->makeChild(root, type, tokens));
+			this->evaluate(first_vec.back(), &grid_simulator);
+			this->n_nodes++;
+		}
+	}
+
+	// two type subtrees
+	WorkStealingPool pool(n_threads);
+	int n_tasks = 0;
+	for (size_t i = 0; i < first_vec.size(); i++) {
+		const PortfolioNode* first_ptr = &(first_vec[i]);
+
+		for (int type = first_ptr->last_type + 1; type < N_PLANT_TYPES; type++) {
+			int step_tokens = this->token_step * tokensPerUnit(type);
+			for (
+				int tokens = step_tokens;
+				first_ptr->tokens_used + tokens <= TOTAL_TOKENS;
+				tokens += step_tokens
+			) {
+				pool.push(
+					n_tasks,
+					[this, first_ptr, type, tokens]() {
+						GridSimulator task_simulator(0);
+						this->search(
+							this->makeChild(*first_ptr, type, tokens),
+							&task_simulator
+						);
+					}
+				);
+				n_tasks++;
+			}
+		}
+	}
+	pool.run();
+
+	double run_time_s = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start_time
+	).count();
+
+	// sort front by emissions, and print
+	std::sort(
+		this->front_vec.begin(),
+		this->front_vec.end(),
+		[](const PortfolioScore& a, const PortfolioScore& b) {
+			return a.emissions < b.emissions;
+		}
+	);
+
+	std::cout << "\toptimizer finished: " << this->n_days << " day(s), " <<
+		this->n_nodes << " node(s), " << this->n_pruned << " pruned, " <<
+		this->n_evaluated << " evaluated, " << this->n_raced << " raced, " <<
+		this->n_days_simulated << " day(s) simulated, in " << run_time_s <<
+		" s on " << n_threads << " thread(s)." << std::endl;
+
+	std::ios_base::fmtflags cout_flags = std::cout.flags();
+	std::streamsize cout_precision = std::cout.precision();
+
+	std::cout << "\n\tPareto front (mean score vs mean emissions [marbles/day]):" << std::endl;
+	for (size_t i = 0; i < this->front_vec.size(); i++) {
+		std::cout << "\t\t" << std::fixed << std::setprecision(2) <<
+			std::setw(8) << this->front_vec[i].score <<
+			std::setw(8) << this->front_vec[i].emissions << "\t" <<
+			this->getPortfolioString(this->front_vec[i].tokens) << std::endl;
+	}
+	std::cout.flags(cout_flags);
+	std::cout.precision(cout_precision);
+
+	return;
+}	// end PortfolioOptimizer::run()
+
+
+std::string PortfolioOptimizer::getPortfolioString(const TokenVector& tokens) {
+	/*
+	 *	Method to get a portfolio as <type>:<tokens> slots (as in a batch
+	 *	scenario file)
+	 */
+
+	std::stringstream portfolio_ss;
+	for (int type = 0; type < N_PLANT_TYPES; type++) {
+		if (tokens[type] <= 0) {
+			continue;
+		}
+		if (portfolio_ss.tellp() > 0) {
+			portfolio_ss << " ";
+		}
+		portfolio_ss << plantTypeToString(type) << ":" << tokens[type];
+	}
+
+	return portfolio_ss.str();
+}	// end PortfolioOptimizer::getPortfolioString()
+
+
+const std::vector<int>& PortfolioOptimizer::getMeritOrder(void) {
+	return this->merit_order;
+}	// end PortfolioOptimizer::getMeritOrder()
+
+
+const std::vector<PortfolioScore>& PortfolioOptimizer::getFront(void) {
+	return this->front_vec;
+}	// end PortfolioOptimizer::getFront()
+
+
+void PortfolioOptimizer::writeFront(std::string path) {
+	/*
+	 *	Method to write the front to a CSV file
+	 */
+
+	std::ofstream out_stream(path);
+	if (!out_stream.is_open()) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: PortfolioOptimizer::writeFront(): " <<
+			"could not open " << path;
+		throw std::runtime_error(error_ss.str());
+	}
+
+	out_stream << "score,emissions,unmet_demand_GWh,portfolio\n";
+	for (size_t i = 0; i < this->front_vec.size(); i++) {
+		out_stream << this->front_vec[i].score << "," <<
+			this->front_vec[i].emissions << "," <<
+			this->front_vec[i].unmet_demand_GWh << "," <<
+			this->getPortfolioString(this->front_vec[i].tokens) << "\n";
+	}
+
+	std::cout << "\tfront written to \"" << path << "\"." << std::endl;
+
+	return;
+}	// end PortfolioOptimizer::writeFront()
+
+
+PortfolioOptimizer::~PortfolioOptimizer(void) {
+	/*
+	 *	Destructor for PortfolioOptimizer class
+	 */
+
+	// stream out and return
+	std::cout << "PortfolioOptimizer object at " << this << " destroyed." << std::endl;
+	return;
+}	// end PortfolioOptimizer::~PortfolioOptimizer()
@@ -0,0 +1,285 @@
+/*
+ *	Random number implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the counter-based random streams and of the process-wide
+ *	random service.
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/Random.h"
+
+#include <ctime>
+#include <sstream>
+#include <stdexcept>
+
+
+// -------- constants -------- //
+static const unsigned long long RNG_GAMMA = 0x9E3779B97F4A7C15ULL;	// golden ratio increment
+static const double RNG_DOUBLE_UNIT = 1.0 / 9007199254740992.0;		// 2^-53
+static const float RNG_FLOAT_UNIT = 1.0f / 16777216.0f;				// 2^-24
+
+
+// -------- function implementations -------- //
+
+unsigned long long mixBits(unsigned long long x) {
+	/*
+	 *	SplitMix64 output function (a bijective 64 bit mixer)
+	 */
+
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}	// end mixBits()
+
+
+unsigned long long deriveSeed(
+	unsigned long long seed,
+	unsigned long long domain,
+	unsigned long long index
+) {
+	/*
+	 *	Function to derive an independent key from a seed, a domain (e.g. a
+	 *	RandomSubsystem), and an index (e.g. a thread or game number)
+	 */
+
+	unsigned long long x = mixBits(seed + RNG_GAMMA);
+	x = mixBits(x ^ ((domain + 1) * 0xD1B54A32D192ED03ULL));
+	x = mixBits(x ^ ((index + 1) * RNG_GAMMA));
+	return x;
+}	// end deriveSeed()
+
+
+// ---- RandomStream ---- //
+
+RandomStream::RandomStream(void) {
+	/*
+	 *	Constructor for RandomStream class (key 0)
+	 *
+	 *	(no stream out here, these are copied around freely)
+	 */
+
+	this->key = 0;
+	this->counter = 0;
+	return;
+}	// end RandomStream::RandomStream()
+
+
+RandomStream::RandomStream(unsigned long long key) {
+	/*
+	 *	Constructor for RandomStream class
+	 */
+
+	this->key = key;
+	this->counter = 0;
+	return;
+}	// end RandomStream::RandomStream()
+
+
+unsigned long long RandomStream::getKey(void) {
+	return this->key;
+}	// end RandomStream::getKey()
+
+
+unsigned long long RandomStream::getCounter(void) {
+	return this->counter;
+}	// end RandomStream::getCounter()
+
+
+void RandomStream::setCounter(unsigned long long counter) {
+	/*
+	 *	Method to jump the stream to the given position
+	 */
+
+	this->counter = counter;
+	return;
+}	// end RandomStream::setCounter()
+
+
+unsigned long long RandomStream::nextBits(void) {
+	/*
+	 *	Method to draw the next 64 random bits
+	 */
+
+	this->counter++;
+	return mixBits(this->key + this->counter * RNG_GAMMA);
+}	// end RandomStream::nextBits()
+
+
+double RandomStream::uniform(void) {
+	/*
+	 *	Method to draw a uniform double on [0, 1) (53 bits)
+	 */
+
+	return double(this->nextBits() >> 11) * RNG_DOUBLE_UNIT;
+}	// end RandomStream::uniform()
+
+
+float RandomStream::uniformFloat(void) {
+	/*
+	 *	Method to draw a uniform float on [0, 1) (24 bits)
+	 */
+
+	return float(this->nextBits() >> 40) * RNG_FLOAT_UNIT;
+}	// end RandomStream::uniformFloat()
+
+
+int RandomStream::uniformInt(int lower, int upper) {
+	/*
+	 *	Method to draw a uniform integer on [lower, upper]
+	 */
+
+	if (upper < lower) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: RandomStream::uniformInt(): upper bound " <<
+			upper << " less than lower bound " << lower;
+		throw std::runtime_error(error_ss.str());
+	}
+
+	return lower + int(double(upper - lower + 1) * this->uniform());
+}	// end RandomStream::uniformInt()
+
+
+void RandomStream::fill(float* out_ptr, size_t n) {
+	/*
+	 *	Method to fill a buffer with uniform floats on [0, 1)
+	 *
+	 *	(each output depends only on its own counter, so this loop has no
+	 *	carried dependency and the compiler is free to vectorize it)
+	 */
+
+	const unsigned long long base = this->key + this->counter * RNG_GAMMA;
+	for (size_t i = 0; i < n; i++) {
+		unsigned long long bits = mixBits(base + (i + 1) * RNG_GAMMA);
+		out_ptr[i] = float(bits >> 40) * RNG_FLOAT_UNIT;
+	}
+	this->counter += n;
+
+	return;
+}	// end RandomStream::fill()
+
+
+void RandomStream::fill(double* out_ptr, size_t n) {
+	/*
+	 *	Method to fill a buffer with uniform doubles on [0, 1)
+	 */
+
+	const unsigned long long base = this->key + this->counter * RNG_GAMMA;
+	for (size_t i = 0; i < n; i++) {
+		unsigned long long bits = mixBits(base + (i + 1) * RNG_GAMMA);
+		out_ptr[i] = double(bits >> 11) * RNG_DOUBLE_UNIT;
+	}
+	this->counter += n;
+
+	return;
+}	// end RandomStream::fill()
+
+
+void RandomStream::fill(std::vector<float>* out_vec_ptr) {
+	/*
+	 *	Method to fill a whole vector with uniform floats on [0, 1)
+	 */
+
+	this->fill(out_vec_ptr->data(), out_vec_ptr->size());
+	return;
+}	// end RandomStream::fill()
+
+
+RandomStream::~RandomStream(void) {
+	return;
+}	// end RandomStream::~RandomStream()
+
+
+// ---- RandomService ---- //
+
+RandomService::RandomService(unsigned long long game_seed) {
+	/*
+	 *	Constructor for RandomService class
+	 */
+
+	this->reseed(game_seed);
+	return;
+}	// end RandomService::RandomService()
+
+
+void RandomService::reseed(unsigned long long game_seed) {
+	/*
+	 *	Method to set the game seed and rekey all subsystem streams (stream
+	 *	references taken before stay valid)
+	 */
+
+	this->game_seed = game_seed;
+	this->stream_vec.resize(N_RNG_SUBSYSTEMS);
+	for (int i = 0; i < N_RNG_SUBSYSTEMS; i++) {
+		this->stream_vec[i] = this->deriveStream(i, 0);
+	}
+
+	return;
+}	// end RandomService::reseed()
+
+
+unsigned long long RandomService::getSeed(void) {
+	return this->game_seed;
+}	// end RandomService::getSeed()
+
+
+RandomStream& RandomService::getStream(int subsystem) {
+	/*
+	 *	Method to get the (main thread) stream of the given subsystem
+	 */
+
+	if (subsystem < 0 || subsystem >= N_RNG_SUBSYSTEMS) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: RandomService::getStream(): subsystem " <<
+			subsystem << " out of range";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	return this->stream_vec[subsystem];
+}	// end RandomService::getStream()
+
+
+RandomStream RandomService::deriveStream(int subsystem, unsigned long long index) const {
+	/*
+	 *	Method to derive an independent stream for the given subsystem and
+	 *	index (e.g. worker thread number); index 0 is the main thread stream
+	 */
+
+	return RandomStream(deriveSeed(this->game_seed, subsystem, index));
+}	// end RandomService::deriveStream()
+
+
+RandomService::~RandomService(void) {
+	return;
+}	// end RandomService::~RandomService()
+
+
+// -------- function implementations (process-wide service) -------- //
+
+RandomService& randomService(void) {
+	/*
+	 *	Function to get the process-wide random service (seeded from the
+	 *	clock until main() reseeds it)
+	 */
+
+	static RandomService random_service((unsigned long long)time(NULL));
+	return random_service;
+}	// end randomService()
+
+
+RandomStream& randomStream(int subsystem) {
+	/*
+	 *	Shorthand for randomService().getStream(subsystem)
+	 */
+
+	return randomService().getStream(subsystem);
+}	// end randomStream()
@@ -0,0 +1,340 @@
+/*
+ *	Session log implementation for Megawatts & Marbles - The Energy Planning Game
+ *
+ *	[ESC] Interactive
+ *
+ *	Anthony Truelove MASc, P.Eng.
+ *	Spencer Funk BEng, EIT
+ *
+ *	Copyright 2022 (C) - [ESC] Interactive
+ *	See license terms for details
+ *
+ *	Implementation of the session log (see Session.h for the file format).
+ *
+ */
+
+
+// -------- includes -------- //
+#include "../header/Session.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+
+// -------- constants -------- //
+static const char SESSION_MAGIC[4] = {'M', 'M', 'S', 'R'};
+static const unsigned char SESSION_VERSION = 1;
+
+
+// -------- function implementations -------- //
+
+static void writeVarint(std::string* bytes_ptr, unsigned long long value) {
+	/*
+	 *	Helper function to append an unsigned LEB128 varint
+	 */
+
+	while (value >= 0x80) {
+		bytes_ptr->push_back(char((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	bytes_ptr->push_back(char(value));
+
+	return;
+}	// end writeVarint()
+
+
+static bool readVarint(
+	const std::string& bytes,
+	size_t* idx_ptr,
+	unsigned long long* value_ptr
+) {
+	/*
+	 *	Helper function to read an unsigned LEB128 varint (false if truncated
+	 *	or too long)
+	 */
+
+	unsigned long long value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		if (*idx_ptr >= bytes.size()) {
+			return false;
+		}
+
+		unsigned char byte = bytes[*idx_ptr];
+		(*idx_ptr)++;
+
+		value |= (unsigned long long)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			*value_ptr = value;
+			return true;
+		}
+	}
+
+	return false;
+}	// end readVarint()
+
+
+static unsigned long long zigzag(long long value) {
+	return ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63);
+}	// end zigzag()
+
+
+static long long unzigzag(unsigned long long value) {
+	return (long long)(value >> 1) ^ -(long long)(value & 1);
+}	// end unzigzag()
+
+
+// ---- SessionLog ---- //
+
+SessionLog::SessionLog(void) {
+	/*
+	 *	Constructor for SessionLog class
+	 */
+
+	this->reset(0);
+
+	// stream out and return
+	std::cout << "\nSessionLog object created at " << this << "." << std::endl;
+	return;
+}	// end SessionLog::SessionLog()
+
+
+void SessionLog::reset(unsigned long long seed) {
+	/*
+	 *	Method to clear the log and start a new session with the given seed
+	 */
+
+	this->seed = seed;
+	this->replay_idx = 0;
+	this->event_vec.clear();
+
+	return;
+}	// end SessionLog::reset()
+
+
+void SessionLog::pushEvent(int frame, int type, int value) {
+	/*
+	 *	Method to log an event (frames must not decrease)
+	 */
+
+	if (!this->event_vec.empty() && frame < this->event_vec.back().frame) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: SessionLog::pushEvent(): frame " << frame <<
+			" is before the last logged frame " << this->event_vec.back().frame;
+		throw std::runtime_error(error_ss.str());
+	}
+
+	SessionEvent event;
+	event.frame = frame;
+	event.type = type;
+	event.value = value;
+	this->event_vec.push_back(event);
+
+	return;
+}	// end SessionLog::pushEvent()
+
+
+void SessionLog::write(std::string path) {
+	/*
+	 *	Method to write the log to the given path (see Session.h for format)
+	 */
+
+	std::string bytes(SESSION_MAGIC, 4);
+	bytes.push_back(char(SESSION_VERSION));
+	for (int i = 0; i < 8; i++) {
+		bytes.push_back(char((this->seed >> (8 * i)) & 0xFF));
+	}
+
+	writeVarint(&bytes, this->event_vec.size());
+	int last_frame = 0;
+	for (size_t i = 0; i < this->event_vec.size(); i++) {
+		bytes.push_back(char(this->event_vec[i].type));
+		writeVarint(&bytes, this->event_vec[i].frame - last_frame);
+		writeVarint(&bytes, zigzag(this->event_vec[i].value));
+		last_frame = this->event_vec[i].frame;
+	}
+
+	std::ofstream out_stream(path, std::ios::binary);
+	if (!out_stream.is_open()) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: SessionLog::write(): Cannot open \"" <<
+			path << "\" for writing.";
+		throw std::runtime_error(error_ss.str());
+	}
+	out_stream.write(bytes.data(), bytes.size());
+
+	return;
+}	// end SessionLog::write()
+
+
+void SessionLog::read(std::string path) {
+	/*
+	 *	Method to read a log from the given path (see Session.h for format),
+	 *	ready to replay
+	 */
+
+	std::ifstream in_stream(path, std::ios::binary);
+	if (!in_stream.is_open()) {
+		std::stringstream error_ss;
+		error_ss << "EXCEPTION: SessionLog::read(): Cannot open session at \"" <<
+			path << "\".";
+		throw std::runtime_error(error_ss.str());
+	}
+	std::string bytes(
+		(std::istreambuf_iterator<char>(in_stream)),
+		std::istreambuf_iterator<char>()
+	);
+
+	std::stringstream error_ss;
+	error_ss << "EXCEPTION: SessionLog::read(): \"" << path << "\" ";
+
+	if (bytes.size() < 13 || bytes.compare(0, 4, SESSION_MAGIC, 4) != 0) {
+		error_ss << "is not a session log.";
+		throw std::runtime_error(error_ss.str());
+	}
+	if ((unsigned char)bytes[4] != SESSION_VERSION) {
+		error_ss << "has unsupported version " << int((unsigned char)bytes[4]) << ".";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	unsigned long long seed = 0;
+	for (int i = 0; i < 8; i++) {
+		seed |= (unsigned long long)(unsigned char)bytes[5 + i] << (8 * i);
+	}
+
+	size_t idx = 13;
+	unsigned long long n_events = 0;
+	if (!readVarint(bytes, &idx, &n_events)) {
+		error_ss << "is truncated.";
+		throw std::runtime_error(error_ss.str());
+	}
+
+	std::vector<SessionEvent> event_vec;
+	int frame = 0;
+	for (unsigned long long i = 0; i < n_events; i++) {
+		unsigned long long delta = 0;
+		unsigned long long value = 0;
+		if (idx >= bytes.size()) {
+			error_ss << "is truncated (event " << i << " of " << n_events << ").";
+			throw std::runtime_error(error_ss.str());
+		}
+		int type = (unsigned char)bytes[idx];
+		idx++;
+		if (
+			!readVarint(bytes, &idx, &delta) ||
+			!readVarint(bytes, &idx, &value)
+		) {
+			error_ss << "is truncated (event " << i << " of " << n_events << ").";
+			throw std::runtime_error(error_ss.str());
+		}
+		if (type >= N_SESSION_EVENT_TYPES) {
+			error_ss << "has unknown event type " << type << " (event " << i << ").";
+			throw std::runtime_error(error_ss.str());
+		}
+
+		frame += int(delta);
+
+		SessionEvent event;
+		event.frame = frame;
+		event.type = type;
+		event.value = int(unzigzag(value));
+		event_vec.push_back(event);
+	}
+
+	this->seed = seed;
+	this->replay_idx = 0;
+	this->event_vec = event_vec;
+
+	return;
+}	// end SessionLog::read()
+
+
+void SessionLog::rewind(void) {
+	/*
+	 *	Method to restart playback from the first event
+	 */
+
+	this->replay_idx = 0;
+	return;
+}	// end SessionLog::rewind()
+
+
+bool SessionLog::nextEvent(int frame, SessionEvent* event_ptr) {
+	/*
+	 *	Method to play back the next event due by the given frame (false if
+	 *	none are due yet)
+	 */
+
+	if (
+		this->replay_idx >= this->event_vec.size() ||
+		this->event_vec[this->replay_idx].frame > frame
+	) {
+		return false;
+	}
+
+	*event_ptr = this->event_vec[this->replay_idx];
+	this->replay_idx++;
+
+	return true;
+}	// end SessionLog::nextEvent()
+
+
+bool SessionLog::hasEvent(int frame, int type, int value) {
+	/*
+	 *	Method to check if the given event was logged (used to check a replay
+	 *	against its recording)
+	 */
+
+	size_t lower = 0;
+	size_t upper = this->event_vec.size();
+	while (lower < upper) {
+		size_t middle = (lower + upper) / 2;
+		if (this->event_vec[middle].frame < frame) {
+			lower = middle + 1;
+		}
+		else {
+			upper = middle;
+		}
+	}
+
+	for (size_t i = lower; i < this->event_vec.size(); i++) {
+		if (this->event_vec[i].frame != frame) {
+			break;
+		}
+		if (
+			this->event_vec[i].type == type &&
+			this->event_vec[i].value == value
+		) {
+			return true;
+		}
+	}
+
+	return false;
+}	// end SessionLog::hasEvent()
+
+
+unsigned long long SessionLog::getSeed(void) {
+	return this->seed;
+}	// end SessionLog::getSeed()
+
+
+int SessionLog::getNumEvents(void) {
+	return this->event_vec.size();
+}	// end SessionLog::getNumEvents()
+
+
+SessionEvent SessionLog::getEvent(int i) {
+	return this->event_vec.at(i);
+}	// end SessionLog::getEvent()
+
+
+SessionLog::~SessionLog(void) {
+	/*
+	 *	Destructor for SessionLog class
+	 */
+
+	std::cout << "SessionLog object at " << this << " destroyed." << std::endl;
+	return;
+}	// end SessionLog::~SessionLog()
@@ -25,14 +25,28 @@
 #include "../header/constants.h"
 #include "../header/includes.h"
 
+#include "../header/AssetPack.h"
 #include "../header/ESC.h"
 #include "../header/MM.h"
+#include "../header/BatchRunner.h"
+#include "../header/Benchmarks.h"
+#include "../header/PixelCache.h"
+#include "../header/PortfolioOptimizer.h"
 
 
 // -------- global variables -------- //
 //          USE SPARINGLY!!!          //
 bool fullscreen = false;
 bool test_flag = false;
+bool batch_flag = false;
+bool benchmark_flag = false;
+bool optimize_flag = false;
+bool pack_flag = false;
+std::string record_path = "";
+std::string replay_path = "";
+int replay_speed = 1;
+double target_frame_rate = FRAMES_PER_SECOND;
+double asset_budget_MB = ASSET_RESIDENCY_BUDGET_MB;
 
 
 // -------- helper functions -------- //
@@ -56,6 +70,143 @@ void handleInputArgs(int argc, char** argv) {
 			test_flag = true;
 		}
 
+		else if (
+			arg_str.compare("--batch") == 0 ||
+			arg_str.compare("-b") == 0
+		) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --batch requires a scenario file."
+				);
+			}
+			i++;
+			runBatch(std::string(argv[i]));
+			batch_flag = true;
+		}
+
+		else if (arg_str.compare("--benchmark") == 0) {
+			runBenchmarks();
+			benchmark_flag = true;
+		}
+
+		else if (arg_str.compare("--benchmark-startup") == 0) {
+			benchmarkStartup();
+			benchmark_flag = true;
+		}
+
+		else if (arg_str.compare("--benchmark-assets") == 0) {
+			benchmarkAssetHandles();
+			benchmark_flag = true;
+		}
+
+		else if (arg_str.compare("--optimize") == 0) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --optimize requires a number of days."
+				);
+			}
+			i++;
+			int n_days = std::stoi(std::string(argv[i]));
+
+			// optional token step (coarser, faster search)
+			int token_step = 1;
+			if (i + 1 < argc && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9') {
+				i++;
+				token_step = std::stoi(std::string(argv[i]));
+			}
+
+			runOptimizer(n_days, token_step);
+			optimize_flag = true;
+		}
+
+		else if (arg_str.compare("--pack") == 0) {
+			// optional output path (else the path the game looks for)
+			std::string pack_path = ASSET_PACK_PATH;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				i++;
+				pack_path = std::string(argv[i]);
+			}
+
+			AssetPack::build("assets", pack_path);
+			pack_flag = true;
+		}
+
+		else if (
+			arg_str.compare("--seed") == 0 ||
+			arg_str.compare("-s") == 0
+		) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --seed requires a value."
+				);
+			}
+			i++;
+			randomService().reseed(std::stoull(std::string(argv[i])));
+		}
+
+		else if (arg_str.compare("--record") == 0) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --record requires a session file."
+				);
+			}
+			i++;
+			record_path = std::string(argv[i]);
+		}
+
+		else if (arg_str.compare("--replay") == 0) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --replay requires a session file."
+				);
+			}
+			i++;
+			replay_path = std::string(argv[i]);
+
+			// optional speed (multiple of real time, e.g. 1, 4, 16), or headless
+			if (i + 1 < argc) {
+				std::string speed_str(argv[i + 1]);
+				if (speed_str.compare("headless") == 0) {
+					i++;
+					replay_speed = 0;
+				}
+				else if (argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9') {
+					i++;
+					replay_speed = std::stoi(speed_str);
+				}
+			}
+		}
+
+		else if (arg_str.compare("--fps") == 0) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --fps requires a frame rate."
+				);
+			}
+			i++;
+			target_frame_rate = std::stod(std::string(argv[i]));
+			if (target_frame_rate <= 0) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --fps must be positive."
+				);
+			}
+		}
+
+		else if (arg_str.compare("--asset-budget") == 0) {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --asset-budget requires a budget [MB]."
+				);
+			}
+			i++;
+			asset_budget_MB = std::stod(std::string(argv[i]));
+			if (asset_budget_MB < 0) {
+				throw std::runtime_error(
+					"EXCEPTION: handleInputArgs(): --asset-budget must not be negative."
+				);
+			}
+		}
+
 		// else if ()
 
 		// else {}
@@ -71,7 +222,7 @@ int main(int argc, char** argv)
 	// handle input args
 	try {
 		handleInputArgs(argc, argv);
-		if (test_flag) {
+		if (test_flag || batch_flag || benchmark_flag || optimize_flag || pack_flag) {
 			return 0;
 		}
 	}
@@ -82,17 +233,48 @@ int main(int argc, char** argv)
 
 	// init window pointer (used throughout)
 	sf::RenderWindow* window_ptr;
-	/* initialize random seed: */
-  srand (time(NULL));
+
+	// a replay takes its seed from the session log (and streams restart
+	// from their first draw either way, so a recording starts clean)
+	SessionLog session_log;
+	try {
+		if (!replay_path.empty()) {
+			session_log.read(replay_path);
+			randomService().reseed(session_log.getSeed());
+		}
+		else {
+			randomService().reseed(randomService().getSeed());
+		}
+	}
+	catch (const std::exception &exception) {
+		std::cerr << exception.what() << std::endl;
+		return -1;
+	}
+
+	// game seed (clock unless set by --seed), all random streams derive from it
+	std::cout << "\ngame seed: " << randomService().getSeed() << std::endl;
 
 	// create and run game
 	try {
+		// map the asset pack, if installed (else assets load from loose files)
+		if (std::filesystem::exists(ASSET_PACK_PATH)) {
+			assetPack().open(ASSET_PACK_PATH);
+		}
+
+		// map decoded images from earlier launches (written back below)
+		pixelCache().open(PIXEL_CACHE_PATH);
+
+		// start decoding game assets in the background (uploaded by Game)
+		AssetLoader asset_loader(0);
+		Game::queueAssets(&asset_loader);
+		asset_loader.start();
+
 		// play brand animation (also creates window and returns ptr to it)
 		window_ptr = playBrandAnimation("Copyright 2022 (C) - [ESC] Interactive");
 
 		// set window icon
 		sf::Image window_icon;
-		assert (window_icon.loadFromFile("assets/images/MM_256x116.png"));
+		assert (loadAsset(&window_icon, "assets/images/MM_256x116.png"));
 		window_ptr->setIcon(
 			window_icon.getSize().x,
 			window_icon.getSize().y,
@@ -102,12 +284,26 @@ int main(int argc, char** argv)
 		// set window title
 		window_ptr->setTitle("Megawatts & Marbles - The Energy Planning Game");
 
-		// render splash screen
-		renderSplashScreen(window_ptr);
+		// render splash screen (skipped in replays)
+		if (replay_path.empty()) {
+			renderSplashScreen(window_ptr);
+		}
 
-		// create Game object and run
-		Game game(window_ptr);
+		// create Game object, set up session recording or replay, and run
+		Game game(window_ptr, &asset_loader);
+		pixelCache().save(false);
+		game.setTargetFrameRate(target_frame_rate);
+		game.setAssetBudget(asset_budget_MB);
+		if (!replay_path.empty()) {
+			game.replaySession(session_log, replay_speed);
+		}
+		if (!record_path.empty()) {
+			game.recordSession(record_path);
+		}
 		game.run();
+
+		// write back images decoded during play (lazy assets), drop unused
+		pixelCache().save(true);
 	}
 	catch (const std::exception &exception) {
 		std::cerr << exception.what() << std::endl;